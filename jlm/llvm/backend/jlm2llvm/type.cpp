@@ -96,7 +96,9 @@ convert(const fptype & type, context & ctx)
 static ::llvm::Type *
 convert(const StructType & type, context & ctx)
 {
-  auto & decl = type.GetDeclaration();
+  // Equal struct types can refer to distinct declarations. The declaration of their canonical
+  // instance identifies the LLVM struct type.
+  auto & decl = static_cast<const StructType &>(type.Intern()).GetDeclaration();
 
   if (auto st = ctx.structtype(&decl))
     return st;
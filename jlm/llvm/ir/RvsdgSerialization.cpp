@@ -0,0 +1,2106 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/llvm/ir/operators.hpp>
+#include <jlm/llvm/ir/RvsdgModule.hpp>
+#include <jlm/llvm/ir/RvsdgSerialization.hpp>
+#include <jlm/llvm/opt/alias-analyses/Operators.hpp>
+#include <jlm/rvsdg/bitstring.hpp>
+#include <jlm/rvsdg/control.hpp>
+#include <jlm/rvsdg/record.hpp>
+#include <jlm/rvsdg/statemux.hpp>
+
+#include <llvm/ADT/APFloat.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <typeindex>
+#include <unordered_map>
+#include <unordered_set>
+
+namespace jlm::llvm
+{
+
+static constexpr uint8_t MagicNumber[] = { 'J', 'R', 'V', 'S' };
+static constexpr uint64_t FormatVersion = 1;
+
+enum class TypeTag : uint64_t
+{
+  Declaration,
+  Bit,
+  Control,
+  Pointer,
+  Record,
+  Function,
+  Array,
+  FloatingPoint,
+  VariableArgument,
+  Struct,
+  FixedVector,
+  ScalableVector,
+  LoopState,
+  IoState,
+  MemoryState
+};
+
+enum class NodeTag : uint64_t
+{
+  Simple,
+  Gamma,
+  Theta,
+  Lambda,
+  Delta,
+  Phi
+};
+
+enum class AttributeTag : uint64_t
+{
+  Enum,
+  Int,
+  Type,
+  String
+};
+
+/**
+ * Appends LEB128 encoded numbers and length-prefixed strings to a byte buffer.
+ */
+class Encoder final
+{
+public:
+  void
+  WriteVarint(uint64_t value)
+  {
+    do
+    {
+      uint8_t byte = value & 0x7f;
+      value >>= 7;
+      if (value != 0)
+        byte |= 0x80;
+      Bytes_.push_back(byte);
+    } while (value != 0);
+  }
+
+  template<class ENUM>
+  void
+  WriteEnum(ENUM value)
+  {
+    WriteVarint(static_cast<uint64_t>(value));
+  }
+
+  /**
+   * Writes \p value zigzag encoded, such that numbers with a small magnitude are encoded in few
+   * bytes independent of their sign.
+   */
+  void
+  WriteSignedVarint(int64_t value)
+  {
+    WriteVarint((static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+  }
+
+  void
+  WriteString(const std::string & string)
+  {
+    WriteVarint(string.size());
+    Bytes_.insert(Bytes_.end(), string.begin(), string.end());
+  }
+
+  void
+  Append(const Encoder & encoder)
+  {
+    Bytes_.insert(Bytes_.end(), encoder.Bytes_.begin(), encoder.Bytes_.end());
+  }
+
+  void
+  Append(const uint8_t * data, size_t size)
+  {
+    Bytes_.insert(Bytes_.end(), data, data + size);
+  }
+
+  [[nodiscard]] std::vector<uint8_t> &
+  Bytes() noexcept
+  {
+    return Bytes_;
+  }
+
+private:
+  std::vector<uint8_t> Bytes_;
+};
+
+/**
+ * Reads the numbers and strings written by an Encoder from a byte buffer. The decoder never
+ * copies the underlying buffer.
+ */
+class Decoder final
+{
+public:
+  Decoder(const uint8_t * data, size_t size)
+      : Data_(data),
+        Size_(size),
+        Position_(0)
+  {}
+
+  uint64_t
+  ReadVarint()
+  {
+    uint64_t value = 0;
+    for (size_t shift = 0; shift < 64; shift += 7)
+    {
+      auto byte = ReadByte();
+      value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+      if ((byte & 0x80) == 0)
+        return value;
+    }
+
+    throw util::error("Malformed varint in serialized RVSDG module.");
+  }
+
+  template<class ENUM>
+  ENUM
+  ReadEnum()
+  {
+    return static_cast<ENUM>(ReadVarint());
+  }
+
+  int64_t
+  ReadSignedVarint()
+  {
+    auto value = ReadVarint();
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+  }
+
+  bool
+  ReadBool()
+  {
+    return ReadVarint() != 0;
+  }
+
+  std::string
+  ReadString()
+  {
+    auto size = ReadVarint();
+    return std::string(reinterpret_cast<const char *>(ReadBytes(size)), size);
+  }
+
+  const uint8_t *
+  ReadBytes(size_t size)
+  {
+    if (size > Size_ - Position_)
+      throw util::error("Unexpected end of serialized RVSDG module.");
+
+    auto bytes = Data_ + Position_;
+    Position_ += size;
+    return bytes;
+  }
+
+  [[nodiscard]] bool
+  IsAtEnd() const noexcept
+  {
+    return Position_ == Size_;
+  }
+
+private:
+  uint8_t
+  ReadByte()
+  {
+    return *ReadBytes(1);
+  }
+
+  const uint8_t * Data_;
+  size_t Size_;
+  size_t Position_;
+};
+
+using TypeList = std::vector<const rvsdg::type *>;
+
+using CreateNodeFunction = std::function<
+    std::vector<rvsdg::output *>(rvsdg::region &, const std::vector<rvsdg::output *> &)>;
+
+/**
+ * An entry of the operation table of a module that is deserialized. Operations that cannot be
+ * constructed outside of their node creation function, such as the memory state operators of the
+ * alias analyses, have no operation object.
+ */
+struct OperationEntry
+{
+  std::shared_ptr<const rvsdg::simple_op> Operation;
+  CreateNodeFunction CreateNode;
+  size_t NumOperands = 0;
+};
+
+class RvsdgWriter;
+class RvsdgReader;
+
+/**
+ * Describes how operations of a specific class are serialized. Every operation is stored with
+ * its tag and its operand and result types. The Write and Read functions take care of any
+ * further attributes the operation requires for its reconstruction.
+ */
+struct OperationCodec
+{
+  std::type_index Type;
+  const char * Tag;
+  std::function<void(RvsdgWriter &, Encoder &, const rvsdg::simple_op &)> Write;
+  std::function<OperationEntry(RvsdgReader &, const TypeList &, const TypeList &)> Read;
+};
+
+static util::error
+CreateMalformedModuleError()
+{
+  return util::error("Malformed serialized RVSDG module.");
+}
+
+template<class T>
+static const T &
+CastType(const TypeList & types, size_t index)
+{
+  if (index >= types.size())
+    throw CreateMalformedModuleError();
+
+  auto type = dynamic_cast<const T *>(types[index]);
+  if (type == nullptr)
+    throw CreateMalformedModuleError();
+
+  return *type;
+}
+
+static std::vector<rvsdg::port>
+CreatePorts(const TypeList & types)
+{
+  std::vector<rvsdg::port> ports;
+  for (auto type : types)
+    ports.emplace_back(*type);
+
+  return ports;
+}
+
+static OperationEntry
+CreateSimpleNodeEntry(std::unique_ptr<rvsdg::simple_op> operation)
+{
+  std::shared_ptr<const rvsdg::simple_op> sharedOperation(std::move(operation));
+  auto createNode = [=](rvsdg::region & region, const std::vector<rvsdg::output *> & operands)
+  {
+    return rvsdg::outputs(rvsdg::simple_node::create(&region, *sharedOperation, operands));
+  };
+
+  return { sharedOperation, createNode };
+}
+
+template<class OPERATION, class... ARGUMENTS>
+static OperationEntry
+CreateSimpleNodeEntry(ARGUMENTS &&... arguments)
+{
+  return CreateSimpleNodeEntry(
+      std::make_unique<OPERATION>(std::forward<ARGUMENTS>(arguments)...));
+}
+
+/**
+ * Creates the entry for operations that require a dedicated node class, such as loads, stores,
+ * and calls.
+ */
+template<class NODE, class OPERATION>
+static OperationEntry
+CreateDedicatedNodeEntry(std::unique_ptr<OPERATION> operation)
+{
+  std::shared_ptr<const OPERATION> sharedOperation(std::move(operation));
+  auto createNode = [=](rvsdg::region & region, const std::vector<rvsdg::output *> & operands)
+  {
+    return NODE::Create(region, *sharedOperation, operands);
+  };
+
+  return { sharedOperation, createNode };
+}
+
+/**
+ * Serializes an RVSDG module. Types and operations are interned into tables as they are
+ * encountered while the regions are written, and the tables are emitted in front of the graph.
+ */
+class RvsdgWriter final
+{
+  using OutputNumbering = std::unordered_map<const rvsdg::output *, size_t>;
+
+public:
+  std::vector<uint8_t>
+  Write(const RvsdgModule & rvsdgModule);
+
+  size_t
+  GetTypeIndex(const rvsdg::type & type);
+
+  size_t
+  GetOperationIndex(const rvsdg::simple_op & operation);
+
+  void
+  WriteAttributes(const attributeset & attributes, Encoder & encoder);
+
+private:
+  size_t
+  GetDeclarationIndex(const rvsdg::rcddeclaration & declaration);
+
+  void
+  WriteTypeEntry(const rvsdg::type & type, Encoder & encoder);
+
+  OutputNumbering
+  WriteRegion(const rvsdg::region & region, Encoder & encoder);
+
+  void
+  WriteNode(const rvsdg::node & node, const OutputNumbering & numbering, Encoder & encoder);
+
+  void
+  WriteGammaNode(
+      const rvsdg::gamma_node & gammaNode,
+      const OutputNumbering & numbering,
+      Encoder & encoder);
+
+  void
+  WriteThetaNode(
+      const rvsdg::theta_node & thetaNode,
+      const OutputNumbering & numbering,
+      Encoder & encoder);
+
+  void
+  WriteLambdaNode(
+      const lambda::node & lambdaNode,
+      const OutputNumbering & numbering,
+      Encoder & encoder);
+
+  void
+  WriteDeltaNode(
+      const delta::node & deltaNode,
+      const OutputNumbering & numbering,
+      Encoder & encoder);
+
+  void
+  WritePhiNode(const phi::node & phiNode, const OutputNumbering & numbering, Encoder & encoder);
+
+  static void
+  WriteOrigin(const rvsdg::output & origin, const OutputNumbering & numbering, Encoder & encoder);
+
+  static std::vector<const rvsdg::node *>
+  ComputeTopologicalOrder(const rvsdg::region & region);
+
+  Encoder TypeTable_;
+  size_t NumTypeTableEntries_ = 0;
+  std::vector<const rvsdg::type *> Types_;
+  std::unordered_map<std::string, std::vector<size_t>> TypeIndices_;
+  std::unordered_map<const rvsdg::rcddeclaration *, size_t> DeclarationIndices_;
+
+  Encoder OperationTable_;
+  size_t NumOperations_ = 0;
+  std::unordered_map<std::string, size_t> OperationIndices_;
+};
+
+/**
+ * Deserializes an RVSDG module that was serialized by the RvsdgWriter.
+ */
+class RvsdgReader final
+{
+  using OutputTable = std::vector<rvsdg::output *>;
+
+public:
+  RvsdgReader(const uint8_t * data, size_t size)
+      : Decoder_(data, size)
+  {}
+
+  std::unique_ptr<RvsdgModule>
+  Read();
+
+  [[nodiscard]] Decoder &
+  GetDecoder() noexcept
+  {
+    return Decoder_;
+  }
+
+  template<class T>
+  const T &
+  ReadType()
+  {
+    auto index = Decoder_.ReadVarint();
+    if (index >= Types_.size())
+      throw CreateMalformedModuleError();
+
+    return CastType<T>({ Types_[index].get() }, 0);
+  }
+
+  const OperationEntry &
+  ReadOperation()
+  {
+    auto index = Decoder_.ReadVarint();
+    if (index >= Operations_.size())
+      throw CreateMalformedModuleError();
+
+    return Operations_[index];
+  }
+
+  attributeset
+  ReadAttributes();
+
+private:
+  void
+  ReadTypeTable();
+
+  void
+  ReadTypeEntry();
+
+  void
+  ReadOperationTable();
+
+  OutputTable
+  ReadRegion(rvsdg::region & region);
+
+  std::vector<rvsdg::output *>
+  ReadNode(rvsdg::region & region, const OutputTable & table);
+
+  std::vector<rvsdg::output *>
+  ReadGammaNode(const OutputTable & table);
+
+  std::vector<rvsdg::output *>
+  ReadThetaNode(rvsdg::region & region, const OutputTable & table);
+
+  std::vector<rvsdg::output *>
+  ReadLambdaNode(rvsdg::region & region, const OutputTable & table);
+
+  std::vector<rvsdg::output *>
+  ReadDeltaNode(rvsdg::region & region, const OutputTable & table);
+
+  std::vector<rvsdg::output *>
+  ReadPhiNode(rvsdg::region & region, const OutputTable & table);
+
+  rvsdg::output *
+  ReadOrigin(const OutputTable & table);
+
+  Decoder Decoder_;
+  std::vector<std::unique_ptr<rvsdg::type>> Types_;
+  std::vector<const rvsdg::rcddeclaration *> Declarations_;
+  std::vector<OperationEntry> Operations_;
+};
+
+static const ::llvm::fltSemantics &
+GetFloatingPointSemantics(fpsize size)
+{
+  switch (size)
+  {
+  case fpsize::half:
+    return ::llvm::APFloat::IEEEhalf();
+  case fpsize::flt:
+    return ::llvm::APFloat::IEEEsingle();
+  case fpsize::dbl:
+    return ::llvm::APFloat::IEEEdouble();
+  case fpsize::x86fp80:
+    return ::llvm::APFloat::x87DoubleExtended();
+  default:
+    JLM_UNREACHABLE("Unhandled floating point size.");
+  }
+}
+
+template<class OPERATION>
+static OperationCodec
+CreateCodec(
+    const char * tag,
+    std::function<OperationEntry(RvsdgReader &, const TypeList &, const TypeList &)> read,
+    std::function<void(RvsdgWriter &, Encoder &, const rvsdg::simple_op &)> write = nullptr)
+{
+  return { typeid(OPERATION), tag, std::move(write), std::move(read) };
+}
+
+/**
+ * Creates the codec for bitstring operations that are fully described by the type of their
+ * first operand.
+ */
+template<class OPERATION>
+static OperationCodec
+CreateBitCodec(const char * tag)
+{
+  return CreateCodec<OPERATION>(
+      tag,
+      [](RvsdgReader &, const TypeList & operandTypes, const TypeList &)
+      {
+        return CreateSimpleNodeEntry<OPERATION>(CastType<rvsdg::bittype>(operandTypes, 0));
+      });
+}
+
+template<class OPERATION>
+static OperationCodec
+CreateCastCodec(const char * tag)
+{
+  return CreateCodec<OPERATION>(
+      tag,
+      [](RvsdgReader &, const TypeList & operandTypes, const TypeList & resultTypes)
+      {
+        return CreateSimpleNodeEntry<OPERATION>(
+            CastType<rvsdg::type>(operandTypes, 0).copy(),
+            CastType<rvsdg::type>(resultTypes, 0).copy());
+      });
+}
+
+static std::vector<OperationCodec>
+CreateOperationCodecs()
+{
+  using namespace jlm::rvsdg;
+
+  std::vector<OperationCodec> codecs({
+      CreateBitCodec<bitneg_op>("bitneg"),
+      CreateBitCodec<bitnot_op>("bitnot"),
+      CreateBitCodec<bitadd_op>("bitadd"),
+      CreateBitCodec<bitand_op>("bitand"),
+      CreateBitCodec<bitashr_op>("bitashr"),
+      CreateBitCodec<bitmul_op>("bitmul"),
+      CreateBitCodec<bitor_op>("bitor"),
+      CreateBitCodec<bitsdiv_op>("bitsdiv"),
+      CreateBitCodec<bitshl_op>("bitshl"),
+      CreateBitCodec<bitshr_op>("bitshr"),
+      CreateBitCodec<bitsmod_op>("bitsmod"),
+      CreateBitCodec<bitsmulh_op>("bitsmulh"),
+      CreateBitCodec<bitsub_op>("bitsub"),
+      CreateBitCodec<bitudiv_op>("bitudiv"),
+      CreateBitCodec<bitumod_op>("bitumod"),
+      CreateBitCodec<bitumulh_op>("bitumulh"),
+      CreateBitCodec<bitxor_op>("bitxor"),
+      CreateBitCodec<biteq_op>("biteq"),
+      CreateBitCodec<bitne_op>("bitne"),
+      CreateBitCodec<bitsge_op>("bitsge"),
+      CreateBitCodec<bitsgt_op>("bitsgt"),
+      CreateBitCodec<bitsle_op>("bitsle"),
+      CreateBitCodec<bitslt_op>("bitslt"),
+      CreateBitCodec<bituge_op>("bituge"),
+      CreateBitCodec<bitugt_op>("bitugt"),
+      CreateBitCodec<bitule_op>("bitule"),
+      CreateBitCodec<bitult_op>("bitult"),
+      CreateCodec<bitconstant_op>(
+          "bitconstant",
+          [](RvsdgReader & reader, const TypeList &, const TypeList &)
+          {
+            auto value = reader.GetDecoder().ReadString();
+            return CreateSimpleNodeEntry<bitconstant_op>(bitvalue_repr(value.c_str()));
+          },
+          [](RvsdgWriter &, Encoder & encoder, const simple_op & operation)
+          {
+            encoder.WriteString(static_cast<const bitconstant_op &>(operation).value().str());
+          }),
+      CreateCodec<bitslice_op>(
+          "bitslice",
+          [](RvsdgReader & reader, const TypeList & operandTypes, const TypeList & resultTypes)
+          {
+            auto low = reader.GetDecoder().ReadVarint();
+            auto high = low + CastType<bittype>(resultTypes, 0).nbits();
+            return CreateSimpleNodeEntry<bitslice_op>(
+                CastType<bittype>(operandTypes, 0),
+                low,
+                high);
+          },
+          [](RvsdgWriter &, Encoder & encoder, const simple_op & operation)
+          {
+            encoder.WriteVarint(static_cast<const bitslice_op &>(operation).low());
+          }),
+      CreateCodec<bitconcat_op>(
+          "bitconcat",
+          [](RvsdgReader &, const TypeList & operandTypes, const TypeList &)
+          {
+            std::vector<bittype> types;
+            for (size_t n = 0; n < operandTypes.size(); n++)
+              types.push_back(CastType<bittype>(operandTypes, n));
+
+            return CreateSimpleNodeEntry<bitconcat_op>(types);
+          }),
+      CreateCodec<ctlconstant_op>(
+          "ctlconstant",
+          [](RvsdgReader & reader, const TypeList &, const TypeList & resultTypes)
+          {
+            auto alternative = reader.GetDecoder().ReadVarint();
+            auto numAlternatives = CastType<ctltype>(resultTypes, 0).nalternatives();
+            return CreateSimpleNodeEntry<ctlconstant_op>(
+                ctlvalue_repr(alternative, numAlternatives));
+          },
+          [](RvsdgWriter &, Encoder & encoder, const simple_op & operation)
+          {
+            auto & value = static_cast<const ctlconstant_op &>(operation).value();
+            encoder.WriteVarint(value.alternative());
+          }),
+      CreateCodec<match_op>(
+          "match",
+          [](RvsdgReader & reader, const TypeList & operandTypes, const TypeList & resultTypes)
+          {
+            auto & decoder = reader.GetDecoder();
+            auto defaultAlternative = decoder.ReadVarint();
+            auto numMappings = decoder.ReadVarint();
+            std::unordered_map<uint64_t, uint64_t> mapping;
+            for (size_t n = 0; n < numMappings; n++)
+            {
+              auto value = decoder.ReadVarint();
+              mapping[value] = decoder.ReadVarint();
+            }
+
+            return CreateSimpleNodeEntry<match_op>(
+                CastType<bittype>(operandTypes, 0).nbits(),
+                mapping,
+                defaultAlternative,
+                CastType<ctltype>(resultTypes, 0).nalternatives());
+          },
+          [](RvsdgWriter &, Encoder & encoder, const simple_op & operation)
+          {
+            auto & matchOperation = static_cast<const match_op &>(operation);
+            std::vector<std::pair<uint64_t, uint64_t>> mapping(
+                matchOperation.begin(),
+                matchOperation.end());
+            std::sort(mapping.begin(), mapping.end());
+
+            encoder.WriteVarint(matchOperation.default_alternative());
+            encoder.WriteVarint(mapping.size());
+            for (auto & [value, alternative] : mapping)
+            {
+              encoder.WriteVarint(value);
+              encoder.WriteVarint(alternative);
+            }
+          }),
+      CreateCodec<mux_op>(
+          "mux",
+          [](RvsdgReader &, const TypeList & operandTypes, const TypeList & resultTypes)
+          {
+            auto & type = resultTypes.empty() ? CastType<statetype>(operandTypes, 0)
+                                              : CastType<statetype>(resultTypes, 0);
+            return CreateSimpleNodeEntry<mux_op>(type, operandTypes.size(), resultTypes.size());
+          }),
+
+      CreateCodec<ConstantFP>(
+          "ConstantFP",
+          [](RvsdgReader & reader, const TypeList &, const TypeList & resultTypes)
+          {
+            auto & decoder = reader.GetDecoder();
+            auto size = CastType<fptype>(resultTypes, 0).size();
+            auto numBits = decoder.ReadVarint();
+            auto numWords = decoder.ReadVarint();
+            std::vector<uint64_t> words;
+            for (size_t n = 0; n < numWords; n++)
+              words.push_back(decoder.ReadVarint());
+
+            ::llvm::APInt bits(numBits, words);
+            ::llvm::APFloat constant(GetFloatingPointSemantics(size), bits);
+            return CreateSimpleNodeEntry<ConstantFP>(size, constant);
+          },
+          [](RvsdgWriter &, Encoder & encoder, const simple_op & operation)
+          {
+            auto bits = static_cast<const ConstantFP &>(operation).constant().bitcastToAPInt();
+            encoder.WriteVarint(bits.getBitWidth());
+            encoder.WriteVarint(bits.getNumWords());
+            for (size_t n = 0; n < bits.getNumWords(); n++)
+              encoder.WriteVarint(bits.getRawData()[n]);
+          }),
+      CreateCodec<UndefValueOperation>(
+          "UndefValue",
+          [](RvsdgReader &, const TypeList &, const TypeList & resultTypes)
+          {
+            return CreateSimpleNodeEntry<UndefValueOperation>(
+                CastType<rvsdg::type>(resultTypes, 0));
+          }),
+      CreateCodec<PoisonValueOperation>(
+          "PoisonValue",
+          [](RvsdgReader &, const TypeList &, const TypeList & resultTypes)
+          {
+            return CreateSimpleNodeEntry<PoisonValueOperation>(CastType<valuetype>(resultTypes, 0));
+          }),
+      CreateCodec<ConstantPointerNullOperation>(
+          "ConstantPointerNull",
+          [](RvsdgReader &, const TypeList &, const TypeList & resultTypes)
+          {
+            return CreateSimpleNodeEntry<ConstantPointerNullOperation>(
+                CastType<PointerType>(resultTypes, 0));
+          }),
+      CreateCodec<ConstantAggregateZero>(
+          "ConstantAggregateZero",
+          [](RvsdgReader &, const TypeList &, const TypeList & resultTypes)
+          {
+            return CreateSimpleNodeEntry<ConstantAggregateZero>(
+                CastType<rvsdg::type>(resultTypes, 0));
+          }),
+      CreateCodec<ConstantDataArray>(
+          "ConstantDataArray",
+          [](RvsdgReader &, const TypeList &, const TypeList & resultTypes)
+          {
+            auto & type = CastType<arraytype>(resultTypes, 0);
+            return CreateSimpleNodeEntry<ConstantDataArray>(type.element_type(), type.nelements());
+          }),
+      CreateCodec<ConstantArray>(
+          "ConstantArray",
+          [](RvsdgReader &, const TypeList &, const TypeList & resultTypes)
+          {
+            auto & type = CastType<arraytype>(resultTypes, 0);
+            return CreateSimpleNodeEntry<ConstantArray>(type.element_type(), type.nelements());
+          }),
+      CreateCodec<ConstantStruct>(
+          "ConstantStruct",
+          [](RvsdgReader &, const TypeList &, const TypeList & resultTypes)
+          {
+            return CreateSimpleNodeEntry<ConstantStruct>(CastType<StructType>(resultTypes, 0));
+          }),
+      CreateCodec<constantvector_op>(
+          "ConstantVector",
+          [](RvsdgReader &, const TypeList &, const TypeList & resultTypes)
+          {
+            return CreateSimpleNodeEntry<constantvector_op>(CastType<vectortype>(resultTypes, 0));
+          }),
+
+      CreateCodec<LoadOperation>(
+          "Load",
+          [](RvsdgReader & reader, const TypeList & operandTypes, const TypeList & resultTypes)
+          {
+            auto alignment = reader.GetDecoder().ReadVarint();
+            return CreateDedicatedNodeEntry<LoadNode>(std::make_unique<LoadOperation>(
+                CastType<valuetype>(resultTypes, 0),
+                operandTypes.size() - 1,
+                alignment));
+          },
+          [](RvsdgWriter &, Encoder & encoder, const simple_op & operation)
+          {
+            encoder.WriteVarint(static_cast<const LoadOperation &>(operation).GetAlignment());
+          }),
+      CreateCodec<StoreOperation>(
+          "Store",
+          [](RvsdgReader & reader, const TypeList & operandTypes, const TypeList & resultTypes)
+          {
+            auto alignment = reader.GetDecoder().ReadVarint();
+            return CreateDedicatedNodeEntry<StoreNode>(std::make_unique<StoreOperation>(
+                CastType<valuetype>(operandTypes, 1),
+                resultTypes.size(),
+                alignment));
+          },
+          [](RvsdgWriter &, Encoder & encoder, const simple_op & operation)
+          {
+            encoder.WriteVarint(static_cast<const StoreOperation &>(operation).GetAlignment());
+          }),
+      CreateCodec<CallOperation>(
+          "Call",
+          [](RvsdgReader & reader, const TypeList &, const TypeList &)
+          {
+            auto & functionType = reader.ReadType<FunctionType>();
+            return CreateDedicatedNodeEntry<CallNode>(
+                std::make_unique<CallOperation>(functionType));
+          },
+          [](RvsdgWriter & writer, Encoder & encoder, const simple_op & operation)
+          {
+            auto & functionType = static_cast<const CallOperation &>(operation).GetFunctionType();
+            encoder.WriteVarint(writer.GetTypeIndex(functionType));
+          }),
+      CreateCodec<alloca_op>(
+          "Alloca",
+          [](RvsdgReader & reader, const TypeList & operandTypes, const TypeList &)
+          {
+            auto & allocatedType = reader.ReadType<valuetype>();
+            auto alignment = reader.GetDecoder().ReadVarint();
+            return CreateSimpleNodeEntry<alloca_op>(
+                allocatedType,
+                CastType<bittype>(operandTypes, 0),
+                alignment);
+          },
+          [](RvsdgWriter & writer, Encoder & encoder, const simple_op & operation)
+          {
+            auto & allocaOperation = static_cast<const alloca_op &>(operation);
+            encoder.WriteVarint(writer.GetTypeIndex(allocaOperation.value_type()));
+            encoder.WriteVarint(allocaOperation.alignment());
+          }),
+      CreateCodec<GetElementPtrOperation>(
+          "GetElementPtr",
+          [](RvsdgReader & reader, const TypeList & operandTypes, const TypeList &)
+          {
+            auto & pointeeType = reader.ReadType<valuetype>();
+            std::vector<bittype> offsetTypes;
+            for (size_t n = 1; n < operandTypes.size(); n++)
+              offsetTypes.push_back(CastType<bittype>(operandTypes, n));
+
+            return CreateSimpleNodeEntry<GetElementPtrOperation>(offsetTypes, pointeeType);
+          },
+          [](RvsdgWriter & writer, Encoder & encoder, const simple_op & operation)
+          {
+            auto & pointeeType =
+                static_cast<const GetElementPtrOperation &>(operation).GetPointeeType();
+            encoder.WriteVarint(writer.GetTypeIndex(pointeeType));
+          }),
+      CreateCodec<malloc_op>(
+          "Malloc",
+          [](RvsdgReader &, const TypeList & operandTypes, const TypeList &)
+          {
+            return CreateSimpleNodeEntry<malloc_op>(CastType<bittype>(operandTypes, 0));
+          }),
+      CreateCodec<FreeOperation>(
+          "Free",
+          [](RvsdgReader &, const TypeList &, const TypeList & resultTypes)
+          {
+            if (resultTypes.empty())
+              throw CreateMalformedModuleError();
+
+            return CreateSimpleNodeEntry<FreeOperation>(resultTypes.size() - 1);
+          }),
+      CreateCodec<Memcpy>(
+          "Memcpy",
+          [](RvsdgReader &, const TypeList & operandTypes, const TypeList & resultTypes)
+          {
+            return CreateSimpleNodeEntry<Memcpy>(
+                CreatePorts(operandTypes),
+                CreatePorts(resultTypes));
+          }),
+      CreateCodec<valist_op>(
+          "VariableArgumentList",
+          [](RvsdgReader &, const TypeList & operandTypes, const TypeList &)
+          {
+            std::vector<std::unique_ptr<rvsdg::type>> types;
+            for (auto type : operandTypes)
+              types.push_back(type->copy());
+
+            return CreateSimpleNodeEntry<valist_op>(std::move(types));
+          }),
+
+      CreateCodec<ptrcmp_op>(
+          "PointerCompare",
+          [](RvsdgReader & reader, const TypeList & operandTypes, const TypeList &)
+          {
+            auto compare = reader.GetDecoder().ReadEnum<cmp>();
+            return CreateSimpleNodeEntry<ptrcmp_op>(
+                CastType<PointerType>(operandTypes, 0),
+                compare);
+          },
+          [](RvsdgWriter &, Encoder & encoder, const simple_op & operation)
+          {
+            encoder.WriteEnum(static_cast<const ptrcmp_op &>(operation).cmp());
+          }),
+      CreateCodec<fpcmp_op>(
+          "FloatingPointCompare",
+          [](RvsdgReader & reader, const TypeList & operandTypes, const TypeList &)
+          {
+            auto compare = reader.GetDecoder().ReadEnum<fpcmp>();
+            return CreateSimpleNodeEntry<fpcmp_op>(
+                compare,
+                CastType<fptype>(operandTypes, 0).size());
+          },
+          [](RvsdgWriter &, Encoder & encoder, const simple_op & operation)
+          {
+            encoder.WriteEnum(static_cast<const fpcmp_op &>(operation).cmp());
+          }),
+      CreateCodec<fpbin_op>(
+          "FloatingPointBinary",
+          [](RvsdgReader & reader, const TypeList &, const TypeList & resultTypes)
+          {
+            auto operation = reader.GetDecoder().ReadEnum<fpop>();
+            return CreateSimpleNodeEntry<fpbin_op>(
+                operation,
+                CastType<fptype>(resultTypes, 0).size());
+          },
+          [](RvsdgWriter &, Encoder & encoder, const simple_op & operation)
+          {
+            encoder.WriteEnum(static_cast<const fpbin_op &>(operation).fpop());
+          }),
+      CreateCodec<fpneg_op>(
+          "FloatingPointNegation",
+          [](RvsdgReader &, const TypeList & operandTypes, const TypeList &)
+          {
+            return CreateSimpleNodeEntry<fpneg_op>(CastType<fptype>(operandTypes, 0).size());
+          }),
+      CreateCodec<select_op>(
+          "Select",
+          [](RvsdgReader &, const TypeList &, const TypeList & resultTypes)
+          {
+            return CreateSimpleNodeEntry<select_op>(CastType<rvsdg::type>(resultTypes, 0));
+          }),
+      CreateCodec<ctl2bits_op>(
+          "ControlToBits",
+          [](RvsdgReader &, const TypeList & operandTypes, const TypeList & resultTypes)
+          {
+            return CreateSimpleNodeEntry<ctl2bits_op>(
+                CastType<ctltype>(operandTypes, 0),
+                CastType<bittype>(resultTypes, 0));
+          }),
+      CreateCodec<ExtractValue>(
+          "ExtractValue",
+          [](RvsdgReader & reader, const TypeList & operandTypes, const TypeList &)
+          {
+            auto & decoder = reader.GetDecoder();
+            std::vector<unsigned> indices(decoder.ReadVarint());
+            for (auto & index : indices)
+              index = decoder.ReadVarint();
+
+            return CreateSimpleNodeEntry<ExtractValue>(
+                CastType<rvsdg::type>(operandTypes, 0),
+                indices);
+          },
+          [](RvsdgWriter &, Encoder & encoder, const simple_op & operation)
+          {
+            auto & extractValue = static_cast<const ExtractValue &>(operation);
+            encoder.WriteVarint(std::distance(extractValue.begin(), extractValue.end()));
+            for (auto index : extractValue)
+              encoder.WriteVarint(index);
+          }),
+
+      CreateCodec<extractelement_op>(
+          "ExtractElement",
+          [](RvsdgReader &, const TypeList & operandTypes, const TypeList &)
+          {
+            return CreateSimpleNodeEntry<extractelement_op>(
+                CastType<vectortype>(operandTypes, 0),
+                CastType<bittype>(operandTypes, 1));
+          }),
+      CreateCodec<insertelement_op>(
+          "InsertElement",
+          [](RvsdgReader &, const TypeList & operandTypes, const TypeList &)
+          {
+            return CreateSimpleNodeEntry<insertelement_op>(
+                CastType<vectortype>(operandTypes, 0),
+                CastType<valuetype>(operandTypes, 1),
+                CastType<bittype>(operandTypes, 2));
+          }),
+      CreateCodec<shufflevector_op>(
+          "ShuffleVector",
+          [](RvsdgReader & reader, const TypeList & operandTypes, const TypeList &)
+          {
+            auto & decoder = reader.GetDecoder();
+            std::vector<int> mask(decoder.ReadVarint());
+            for (auto & element : mask)
+              element = decoder.ReadSignedVarint();
+
+            if (auto type = dynamic_cast<const fixedvectortype *>(operandTypes.at(0)))
+              return CreateSimpleNodeEntry<shufflevector_op>(*type, mask);
+
+            return CreateSimpleNodeEntry<shufflevector_op>(
+                CastType<scalablevectortype>(operandTypes, 0),
+                mask);
+          },
+          [](RvsdgWriter &, Encoder & encoder, const simple_op & operation)
+          {
+            auto & mask = static_cast<const shufflevector_op &>(operation).Mask();
+            encoder.WriteVarint(mask.size());
+            for (auto element : mask)
+              encoder.WriteSignedVarint(element);
+          }),
+      CreateCodec<vectorunary_op>(
+          "VectorUnary",
+          [](RvsdgReader & reader, const TypeList & operandTypes, const TypeList & resultTypes)
+          {
+            auto unaryOperation =
+                dynamic_cast<const unary_op *>(reader.ReadOperation().Operation.get());
+            if (unaryOperation == nullptr)
+              throw CreateMalformedModuleError();
+
+            return CreateSimpleNodeEntry<vectorunary_op>(
+                *unaryOperation,
+                CastType<vectortype>(operandTypes, 0),
+                CastType<vectortype>(resultTypes, 0));
+          },
+          [](RvsdgWriter & writer, Encoder & encoder, const simple_op & operation)
+          {
+            auto & unaryOperation = static_cast<const vectorunary_op &>(operation).operation();
+            encoder.WriteVarint(writer.GetOperationIndex(unaryOperation));
+          }),
+      CreateCodec<vectorbinary_op>(
+          "VectorBinary",
+          [](RvsdgReader & reader, const TypeList & operandTypes, const TypeList & resultTypes)
+          {
+            auto binaryOperation =
+                dynamic_cast<const binary_op *>(reader.ReadOperation().Operation.get());
+            if (binaryOperation == nullptr)
+              throw CreateMalformedModuleError();
+
+            return CreateSimpleNodeEntry<vectorbinary_op>(
+                *binaryOperation,
+                CastType<vectortype>(operandTypes, 0),
+                CastType<vectortype>(operandTypes, 1),
+                CastType<vectortype>(resultTypes, 0));
+          },
+          [](RvsdgWriter & writer, Encoder & encoder, const simple_op & operation)
+          {
+            auto & binaryOperation = static_cast<const vectorbinary_op &>(operation).operation();
+            encoder.WriteVarint(writer.GetOperationIndex(binaryOperation));
+          }),
+
+      CreateCastCodec<bitcast_op>("BitCast"),
+      CreateCastCodec<bits2ptr_op>("BitsToPointer"),
+      CreateCastCodec<fp2si_op>("FloatingPointToSignedInteger"),
+      CreateCastCodec<fp2ui_op>("FloatingPointToUnsignedInteger"),
+      CreateCastCodec<fpext_op>("FloatingPointExtend"),
+      CreateCastCodec<fptrunc_op>("FloatingPointTruncate"),
+      CreateCastCodec<ptr2bits_op>("PointerToBits"),
+      CreateCastCodec<sext_op>("SignExtend"),
+      CreateCastCodec<sitofp_op>("SignedIntegerToFloatingPoint"),
+      CreateCastCodec<trunc_op>("Truncate"),
+      CreateCastCodec<uitofp_op>("UnsignedIntegerToFloatingPoint"),
+      CreateCastCodec<zext_op>("ZeroExtend"),
+
+      CreateCodec<loopstatemux_op>(
+          "LoopStateMux",
+          [](RvsdgReader &, const TypeList & operandTypes, const TypeList & resultTypes)
+          {
+            return CreateSimpleNodeEntry<loopstatemux_op>(
+                operandTypes.size(),
+                resultTypes.size());
+          }),
+      CreateCodec<MemStateMergeOperator>(
+          "MemStateMerge",
+          [](RvsdgReader &, const TypeList & operandTypes, const TypeList &)
+          {
+            return CreateSimpleNodeEntry<MemStateMergeOperator>(operandTypes.size());
+          }),
+      CreateCodec<MemStateSplitOperator>(
+          "MemStateSplit",
+          [](RvsdgReader &, const TypeList &, const TypeList & resultTypes)
+          {
+            return CreateSimpleNodeEntry<MemStateSplitOperator>(resultTypes.size());
+          }),
+      CreateCodec<aa::LambdaEntryMemStateOperator>(
+          "LambdaEntryMemState",
+          [](RvsdgReader &, const TypeList &, const TypeList & resultTypes)
+          {
+            auto numResults = resultTypes.size();
+            OperationEntry entry;
+            entry.CreateNode = [=](rvsdg::region &, const std::vector<rvsdg::output *> & operands)
+            {
+              return aa::LambdaEntryMemStateOperator::Create(operands[0], numResults);
+            };
+            return entry;
+          }),
+      CreateCodec<aa::LambdaExitMemStateOperator>(
+          "LambdaExitMemState",
+          [](RvsdgReader &, const TypeList &, const TypeList &)
+          {
+            OperationEntry entry;
+            entry.CreateNode =
+                [](rvsdg::region & region, const std::vector<rvsdg::output *> & operands)
+            {
+              return std::vector<rvsdg::output *>(
+                  { aa::LambdaExitMemStateOperator::Create(&region, operands) });
+            };
+            return entry;
+          }),
+      CreateCodec<aa::CallEntryMemStateOperator>(
+          "CallEntryMemState",
+          [](RvsdgReader &, const TypeList &, const TypeList &)
+          {
+            OperationEntry entry;
+            entry.CreateNode =
+                [](rvsdg::region & region, const std::vector<rvsdg::output *> & operands)
+            {
+              return std::vector<rvsdg::output *>(
+                  { aa::CallEntryMemStateOperator::Create(&region, operands) });
+            };
+            return entry;
+          }),
+      CreateCodec<aa::CallExitMemStateOperator>(
+          "CallExitMemState",
+          [](RvsdgReader &, const TypeList &, const TypeList & resultTypes)
+          {
+            auto numResults = resultTypes.size();
+            OperationEntry entry;
+            entry.CreateNode = [=](rvsdg::region &, const std::vector<rvsdg::output *> & operands)
+            {
+              return aa::CallExitMemStateOperator::Create(operands[0], numResults);
+            };
+            return entry;
+          }),
+  });
+
+  return codecs;
+}
+
+static const OperationCodec &
+GetOperationCodec(const rvsdg::simple_op & operation)
+{
+  static std::unordered_map<std::type_index, OperationCodec> codecs;
+  if (codecs.empty())
+  {
+    for (auto & codec : CreateOperationCodecs())
+      codecs.emplace(codec.Type, codec);
+  }
+
+  auto it = codecs.find(typeid(operation));
+  if (it == codecs.end())
+    throw util::error("Cannot serialize operation: " + operation.debug_string());
+
+  return it->second;
+}
+
+static const OperationCodec &
+GetOperationCodec(const std::string & tag)
+{
+  static std::unordered_map<std::string, OperationCodec> codecs;
+  if (codecs.empty())
+  {
+    for (auto & codec : CreateOperationCodecs())
+      codecs.emplace(codec.Tag, codec);
+  }
+
+  auto it = codecs.find(tag);
+  if (it == codecs.end())
+    throw util::error("Unknown operation in serialized RVSDG module: " + tag);
+
+  return it->second;
+}
+
+std::vector<uint8_t>
+RvsdgWriter::Write(const RvsdgModule & rvsdgModule)
+{
+  auto & rootRegion = *rvsdgModule.Rvsdg().root();
+
+  Encoder graph;
+  graph.WriteVarint(rootRegion.narguments());
+  for (size_t n = 0; n < rootRegion.narguments(); n++)
+  {
+    auto & import = *util::AssertedCast<const impport>(&rootRegion.argument(n)->port());
+    graph.WriteString(import.name());
+    graph.WriteVarint(GetTypeIndex(import.GetValueType()));
+    graph.WriteEnum(import.linkage());
+  }
+
+  auto numbering = WriteRegion(rootRegion, graph);
+
+  graph.WriteVarint(rootRegion.nresults());
+  for (size_t n = 0; n < rootRegion.nresults(); n++)
+  {
+    auto result = rootRegion.result(n);
+    WriteOrigin(*result->origin(), numbering, graph);
+    graph.WriteString(util::AssertedCast<const rvsdg::expport>(&result->port())->name());
+  }
+
+  Encoder module;
+  module.Append(MagicNumber, sizeof(MagicNumber));
+  module.WriteVarint(FormatVersion);
+  module.WriteString(rvsdgModule.SourceFileName().to_str());
+  module.WriteString(rvsdgModule.TargetTriple());
+  module.WriteString(rvsdgModule.DataLayout());
+  module.WriteVarint(NumTypeTableEntries_);
+  module.Append(TypeTable_);
+  module.WriteVarint(NumOperations_);
+  module.Append(OperationTable_);
+  module.Append(graph);
+
+  return std::move(module.Bytes());
+}
+
+size_t
+RvsdgWriter::GetTypeIndex(const rvsdg::type & type)
+{
+  auto & candidates = TypeIndices_[type.debug_string()];
+  for (auto index : candidates)
+  {
+    if (*Types_[index] == type)
+      return index;
+  }
+
+  Encoder entry;
+  WriteTypeEntry(type, entry);
+  TypeTable_.Append(entry);
+  NumTypeTableEntries_++;
+
+  auto index = Types_.size();
+  Types_.push_back(&type);
+  candidates.push_back(index);
+
+  return index;
+}
+
+size_t
+RvsdgWriter::GetDeclarationIndex(const rvsdg::rcddeclaration & declaration)
+{
+  if (auto it = DeclarationIndices_.find(&declaration); it != DeclarationIndices_.end())
+    return it->second;
+
+  std::vector<size_t> elementTypes;
+  for (size_t n = 0; n < declaration.nelements(); n++)
+    elementTypes.push_back(GetTypeIndex(declaration.element(n)));
+
+  TypeTable_.WriteEnum(TypeTag::Declaration);
+  TypeTable_.WriteVarint(elementTypes.size());
+  for (auto elementType : elementTypes)
+    TypeTable_.WriteVarint(elementType);
+  NumTypeTableEntries_++;
+
+  auto index = DeclarationIndices_.size();
+  DeclarationIndices_[&declaration] = index;
+
+  return index;
+}
+
+void
+RvsdgWriter::WriteTypeEntry(const rvsdg::type & type, Encoder & encoder)
+{
+  if (auto bitType = dynamic_cast<const rvsdg::bittype *>(&type))
+  {
+    encoder.WriteEnum(TypeTag::Bit);
+    encoder.WriteVarint(bitType->nbits());
+  }
+  else if (auto controlType = dynamic_cast<const rvsdg::ctltype *>(&type))
+  {
+    encoder.WriteEnum(TypeTag::Control);
+    encoder.WriteVarint(controlType->nalternatives());
+  }
+  else if (dynamic_cast<const PointerType *>(&type))
+  {
+    encoder.WriteEnum(TypeTag::Pointer);
+  }
+  else if (auto recordType = dynamic_cast<const rvsdg::rcdtype *>(&type))
+  {
+    auto declaration = GetDeclarationIndex(*recordType->declaration());
+    encoder.WriteEnum(TypeTag::Record);
+    encoder.WriteVarint(declaration);
+  }
+  else if (auto functionType = dynamic_cast<const FunctionType *>(&type))
+  {
+    std::vector<size_t> argumentTypes, resultTypes;
+    for (size_t n = 0; n < functionType->NumArguments(); n++)
+      argumentTypes.push_back(GetTypeIndex(functionType->ArgumentType(n)));
+    for (size_t n = 0; n < functionType->NumResults(); n++)
+      resultTypes.push_back(GetTypeIndex(functionType->ResultType(n)));
+
+    encoder.WriteEnum(TypeTag::Function);
+    encoder.WriteVarint(argumentTypes.size());
+    for (auto argumentType : argumentTypes)
+      encoder.WriteVarint(argumentType);
+    encoder.WriteVarint(resultTypes.size());
+    for (auto resultType : resultTypes)
+      encoder.WriteVarint(resultType);
+  }
+  else if (auto arrayType = dynamic_cast<const arraytype *>(&type))
+  {
+    auto elementType = GetTypeIndex(arrayType->element_type());
+    encoder.WriteEnum(TypeTag::Array);
+    encoder.WriteVarint(elementType);
+    encoder.WriteVarint(arrayType->nelements());
+  }
+  else if (auto floatingPointType = dynamic_cast<const fptype *>(&type))
+  {
+    encoder.WriteEnum(TypeTag::FloatingPoint);
+    encoder.WriteEnum(floatingPointType->size());
+  }
+  else if (dynamic_cast<const varargtype *>(&type))
+  {
+    encoder.WriteEnum(TypeTag::VariableArgument);
+  }
+  else if (auto structType = dynamic_cast<const StructType *>(&type))
+  {
+    auto declaration = GetDeclarationIndex(structType->GetDeclaration());
+    encoder.WriteEnum(TypeTag::Struct);
+    encoder.WriteVarint(structType->HasName());
+    encoder.WriteString(structType->HasName() ? structType->GetName() : "");
+    encoder.WriteVarint(structType->IsPacked());
+    encoder.WriteVarint(declaration);
+  }
+  else if (auto vectorType = dynamic_cast<const vectortype *>(&type))
+  {
+    auto elementType = GetTypeIndex(vectorType->type());
+    encoder.WriteEnum(
+        dynamic_cast<const fixedvectortype *>(vectorType) ? TypeTag::FixedVector
+                                                          : TypeTag::ScalableVector);
+    encoder.WriteVarint(elementType);
+    encoder.WriteVarint(vectorType->size());
+  }
+  else if (dynamic_cast<const loopstatetype *>(&type))
+  {
+    encoder.WriteEnum(TypeTag::LoopState);
+  }
+  else if (dynamic_cast<const iostatetype *>(&type))
+  {
+    encoder.WriteEnum(TypeTag::IoState);
+  }
+  else if (dynamic_cast<const MemoryStateType *>(&type))
+  {
+    encoder.WriteEnum(TypeTag::MemoryState);
+  }
+  else
+  {
+    throw util::error("Cannot serialize type: " + type.debug_string());
+  }
+}
+
+size_t
+RvsdgWriter::GetOperationIndex(const rvsdg::simple_op & operation)
+{
+  auto & codec = GetOperationCodec(operation);
+
+  std::vector<size_t> operandTypes, resultTypes;
+  for (size_t n = 0; n < operation.narguments(); n++)
+    operandTypes.push_back(GetTypeIndex(operation.argument(n).type()));
+  for (size_t n = 0; n < operation.nresults(); n++)
+    resultTypes.push_back(GetTypeIndex(operation.result(n).type()));
+
+  Encoder attributes;
+  if (codec.Write)
+    codec.Write(*this, attributes, operation);
+
+  Encoder entry;
+  entry.WriteString(codec.Tag);
+  entry.WriteVarint(operandTypes.size());
+  for (auto operandType : operandTypes)
+    entry.WriteVarint(operandType);
+  entry.WriteVarint(resultTypes.size());
+  for (auto resultType : resultTypes)
+    entry.WriteVarint(resultType);
+  entry.Append(attributes);
+
+  /*
+   * Operations are deduplicated by their encoding instead of their equality operator, as the
+   * latter does not necessarily take all operand and result types into account.
+   */
+  auto & bytes = entry.Bytes();
+  auto [it, wasInserted] =
+      OperationIndices_.emplace(std::string(bytes.begin(), bytes.end()), NumOperations_);
+  if (wasInserted)
+  {
+    OperationTable_.Append(entry);
+    NumOperations_++;
+  }
+
+  return it->second;
+}
+
+void
+RvsdgWriter::WriteAttributes(const attributeset & attributes, Encoder & encoder)
+{
+  encoder.WriteVarint(std::distance(attributes.begin(), attributes.end()));
+  for (auto & attribute : attributes)
+  {
+    if (auto typeAttribute = dynamic_cast<const type_attribute *>(&attribute))
+    {
+      encoder.WriteEnum(AttributeTag::Type);
+      encoder.WriteEnum(typeAttribute->kind());
+      encoder.WriteVarint(GetTypeIndex(typeAttribute->type()));
+    }
+    else if (auto intAttribute = dynamic_cast<const int_attribute *>(&attribute))
+    {
+      encoder.WriteEnum(AttributeTag::Int);
+      encoder.WriteEnum(intAttribute->kind());
+      encoder.WriteVarint(intAttribute->value());
+    }
+    else if (auto enumAttribute = dynamic_cast<const enum_attribute *>(&attribute))
+    {
+      encoder.WriteEnum(AttributeTag::Enum);
+      encoder.WriteEnum(enumAttribute->kind());
+    }
+    else if (auto stringAttribute = dynamic_cast<const string_attribute *>(&attribute))
+    {
+      encoder.WriteEnum(AttributeTag::String);
+      encoder.WriteString(stringAttribute->kind());
+      encoder.WriteString(stringAttribute->value());
+    }
+    else
+    {
+      JLM_UNREACHABLE("Unhandled attribute.");
+    }
+  }
+}
+
+RvsdgWriter::OutputNumbering
+RvsdgWriter::WriteRegion(const rvsdg::region & region, Encoder & encoder)
+{
+  OutputNumbering numbering;
+  for (size_t n = 0; n < region.narguments(); n++)
+    numbering[region.argument(n)] = n;
+
+  auto nodes = ComputeTopologicalOrder(region);
+  encoder.WriteVarint(nodes.size());
+  for (auto node : nodes)
+  {
+    WriteNode(*node, numbering, encoder);
+    for (size_t n = 0; n < node->noutputs(); n++)
+    {
+      auto index = numbering.size();
+      numbering[node->output(n)] = index;
+    }
+  }
+
+  return numbering;
+}
+
+void
+RvsdgWriter::WriteNode(
+    const rvsdg::node & node,
+    const OutputNumbering & numbering,
+    Encoder & encoder)
+{
+  if (auto simpleNode = dynamic_cast<const rvsdg::simple_node *>(&node))
+  {
+    encoder.WriteEnum(NodeTag::Simple);
+    encoder.WriteVarint(GetOperationIndex(simpleNode->operation()));
+    for (size_t n = 0; n < node.ninputs(); n++)
+      WriteOrigin(*node.input(n)->origin(), numbering, encoder);
+  }
+  else if (auto gammaNode = dynamic_cast<const rvsdg::gamma_node *>(&node))
+  {
+    WriteGammaNode(*gammaNode, numbering, encoder);
+  }
+  else if (auto thetaNode = dynamic_cast<const rvsdg::theta_node *>(&node))
+  {
+    WriteThetaNode(*thetaNode, numbering, encoder);
+  }
+  else if (auto lambdaNode = dynamic_cast<const lambda::node *>(&node))
+  {
+    WriteLambdaNode(*lambdaNode, numbering, encoder);
+  }
+  else if (auto deltaNode = dynamic_cast<const delta::node *>(&node))
+  {
+    WriteDeltaNode(*deltaNode, numbering, encoder);
+  }
+  else if (auto phiNode = dynamic_cast<const phi::node *>(&node))
+  {
+    WritePhiNode(*phiNode, numbering, encoder);
+  }
+  else
+  {
+    throw util::error("Cannot serialize node: " + node.operation().debug_string());
+  }
+}
+
+void
+RvsdgWriter::WriteGammaNode(
+    const rvsdg::gamma_node & gammaNode,
+    const OutputNumbering & numbering,
+    Encoder & encoder)
+{
+  encoder.WriteEnum(NodeTag::Gamma);
+  encoder.WriteVarint(gammaNode.nsubregions());
+  WriteOrigin(*gammaNode.predicate()->origin(), numbering, encoder);
+  encoder.WriteVarint(gammaNode.nentryvars());
+  for (size_t n = 0; n < gammaNode.nentryvars(); n++)
+    WriteOrigin(*gammaNode.entryvar(n)->origin(), numbering, encoder);
+
+  encoder.WriteVarint(gammaNode.nexitvars());
+  for (size_t r = 0; r < gammaNode.nsubregions(); r++)
+  {
+    auto & subregion = *gammaNode.subregion(r);
+    for (size_t n = 0; n < subregion.narguments(); n++)
+      JLM_ASSERT(subregion.argument(n)->input() == gammaNode.entryvar(n));
+
+    auto subregionNumbering = WriteRegion(subregion, encoder);
+    for (size_t n = 0; n < gammaNode.nexitvars(); n++)
+    {
+      auto result = subregion.result(n);
+      JLM_ASSERT(result->output() == gammaNode.exitvar(n));
+      WriteOrigin(*result->origin(), subregionNumbering, encoder);
+    }
+  }
+}
+
+void
+RvsdgWriter::WriteThetaNode(
+    const rvsdg::theta_node & thetaNode,
+    const OutputNumbering & numbering,
+    Encoder & encoder)
+{
+  encoder.WriteEnum(NodeTag::Theta);
+  encoder.WriteVarint(thetaNode.nloopvars());
+  for (size_t n = 0; n < thetaNode.nloopvars(); n++)
+  {
+    JLM_ASSERT(thetaNode.input(n)->argument() == thetaNode.subregion()->argument(n));
+    WriteOrigin(*thetaNode.input(n)->origin(), numbering, encoder);
+  }
+
+  auto subregionNumbering = WriteRegion(*thetaNode.subregion(), encoder);
+  WriteOrigin(*thetaNode.predicate()->origin(), subregionNumbering, encoder);
+  for (size_t n = 0; n < thetaNode.nloopvars(); n++)
+    WriteOrigin(*thetaNode.output(n)->result()->origin(), subregionNumbering, encoder);
+}
+
+void
+RvsdgWriter::WriteLambdaNode(
+    const lambda::node & lambdaNode,
+    const OutputNumbering & numbering,
+    Encoder & encoder)
+{
+  auto functionType = GetTypeIndex(lambdaNode.type());
+
+  encoder.WriteEnum(NodeTag::Lambda);
+  encoder.WriteVarint(functionType);
+  encoder.WriteString(lambdaNode.name());
+  encoder.WriteEnum(lambdaNode.linkage());
+  WriteAttributes(lambdaNode.attributes(), encoder);
+
+  encoder.WriteVarint(lambdaNode.ncvarguments());
+  for (size_t n = 0; n < lambdaNode.ncvarguments(); n++)
+  {
+    JLM_ASSERT(
+        lambdaNode.cvargument(n)
+        == lambdaNode.subregion()->argument(lambdaNode.nfctarguments() + n));
+    WriteOrigin(*lambdaNode.input(n)->origin(), numbering, encoder);
+  }
+
+  for (size_t n = 0; n < lambdaNode.nfctarguments(); n++)
+    WriteAttributes(lambdaNode.fctargument(n)->attributes(), encoder);
+
+  auto subregionNumbering = WriteRegion(*lambdaNode.subregion(), encoder);
+  for (size_t n = 0; n < lambdaNode.nfctresults(); n++)
+    WriteOrigin(*lambdaNode.fctresult(n)->origin(), subregionNumbering, encoder);
+}
+
+void
+RvsdgWriter::WriteDeltaNode(
+    const delta::node & deltaNode,
+    const OutputNumbering & numbering,
+    Encoder & encoder)
+{
+  auto type = GetTypeIndex(deltaNode.type());
+
+  encoder.WriteEnum(NodeTag::Delta);
+  encoder.WriteVarint(type);
+  encoder.WriteString(deltaNode.name());
+  encoder.WriteEnum(deltaNode.linkage());
+  encoder.WriteString(deltaNode.Section());
+  encoder.WriteVarint(deltaNode.constant());
+
+  encoder.WriteVarint(deltaNode.ncvarguments());
+  for (size_t n = 0; n < deltaNode.ncvarguments(); n++)
+  {
+    JLM_ASSERT(deltaNode.cvargument(n) == deltaNode.subregion()->argument(n));
+    WriteOrigin(*deltaNode.input(n)->origin(), numbering, encoder);
+  }
+
+  auto subregionNumbering = WriteRegion(*deltaNode.subregion(), encoder);
+  WriteOrigin(*deltaNode.result()->origin(), subregionNumbering, encoder);
+}
+
+void
+RvsdgWriter::WritePhiNode(
+    const phi::node & phiNode,
+    const OutputNumbering & numbering,
+    Encoder & encoder)
+{
+  auto & subregion = *phiNode.subregion();
+
+  std::vector<size_t> recursionVariableTypes;
+  for (size_t n = 0; n < subregion.narguments(); n++)
+  {
+    if (auto argument = dynamic_cast<const phi::rvargument *>(subregion.argument(n)))
+    {
+      JLM_ASSERT(argument->output() == phiNode.output(recursionVariableTypes.size()));
+      recursionVariableTypes.push_back(GetTypeIndex(argument->type()));
+    }
+  }
+
+  encoder.WriteEnum(NodeTag::Phi);
+  encoder.WriteVarint(subregion.narguments());
+  for (size_t n = 0, r = 0; n < subregion.narguments(); n++)
+  {
+    if (auto argument = dynamic_cast<const phi::cvargument *>(subregion.argument(n)))
+    {
+      encoder.WriteVarint(1);
+      WriteOrigin(*argument->input()->origin(), numbering, encoder);
+    }
+    else
+    {
+      encoder.WriteVarint(0);
+      encoder.WriteVarint(recursionVariableTypes[r++]);
+    }
+  }
+
+  auto subregionNumbering = WriteRegion(subregion, encoder);
+  for (size_t n = 0; n < phiNode.noutputs(); n++)
+    WriteOrigin(*phiNode.output(n)->result()->origin(), subregionNumbering, encoder);
+}
+
+void
+RvsdgWriter::WriteOrigin(
+    const rvsdg::output & origin,
+    const OutputNumbering & numbering,
+    Encoder & encoder)
+{
+  auto it = numbering.find(&origin);
+  JLM_ASSERT(it != numbering.end());
+  encoder.WriteVarint(numbering.size() - 1 - it->second);
+}
+
+std::vector<const rvsdg::node *>
+RvsdgWriter::ComputeTopologicalOrder(const rvsdg::region & region)
+{
+  std::vector<const rvsdg::node *> nodes;
+  nodes.reserve(region.nnodes());
+
+  std::unordered_set<const rvsdg::node *> visited;
+  std::vector<std::pair<const rvsdg::node *, size_t>> stack;
+  for (auto & node : region.nodes)
+  {
+    if (!visited.insert(&node).second)
+      continue;
+
+    stack.emplace_back(&node, 0);
+    while (!stack.empty())
+    {
+      auto current = stack.back().first;
+      auto inputIndex = stack.back().second++;
+      if (inputIndex < current->ninputs())
+      {
+        auto producer = rvsdg::node_output::node(current->input(inputIndex)->origin());
+        if (producer && visited.insert(producer).second)
+          stack.emplace_back(producer, 0);
+        continue;
+      }
+
+      nodes.push_back(current);
+      stack.pop_back();
+    }
+  }
+
+  return nodes;
+}
+
+std::unique_ptr<RvsdgModule>
+RvsdgReader::Read()
+{
+  auto magicNumber = Decoder_.ReadBytes(sizeof(MagicNumber));
+  if (memcmp(magicNumber, MagicNumber, sizeof(MagicNumber)) != 0)
+    throw util::error("Not a serialized RVSDG module.");
+
+  auto version = Decoder_.ReadVarint();
+  if (version != FormatVersion)
+    throw util::error("Unsupported RVSDG module version: " + std::to_string(version));
+
+  auto sourceFileName = Decoder_.ReadString();
+  auto targetTriple = Decoder_.ReadString();
+  auto dataLayout = Decoder_.ReadString();
+  auto rvsdgModule =
+      RvsdgModule::Create(util::filepath(sourceFileName), targetTriple, dataLayout);
+
+  auto & graph = rvsdgModule->Rvsdg();
+  auto nf = graph.node_normal_form(typeid(rvsdg::operation));
+  nf->set_mutable(false);
+
+  ReadTypeTable();
+  ReadOperationTable();
+
+  auto numImports = Decoder_.ReadVarint();
+  for (size_t n = 0; n < numImports; n++)
+  {
+    auto name = Decoder_.ReadString();
+    auto & valueType = ReadType<rvsdg::valuetype>();
+    auto linkage = Decoder_.ReadEnum<llvm::linkage>();
+    graph.add_import(impport(valueType, name, linkage));
+  }
+
+  auto table = ReadRegion(*graph.root());
+
+  auto numExports = Decoder_.ReadVarint();
+  for (size_t n = 0; n < numExports; n++)
+  {
+    auto origin = ReadOrigin(table);
+    auto name = Decoder_.ReadString();
+    graph.add_export(origin, { origin->type(), name });
+  }
+
+  if (!Decoder_.IsAtEnd())
+    throw CreateMalformedModuleError();
+
+  return rvsdgModule;
+}
+
+void
+RvsdgReader::ReadTypeTable()
+{
+  auto numEntries = Decoder_.ReadVarint();
+  for (size_t n = 0; n < numEntries; n++)
+    ReadTypeEntry();
+}
+
+void
+RvsdgReader::ReadTypeEntry()
+{
+  /*
+   * The types of a struct refer to their declaration. Declarations must therefore outlive the
+   * RVSDG module that is created from the serialized module.
+   */
+  static std::vector<std::unique_ptr<rvsdg::rcddeclaration>> declarations;
+
+  auto readTypes = [&]()
+  {
+    std::vector<std::unique_ptr<rvsdg::type>> types(Decoder_.ReadVarint());
+    for (auto & type : types)
+      type = ReadType<rvsdg::type>().copy();
+
+    return types;
+  };
+
+  auto tag = Decoder_.ReadEnum<TypeTag>();
+  switch (tag)
+  {
+  case TypeTag::Declaration:
+  {
+    auto declaration = rvsdg::rcddeclaration::create();
+    auto numElements = Decoder_.ReadVarint();
+    for (size_t n = 0; n < numElements; n++)
+      declaration->append(ReadType<rvsdg::valuetype>());
+
+    Declarations_.push_back(declaration.get());
+    declarations.push_back(std::move(declaration));
+    return;
+  }
+  case TypeTag::Bit:
+    Types_.push_back(std::make_unique<rvsdg::bittype>(Decoder_.ReadVarint()));
+    return;
+  case TypeTag::Control:
+    Types_.push_back(std::make_unique<rvsdg::ctltype>(Decoder_.ReadVarint()));
+    return;
+  case TypeTag::Pointer:
+    Types_.push_back(PointerType::Create());
+    return;
+  case TypeTag::Record:
+  {
+    auto index = Decoder_.ReadVarint();
+    if (index >= Declarations_.size())
+      throw CreateMalformedModuleError();
+
+    Types_.push_back(std::make_unique<rvsdg::rcdtype>(Declarations_[index]));
+    return;
+  }
+  case TypeTag::Function:
+  {
+    auto argumentTypes = readTypes();
+    auto resultTypes = readTypes();
+    Types_.push_back(
+        std::make_unique<FunctionType>(std::move(argumentTypes), std::move(resultTypes)));
+    return;
+  }
+  case TypeTag::Array:
+  {
+    auto & elementType = ReadType<rvsdg::valuetype>();
+    Types_.push_back(std::make_unique<arraytype>(elementType, Decoder_.ReadVarint()));
+    return;
+  }
+  case TypeTag::FloatingPoint:
+    Types_.push_back(std::make_unique<fptype>(Decoder_.ReadEnum<fpsize>()));
+    return;
+  case TypeTag::VariableArgument:
+    Types_.push_back(std::make_unique<varargtype>());
+    return;
+  case TypeTag::Struct:
+  {
+    auto hasName = Decoder_.ReadBool();
+    auto name = Decoder_.ReadString();
+    auto isPacked = Decoder_.ReadBool();
+    auto index = Decoder_.ReadVarint();
+    if (index >= Declarations_.size())
+      throw CreateMalformedModuleError();
+
+    auto & declaration = *Declarations_[index];
+    Types_.push_back(
+        hasName ? StructType::Create(name, isPacked, declaration)
+                : StructType::Create(isPacked, declaration));
+    return;
+  }
+  case TypeTag::FixedVector:
+  {
+    auto & elementType = ReadType<rvsdg::valuetype>();
+    Types_.push_back(std::make_unique<fixedvectortype>(elementType, Decoder_.ReadVarint()));
+    return;
+  }
+  case TypeTag::ScalableVector:
+  {
+    auto & elementType = ReadType<rvsdg::valuetype>();
+    Types_.push_back(std::make_unique<scalablevectortype>(elementType, Decoder_.ReadVarint()));
+    return;
+  }
+  case TypeTag::LoopState:
+    Types_.push_back(std::make_unique<loopstatetype>());
+    return;
+  case TypeTag::IoState:
+    Types_.push_back(std::make_unique<iostatetype>());
+    return;
+  case TypeTag::MemoryState:
+    Types_.push_back(MemoryStateType::Create());
+    return;
+  }
+
+  throw CreateMalformedModuleError();
+}
+
+void
+RvsdgReader::ReadOperationTable()
+{
+  auto readTypes = [&]()
+  {
+    TypeList types(Decoder_.ReadVarint());
+    for (auto & type : types)
+      type = &ReadType<rvsdg::type>();
+
+    return types;
+  };
+
+  auto numOperations = Decoder_.ReadVarint();
+  for (size_t n = 0; n < numOperations; n++)
+  {
+    auto & codec = GetOperationCodec(Decoder_.ReadString());
+    auto operandTypes = readTypes();
+    auto resultTypes = readTypes();
+
+    auto entry = codec.Read(*this, operandTypes, resultTypes);
+    entry.NumOperands = operandTypes.size();
+    if (entry.Operation
+        && (entry.Operation->narguments() != operandTypes.size()
+            || entry.Operation->nresults() != resultTypes.size()))
+      throw CreateMalformedModuleError();
+
+    Operations_.push_back(std::move(entry));
+  }
+}
+
+attributeset
+RvsdgReader::ReadAttributes()
+{
+  attributeset attributes;
+  auto numAttributes = Decoder_.ReadVarint();
+  for (size_t n = 0; n < numAttributes; n++)
+  {
+    switch (Decoder_.ReadEnum<AttributeTag>())
+    {
+    case AttributeTag::Enum:
+      attributes.insert(enum_attribute::create(Decoder_.ReadEnum<attribute::kind>()));
+      break;
+    case AttributeTag::Int:
+    {
+      auto kind = Decoder_.ReadEnum<attribute::kind>();
+      attributes.insert(int_attribute::create(kind, Decoder_.ReadVarint()));
+      break;
+    }
+    case AttributeTag::Type:
+    {
+      auto kind = Decoder_.ReadEnum<attribute::kind>();
+      auto type = ReadType<rvsdg::valuetype>().copy();
+      std::unique_ptr<rvsdg::valuetype> valueType(
+          static_cast<rvsdg::valuetype *>(type.release()));
+      if (kind == attribute::kind::ByVal)
+        attributes.insert(type_attribute::create_byval(std::move(valueType)));
+      else if (kind == attribute::kind::StructRet)
+        attributes.insert(type_attribute::CreateStructRetAttribute(std::move(valueType)));
+      else
+        throw CreateMalformedModuleError();
+      break;
+    }
+    case AttributeTag::String:
+    {
+      auto kind = Decoder_.ReadString();
+      attributes.insert(string_attribute::create(kind, Decoder_.ReadString()));
+      break;
+    }
+    default:
+      throw CreateMalformedModuleError();
+    }
+  }
+
+  return attributes;
+}
+
+RvsdgReader::OutputTable
+RvsdgReader::ReadRegion(rvsdg::region & region)
+{
+  OutputTable table;
+  for (size_t n = 0; n < region.narguments(); n++)
+    table.push_back(region.argument(n));
+
+  auto numNodes = Decoder_.ReadVarint();
+  for (size_t n = 0; n < numNodes; n++)
+  {
+    auto outputs = ReadNode(region, table);
+    table.insert(table.end(), outputs.begin(), outputs.end());
+  }
+
+  return table;
+}
+
+std::vector<rvsdg::output *>
+RvsdgReader::ReadNode(rvsdg::region & region, const OutputTable & table)
+{
+  switch (Decoder_.ReadEnum<NodeTag>())
+  {
+  case NodeTag::Simple:
+  {
+    auto & entry = ReadOperation();
+    std::vector<rvsdg::output *> operands;
+    for (size_t n = 0; n < entry.NumOperands; n++)
+      operands.push_back(ReadOrigin(table));
+
+    return entry.CreateNode(region, operands);
+  }
+  case NodeTag::Gamma:
+    return ReadGammaNode(table);
+  case NodeTag::Theta:
+    return ReadThetaNode(region, table);
+  case NodeTag::Lambda:
+    return ReadLambdaNode(region, table);
+  case NodeTag::Delta:
+    return ReadDeltaNode(region, table);
+  case NodeTag::Phi:
+    return ReadPhiNode(region, table);
+  }
+
+  throw CreateMalformedModuleError();
+}
+
+std::vector<rvsdg::output *>
+RvsdgReader::ReadGammaNode(const OutputTable & table)
+{
+  auto numSubregions = Decoder_.ReadVarint();
+  auto predicate = ReadOrigin(table);
+  auto gammaNode = rvsdg::gamma_node::create(predicate, numSubregions);
+
+  auto numEntryVariables = Decoder_.ReadVarint();
+  for (size_t n = 0; n < numEntryVariables; n++)
+    gammaNode->add_entryvar(ReadOrigin(table));
+
+  auto numExitVariables = Decoder_.ReadVarint();
+  std::vector<std::vector<rvsdg::output *>> exitVariableOrigins(
+      numExitVariables,
+      std::vector<rvsdg::output *>(numSubregions));
+  for (size_t r = 0; r < numSubregions; r++)
+  {
+    auto subregionTable = ReadRegion(*gammaNode->subregion(r));
+    for (size_t n = 0; n < numExitVariables; n++)
+      exitVariableOrigins[n][r] = ReadOrigin(subregionTable);
+  }
+
+  for (auto & origins : exitVariableOrigins)
+    gammaNode->add_exitvar(origins);
+
+  return rvsdg::outputs(gammaNode);
+}
+
+std::vector<rvsdg::output *>
+RvsdgReader::ReadThetaNode(rvsdg::region & region, const OutputTable & table)
+{
+  auto thetaNode = rvsdg::theta_node::create(&region);
+
+  auto numLoopVariables = Decoder_.ReadVarint();
+  for (size_t n = 0; n < numLoopVariables; n++)
+    thetaNode->add_loopvar(ReadOrigin(table));
+
+  auto subregionTable = ReadRegion(*thetaNode->subregion());
+  thetaNode->set_predicate(ReadOrigin(subregionTable));
+  for (size_t n = 0; n < numLoopVariables; n++)
+    thetaNode->output(n)->result()->divert_to(ReadOrigin(subregionTable));
+
+  return rvsdg::outputs(thetaNode);
+}
+
+std::vector<rvsdg::output *>
+RvsdgReader::ReadLambdaNode(rvsdg::region & region, const OutputTable & table)
+{
+  auto & functionType = ReadType<FunctionType>();
+  auto name = Decoder_.ReadString();
+  auto linkage = Decoder_.ReadEnum<llvm::linkage>();
+  auto attributes = ReadAttributes();
+  auto lambdaNode = lambda::node::create(&region, functionType, name, linkage, attributes);
+
+  auto numContextVariables = Decoder_.ReadVarint();
+  for (size_t n = 0; n < numContextVariables; n++)
+    lambdaNode->add_ctxvar(ReadOrigin(table));
+
+  for (size_t n = 0; n < lambdaNode->nfctarguments(); n++)
+    lambdaNode->fctargument(n)->set_attributes(ReadAttributes());
+
+  auto subregionTable = ReadRegion(*lambdaNode->subregion());
+  std::vector<rvsdg::output *> results;
+  for (size_t n = 0; n < functionType.NumResults(); n++)
+    results.push_back(ReadOrigin(subregionTable));
+
+  return { lambdaNode->finalize(results) };
+}
+
+std::vector<rvsdg::output *>
+RvsdgReader::ReadDeltaNode(rvsdg::region & region, const OutputTable & table)
+{
+  auto & type = ReadType<rvsdg::valuetype>();
+  auto name = Decoder_.ReadString();
+  auto linkage = Decoder_.ReadEnum<llvm::linkage>();
+  auto section = Decoder_.ReadString();
+  auto constant = Decoder_.ReadBool();
+  auto deltaNode = delta::node::Create(&region, type, name, linkage, section, constant);
+
+  auto numContextVariables = Decoder_.ReadVarint();
+  for (size_t n = 0; n < numContextVariables; n++)
+    deltaNode->add_ctxvar(ReadOrigin(table));
+
+  auto subregionTable = ReadRegion(*deltaNode->subregion());
+  return { deltaNode->finalize(ReadOrigin(subregionTable)) };
+}
+
+std::vector<rvsdg::output *>
+RvsdgReader::ReadPhiNode(rvsdg::region & region, const OutputTable & table)
+{
+  phi::builder phiBuilder;
+  phiBuilder.begin(&region);
+
+  std::vector<phi::rvoutput *> recursionVariables;
+  auto numArguments = Decoder_.ReadVarint();
+  for (size_t n = 0; n < numArguments; n++)
+  {
+    if (Decoder_.ReadBool())
+      phiBuilder.add_ctxvar(ReadOrigin(table));
+    else
+      recursionVariables.push_back(phiBuilder.add_recvar(ReadType<rvsdg::type>()));
+  }
+
+  auto subregionTable = ReadRegion(*phiBuilder.subregion());
+  for (auto recursionVariable : recursionVariables)
+    recursionVariable->set_rvorigin(ReadOrigin(subregionTable));
+
+  return rvsdg::outputs(phiBuilder.end());
+}
+
+rvsdg::output *
+RvsdgReader::ReadOrigin(const OutputTable & table)
+{
+  auto distance = Decoder_.ReadVarint();
+  if (distance >= table.size())
+    throw CreateMalformedModuleError();
+
+  return table[table.size() - 1 - distance];
+}
+
+std::vector<uint8_t>
+SerializeRvsdgModule(const RvsdgModule & rvsdgModule)
+{
+  RvsdgWriter writer;
+  return writer.Write(rvsdgModule);
+}
+
+std::unique_ptr<RvsdgModule>
+DeserializeRvsdgModule(const uint8_t * data, size_t size)
+{
+  RvsdgReader reader(data, size);
+  return reader.Read();
+}
+
+std::unique_ptr<RvsdgModule>
+ReadRvsdgModuleFile(const util::filepath & file)
+{
+  auto fd = open(file.to_str().c_str(), O_RDONLY);
+  if (fd < 0)
+    throw util::error("Cannot open " + file.to_str() + ": " + strerror(errno));
+
+  struct stat fileStatus;
+  if (fstat(fd, &fileStatus) != 0)
+  {
+    close(fd);
+    throw util::error("Cannot stat " + file.to_str() + ": " + strerror(errno));
+  }
+
+  size_t size = fileStatus.st_size;
+  if (size == 0)
+  {
+    close(fd);
+    throw util::error("Not a serialized RVSDG module: " + file.to_str());
+  }
+
+  auto data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (data == MAP_FAILED)
+    throw util::error("Cannot map " + file.to_str() + ": " + strerror(errno));
+
+  try
+  {
+    auto rvsdgModule = DeserializeRvsdgModule(static_cast<const uint8_t *>(data), size);
+    munmap(data, size);
+    return rvsdgModule;
+  }
+  catch (...)
+  {
+    munmap(data, size);
+    throw;
+  }
+}
+
+}
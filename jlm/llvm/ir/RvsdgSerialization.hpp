@@ -0,0 +1,70 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_LLVM_IR_RVSDGSERIALIZATION_HPP
+#define JLM_LLVM_IR_RVSDGSERIALIZATION_HPP
+
+#include <jlm/util/file.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace jlm::llvm
+{
+
+class RvsdgModule;
+
+/**
+ * Serializes an RVSDG module into jlm's binary RVSDG format.
+ *
+ * The format consists of a header with the magic number "JRVS" and a version, the module's
+ * source file name, target triple, and data layout, followed by a type table and an operation
+ * table. The graph itself is stored as a sequence of nested region bodies. Every node refers to
+ * its operation by index into the operation table and to its operands by a region-local output
+ * number. All numbers are LEB128 varints, and operand numbers are encoded relative to the
+ * number of outputs defined so far in the region, such that references to nearby producers
+ * require only a single byte.
+ *
+ * @param rvsdgModule The RVSDG module to serialize.
+ * @return The serialized module.
+ *
+ * @throws util::error if the module contains an operation or type that cannot be serialized.
+ */
+[[nodiscard]] std::vector<uint8_t>
+SerializeRvsdgModule(const RvsdgModule & rvsdgModule);
+
+/**
+ * Deserializes an RVSDG module from jlm's binary RVSDG format. The module is reconstructed
+ * directly from \p data without copying it first, i.e., \p data can point to a memory mapped
+ * file.
+ *
+ * @param data The serialized module.
+ * @param size The number of bytes of \p data.
+ * @return The deserialized RVSDG module.
+ *
+ * @throws util::error if \p data is not a valid serialized module.
+ *
+ * @see SerializeRvsdgModule()
+ */
+[[nodiscard]] std::unique_ptr<RvsdgModule>
+DeserializeRvsdgModule(const uint8_t * data, size_t size);
+
+/**
+ * Memory maps the file \p file and deserializes the RVSDG module stored in it.
+ *
+ * @param file A file in jlm's binary RVSDG format.
+ * @return The deserialized RVSDG module.
+ *
+ * @throws util::error if the file cannot be read or is not a valid serialized module.
+ *
+ * @see DeserializeRvsdgModule()
+ */
+[[nodiscard]] std::unique_ptr<RvsdgModule>
+ReadRvsdgModuleFile(const util::filepath & file);
+
+}
+
+#endif
@@ -5,7 +5,9 @@
 
 #include <jlm/llvm/ir/operators/operators.hpp>
 #include <jlm/rvsdg/bitstring/constant.hpp>
+#include <jlm/util/Hash.hpp>
 
+#include <llvm/ADT/Hashing.h>
 #include <llvm/ADT/SmallVector.h>
 
 namespace jlm::llvm
@@ -458,6 +460,14 @@ ConstantFP::operator==(const operation & other) const noexcept
   return op && size() == op->size() && constant().bitwiseIsEqual(op->constant());
 }
 
+std::size_t
+ConstantFP::hash() const noexcept
+{
+  return util::CombineHashes(
+      typeid(*this).hash_code(),
+      static_cast<std::size_t>(::llvm::hash_value(constant())));
+}
+
 std::string
 ConstantFP::debug_string() const
 {
@@ -819,6 +819,9 @@ public:
   virtual bool
   operator==(const operation & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  hash() const noexcept override;
+
   virtual std::string
   debug_string() const override;
 
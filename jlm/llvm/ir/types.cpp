@@ -4,6 +4,7 @@
  */
 
 #include <jlm/llvm/ir/types.hpp>
+#include <jlm/util/Hash.hpp>
 
 #include <unordered_map>
 
@@ -97,6 +98,18 @@ FunctionType::operator==(const jlm::rvsdg::type & _other) const noexcept
   return true;
 }
 
+std::size_t
+FunctionType::hash() const noexcept
+{
+  auto seed = util::CombineHashes(typeid(FunctionType).hash_code(), NumArguments(), NumResults());
+  for (auto & argumentType : ArgumentTypes_)
+    util::CombineHashesWithSeed(seed, argumentType->hash());
+  for (auto & resultType : ResultTypes_)
+    util::CombineHashesWithSeed(seed, resultType->hash());
+
+  return seed;
+}
+
 std::unique_ptr<jlm::rvsdg::type>
 FunctionType::copy() const
 {
@@ -164,6 +177,12 @@ arraytype::operator==(const jlm::rvsdg::type & other) const noexcept
   return type && type->element_type() == element_type() && type->nelements() == nelements();
 }
 
+std::size_t
+arraytype::hash() const noexcept
+{
+  return util::CombineHashes(typeid(arraytype).hash_code(), type_->hash(), nelements());
+}
+
 std::unique_ptr<jlm::rvsdg::type>
 arraytype::copy() const
 {
@@ -194,6 +213,12 @@ fptype::operator==(const jlm::rvsdg::type & other) const noexcept
   return type && type->size() == size();
 }
 
+std::size_t
+fptype::hash() const noexcept
+{
+  return util::CombineHashes(typeid(fptype).hash_code(), static_cast<size_t>(size()));
+}
+
 std::unique_ptr<jlm::rvsdg::type>
 fptype::copy() const
 {
@@ -230,7 +255,13 @@ StructType::operator==(const jlm::rvsdg::type & other) const noexcept
 {
   auto type = dynamic_cast<const StructType *>(&other);
   return type && type->IsPacked_ == IsPacked_ && type->Name_ == Name_
-      && &type->Declaration_ == &Declaration_;
+      && *type->Declaration_ == *Declaration_;
+}
+
+std::size_t
+StructType::hash() const noexcept
+{
+  return util::CombineHashes(typeid(StructType).hash_code(), Name_, Declaration_->hash());
 }
 
 std::string
@@ -245,6 +276,15 @@ StructType::copy() const
   return std::unique_ptr<jlm::rvsdg::type>(new StructType(*this));
 }
 
+std::unique_ptr<jlm::rvsdg::type>
+StructType::CreateCanonicalCopy() const
+{
+  auto declaration = Declaration_->CopyWithInternedTypes();
+  auto type = std::make_unique<StructType>(Name_, IsPacked_, *declaration);
+  type->OwnedDeclaration_ = std::move(declaration);
+  return type;
+}
+
 /* vectortype */
 
 bool
@@ -254,6 +294,13 @@ vectortype::operator==(const jlm::rvsdg::type & other) const noexcept
   return type && type->size_ == size_ && *type->type_ == *type_;
 }
 
+std::size_t
+vectortype::hash() const noexcept
+{
+  // Fixed and scalable vector types of the same size and element type are considered equal
+  return util::CombineHashes(typeid(vectortype).hash_code(), size_, type_->hash());
+}
+
 /* fixedvectortype */
 
 fixedvectortype::~fixedvectortype()
@@ -150,6 +150,9 @@ public:
   bool
   operator==(const jlm::rvsdg::type & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  hash() const noexcept override;
+
   std::unique_ptr<jlm::rvsdg::type>
   copy() const override;
 
@@ -222,6 +225,9 @@ public:
   virtual bool
   operator==(const jlm::rvsdg::type & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  hash() const noexcept override;
+
   virtual std::unique_ptr<jlm::rvsdg::type>
   copy() const override;
 
@@ -278,6 +284,9 @@ public:
   virtual bool
   operator==(const jlm::rvsdg::type & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  hash() const noexcept override;
+
   virtual std::unique_ptr<jlm::rvsdg::type>
   copy() const override;
 
@@ -336,17 +345,25 @@ public:
   StructType(bool isPacked, const jlm::rvsdg::rcddeclaration & declaration)
       : jlm::rvsdg::valuetype(),
         IsPacked_(isPacked),
-        Declaration_(declaration)
+        Declaration_(&declaration)
   {}
 
   StructType(std::string name, bool isPacked, const jlm::rvsdg::rcddeclaration & declaration)
       : jlm::rvsdg::valuetype(),
         IsPacked_(isPacked),
         Name_(std::move(name)),
-        Declaration_(declaration)
+        Declaration_(&declaration)
   {}
 
-  StructType(const StructType &) = default;
+  /**
+   * Copies refer to the declaration of \p other, but never own it.
+   */
+  StructType(const StructType & other)
+      : jlm::rvsdg::valuetype(other),
+        IsPacked_(other.IsPacked_),
+        Name_(other.Name_),
+        Declaration_(other.Declaration_)
+  {}
 
   StructType(StructType &&) = delete;
 
@@ -377,12 +394,15 @@ public:
   [[nodiscard]] const jlm::rvsdg::rcddeclaration &
   GetDeclaration() const noexcept
   {
-    return Declaration_;
+    return *Declaration_;
   }
 
   bool
   operator==(const jlm::rvsdg::type & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  hash() const noexcept override;
+
   [[nodiscard]] std::unique_ptr<jlm::rvsdg::type>
   copy() const override;
 
@@ -401,10 +421,20 @@ public:
     return std::make_unique<StructType>(isPacked, declaration);
   }
 
+protected:
+  [[nodiscard]] std::unique_ptr<jlm::rvsdg::type>
+  CreateCanonicalCopy() const override;
+
 private:
   bool IsPacked_;
   std::string Name_;
-  const jlm::rvsdg::rcddeclaration & Declaration_;
+  const jlm::rvsdg::rcddeclaration * Declaration_;
+
+  /**
+   * The declaration of a canonical instance, which must not refer to a declaration that is freed
+   * with its module.
+   */
+  std::unique_ptr<const jlm::rvsdg::rcddeclaration> OwnedDeclaration_;
 };
 
 /* vector type */
@@ -454,6 +484,9 @@ public:
   virtual bool
   operator==(const jlm::rvsdg::type & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  hash() const noexcept override;
+
   size_t
   size() const noexcept
   {
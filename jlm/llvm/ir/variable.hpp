@@ -25,17 +25,17 @@ public:
 
   inline variable(const jlm::rvsdg::type & type, const std::string & name)
       : name_(name),
-        type_(type.copy())
+        type_(&type.Intern())
   {}
 
   variable(std::unique_ptr<jlm::rvsdg::type> type, const std::string & name)
       : name_(name),
-        type_(std::move(type))
+        type_(&type->Intern())
   {}
 
   variable(variable && other)
       : name_(std::move(other.name_)),
-        type_(std::move(other.type_))
+        type_(other.type_)
   {}
 
   variable &
@@ -45,7 +45,7 @@ public:
       return *this;
 
     name_ = std::move(other.name_);
-    type_ = std::move(other.type_);
+    type_ = other.type_;
 
     return *this;
   }
@@ -67,7 +67,9 @@ public:
 
 private:
   std::string name_;
-  std::unique_ptr<jlm::rvsdg::type> type_;
+
+  /* interned type, see rvsdg::type::Intern() */
+  const jlm::rvsdg::type * type_;
 };
 
 template<class T>
@@ -6,6 +6,8 @@
 #include <jlm/llvm/ir/operators.hpp>
 #include <jlm/llvm/ir/RvsdgModule.hpp>
 #include <jlm/llvm/opt/DeadNodeElimination.hpp>
+#include <jlm/rvsdg/IdMap.hpp>
+#include <jlm/util/HashSet.hpp>
 #include <jlm/util/Statistics.hpp>
 #include <jlm/util/time.hpp>
 
@@ -35,20 +37,59 @@ is_phi_argument(const jlm::rvsdg::output * output)
  * to mark o2 alive in the future, we can immediately stop marking instead of reiterating through i1
  * ... iN again. Thus, by marking the entire simple node instead of just its outputs, we reduce the
  * runtime for marking Node2 from O(oN x iN) to O(oN + iN).
+ *
+ * The alive nodes and outputs of an entire RVSDG are kept in bit vectors indexed by their dense
+ * ids. The bit vectors are sized by the largest id in the graph, which is wasteful when only a
+ * single function body is marked. The context of a function body therefore uses hash sets, such
+ * that its memory is proportional to the size of the body.
  */
 class DeadNodeElimination::Context final
 {
+  template<typename T>
+  class AliveSet final
+  {
+  public:
+    explicit AliveSet(bool dense)
+        : Dense_(dense)
+    {}
+
+    void
+    Insert(const T & item)
+    {
+      if (Dense_)
+        DenseItems_.Insert(item);
+      else
+        SparseItems_.Insert(&item);
+    }
+
+    [[nodiscard]] bool
+    Contains(const T & item) const noexcept
+    {
+      return Dense_ ? DenseItems_.Contains(item) : SparseItems_.Contains(&item);
+    }
+
+  private:
+    bool Dense_;
+    rvsdg::IdSet<T> DenseItems_;
+    util::HashSet<const T *> SparseItems_;
+  };
+
 public:
+  explicit Context(bool dense)
+      : SimpleNodes_(dense),
+        Outputs_(dense)
+  {}
+
   void
   MarkAlive(const jlm::rvsdg::output & output)
   {
     if (auto simpleOutput = dynamic_cast<const jlm::rvsdg::simple_output *>(&output))
     {
-      SimpleNodes_.Insert(simpleOutput->node());
+      SimpleNodes_.Insert(*simpleOutput->node());
       return;
     }
 
-    Outputs_.Insert(&output);
+    Outputs_.Insert(output);
   }
 
   bool
@@ -56,10 +97,10 @@ public:
   {
     if (auto simpleOutput = dynamic_cast<const jlm::rvsdg::simple_output *>(&output))
     {
-      return SimpleNodes_.Contains(simpleOutput->node());
+      return SimpleNodes_.Contains(*simpleOutput->node());
     }
 
-    return Outputs_.Contains(&output);
+    return Outputs_.Contains(output);
   }
 
   bool
@@ -67,7 +108,7 @@ public:
   {
     if (auto simpleNode = dynamic_cast<const jlm::rvsdg::simple_node *>(&node))
     {
-      return SimpleNodes_.Contains(simpleNode);
+      return SimpleNodes_.Contains(*simpleNode);
     }
 
     for (size_t n = 0; n < node.noutputs(); n++)
@@ -84,12 +125,21 @@ public:
   static std::unique_ptr<Context>
   Create()
   {
-    return std::make_unique<Context>();
+    return std::make_unique<Context>(true);
+  }
+
+  /**
+   * Creates a context for marking a single function body.
+   */
+  static std::unique_ptr<Context>
+  CreateForFunctionBody()
+  {
+    return std::make_unique<Context>(false);
   }
 
 private:
-  util::HashSet<const jlm::rvsdg::simple_node *> SimpleNodes_;
-  util::HashSet<const jlm::rvsdg::output *> Outputs_;
+  AliveSet<jlm::rvsdg::node> SimpleNodes_;
+  AliveSet<jlm::rvsdg::output> Outputs_;
 };
 
 /** \brief Dead Node Elimination statistics class
@@ -218,6 +268,29 @@ DeadNodeElimination::run(RvsdgModule & module, jlm::util::StatisticsCollector &
   Context_.reset();
 }
 
+bool
+DeadNodeElimination::IsIntraProcedural() const noexcept
+{
+  return true;
+}
+
+void
+DeadNodeElimination::RunOnFunctionBody(jlm::rvsdg::region & body) const
+{
+  // Use a fresh instance such that concurrent invocations do not share a context
+  DeadNodeElimination deadNodeElimination;
+  deadNodeElimination.Context_ = Context::CreateForFunctionBody();
+
+  // Marking the arguments alive beforehand ensures that marking never leaves the function body
+  for (size_t n = 0; n < body.narguments(); n++)
+  {
+    deadNodeElimination.Context_->MarkAlive(*body.argument(n));
+  }
+
+  deadNodeElimination.MarkRegion(body);
+  deadNodeElimination.SweepRegion(body);
+}
+
 void
 DeadNodeElimination::MarkRegion(const jlm::rvsdg::region & region)
 {
@@ -77,6 +77,18 @@ public:
   void
   run(RvsdgModule & module, jlm::util::StatisticsCollector & statisticsCollector) override;
 
+  [[nodiscard]] bool
+  IsIntraProcedural() const noexcept override;
+
+  /**
+   * Removes all dead nodes from \p body. In contrast to run(), the arguments of \p body are
+   * considered alive and are left untouched, i.e., the inputs of the lambda node are not pruned.
+   *
+   * @param body The subregion of a lambda node.
+   */
+  void
+  RunOnFunctionBody(jlm::rvsdg::region & body) const override;
+
 private:
   void
   MarkRegion(const jlm::rvsdg::region & region);
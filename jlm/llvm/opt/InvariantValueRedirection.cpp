@@ -6,6 +6,7 @@
 #include <jlm/llvm/ir/operators/gamma.hpp>
 #include <jlm/llvm/ir/RvsdgModule.hpp>
 #include <jlm/llvm/opt/InvariantValueRedirection.hpp>
+#include <jlm/rvsdg/EdgeBatch.hpp>
 #include <jlm/rvsdg/theta.hpp>
 #include <jlm/rvsdg/traverser.hpp>
 #include <jlm/util/Statistics.hpp>
@@ -97,18 +98,21 @@ InvariantValueRedirection::RedirectInvariantValues(jlm::rvsdg::region & region)
 void
 InvariantValueRedirection::RedirectInvariantGammaOutputs(jlm::rvsdg::gamma_node & gammaNode)
 {
+  jlm::rvsdg::EdgeBatch batch;
   for (auto it = gammaNode.begin_exitvar(); it != gammaNode.end_exitvar(); it++)
   {
     auto & gammaOutput = *it;
 
     if (auto origin = is_invariant(&gammaOutput))
-      it->divert_users(origin);
+      batch.DivertUsers(gammaOutput, *origin);
   }
+  batch.Apply();
 }
 
 void
 InvariantValueRedirection::RedirectInvariantThetaOutputs(jlm::rvsdg::theta_node & thetaNode)
 {
+  jlm::rvsdg::EdgeBatch batch;
   for (const auto & thetaOutput : thetaNode)
   {
     /* FIXME: In order to also redirect loop state type variables, we need to know whether a loop
@@ -117,8 +121,9 @@ InvariantValueRedirection::RedirectInvariantThetaOutputs(jlm::rvsdg::theta_node
       continue;
 
     if (jlm::rvsdg::is_invariant(thetaOutput))
-      thetaOutput->divert_users(thetaOutput->input()->origin());
+      batch.DivertUsers(*thetaOutput, *thetaOutput->input()->origin());
   }
+  batch.Apply();
 }
 
 }
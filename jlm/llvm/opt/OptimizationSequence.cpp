@@ -3,11 +3,19 @@
  * See COPYING for terms of redistribution.
  */
 
+#include <jlm/llvm/ir/operators/lambda.hpp>
+#include <jlm/llvm/ir/operators/Phi.hpp>
 #include <jlm/llvm/ir/RvsdgModule.hpp>
 #include <jlm/llvm/opt/OptimizationSequence.hpp>
+#include <jlm/util/SlabAllocator.hpp>
 #include <jlm/util/Statistics.hpp>
+#include <jlm/util/ThreadPool.hpp>
 #include <jlm/util/time.hpp>
 
+#include <algorithm>
+
+#include <sys/resource.h>
+
 namespace jlm::llvm
 {
 
@@ -20,13 +28,17 @@ public:
       : util::Statistics(Statistics::Id::RvsdgOptimization),
         SourceFile_(std::move(sourceFile)),
         NumNodesBefore_(0),
-        NumNodesAfter_(0)
+        NumNodesAfter_(0),
+        NumAllocations_(0),
+        NumChunks_(0),
+        PeakResidentSetSize_(0)
   {}
 
   void
   StartMeasuring(const jlm::rvsdg::graph & graph) noexcept
   {
     NumNodesBefore_ = jlm::rvsdg::nnodes(graph.root());
+    NumAllocations_ = util::SlabAllocator::NumAllocations();
     Timer_.start();
   }
 
@@ -35,11 +47,48 @@ public:
   {
     Timer_.stop();
     NumNodesAfter_ = jlm::rvsdg::nnodes(graph.root());
+    NumAllocations_ = util::SlabAllocator::NumAllocations() - NumAllocations_;
+    NumChunks_ = util::SlabAllocator::NumChunks();
+
+    struct rusage usage = {};
+    if (getrusage(RUSAGE_SELF, &usage) == 0)
+      PeakResidentSetSize_ = usage.ru_maxrss;
+  }
+
+  /**
+   * Accounts \p ns nanoseconds that thread \p thread spent applying the optimization with index
+   * \p optimization to function bodies. Different threads can invoke this method concurrently.
+   */
+  void
+  AddThreadTime(size_t optimization, size_t thread, size_t ns) noexcept
+  {
+    ThreadTimes_[optimization][thread] += ns;
+  }
+
+  void
+  ResizeThreadTimes(size_t numOptimizations, size_t numThreads)
+  {
+    ThreadTimes_.assign(numOptimizations, std::vector<size_t>(numThreads, 0));
   }
 
   [[nodiscard]] std::string
   ToString() const override
   {
+    std::string threadTimes;
+    for (size_t o = 0; o < ThreadTimes_.size(); o++)
+    {
+      auto & times = ThreadTimes_[o];
+      auto isZero = [](size_t ns)
+      {
+        return ns == 0;
+      };
+      if (std::all_of(times.begin(), times.end(), isZero))
+        continue;
+
+      for (size_t t = 0; t < times.size(); t++)
+        threadTimes += util::strfmt(" Optimization", o, "Thread", t, "[ns]:", times[t]);
+    }
+
     return util::strfmt(
         "RVSDGOPTIMIZATION ",
         SourceFile_.to_str(),
@@ -48,7 +97,14 @@ public:
         " ",
         NumNodesAfter_,
         " ",
-        Timer_.ns());
+        Timer_.ns(),
+        " #Allocations:",
+        NumAllocations_,
+        " #AllocatorChunks:",
+        NumChunks_,
+        " PeakRss[KiB]:",
+        PeakResidentSetSize_,
+        threadTimes);
   }
 
   static std::unique_ptr<Statistics>
@@ -62,8 +118,36 @@ private:
   util::filepath SourceFile_;
   size_t NumNodesBefore_;
   size_t NumNodesAfter_;
+
+  /* graph elements allocated during the optimization, and chunks held by the slab allocator */
+  size_t NumAllocations_;
+  size_t NumChunks_;
+  size_t PeakResidentSetSize_;
+
+  /* time spent per optimization and thread on function bodies */
+  std::vector<std::vector<size_t>> ThreadTimes_;
 };
 
+/**
+ * Collects the lambda nodes of \p region and of all phi nodes within it.
+ */
+static void
+CollectLambdaNodes(rvsdg::region & region, std::vector<lambda::node *> & lambdaNodes)
+{
+  for (auto & node : region.nodes)
+  {
+    if (auto lambdaNode = dynamic_cast<lambda::node *>(&node))
+    {
+      lambdaNodes.push_back(lambdaNode);
+    }
+    else if (auto phiNode = dynamic_cast<phi::node *>(&node))
+    {
+      auto phiLambdaNodes = phi::node::ExtractLambdaNodes(*phiNode);
+      lambdaNodes.insert(lambdaNodes.end(), phiLambdaNodes.begin(), phiLambdaNodes.end());
+    }
+  }
+}
+
 OptimizationSequence::~OptimizationSequence() noexcept = default;
 
 void
@@ -74,13 +158,84 @@ OptimizationSequence::run(
   auto statistics = Statistics::Create(rvsdgModule.SourceFileName());
   statistics->StartMeasuring(rvsdgModule.Rvsdg());
 
-  for (const auto & optimization : Optimizations_)
+  if (NumThreads_ == 1)
   {
-    optimization->run(rvsdgModule, statisticsCollector);
+    for (const auto & optimization : Optimizations_)
+    {
+      optimization->run(rvsdgModule, statisticsCollector);
+    }
+  }
+  else
+  {
+    util::ThreadPool threadPool(NumThreads_);
+    statistics->ResizeThreadTimes(Optimizations_.size(), threadPool.NumThreads());
+
+    size_t n = 0;
+    while (n < Optimizations_.size())
+    {
+      if (!Optimizations_[n]->IsIntraProcedural())
+      {
+        Optimizations_[n++]->RunWithThreads(rvsdgModule, statisticsCollector, NumThreads_);
+        continue;
+      }
+
+      auto end = n;
+      while (end < Optimizations_.size() && Optimizations_[end]->IsIntraProcedural())
+        end++;
+
+      RunOnFunctionBodies(rvsdgModule, n, end, threadPool, *statistics);
+      n = end;
+    }
   }
 
   statistics->EndMeasuring(rvsdgModule.Rvsdg());
   statisticsCollector.CollectDemandedStatistics(std::move(statistics));
 }
 
+void
+OptimizationSequence::RunOnFunctionBodies(
+    RvsdgModule & rvsdgModule,
+    size_t begin,
+    size_t end,
+    util::ThreadPool & threadPool,
+    Statistics & statistics) const
+{
+  std::vector<lambda::node *> lambdaNodes;
+  CollectLambdaNodes(*rvsdgModule.Rvsdg().root(), lambdaNodes);
+
+  // Start the largest function bodies first to reduce the imbalance at the end of the batch
+  std::vector<std::pair<size_t, lambda::node *>> sizedLambdaNodes;
+  for (auto lambdaNode : lambdaNodes)
+    sizedLambdaNodes.emplace_back(rvsdg::nnodes(lambdaNode->subregion()), lambdaNode);
+  std::stable_sort(
+      sizedLambdaNodes.begin(),
+      sizedLambdaNodes.end(),
+      [](const auto & a, const auto & b)
+      {
+        return a.first > b.first;
+      });
+
+  std::vector<util::ThreadPool::Task> tasks;
+  for (auto & sizedLambdaNode : sizedLambdaNodes)
+  {
+    auto & body = *sizedLambdaNode.second->subregion();
+    tasks.emplace_back(
+        [&, begin, end](size_t thread)
+        {
+          for (size_t n = begin; n < end; n++)
+          {
+            util::timer timer;
+            timer.start();
+            Optimizations_[n]->RunOnFunctionBody(body);
+            timer.stop();
+            statistics.AddThreadTime(n, thread, timer.ns());
+          }
+        });
+  }
+
+  rvsdgModule.Rvsdg().SetConcurrentModification(true);
+  threadPool.Run(std::move(tasks));
+  rvsdgModule.Rvsdg().SetConcurrentModification(false);
+}
+
 }
@@ -7,12 +7,27 @@
 #define JLM_LLVM_OPT_OPTIMIZATIONSEQUENCE_HPP
 
 #include <jlm/llvm/opt/optimization.hpp>
+#include <jlm/util/common.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace jlm::util
+{
+class ThreadPool;
+}
 
 namespace jlm::llvm
 {
 
 /**
  * Sequentially applies a list of optimizations to an Rvsdg.
+ *
+ * If more than one thread is requested, every maximal run of consecutive intra-procedural
+ * optimizations (see optimization::IsIntraProcedural()) is applied to the function bodies of the
+ * module concurrently: each function body is a task that applies the entire run of
+ * optimizations, and the tasks are distributed over a work-stealing thread pool. All other
+ * optimizations act as barriers and are applied to the entire module on the calling thread.
  */
 class OptimizationSequence final : public optimization
 {
@@ -21,9 +36,12 @@ public:
 
   ~OptimizationSequence() noexcept override;
 
-  explicit OptimizationSequence(std::vector<optimization *> optimizations)
-      : Optimizations_(std::move(optimizations))
-  {}
+  explicit OptimizationSequence(std::vector<optimization *> optimizations, size_t numThreads = 1)
+      : Optimizations_(std::move(optimizations)),
+        NumThreads_(numThreads)
+  {
+    JLM_ASSERT(NumThreads_ > 0);
+  }
 
   void
   run(RvsdgModule & rvsdgModule, util::StatisticsCollector & statisticsCollector) override;
@@ -32,14 +50,28 @@ public:
   CreateAndRun(
       RvsdgModule & rvsdgModule,
       util::StatisticsCollector & statisticsCollector,
-      std::vector<optimization *> optimizations)
+      std::vector<optimization *> optimizations,
+      size_t numThreads = 1)
   {
-    OptimizationSequence sequentialApplication(std::move(optimizations));
+    OptimizationSequence sequentialApplication(std::move(optimizations), numThreads);
     sequentialApplication.run(rvsdgModule, statisticsCollector);
   }
 
 private:
+  /**
+   * Applies the optimizations in [\p begin, \p end) to all function bodies of \p rvsdgModule
+   * using \p threadPool.
+   */
+  void
+  RunOnFunctionBodies(
+      RvsdgModule & rvsdgModule,
+      size_t begin,
+      size_t end,
+      util::ThreadPool & threadPool,
+      Statistics & statistics) const;
+
   std::vector<optimization *> Optimizations_;
+  size_t NumThreads_;
 };
 
 }
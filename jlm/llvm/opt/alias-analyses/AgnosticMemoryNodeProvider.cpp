@@ -18,9 +18,11 @@ public:
 
 private:
   AgnosticMemoryNodeProvisioning(
-      const PointsToGraph & pointsToGraph,
-      util::HashSet<const PointsToGraph::MemoryNode *> memoryNodes)
-      : PointsToGraph_(pointsToGraph),
+      const PointsToQuery & pointsToQuery,
+      std::unique_ptr<const PointsToQuery> ownedPointsToQuery,
+      MemoryNodeSet memoryNodes)
+      : OwnedPointsToQuery_(std::move(ownedPointsToQuery)),
+        PointsToQuery_(pointsToQuery),
         MemoryNodes_(std::move(memoryNodes))
   {}
 
@@ -38,102 +40,55 @@ public:
   [[nodiscard]] const PointsToGraph &
   GetPointsToGraph() const noexcept override
   {
-    return PointsToGraph_;
+    return PointsToQuery_.GetPointsToGraph();
   }
 
-  [[nodiscard]] const util::HashSet<const PointsToGraph::MemoryNode *> &
+  [[nodiscard]] const MemoryNodeSet &
   GetRegionEntryNodes(const rvsdg::region & region) const override
   {
     return MemoryNodes_;
   }
 
-  [[nodiscard]] const util::HashSet<const PointsToGraph::MemoryNode *> &
+  [[nodiscard]] const MemoryNodeSet &
   GetRegionExitNodes(const rvsdg::region & region) const override
   {
     return MemoryNodes_;
   }
 
-  [[nodiscard]] const util::HashSet<const PointsToGraph::MemoryNode *> &
+  [[nodiscard]] const MemoryNodeSet &
   GetCallEntryNodes(const CallNode & callNode) const override
   {
     return MemoryNodes_;
   }
 
-  [[nodiscard]] const util::HashSet<const PointsToGraph::MemoryNode *> &
+  [[nodiscard]] const MemoryNodeSet &
   GetCallExitNodes(const CallNode & callNode) const override
   {
     return MemoryNodes_;
   }
 
-  [[nodiscard]] util::HashSet<const PointsToGraph::MemoryNode *>
+  [[nodiscard]] MemoryNodeSet
   GetOutputNodes(const rvsdg::output & output) const override
   {
-    JLM_ASSERT(is<PointerType>(output.type()));
-
-    util::HashSet<const PointsToGraph::MemoryNode *> memoryNodes;
-    if (GetOutputNodesFromRegisterNode(output, memoryNodes))
-      return memoryNodes;
-
-    if (GetOutputNodesFromRegisterSetNode(output, memoryNodes))
-      return memoryNodes;
-
-    throw util::error("Cannot find register in points-to graph.");
+    return PointsToQuery_.GetOutputNodes(output);
   }
 
   static std::unique_ptr<AgnosticMemoryNodeProvisioning>
   Create(
-      const PointsToGraph & pointsToGraph,
-      util::HashSet<const PointsToGraph::MemoryNode *> memoryNodes)
+      const PointsToQuery & pointsToQuery,
+      std::unique_ptr<const PointsToQuery> ownedPointsToQuery,
+      MemoryNodeSet memoryNodes)
   {
-    return std::unique_ptr<AgnosticMemoryNodeProvisioning>(
-        new AgnosticMemoryNodeProvisioning(pointsToGraph, std::move(memoryNodes)));
+    return std::unique_ptr<AgnosticMemoryNodeProvisioning>(new AgnosticMemoryNodeProvisioning(
+        pointsToQuery,
+        std::move(ownedPointsToQuery),
+        std::move(memoryNodes)));
   }
 
 private:
-  [[nodiscard]] bool
-  GetOutputNodesFromRegisterNode(
-      const rvsdg::output & output,
-      util::HashSet<const PointsToGraph::MemoryNode *> & memoryNodes) const
-  {
-    const PointsToGraph::RegisterNode * registerNode;
-    try
-    {
-      registerNode = &PointsToGraph_.GetRegisterNode(output);
-    }
-    catch (...)
-    {
-      return false;
-    }
-
-    for (auto & memoryNode : registerNode->Targets())
-      memoryNodes.Insert(&memoryNode);
-
-    return true;
-  }
-
-  [[nodiscard]] bool
-  GetOutputNodesFromRegisterSetNode(
-      const rvsdg::output & output,
-      util::HashSet<const PointsToGraph::MemoryNode *> & memoryNodes) const
-  {
-    const PointsToGraph::RegisterSetNode * registerSetNode;
-    try
-    {
-      registerSetNode = &PointsToGraph_.GetRegisterSetNode(output);
-    }
-    catch (...)
-    {
-      return false;
-    }
-
-    for (auto & memoryNode : registerSetNode->Targets())
-      memoryNodes.Insert(&memoryNode);
-
-    return true;
-  }
-
-  const PointsToGraph & PointsToGraph_;
-  util::HashSet<const PointsToGraph::MemoryNode *> MemoryNodes_;
+  std::unique_ptr<const PointsToQuery> OwnedPointsToQuery_;
+  const PointsToQuery & PointsToQuery_;
+  MemoryNodeSet MemoryNodes_;
 };
 
 AgnosticMemoryNodeProvider::~AgnosticMemoryNodeProvider() = default;
@@ -144,11 +99,37 @@ AgnosticMemoryNodeProvider::ProvisionMemoryNodes(
     const PointsToGraph & pointsToGraph,
     util::StatisticsCollector & statisticsCollector)
 {
+  auto pointsToQuery = PointsToGraphQuery::Create(pointsToGraph);
+  auto & pointsToQueryRef = *pointsToQuery;
+  return ProvisionMemoryNodes(
+      rvsdgModule,
+      pointsToQueryRef,
+      std::move(pointsToQuery),
+      statisticsCollector);
+}
+
+std::unique_ptr<MemoryNodeProvisioning>
+AgnosticMemoryNodeProvider::ProvisionMemoryNodes(
+    const RvsdgModule & rvsdgModule,
+    const PointsToQuery & pointsToQuery,
+    util::StatisticsCollector & statisticsCollector)
+{
+  return ProvisionMemoryNodes(rvsdgModule, pointsToQuery, nullptr, statisticsCollector);
+}
+
+std::unique_ptr<MemoryNodeProvisioning>
+AgnosticMemoryNodeProvider::ProvisionMemoryNodes(
+    const RvsdgModule & rvsdgModule,
+    const PointsToQuery & pointsToQuery,
+    std::unique_ptr<const PointsToQuery> ownedPointsToQuery,
+    util::StatisticsCollector & statisticsCollector)
+{
+  auto & pointsToGraph = pointsToQuery.GetPointsToGraph();
   auto statistics =
       Statistics::Create(rvsdgModule.SourceFileName(), statisticsCollector, pointsToGraph);
   statistics->StartCollecting();
 
-  util::HashSet<const PointsToGraph::MemoryNode *> memoryNodes;
+  MemoryNodeSet memoryNodes;
   for (auto & allocaNode : pointsToGraph.AllocaNodes())
     memoryNodes.Insert(&allocaNode);
 
@@ -166,7 +147,10 @@ AgnosticMemoryNodeProvider::ProvisionMemoryNodes(
 
   memoryNodes.Insert(&pointsToGraph.GetExternalMemoryNode());
 
-  auto provisioning = AgnosticMemoryNodeProvisioning::Create(pointsToGraph, std::move(memoryNodes));
+  auto provisioning = AgnosticMemoryNodeProvisioning::Create(
+      pointsToQuery,
+      std::move(ownedPointsToQuery),
+      std::move(memoryNodes));
 
   statistics->StopCollecting();
   statisticsCollector.CollectDemandedStatistics(std::move(statistics));
@@ -193,4 +177,14 @@ AgnosticMemoryNodeProvider::Create(
   return Create(rvsdgModule, pointsToGraph, statisticsCollector);
 }
 
+std::unique_ptr<MemoryNodeProvisioning>
+AgnosticMemoryNodeProvider::Create(
+    const RvsdgModule & rvsdgModule,
+    const PointsToQuery & pointsToQuery,
+    util::StatisticsCollector & statisticsCollector)
+{
+  AgnosticMemoryNodeProvider provider;
+  return provider.ProvisionMemoryNodes(rvsdgModule, pointsToQuery, statisticsCollector);
+}
+
 }
@@ -51,6 +51,12 @@ public:
       const PointsToGraph & pointsToGraph,
       util::StatisticsCollector & statisticsCollector) override;
 
+  std::unique_ptr<MemoryNodeProvisioning>
+  ProvisionMemoryNodes(
+      const RvsdgModule & rvsdgModule,
+      const PointsToQuery & pointsToQuery,
+      util::StatisticsCollector & statisticsCollector) override;
+
   /**
    * Creates a AgnosticMemoryNodeProvider and calls the ProvisionMemoryNodes() method.
    *
@@ -76,6 +82,35 @@ public:
    */
   static std::unique_ptr<MemoryNodeProvisioning>
   Create(const RvsdgModule & rvsdgModule, const PointsToGraph & pointsToGraph);
+
+  /**
+   * Creates a AgnosticMemoryNodeProvider and calls the ProvisionMemoryNodes() method.
+   *
+   * @param rvsdgModule The RVSDG module on which the provision should be performed.
+   * @param pointsToQuery The points-to queries corresponding to the RVSDG module.
+   * @param statisticsCollector The statistics collector for collecting pass statistics.
+   *
+   * @return A new instance of MemoryNodeProvisioning.
+   */
+  static std::unique_ptr<MemoryNodeProvisioning>
+  Create(
+      const RvsdgModule & rvsdgModule,
+      const PointsToQuery & pointsToQuery,
+      util::StatisticsCollector & statisticsCollector);
+
+private:
+  /**
+   * Computes the memory node provisioning with the points-to queries \p pointsToQuery.
+   *
+   * @param ownedPointsToQuery Transferred to the provisioning in order to keep \p pointsToQuery
+   * alive, if the query was created by the provider itself.
+   */
+  std::unique_ptr<MemoryNodeProvisioning>
+  ProvisionMemoryNodes(
+      const RvsdgModule & rvsdgModule,
+      const PointsToQuery & pointsToQuery,
+      std::unique_ptr<const PointsToQuery> ownedPointsToQuery,
+      util::StatisticsCollector & statisticsCollector);
 };
 
 /** \brief Agnostic memory node provider statistics
@@ -0,0 +1,20 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/llvm/opt/alias-analyses/AliasAnalysis.hpp>
+#include <jlm/llvm/opt/alias-analyses/PointsToQuery.hpp>
+
+namespace jlm::llvm::aa
+{
+
+std::unique_ptr<PointsToQuery>
+AliasAnalysis::AnalyzeOnDemand(
+    const RvsdgModule & module,
+    jlm::util::StatisticsCollector & statisticsCollector)
+{
+  return PointsToGraphQuery::Create(Analyze(module, statisticsCollector));
+}
+
+}
@@ -22,6 +22,7 @@ namespace aa
 {
 
 class PointsToGraph;
+class PointsToQuery;
 
 /**
  * \brief Alias Analysis Interface
@@ -41,6 +42,21 @@ public:
    */
   virtual std::unique_ptr<PointsToGraph>
   Analyze(const RvsdgModule & module, jlm::util::StatisticsCollector & statisticsCollector) = 0;
+
+  /**
+   * \brief Analyze RVSDG module for demand-driven points-to queries
+   *
+   * In contrast to Analyze(), the points-to sets of the registers are not materialized in a
+   * PointsToGraph, but computed on demand. The default implementation answers the queries from
+   * the PointsToGraph returned by Analyze().
+   *
+   * \param module RVSDG module the analysis is performed on.
+   * \param statisticsCollector Statistics collector for collecting analysis statistics.
+   *
+   * \return A PointsToQuery.
+   */
+  virtual std::unique_ptr<PointsToQuery>
+  AnalyzeOnDemand(const RvsdgModule & module, jlm::util::StatisticsCollector & statisticsCollector);
 };
 
 }
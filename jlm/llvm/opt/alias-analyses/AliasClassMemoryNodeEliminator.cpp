@@ -0,0 +1,667 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/llvm/ir/operators.hpp>
+#include <jlm/llvm/ir/RvsdgModule.hpp>
+#include <jlm/llvm/opt/alias-analyses/AliasClassMemoryNodeEliminator.hpp>
+
+#include <functional>
+#include <limits>
+#include <typeindex>
+
+namespace jlm::llvm::aa
+{
+
+/** \brief Memory node provisioning of the alias class memory node eliminator
+ *
+ * Contains only the representatives of the alias classes. The memory node sets of all nodes are
+ * computed by the AliasClassMemoryNodeEliminator upfront, such that the provisioning does not
+ * depend on the seed provisioning.
+ */
+class AliasClassMemoryNodeProvisioning final : public MemoryNodeProvisioning
+{
+  template<class T>
+  using MemoryNodeSetMap = std::unordered_map<const T *, const MemoryNodeSet *>;
+
+public:
+  ~AliasClassMemoryNodeProvisioning() noexcept override = default;
+
+  explicit AliasClassMemoryNodeProvisioning(const PointsToGraph & pointsToGraph)
+      : PointsToGraph_(pointsToGraph)
+  {}
+
+  AliasClassMemoryNodeProvisioning(const AliasClassMemoryNodeProvisioning &) = delete;
+
+  AliasClassMemoryNodeProvisioning(AliasClassMemoryNodeProvisioning &&) = delete;
+
+  AliasClassMemoryNodeProvisioning &
+  operator=(const AliasClassMemoryNodeProvisioning &) = delete;
+
+  AliasClassMemoryNodeProvisioning &
+  operator=(AliasClassMemoryNodeProvisioning &&) = delete;
+
+  [[nodiscard]] const PointsToGraph &
+  GetPointsToGraph() const noexcept override
+  {
+    return PointsToGraph_;
+  }
+
+  [[nodiscard]] const MemoryNodeSet &
+  GetRegionEntryNodes(const jlm::rvsdg::region & region) const override
+  {
+    return GetMemoryNodes(RegionEntryNodes_, region);
+  }
+
+  [[nodiscard]] const MemoryNodeSet &
+  GetRegionExitNodes(const jlm::rvsdg::region & region) const override
+  {
+    return GetMemoryNodes(RegionExitNodes_, region);
+  }
+
+  [[nodiscard]] const MemoryNodeSet &
+  GetCallEntryNodes(const CallNode & callNode) const override
+  {
+    return GetMemoryNodes(CallEntryNodes_, callNode);
+  }
+
+  [[nodiscard]] const MemoryNodeSet &
+  GetCallExitNodes(const CallNode & callNode) const override
+  {
+    return GetMemoryNodes(CallExitNodes_, callNode);
+  }
+
+  [[nodiscard]] MemoryNodeSet
+  GetOutputNodes(const jlm::rvsdg::output & output) const override
+  {
+    return GetMemoryNodes(OutputNodes_, output);
+  }
+
+  [[nodiscard]] const MemoryNodeSet &
+  GetLambdaEntryNodes(const lambda::node & lambdaNode) const override
+  {
+    return GetMemoryNodes(LambdaEntryNodes_, lambdaNode);
+  }
+
+  [[nodiscard]] const MemoryNodeSet &
+  GetLambdaExitNodes(const lambda::node & lambdaNode) const override
+  {
+    return GetMemoryNodes(LambdaExitNodes_, lambdaNode);
+  }
+
+  [[nodiscard]] const MemoryNodeSet &
+  GetThetaEntryExitNodes(const jlm::rvsdg::theta_node & thetaNode) const override
+  {
+    return GetMemoryNodes(ThetaEntryExitNodes_, thetaNode);
+  }
+
+  [[nodiscard]] MemoryNodeSet
+  GetGammaEntryNodes(const jlm::rvsdg::gamma_node & gammaNode) const override
+  {
+    return GetMemoryNodes(GammaEntryNodes_, gammaNode);
+  }
+
+  [[nodiscard]] MemoryNodeSet
+  GetGammaExitNodes(const jlm::rvsdg::gamma_node & gammaNode) const override
+  {
+    return GetMemoryNodes(GammaExitNodes_, gammaNode);
+  }
+
+  void
+  AddRegionNodes(
+      const jlm::rvsdg::region & region,
+      const MemoryNodeSet & entryNodes,
+      const MemoryNodeSet & exitNodes)
+  {
+    RegionEntryNodes_[&region] = &entryNodes;
+    RegionExitNodes_[&region] = &exitNodes;
+  }
+
+  void
+  AddCallNodes(
+      const CallNode & callNode,
+      const MemoryNodeSet & entryNodes,
+      const MemoryNodeSet & exitNodes)
+  {
+    CallEntryNodes_[&callNode] = &entryNodes;
+    CallExitNodes_[&callNode] = &exitNodes;
+  }
+
+  void
+  AddOutputNodes(const jlm::rvsdg::output & output, const MemoryNodeSet & memoryNodes)
+  {
+    OutputNodes_[&output] = &memoryNodes;
+  }
+
+  void
+  AddLambdaNodes(
+      const lambda::node & lambdaNode,
+      const MemoryNodeSet & entryNodes,
+      const MemoryNodeSet & exitNodes)
+  {
+    LambdaEntryNodes_[&lambdaNode] = &entryNodes;
+    LambdaExitNodes_[&lambdaNode] = &exitNodes;
+  }
+
+  void
+  AddThetaNodes(const jlm::rvsdg::theta_node & thetaNode, const MemoryNodeSet & entryExitNodes)
+  {
+    ThetaEntryExitNodes_[&thetaNode] = &entryExitNodes;
+  }
+
+  void
+  AddGammaNodes(
+      const jlm::rvsdg::gamma_node & gammaNode,
+      const MemoryNodeSet & entryNodes,
+      const MemoryNodeSet & exitNodes)
+  {
+    GammaEntryNodes_[&gammaNode] = &entryNodes;
+    GammaExitNodes_[&gammaNode] = &exitNodes;
+  }
+
+  /**
+   * Replaces every memory node set \p s of the provisioning with \p replace(s).
+   */
+  void
+  ReplaceMemoryNodeSets(
+      const std::function<const MemoryNodeSet &(const MemoryNodeSet &)> & replace)
+  {
+    auto replaceAll = [&](auto & map)
+    {
+      for (auto & [key, memoryNodes] : map)
+        memoryNodes = &replace(*memoryNodes);
+    };
+
+    replaceAll(RegionEntryNodes_);
+    replaceAll(RegionExitNodes_);
+    replaceAll(CallEntryNodes_);
+    replaceAll(CallExitNodes_);
+    replaceAll(OutputNodes_);
+    replaceAll(LambdaEntryNodes_);
+    replaceAll(LambdaExitNodes_);
+    replaceAll(ThetaEntryExitNodes_);
+    replaceAll(GammaEntryNodes_);
+    replaceAll(GammaExitNodes_);
+  }
+
+  /**
+   * @return The pool that owns the memory node sets of the provisioning.
+   */
+  MemoryNodeSetPool &
+  GetMemoryNodeSets() noexcept
+  {
+    return MemoryNodeSets_;
+  }
+
+  static std::unique_ptr<AliasClassMemoryNodeProvisioning>
+  Create(const PointsToGraph & pointsToGraph)
+  {
+    return std::make_unique<AliasClassMemoryNodeProvisioning>(pointsToGraph);
+  }
+
+private:
+  template<class T>
+  static const MemoryNodeSet &
+  GetMemoryNodes(const MemoryNodeSetMap<T> & map, const T & key)
+  {
+    auto it = map.find(&key);
+    JLM_ASSERT(it != map.end());
+    return *it->second;
+  }
+
+  const PointsToGraph & PointsToGraph_;
+  MemoryNodeSetPool MemoryNodeSets_;
+
+  MemoryNodeSetMap<jlm::rvsdg::region> RegionEntryNodes_;
+  MemoryNodeSetMap<jlm::rvsdg::region> RegionExitNodes_;
+  MemoryNodeSetMap<CallNode> CallEntryNodes_;
+  MemoryNodeSetMap<CallNode> CallExitNodes_;
+  MemoryNodeSetMap<jlm::rvsdg::output> OutputNodes_;
+  MemoryNodeSetMap<lambda::node> LambdaEntryNodes_;
+  MemoryNodeSetMap<lambda::node> LambdaExitNodes_;
+  MemoryNodeSetMap<jlm::rvsdg::theta_node> ThetaEntryExitNodes_;
+  MemoryNodeSetMap<jlm::rvsdg::gamma_node> GammaEntryNodes_;
+  MemoryNodeSetMap<jlm::rvsdg::gamma_node> GammaExitNodes_;
+};
+
+/** \brief Context of the alias class memory node eliminator
+ *
+ * Collects the memory node sets of the seed provisioning. All collected sets are interned, such
+ * that sets that are requested for many nodes only need to be considered once for partitioning the
+ * memory nodes.
+ */
+class AliasClassMemoryNodeEliminator::Context final
+{
+public:
+  explicit Context(const MemoryNodeProvisioning & seedProvisioning)
+      : SeedProvisioning_(seedProvisioning),
+        Provisioning_(AliasClassMemoryNodeProvisioning::Create(seedProvisioning.GetPointsToGraph()))
+  {}
+
+  Context(const Context &) = delete;
+
+  Context(Context &&) = delete;
+
+  Context &
+  operator=(const Context &) = delete;
+
+  Context &
+  operator=(Context &&) = delete;
+
+  [[nodiscard]] const MemoryNodeProvisioning &
+  GetSeedProvisioning() const noexcept
+  {
+    return SeedProvisioning_;
+  }
+
+  [[nodiscard]] AliasClassMemoryNodeProvisioning &
+  GetProvisioning() noexcept
+  {
+    return *Provisioning_;
+  }
+
+  std::unique_ptr<AliasClassMemoryNodeProvisioning>
+  ReleaseProvisioning() noexcept
+  {
+    return std::move(Provisioning_);
+  }
+
+  /**
+   * Adds \p memoryNodes to the collected memory node sets.
+   *
+   * @return The canonical instance of \p memoryNodes.
+   */
+  const MemoryNodeSet &
+  AddMemoryNodes(MemoryNodeSet memoryNodes)
+  {
+    auto numSets = SeedMemoryNodeSets_.NumSets();
+    auto & canonicalMemoryNodes = SeedMemoryNodeSets_.Intern(std::move(memoryNodes));
+    if (SeedMemoryNodeSets_.NumSets() != numSets)
+      DistinctMemoryNodeSets_.push_back(&canonicalMemoryNodes);
+
+    return canonicalMemoryNodes;
+  }
+
+  /**
+   * Adds \p memoryNodes to the collected memory node sets, and records that a state edge is
+   * encoded for each of its memory nodes.
+   *
+   * @return The canonical instance of \p memoryNodes.
+   */
+  const MemoryNodeSet &
+  AddEncodedMemoryNodes(MemoryNodeSet memoryNodes)
+  {
+    auto & canonicalMemoryNodes = AddMemoryNodes(std::move(memoryNodes));
+    EncodedMemoryNodeSets_.push_back(&canonicalMemoryNodes);
+    return canonicalMemoryNodes;
+  }
+
+  [[nodiscard]] const std::vector<const MemoryNodeSet *> &
+  GetDistinctMemoryNodeSets() const noexcept
+  {
+    return DistinctMemoryNodeSets_;
+  }
+
+  [[nodiscard]] const std::vector<const MemoryNodeSet *> &
+  GetEncodedMemoryNodeSets() const noexcept
+  {
+    return EncodedMemoryNodeSets_;
+  }
+
+  static std::unique_ptr<Context>
+  Create(const MemoryNodeProvisioning & seedProvisioning)
+  {
+    return std::make_unique<Context>(seedProvisioning);
+  }
+
+private:
+  const MemoryNodeProvisioning & SeedProvisioning_;
+  std::unique_ptr<AliasClassMemoryNodeProvisioning> Provisioning_;
+
+  MemoryNodeSetPool SeedMemoryNodeSets_;
+  std::vector<const MemoryNodeSet *> DistinctMemoryNodeSets_;
+  std::vector<const MemoryNodeSet *> EncodedMemoryNodeSets_;
+};
+
+AliasClassMemoryNodeEliminator::~AliasClassMemoryNodeEliminator() noexcept = default;
+
+AliasClassMemoryNodeEliminator::AliasClassMemoryNodeEliminator() = default;
+
+std::unique_ptr<MemoryNodeProvisioning>
+AliasClassMemoryNodeEliminator::EliminateMemoryNodes(
+    const RvsdgModule & rvsdgModule,
+    const MemoryNodeProvisioning & seedProvisioning,
+    util::StatisticsCollector & statisticsCollector)
+{
+  Context_ = Context::Create(seedProvisioning);
+  auto statistics = Statistics::Create(rvsdgModule.SourceFileName());
+
+  statistics->Start();
+  CollectRegion(*rvsdgModule.Rvsdg().root());
+  Partition(*statistics);
+  statistics->Stop();
+
+  statisticsCollector.CollectDemandedStatistics(std::move(statistics));
+
+  auto provisioning = Context_->ReleaseProvisioning();
+  Context_.reset();
+
+  return provisioning;
+}
+
+std::unique_ptr<MemoryNodeProvisioning>
+AliasClassMemoryNodeEliminator::CreateAndEliminate(
+    const RvsdgModule & rvsdgModule,
+    const MemoryNodeProvisioning & seedProvisioning,
+    util::StatisticsCollector & statisticsCollector)
+{
+  AliasClassMemoryNodeEliminator eliminator;
+  return eliminator.EliminateMemoryNodes(rvsdgModule, seedProvisioning, statisticsCollector);
+}
+
+std::unique_ptr<MemoryNodeProvisioning>
+AliasClassMemoryNodeEliminator::CreateAndEliminate(
+    const RvsdgModule & rvsdgModule,
+    const MemoryNodeProvisioning & seedProvisioning)
+{
+  util::StatisticsCollector statisticsCollector;
+  return CreateAndEliminate(rvsdgModule, seedProvisioning, statisticsCollector);
+}
+
+void
+AliasClassMemoryNodeEliminator::CollectRegion(const rvsdg::region & region)
+{
+  for (auto & node : region.nodes)
+  {
+    if (auto structuralNode = dynamic_cast<const rvsdg::structural_node *>(&node))
+    {
+      CollectStructuralNode(*structuralNode);
+    }
+    else if (auto simpleNode = dynamic_cast<const rvsdg::simple_node *>(&node))
+    {
+      CollectSimpleNode(*simpleNode);
+    }
+    else
+    {
+      JLM_UNREACHABLE("Unhandled node type!");
+    }
+  }
+}
+
+void
+AliasClassMemoryNodeEliminator::CollectStructuralNode(
+    const rvsdg::structural_node & structuralNode)
+{
+  if (auto lambdaNode = dynamic_cast<const lambda::node *>(&structuralNode))
+  {
+    CollectLambda(*lambdaNode);
+  }
+  else if (auto gammaNode = dynamic_cast<const rvsdg::gamma_node *>(&structuralNode))
+  {
+    CollectGamma(*gammaNode);
+  }
+  else if (auto thetaNode = dynamic_cast<const rvsdg::theta_node *>(&structuralNode))
+  {
+    CollectTheta(*thetaNode);
+  }
+  else if (auto phiNode = dynamic_cast<const phi::node *>(&structuralNode))
+  {
+    CollectRegion(*phiNode->subregion());
+  }
+  else if (dynamic_cast<const delta::node *>(&structuralNode))
+  {
+    // Nothing needs to be done as the memory state encoder does not encode delta nodes.
+  }
+  else
+  {
+    JLM_UNREACHABLE("Unhandled structural node type!");
+  }
+}
+
+void
+AliasClassMemoryNodeEliminator::CollectSimpleNode(const rvsdg::simple_node & simpleNode)
+{
+  auto & seedProvisioning = Context_->GetSeedProvisioning();
+  auto & pointsToGraph = seedProvisioning.GetPointsToGraph();
+
+  if (auto loadNode = dynamic_cast<const LoadNode *>(&simpleNode))
+  {
+    CollectAddress(*loadNode->GetAddressInput()->origin());
+
+    // The memory state encoder looks up the memory nodes of loaded addresses when replacing the
+    // load node.
+    auto & value = *loadNode->GetValueOutput();
+    if (is<PointerType>(value.type()))
+    {
+      auto & memoryNodes = Context_->AddMemoryNodes(seedProvisioning.GetOutputNodes(value));
+      Context_->GetProvisioning().AddOutputNodes(value, memoryNodes);
+    }
+  }
+  else if (auto storeNode = dynamic_cast<const StoreNode *>(&simpleNode))
+  {
+    CollectAddress(*storeNode->GetAddressInput()->origin());
+  }
+  else if (auto callNode = dynamic_cast<const CallNode *>(&simpleNode))
+  {
+    CollectCall(*callNode);
+  }
+  else if (is<FreeOperation>(&simpleNode))
+  {
+    CollectAddress(*simpleNode.input(0)->origin());
+  }
+  else if (is<Memcpy>(&simpleNode))
+  {
+    CollectAddress(*simpleNode.input(0)->origin());
+    CollectAddress(*simpleNode.input(1)->origin());
+  }
+  else if (is<alloca_op>(&simpleNode))
+  {
+    Context_->AddMemoryNodes({ &pointsToGraph.GetAllocaNode(simpleNode) });
+  }
+  else if (is<malloc_op>(&simpleNode))
+  {
+    Context_->AddMemoryNodes({ &pointsToGraph.GetMallocNode(simpleNode) });
+  }
+}
+
+void
+AliasClassMemoryNodeEliminator::CollectLambda(const lambda::node & lambdaNode)
+{
+  auto & seedProvisioning = Context_->GetSeedProvisioning();
+  auto & provisioning = Context_->GetProvisioning();
+  auto & subregion = *lambdaNode.subregion();
+
+  auto & entryNodes =
+      Context_->AddEncodedMemoryNodes(seedProvisioning.GetLambdaEntryNodes(lambdaNode));
+  auto & exitNodes =
+      Context_->AddEncodedMemoryNodes(seedProvisioning.GetLambdaExitNodes(lambdaNode));
+  provisioning.AddLambdaNodes(lambdaNode, entryNodes, exitNodes);
+
+  auto & regionEntryNodes =
+      Context_->AddMemoryNodes(seedProvisioning.GetRegionEntryNodes(subregion));
+  auto & regionExitNodes = Context_->AddMemoryNodes(seedProvisioning.GetRegionExitNodes(subregion));
+  provisioning.AddRegionNodes(subregion, regionEntryNodes, regionExitNodes);
+
+  CollectRegion(subregion);
+}
+
+void
+AliasClassMemoryNodeEliminator::CollectGamma(const rvsdg::gamma_node & gammaNode)
+{
+  auto & seedProvisioning = Context_->GetSeedProvisioning();
+  auto & provisioning = Context_->GetProvisioning();
+
+  auto & entryNodes =
+      Context_->AddEncodedMemoryNodes(seedProvisioning.GetGammaEntryNodes(gammaNode));
+  auto & exitNodes = Context_->AddEncodedMemoryNodes(seedProvisioning.GetGammaExitNodes(gammaNode));
+  provisioning.AddGammaNodes(gammaNode, entryNodes, exitNodes);
+
+  for (size_t n = 0; n < gammaNode.nsubregions(); n++)
+  {
+    auto & subregion = *gammaNode.subregion(n);
+
+    auto & regionEntryNodes =
+        Context_->AddMemoryNodes(seedProvisioning.GetRegionEntryNodes(subregion));
+    auto & regionExitNodes =
+        Context_->AddMemoryNodes(seedProvisioning.GetRegionExitNodes(subregion));
+    provisioning.AddRegionNodes(subregion, regionEntryNodes, regionExitNodes);
+
+    CollectRegion(subregion);
+  }
+}
+
+void
+AliasClassMemoryNodeEliminator::CollectTheta(const rvsdg::theta_node & thetaNode)
+{
+  auto & seedProvisioning = Context_->GetSeedProvisioning();
+  auto & provisioning = Context_->GetProvisioning();
+  auto & subregion = *thetaNode.subregion();
+
+  auto & entryExitNodes =
+      Context_->AddEncodedMemoryNodes(seedProvisioning.GetThetaEntryExitNodes(thetaNode));
+  provisioning.AddThetaNodes(thetaNode, entryExitNodes);
+
+  auto & regionEntryNodes =
+      Context_->AddMemoryNodes(seedProvisioning.GetRegionEntryNodes(subregion));
+  auto & regionExitNodes = Context_->AddMemoryNodes(seedProvisioning.GetRegionExitNodes(subregion));
+  provisioning.AddRegionNodes(subregion, regionEntryNodes, regionExitNodes);
+
+  CollectRegion(subregion);
+}
+
+void
+AliasClassMemoryNodeEliminator::CollectCall(const CallNode & callNode)
+{
+  auto & seedProvisioning = Context_->GetSeedProvisioning();
+
+  auto & entryNodes = Context_->AddEncodedMemoryNodes(seedProvisioning.GetCallEntryNodes(callNode));
+  auto & exitNodes = Context_->AddEncodedMemoryNodes(seedProvisioning.GetCallExitNodes(callNode));
+  Context_->GetProvisioning().AddCallNodes(callNode, entryNodes, exitNodes);
+}
+
+void
+AliasClassMemoryNodeEliminator::CollectAddress(const rvsdg::output & address)
+{
+  auto & seedProvisioning = Context_->GetSeedProvisioning();
+
+  auto & memoryNodes = Context_->AddEncodedMemoryNodes(seedProvisioning.GetOutputNodes(address));
+  Context_->GetProvisioning().AddOutputNodes(address, memoryNodes);
+}
+
+void
+AliasClassMemoryNodeEliminator::Partition(Statistics & statistics)
+{
+  static constexpr size_t NoClass = std::numeric_limits<size_t>::max();
+
+  auto & pointsToGraph = Context_->GetSeedProvisioning().GetPointsToGraph();
+  auto numMemoryNodes = pointsToGraph.NumMemoryNodeIndices();
+
+  /*
+   * Partition refinement: All memory nodes start out in class zero. Every collected memory node
+   * set then splits each class it partially overlaps into the memory nodes inside and outside of
+   * the set. Afterwards, every collected set is a union of classes. Each set is only visited once,
+   * and the refinement therefore takes time linear in the total size of the sets.
+   */
+  std::vector<size_t> memoryNodeClass(numMemoryNodes, 0);
+  std::vector<size_t> classSize(1, numMemoryNodes);
+  std::vector<size_t> numClassMembersInSet(1, 0);
+  std::vector<size_t> splitClass(1, NoClass);
+  std::vector<size_t> touchedClasses;
+  for (auto memoryNodes : Context_->GetDistinctMemoryNodeSets())
+  {
+    for (auto memoryNode : memoryNodes->Items())
+    {
+      auto memoryNodeClassIndex = memoryNodeClass[memoryNode->GetIndex()];
+      if (numClassMembersInSet[memoryNodeClassIndex]++ == 0)
+        touchedClasses.push_back(memoryNodeClassIndex);
+    }
+
+    for (auto classIndex : touchedClasses)
+    {
+      if (numClassMembersInSet[classIndex] == classSize[classIndex])
+        continue;
+
+      splitClass[classIndex] = classSize.size();
+      classSize.push_back(0);
+      numClassMembersInSet.push_back(0);
+      splitClass.push_back(NoClass);
+    }
+
+    for (auto memoryNode : memoryNodes->Items())
+    {
+      auto & memoryNodeClassIndex = memoryNodeClass[memoryNode->GetIndex()];
+      auto newClassIndex = splitClass[memoryNodeClassIndex];
+      if (newClassIndex == NoClass)
+        continue;
+
+      classSize[memoryNodeClassIndex]--;
+      classSize[newClassIndex]++;
+      memoryNodeClassIndex = newClassIndex;
+    }
+
+    for (auto classIndex : touchedClasses)
+    {
+      numClassMembersInSet[classIndex] = 0;
+      splitClass[classIndex] = NoClass;
+    }
+    touchedClasses.clear();
+  }
+
+  // The memory node with the smallest index of each class is its representative
+  std::vector<bool> isUsed(numMemoryNodes, false);
+  for (auto memoryNodes : Context_->GetDistinctMemoryNodeSets())
+  {
+    for (auto memoryNode : memoryNodes->Items())
+      isUsed[memoryNode->GetIndex()] = true;
+  }
+
+  size_t numUsedMemoryNodes = 0;
+  size_t numAliasClasses = 0;
+  std::vector<const PointsToGraph::MemoryNode *> representatives(classSize.size(), nullptr);
+  for (size_t n = 0; n < numMemoryNodes; n++)
+  {
+    if (!isUsed[n])
+      continue;
+
+    numUsedMemoryNodes++;
+    auto & representative = representatives[memoryNodeClass[n]];
+    if (representative == nullptr)
+    {
+      representative = &pointsToGraph.GetMemoryNode(n);
+      numAliasClasses++;
+    }
+  }
+
+  auto & provisioning = Context_->GetProvisioning();
+  std::unordered_map<const MemoryNodeSet *, const MemoryNodeSet *> replacements;
+  for (auto memoryNodes : Context_->GetDistinctMemoryNodeSets())
+  {
+    MemoryNodeSet representativeMemoryNodes;
+    for (auto memoryNode : memoryNodes->Items())
+      representativeMemoryNodes.Insert(representatives[memoryNodeClass[memoryNode->GetIndex()]]);
+
+    replacements[memoryNodes] =
+        &provisioning.GetMemoryNodeSets().Intern(std::move(representativeMemoryNodes));
+  }
+
+  provisioning.ReplaceMemoryNodeSets(
+      [&](const MemoryNodeSet & memoryNodes) -> const MemoryNodeSet &
+      {
+        JLM_ASSERT(replacements.find(&memoryNodes) != replacements.end());
+        return *replacements[&memoryNodes];
+      });
+
+  size_t numStateEdgesBefore = 0;
+  size_t numStateEdgesAfter = 0;
+  for (auto memoryNodes : Context_->GetEncodedMemoryNodeSets())
+  {
+    numStateEdgesBefore += memoryNodes->Size();
+    numStateEdgesAfter += replacements[memoryNodes]->Size();
+  }
+
+  statistics.AddAliasClassStatistics(numUsedMemoryNodes, numAliasClasses);
+  statistics.AddStateEdgeStatistics(numStateEdgesBefore, numStateEdgesAfter);
+}
+
+}
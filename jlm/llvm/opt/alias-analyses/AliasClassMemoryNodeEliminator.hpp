@@ -0,0 +1,237 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_LLVM_OPT_ALIAS_ANALYSES_ALIASCLASSMEMORYNODEELIMINATOR_HPP
+#define JLM_LLVM_OPT_ALIAS_ANALYSES_ALIASCLASSMEMORYNODEELIMINATOR_HPP
+
+#include <jlm/llvm/opt/alias-analyses/MemoryNodeEliminator.hpp>
+#include <jlm/llvm/opt/alias-analyses/MemoryNodeProvisioning.hpp>
+#include <jlm/util/Statistics.hpp>
+#include <jlm/util/time.hpp>
+
+namespace jlm::llvm::aa
+{
+
+/** \brief Alias class memory node eliminator
+ *
+ * Partitions the memory nodes of a seed provisioning into alias classes and replaces every memory
+ * node by the representative of its class. Two memory nodes belong to the same alias class if each
+ * memory node set that the MemoryStateEncoder requests from the provisioning either contains both
+ * or none of them, i.e., if they are provisioned for exactly the same lambda, gamma, and theta
+ * nodes, calls, and memory operations. The state edges of such memory nodes would be routed in
+ * parallel through the same nodes, and it suffices to route a single state edge per alias class.
+ * This reduces the number of state edges, loop variables, and split and merge nodes without
+ * sequentializing any memory operations that were independent before.
+ *
+ * The memory nodes of alloca and malloc nodes always form their own alias class, as the
+ * MemoryStateEncoder replaces their state edge at the allocation.
+ *
+ * @see EliminatedMemoryNodeProvider
+ * @see MemoryStateEncoder
+ */
+class AliasClassMemoryNodeEliminator final : public MemoryNodeEliminator
+{
+public:
+  class Statistics;
+
+  ~AliasClassMemoryNodeEliminator() noexcept override;
+
+  AliasClassMemoryNodeEliminator();
+
+  AliasClassMemoryNodeEliminator(const AliasClassMemoryNodeEliminator &) = delete;
+
+  AliasClassMemoryNodeEliminator(AliasClassMemoryNodeEliminator &&) = delete;
+
+  AliasClassMemoryNodeEliminator &
+  operator=(const AliasClassMemoryNodeEliminator &) = delete;
+
+  AliasClassMemoryNodeEliminator &
+  operator=(AliasClassMemoryNodeEliminator &&) = delete;
+
+  std::unique_ptr<MemoryNodeProvisioning>
+  EliminateMemoryNodes(
+      const RvsdgModule & rvsdgModule,
+      const MemoryNodeProvisioning & seedProvisioning,
+      util::StatisticsCollector & statisticsCollector) override;
+
+  /**
+   * Creates an AliasClassMemoryNodeEliminator and calls the EliminateMemoryNodes() method.
+   *
+   * @param rvsdgModule The RVSDG module from which \p seedProvisioning was computed from.
+   * @param seedProvisioning A provisioning whose memory nodes are partitioned into alias classes.
+   * @param statisticsCollector The statistics collector for collecting pass statistics.
+   *
+   * @return A new instance of MemoryNodeProvisioning. It does not refer to \p seedProvisioning,
+   * but to the points-to graph of \p seedProvisioning.
+   */
+  static std::unique_ptr<MemoryNodeProvisioning>
+  CreateAndEliminate(
+      const RvsdgModule & rvsdgModule,
+      const MemoryNodeProvisioning & seedProvisioning,
+      util::StatisticsCollector & statisticsCollector);
+
+  /**
+   * Creates an AliasClassMemoryNodeEliminator and calls the EliminateMemoryNodes() method.
+   *
+   * @param rvsdgModule The RVSDG module from which \p seedProvisioning was computed from.
+   * @param seedProvisioning A provisioning whose memory nodes are partitioned into alias classes.
+   *
+   * @return A new instance of MemoryNodeProvisioning.
+   */
+  static std::unique_ptr<MemoryNodeProvisioning>
+  CreateAndEliminate(
+      const RvsdgModule & rvsdgModule,
+      const MemoryNodeProvisioning & seedProvisioning);
+
+private:
+  class Context;
+
+  void
+  CollectRegion(const rvsdg::region & region);
+
+  void
+  CollectStructuralNode(const rvsdg::structural_node & structuralNode);
+
+  void
+  CollectSimpleNode(const rvsdg::simple_node & simpleNode);
+
+  void
+  CollectLambda(const lambda::node & lambdaNode);
+
+  void
+  CollectGamma(const rvsdg::gamma_node & gammaNode);
+
+  void
+  CollectTheta(const rvsdg::theta_node & thetaNode);
+
+  void
+  CollectCall(const CallNode & callNode);
+
+  /**
+   * Collects the memory nodes of \p address, which is the address operand of a memory operation.
+   */
+  void
+  CollectAddress(const rvsdg::output & address);
+
+  /**
+   * Partitions the memory nodes of all collected memory node sets into alias classes, and
+   * replaces the memory node sets of the provisioning with the representatives of their classes.
+   */
+  void
+  Partition(Statistics & statistics);
+
+  std::unique_ptr<Context> Context_;
+};
+
+/** \brief Alias class memory node eliminator statistics
+ *
+ * The number of state edges is the sum of the sizes of all memory node sets that are encoded by
+ * the MemoryStateEncoder at lambda, gamma, and theta nodes, calls, and memory operations. Every
+ * memory node of such a set results in a state edge that is routed through the respective node.
+ */
+class AliasClassMemoryNodeEliminator::Statistics final : public util::Statistics
+{
+public:
+  ~Statistics() override = default;
+
+  explicit Statistics(util::filepath sourceFile)
+      : util::Statistics(Statistics::Id::MemoryNodeElimination),
+        SourceFile_(std::move(sourceFile))
+  {}
+
+  /**
+   * @return The number of memory nodes that are provisioned by the seed provisioning.
+   */
+  [[nodiscard]] size_t
+  NumMemoryNodes() const noexcept
+  {
+    return NumMemoryNodes_;
+  }
+
+  [[nodiscard]] size_t
+  NumAliasClasses() const noexcept
+  {
+    return NumAliasClasses_;
+  }
+
+  [[nodiscard]] size_t
+  NumStateEdgesBefore() const noexcept
+  {
+    return NumStateEdgesBefore_;
+  }
+
+  [[nodiscard]] size_t
+  NumStateEdgesAfter() const noexcept
+  {
+    return NumStateEdgesAfter_;
+  }
+
+  void
+  Start() noexcept
+  {
+    Timer_.start();
+  }
+
+  void
+  Stop() noexcept
+  {
+    Timer_.stop();
+  }
+
+  void
+  AddAliasClassStatistics(size_t numMemoryNodes, size_t numAliasClasses) noexcept
+  {
+    NumMemoryNodes_ = numMemoryNodes;
+    NumAliasClasses_ = numAliasClasses;
+  }
+
+  void
+  AddStateEdgeStatistics(size_t numStateEdgesBefore, size_t numStateEdgesAfter) noexcept
+  {
+    NumStateEdgesBefore_ = numStateEdgesBefore;
+    NumStateEdgesAfter_ = numStateEdgesAfter;
+  }
+
+  [[nodiscard]] std::string
+  ToString() const override
+  {
+    return util::strfmt(
+        "AliasClassMemoryNodeElimination ",
+        SourceFile_.to_str(),
+        " ",
+        "#MemoryNodes:",
+        NumMemoryNodes_,
+        " ",
+        "#AliasClasses:",
+        NumAliasClasses_,
+        " ",
+        "#StateEdgesBefore:",
+        NumStateEdgesBefore_,
+        " ",
+        "#StateEdgesAfter:",
+        NumStateEdgesAfter_,
+        " ",
+        "Time[ns]:",
+        Timer_.ns());
+  }
+
+  static std::unique_ptr<Statistics>
+  Create(const util::filepath & sourceFile)
+  {
+    return std::make_unique<Statistics>(sourceFile);
+  }
+
+private:
+  size_t NumMemoryNodes_ = 0;
+  size_t NumAliasClasses_ = 0;
+  size_t NumStateEdgesBefore_ = 0;
+  size_t NumStateEdgesAfter_ = 0;
+  util::timer Timer_;
+  util::filepath SourceFile_;
+};
+
+}
+
+#endif // JLM_LLVM_OPT_ALIAS_ANALYSES_ALIASCLASSMEMORYNODEELIMINATOR_HPP
@@ -5,13 +5,208 @@
 
 #include <jlm/llvm/opt/alias-analyses/Andersen.hpp>
 #include <jlm/llvm/opt/alias-analyses/PointsToGraph.hpp>
+#include <jlm/llvm/opt/alias-analyses/PointsToQuery.hpp>
 #include <jlm/rvsdg/node.hpp>
 #include <jlm/rvsdg/traverser.hpp>
 #include <jlm/util/Statistics.hpp>
+#include <jlm/util/time.hpp>
 
 namespace jlm::llvm::aa
 {
 
+/**
+ * Collects statistics about the constraint building and solving of the Andersen analysis.
+ */
+class Andersen::Statistics final : public util::Statistics
+{
+public:
+  ~Statistics() override = default;
+
+  explicit Statistics(util::filepath sourceFile)
+      : util::Statistics(Statistics::Id::AndersenAnalysis),
+        SourceFile_(std::move(sourceFile)),
+        NumRvsdgNodes_(0),
+        NumPointerObjects_(0),
+        NumConstraints_(0),
+        Solver_(Solver::Worklist),
+        NumSolverIterations_(0),
+        NumCycleDetections_(0),
+        NumUnifications_(0)
+  {}
+
+  void
+  StartConstraintBuildingStatistics(const rvsdg::graph & graph) noexcept
+  {
+    NumRvsdgNodes_ = rvsdg::nnodes(graph.root());
+    ConstraintBuildingTimer_.start();
+  }
+
+  void
+  StopConstraintBuildingStatistics(
+      const PointerObjectSet & set,
+      const PointerObjectConstraintSet & constraints) noexcept
+  {
+    ConstraintBuildingTimer_.stop();
+    NumPointerObjects_ = set.NumPointerObjects();
+    NumConstraints_ = constraints.NumConstraints();
+  }
+
+  void
+  StartConstraintSolvingStatistics(Solver solver) noexcept
+  {
+    Solver_ = solver;
+    ConstraintSolvingTimer_.start();
+  }
+
+  void
+  StopConstraintSolvingNaiveStatistics(size_t numIterations) noexcept
+  {
+    ConstraintSolvingTimer_.stop();
+    NumSolverIterations_ = numIterations;
+  }
+
+  void
+  StopConstraintSolvingWorklistStatistics(
+      const PointerObjectConstraintSet::WorklistStatistics & statistics) noexcept
+  {
+    ConstraintSolvingTimer_.stop();
+    NumSolverIterations_ = statistics.NumWorklistIterations;
+    NumCycleDetections_ = statistics.NumCycleDetections;
+    NumUnifications_ = statistics.NumUnifications;
+  }
+
+  void
+  StartPointsToGraphConstructionStatistics() noexcept
+  {
+    PointsToGraphConstructionTimer_.start();
+  }
+
+  void
+  StopPointsToGraphConstructionStatistics() noexcept
+  {
+    PointsToGraphConstructionTimer_.stop();
+  }
+
+  [[nodiscard]] std::string
+  ToString() const override
+  {
+    return util::strfmt(
+        "AndersenAnalysis ",
+        SourceFile_.to_str(),
+        " ",
+        "#RvsdgNodes:",
+        NumRvsdgNodes_,
+        " ",
+        "ConstraintBuildingTime[ns]:",
+        ConstraintBuildingTimer_.ns(),
+        " ",
+        "#PointerObjects:",
+        NumPointerObjects_,
+        " ",
+        "#Constraints:",
+        NumConstraints_,
+        " ",
+        "Solver:",
+        Solver_ == Solver::Naive ? "Naive" : "Worklist",
+        " ",
+        "#SolverIterations:",
+        NumSolverIterations_,
+        " ",
+        "#CycleDetections:",
+        NumCycleDetections_,
+        " ",
+        "#UnifiedPointerObjects:",
+        NumUnifications_,
+        " ",
+        "ConstraintSolvingTime[ns]:",
+        ConstraintSolvingTimer_.ns(),
+        " ",
+        "PointsToGraphConstructionTime[ns]:",
+        PointsToGraphConstructionTimer_.ns());
+  }
+
+  static std::unique_ptr<Statistics>
+  Create(const util::filepath & sourceFile)
+  {
+    return std::make_unique<Statistics>(sourceFile);
+  }
+
+private:
+  util::filepath SourceFile_;
+  size_t NumRvsdgNodes_;
+  size_t NumPointerObjects_;
+  size_t NumConstraints_;
+
+  Solver Solver_;
+  size_t NumSolverIterations_;
+  size_t NumCycleDetections_;
+  size_t NumUnifications_;
+
+  util::timer ConstraintBuildingTimer_;
+  util::timer ConstraintSolvingTimer_;
+  util::timer PointsToGraphConstructionTimer_;
+};
+
+/** \brief Demand-driven points-to queries of Andersen's analysis
+ *
+ * Owns the solved PointerObjectSet and a points-to graph that only contains memory nodes. The
+ * points-to set of a register is computed from the points-to set of its PointerObject.
+ */
+class AndersenPointsToQuery final : public PointsToQuery
+{
+public:
+  AndersenPointsToQuery(
+      std::unique_ptr<PointerObjectSet> set,
+      std::unique_ptr<PointsToGraph> pointsToGraph,
+      std::vector<PointsToGraph::MemoryNode *> memoryNodes)
+      : Set_(std::move(set)),
+        PointsToGraph_(std::move(pointsToGraph)),
+        MemoryNodes_(std::move(memoryNodes))
+  {
+    EscapedMemoryNodes_.UnionWith(PointsToGraph_->GetEscapedMemoryNodes());
+  }
+
+  [[nodiscard]] const PointsToGraph &
+  GetPointsToGraph() const noexcept override
+  {
+    return *PointsToGraph_;
+  }
+
+protected:
+  [[nodiscard]] MemoryNodeSet
+  ComputeOutputNodes(const rvsdg::output & output) const override
+  {
+    auto & registerMap = Set_->GetRegisterMap();
+    auto it = registerMap.find(&output);
+    if (it == registerMap.end())
+      throw util::error("Cannot find register in pointer object set.");
+
+    auto registerIdx = it->second;
+
+    MemoryNodeSet memoryNodes;
+    for (const auto targetIdx : Set_->GetPointsToSet(registerIdx).Items())
+    {
+      // Only PointerObjects corresponding to memory nodes can be members of points-to sets
+      JLM_ASSERT(MemoryNodes_[targetIdx]);
+      memoryNodes.Insert(MemoryNodes_[targetIdx]);
+    }
+
+    if (Set_->GetPointerObject(registerIdx).PointsToExternal())
+    {
+      memoryNodes.UnionWith(EscapedMemoryNodes_);
+      memoryNodes.Insert(&PointsToGraph_->GetExternalMemoryNode());
+    }
+
+    return memoryNodes;
+  }
+
+private:
+  std::unique_ptr<PointerObjectSet> Set_;
+  std::unique_ptr<PointsToGraph> PointsToGraph_;
+  std::vector<PointsToGraph::MemoryNode *> MemoryNodes_;
+  MemoryNodeSet EscapedMemoryNodes_;
+};
+
 void
 Andersen::AnalyzeSimpleNode(const rvsdg::simple_node & node)
 {
@@ -575,24 +770,72 @@ Andersen::AnalyzeRvsdg(const rvsdg::graph & graph)
   }
 }
 
-std::unique_ptr<PointsToGraph>
-Andersen::Analyze(const RvsdgModule & module, util::StatisticsCollector & statisticsCollector)
+void
+Andersen::SolveConstraints(const RvsdgModule & module, Statistics & statistics)
 {
   Set_ = std::make_unique<PointerObjectSet>();
   Constraints_ = std::make_unique<PointerObjectConstraintSet>(*Set_);
 
+  statistics.StartConstraintBuildingStatistics(module.Rvsdg());
   AnalyzeRvsdg(module.Rvsdg());
+  statistics.StopConstraintBuildingStatistics(*Set_, *Constraints_);
+
+  statistics.StartConstraintSolvingStatistics(Solver_);
+  if (Solver_ == Solver::Naive)
+  {
+    auto numIterations = Constraints_->SolveNaively();
+    statistics.StopConstraintSolvingNaiveStatistics(numIterations);
+  }
+  else
+  {
+    auto solverStatistics = Constraints_->SolveUsingWorklist();
+    statistics.StopConstraintSolvingWorklistStatistics(solverStatistics);
+  }
+}
+
+std::unique_ptr<PointsToGraph>
+Andersen::Analyze(const RvsdgModule & module, util::StatisticsCollector & statisticsCollector)
+{
+  auto statistics = Statistics::Create(module.SourceFileName());
 
-  Constraints_->Solve();
+  SolveConstraints(module, *statistics);
 
+  statistics->StartPointsToGraphConstructionStatistics();
   auto result = ConstructPointsToGraphFromPointerObjectSet(*Set_);
+  statistics->StopPointsToGraphConstructionStatistics();
 
   Constraints_.reset();
   Set_.reset();
 
+  statisticsCollector.CollectDemandedStatistics(std::move(statistics));
+
   return result;
 }
 
+std::unique_ptr<PointsToQuery>
+Andersen::AnalyzeOnDemand(const RvsdgModule & module, util::StatisticsCollector & statisticsCollector)
+{
+  auto statistics = Statistics::Create(module.SourceFileName());
+
+  SolveConstraints(module, *statistics);
+
+  // Only create the memory nodes of the points-to graph
+  statistics->StartPointsToGraphConstructionStatistics();
+  auto pointsToGraph = PointsToGraph::Create();
+  auto memoryNodes = CreatePointsToGraphMemoryNodes(*Set_, *pointsToGraph);
+  statistics->StopPointsToGraphConstructionStatistics();
+
+  Constraints_.reset();
+
+  statisticsCollector.CollectDemandedStatistics(std::move(statistics));
+
+  // The query takes over the solved pointer object set
+  return std::make_unique<AndersenPointsToQuery>(
+      std::move(Set_),
+      std::move(pointsToGraph),
+      std::move(memoryNodes));
+}
+
 std::unique_ptr<PointsToGraph>
 Andersen::Analyze(const RvsdgModule & module)
 {
@@ -607,7 +850,7 @@ Andersen::ConstructPointsToGraphFromPointerObjectSet(const PointerObjectSet & se
 
   // memory nodes are the nodes that can be pointed to in the points-to graph.
   // This vector has the same indexing as the nodes themselves, register nodes become nullptr.
-  std::vector<PointsToGraph::MemoryNode *> memoryNodes(set.NumPointerObjects());
+  auto memoryNodes = CreatePointsToGraphMemoryNodes(set, *pointsToGraph);
 
   // Nodes that should point to external in the final graph.
   // They also get explicit edges connecting them to all escaped memory nodes.
@@ -615,32 +858,10 @@ Andersen::ConstructPointsToGraphFromPointerObjectSet(const PointerObjectSet & se
 
   // A list of all memory nodes that have been marked as escaped
   std::vector<PointsToGraph::MemoryNode *> escapedMemoryNodes;
-
-  // First all memory nodes are created
-  for (auto [allocaNode, pointerObjectIndex] : set.GetAllocaMap())
-  {
-    auto & node = PointsToGraph::AllocaNode::Create(*pointsToGraph, *allocaNode);
-    memoryNodes[pointerObjectIndex] = &node;
-  }
-  for (auto [mallocNode, pointerObjectIndex] : set.GetMallocMap())
-  {
-    auto & node = PointsToGraph::MallocNode::Create(*pointsToGraph, *mallocNode);
-    memoryNodes[pointerObjectIndex] = &node;
-  }
-  for (auto [deltaNode, pointerObjectIndex] : set.GetGlobalMap())
-  {
-    auto & node = PointsToGraph::DeltaNode::Create(*pointsToGraph, *deltaNode);
-    memoryNodes[pointerObjectIndex] = &node;
-  }
-  for (auto [lambdaNode, pointerObjectIndex] : set.GetFunctionMap())
-  {
-    auto & node = PointsToGraph::LambdaNode::Create(*pointsToGraph, *lambdaNode);
-    memoryNodes[pointerObjectIndex] = &node;
-  }
-  for (auto [argument, pointerObjectIndex] : set.GetImportMap())
+  for (PointerObject::Index idx = 0; idx < set.NumPointerObjects(); idx++)
   {
-    auto & node = PointsToGraph::ImportNode::Create(*pointsToGraph, *argument);
-    memoryNodes[pointerObjectIndex] = &node;
+    if (memoryNodes[idx] && set.GetPointerObject(idx).HasEscaped())
+      escapedMemoryNodes.push_back(memoryNodes[idx]);
   }
 
   // Helper function for attaching PointsToGraph nodes to their pointees, based on the
@@ -668,19 +889,12 @@ Andersen::ConstructPointsToGraphFromPointerObjectSet(const PointerObjectSet & se
   }
 
   // Now add all edges from memory node to memory node.
-  // Also checks and informs the PointsToGraph which memory nodes are marked as escaping the module
   for (PointerObject::Index idx = 0; idx < set.NumPointerObjects(); idx++)
   {
     if (memoryNodes[idx] == nullptr)
       continue; // Skip all nodes that are not MemoryNodes
 
     applyPointsToSet(*memoryNodes[idx], idx);
-
-    if (set.GetPointerObject(idx).HasEscaped())
-    {
-      memoryNodes[idx]->MarkAsModuleEscaping();
-      escapedMemoryNodes.push_back(memoryNodes[idx]);
-    }
   }
 
   // Finally make all nodes marked as pointing to external, point to all escaped memory nodes in the
@@ -698,4 +912,45 @@ Andersen::ConstructPointsToGraphFromPointerObjectSet(const PointerObjectSet & se
   return pointsToGraph;
 }
 
+std::vector<PointsToGraph::MemoryNode *>
+Andersen::CreatePointsToGraphMemoryNodes(const PointerObjectSet & set, PointsToGraph & pointsToGraph)
+{
+  std::vector<PointsToGraph::MemoryNode *> memoryNodes(set.NumPointerObjects());
+
+  for (auto [allocaNode, pointerObjectIndex] : set.GetAllocaMap())
+  {
+    auto & node = PointsToGraph::AllocaNode::Create(pointsToGraph, *allocaNode);
+    memoryNodes[pointerObjectIndex] = &node;
+  }
+  for (auto [mallocNode, pointerObjectIndex] : set.GetMallocMap())
+  {
+    auto & node = PointsToGraph::MallocNode::Create(pointsToGraph, *mallocNode);
+    memoryNodes[pointerObjectIndex] = &node;
+  }
+  for (auto [deltaNode, pointerObjectIndex] : set.GetGlobalMap())
+  {
+    auto & node = PointsToGraph::DeltaNode::Create(pointsToGraph, *deltaNode);
+    memoryNodes[pointerObjectIndex] = &node;
+  }
+  for (auto [lambdaNode, pointerObjectIndex] : set.GetFunctionMap())
+  {
+    auto & node = PointsToGraph::LambdaNode::Create(pointsToGraph, *lambdaNode);
+    memoryNodes[pointerObjectIndex] = &node;
+  }
+  for (auto [argument, pointerObjectIndex] : set.GetImportMap())
+  {
+    auto & node = PointsToGraph::ImportNode::Create(pointsToGraph, *argument);
+    memoryNodes[pointerObjectIndex] = &node;
+  }
+
+  // Inform the PointsToGraph which memory nodes are marked as escaping the module
+  for (PointerObject::Index idx = 0; idx < set.NumPointerObjects(); idx++)
+  {
+    if (memoryNodes[idx] && set.GetPointerObject(idx).HasEscaped())
+      memoryNodes[idx]->MarkAsModuleEscaping();
+  }
+
+  return memoryNodes;
+}
+
 }
@@ -10,6 +10,7 @@
 #include <jlm/llvm/ir/RvsdgModule.hpp>
 #include <jlm/llvm/opt/alias-analyses/AliasAnalysis.hpp>
 #include <jlm/llvm/opt/alias-analyses/PointerObjectSet.hpp>
+#include <jlm/llvm/opt/alias-analyses/PointsToGraph.hpp>
 
 namespace jlm::llvm::aa
 {
@@ -25,6 +26,17 @@ class Andersen final : public AliasAnalysis
   class Statistics;
 
 public:
+  /**
+   * The algorithms available for solving the constraint set.
+   */
+  enum class Solver
+  {
+    // Applies all constraints repeatedly until a fixed point is reached
+    Naive,
+    // Propagates new pointees using a worklist, collapsing cycles of subset edges
+    Worklist
+  };
+
   Andersen() = default;
 
   ~Andersen() noexcept override = default;
@@ -57,6 +69,20 @@ public:
   std::unique_ptr<PointsToGraph>
   Analyze(const RvsdgModule & module);
 
+  /**
+   * Performs Andersen's alias analysis on the rvsdg \p module, producing demand-driven points-to
+   * queries. Only the memory nodes of the points-to graph are created. The solved PointerObjectSet
+   * is kept alive by the returned query, and the points-to set of a register is computed from it
+   * on demand. The result of a query is identical to the targets of the register's node in the
+   * PointsToGraph produced by Analyze().
+   * @param module the module to analyze
+   * @param statisticsCollector the collector that will receive pass statistics
+   * @return A PointsToQuery for the module
+   */
+  std::unique_ptr<PointsToQuery>
+  AnalyzeOnDemand(const RvsdgModule & module, util::StatisticsCollector & statisticsCollector)
+      override;
+
   /**
    * Converts a PointerObjectSet into PointsToGraph nodes,
    * and points-to-graph set memberships into edges.
@@ -73,7 +99,42 @@ public:
   static std::unique_ptr<PointsToGraph>
   ConstructPointsToGraphFromPointerObjectSet(const PointerObjectSet & set);
 
+  /**
+   * @return the solver used for the constraint set by subsequent calls to Analyze
+   */
+  [[nodiscard]] Solver
+  GetSolver() const noexcept
+  {
+    return Solver_;
+  }
+
+  /**
+   * Sets the solver used for the constraint set by subsequent calls to Analyze.
+   * Both solvers produce identical PointsToGraphs.
+   * @param solver the solver to use
+   */
+  void
+  SetSolver(Solver solver) noexcept
+  {
+    Solver_ = solver;
+  }
+
 private:
+  /**
+   * Builds and solves the constraint set of \p module.
+   */
+  void
+  SolveConstraints(const RvsdgModule & module, Statistics & statistics);
+
+  /**
+   * Creates a PointsToGraph memory node for every memory PointerObject of \p set, and marks the
+   * memory nodes of escaped PointerObjects as escaping the module.
+   *
+   * @return The memory nodes, indexed by their PointerObject. Register PointerObjects are nullptr.
+   */
+  static std::vector<PointsToGraph::MemoryNode *>
+  CreatePointsToGraphMemoryNodes(const PointerObjectSet & set, PointsToGraph & pointsToGraph);
+
   void
   AnalyzeRegion(rvsdg::region & region);
 
@@ -146,6 +207,8 @@ private:
   void
   AnalyzeRvsdg(const rvsdg::graph & graph);
 
+  Solver Solver_ = Solver::Worklist;
+
   std::unique_ptr<PointerObjectSet> Set_;
   std::unique_ptr<PointerObjectConstraintSet> Constraints_;
 };
@@ -9,6 +9,9 @@
 #include <jlm/llvm/opt/alias-analyses/MemoryNodeEliminator.hpp>
 #include <jlm/llvm/opt/alias-analyses/MemoryNodeProvider.hpp>
 
+#include <type_traits>
+#include <utility>
+
 namespace jlm::llvm::aa
 {
 
@@ -38,6 +41,17 @@ public:
 
   EliminatedMemoryNodeProvider() = default;
 
+  /**
+   * Constructs the combined provider, where \p providerArguments are passed on to the
+   * constructor of \p Provider, e.g., the number of threads of a RegionAwareMemoryNodeProvider.
+   */
+  template<
+      typename... ProviderArguments,
+      typename = std::enable_if_t<std::is_constructible_v<Provider, ProviderArguments...>>>
+  explicit EliminatedMemoryNodeProvider(ProviderArguments &&... providerArguments)
+      : Provider_(std::forward<ProviderArguments>(providerArguments)...)
+  {}
+
   EliminatedMemoryNodeProvider(const EliminatedMemoryNodeProvider &) = delete;
 
   EliminatedMemoryNodeProvider(EliminatedMemoryNodeProvider &&) = delete;
@@ -59,6 +73,55 @@ public:
     return Eliminator_.EliminateMemoryNodes(rvsdgModule, *seedProvisioning, statisticsCollector);
   }
 
+  std::unique_ptr<MemoryNodeProvisioning>
+  ProvisionMemoryNodes(
+      const RvsdgModule & rvsdgModule,
+      const PointsToQuery & pointsToQuery,
+      util::StatisticsCollector & statisticsCollector) override
+  {
+    auto seedProvisioning =
+        Provider_.ProvisionMemoryNodes(rvsdgModule, pointsToQuery, statisticsCollector);
+    return Eliminator_.EliminateMemoryNodes(rvsdgModule, *seedProvisioning, statisticsCollector);
+  }
+
+  /**
+   * Creates an EliminatedMemoryNodeProvider and calls the ProvisionMemoryNodes() method.
+   *
+   * @param rvsdgModule The RVSDG module on which the provision should be performed.
+   * @param pointsToGraph The PointsToGraph corresponding to the RVSDG module.
+   * @param statisticsCollector The statistics collector for collecting pass statistics.
+   *
+   * @return A new instance of MemoryNodeProvisioning.
+   */
+  static std::unique_ptr<MemoryNodeProvisioning>
+  Create(
+      const RvsdgModule & rvsdgModule,
+      const PointsToGraph & pointsToGraph,
+      util::StatisticsCollector & statisticsCollector)
+  {
+    EliminatedMemoryNodeProvider provider;
+    return provider.ProvisionMemoryNodes(rvsdgModule, pointsToGraph, statisticsCollector);
+  }
+
+  /**
+   * Creates an EliminatedMemoryNodeProvider and calls the ProvisionMemoryNodes() method.
+   *
+   * @param rvsdgModule The RVSDG module on which the provision should be performed.
+   * @param pointsToQuery The points-to queries corresponding to the RVSDG module.
+   * @param statisticsCollector The statistics collector for collecting pass statistics.
+   *
+   * @return A new instance of MemoryNodeProvisioning.
+   */
+  static std::unique_ptr<MemoryNodeProvisioning>
+  Create(
+      const RvsdgModule & rvsdgModule,
+      const PointsToQuery & pointsToQuery,
+      util::StatisticsCollector & statisticsCollector)
+  {
+    EliminatedMemoryNodeProvider provider;
+    return provider.ProvisionMemoryNodes(rvsdgModule, pointsToQuery, statisticsCollector);
+  }
+
 private:
   Provider Provider_;
   Eliminator Eliminator_;
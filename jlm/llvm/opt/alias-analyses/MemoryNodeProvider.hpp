@@ -8,6 +8,7 @@
 
 #include <jlm/llvm/opt/alias-analyses/MemoryNodeProvisioning.hpp>
 #include <jlm/llvm/opt/alias-analyses/PointsToGraph.hpp>
+#include <jlm/llvm/opt/alias-analyses/PointsToQuery.hpp>
 
 namespace jlm::util
 {
@@ -37,6 +38,24 @@ public:
       const RvsdgModule & rvsdgModule,
       const PointsToGraph & pointsToGraph,
       jlm::util::StatisticsCollector & statisticsCollector) = 0;
+
+  /**
+   * Computes the memory nodes that are required at the entry and exit of of a region as well as
+   * call node. In contrast to the overload above, the points-to sets of the registers are
+   * requested on demand from \p pointsToQuery.
+   *
+   * @param rvsdgModule The RVSDG module on which the memory node provision should be performed.
+   * @param pointsToQuery The points-to queries corresponding to \p rvsdgModule. They must outlive
+   * the returned MemoryNodeProvisioning.
+   * @param statisticsCollector The statistics collector for collecting pass statistics.
+   *
+   * @return An instance of MemoryNodeProvisioning.
+   */
+  virtual std::unique_ptr<MemoryNodeProvisioning>
+  ProvisionMemoryNodes(
+      const RvsdgModule & rvsdgModule,
+      const PointsToQuery & pointsToQuery,
+      jlm::util::StatisticsCollector & statisticsCollector) = 0;
 };
 
 }
@@ -6,8 +6,8 @@
 #ifndef JLM_LLVM_OPT_ALIAS_ANALYSES_MEMORYNODEPROVISIONING_HPP
 #define JLM_LLVM_OPT_ALIAS_ANALYSES_MEMORYNODEPROVISIONING_HPP
 
+#include <jlm/llvm/opt/alias-analyses/MemoryNodeSet.hpp>
 #include <jlm/llvm/opt/alias-analyses/PointsToGraph.hpp>
-#include <jlm/util/HashSet.hpp>
 
 #include <vector>
 
@@ -17,7 +17,8 @@ namespace jlm::llvm::aa
 /** \brief Memory Node Provisioning
  *
  * Contains the memory nodes that are required at the entry and exit of a region, and for call
- * nodes.
+ * nodes. The memory nodes are represented as MemoryNodeSet, i.e., as bit sets over the dense memory
+ * node indices of the points-to graph.
  */
 class MemoryNodeProvisioning
 {
@@ -27,34 +28,34 @@ public:
   [[nodiscard]] virtual const PointsToGraph &
   GetPointsToGraph() const noexcept = 0;
 
-  [[nodiscard]] virtual const jlm::util::HashSet<const PointsToGraph::MemoryNode *> &
+  [[nodiscard]] virtual const MemoryNodeSet &
   GetRegionEntryNodes(const jlm::rvsdg::region & region) const = 0;
 
-  [[nodiscard]] virtual const jlm::util::HashSet<const PointsToGraph::MemoryNode *> &
+  [[nodiscard]] virtual const MemoryNodeSet &
   GetRegionExitNodes(const jlm::rvsdg::region & region) const = 0;
 
-  [[nodiscard]] virtual const jlm::util::HashSet<const PointsToGraph::MemoryNode *> &
+  [[nodiscard]] virtual const MemoryNodeSet &
   GetCallEntryNodes(const CallNode & callNode) const = 0;
 
-  [[nodiscard]] virtual const jlm::util::HashSet<const PointsToGraph::MemoryNode *> &
+  [[nodiscard]] virtual const MemoryNodeSet &
   GetCallExitNodes(const CallNode & callNode) const = 0;
 
-  [[nodiscard]] virtual jlm::util::HashSet<const PointsToGraph::MemoryNode *>
+  [[nodiscard]] virtual MemoryNodeSet
   GetOutputNodes(const jlm::rvsdg::output & output) const = 0;
 
-  [[nodiscard]] virtual const jlm::util::HashSet<const PointsToGraph::MemoryNode *> &
+  [[nodiscard]] virtual const MemoryNodeSet &
   GetLambdaEntryNodes(const lambda::node & lambdaNode) const
   {
     return GetRegionEntryNodes(*lambdaNode.subregion());
   }
 
-  [[nodiscard]] virtual const jlm::util::HashSet<const PointsToGraph::MemoryNode *> &
+  [[nodiscard]] virtual const MemoryNodeSet &
   GetLambdaExitNodes(const lambda::node & lambdaNode) const
   {
     return GetRegionExitNodes(*lambdaNode.subregion());
   }
 
-  [[nodiscard]] virtual const jlm::util::HashSet<const PointsToGraph::MemoryNode *> &
+  [[nodiscard]] virtual const MemoryNodeSet &
   GetThetaEntryExitNodes(const jlm::rvsdg::theta_node & thetaNode) const
   {
     auto & entryNodes = GetRegionEntryNodes(*thetaNode.subregion());
@@ -63,10 +64,10 @@ public:
     return entryNodes;
   }
 
-  [[nodiscard]] virtual jlm::util::HashSet<const PointsToGraph::MemoryNode *>
+  [[nodiscard]] virtual MemoryNodeSet
   GetGammaEntryNodes(const jlm::rvsdg::gamma_node & gammaNode) const
   {
-    jlm::util::HashSet<const PointsToGraph::MemoryNode *> allMemoryNodes;
+    MemoryNodeSet allMemoryNodes;
     for (size_t n = 0; n < gammaNode.nsubregions(); n++)
     {
       auto & subregion = *gammaNode.subregion(n);
@@ -77,10 +78,10 @@ public:
     return allMemoryNodes;
   }
 
-  [[nodiscard]] virtual jlm::util::HashSet<const PointsToGraph::MemoryNode *>
+  [[nodiscard]] virtual MemoryNodeSet
   GetGammaExitNodes(const jlm::rvsdg::gamma_node & gammaNode) const
   {
-    jlm::util::HashSet<const PointsToGraph::MemoryNode *> allMemoryNodes;
+    MemoryNodeSet allMemoryNodes;
     for (size_t n = 0; n < gammaNode.nsubregions(); n++)
     {
       auto & subregion = *gammaNode.subregion(n);
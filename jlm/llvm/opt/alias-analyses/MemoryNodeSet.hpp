@@ -0,0 +1,358 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_LLVM_OPT_ALIAS_ANALYSES_MEMORYNODESET_HPP
+#define JLM_LLVM_OPT_ALIAS_ANALYSES_MEMORYNODESET_HPP
+
+#include <jlm/llvm/opt/alias-analyses/PointsToGraph.hpp>
+#include <jlm/util/iterator_range.hpp>
+#include <jlm/util/SparseBitVector.hpp>
+
+#include <memory>
+#include <unordered_map>
+
+namespace jlm::llvm::aa
+{
+
+/** \brief Set of points-to graph memory nodes
+ *
+ * Represents a set of memory nodes of a single points-to graph as a sparse bit vector over the
+ * dense memory node indices. Unions, intersections, and comparisons of sets are therefore linear
+ * scans over the words of the bit vectors, and iteration visits the memory nodes in ascending
+ * index order, i.e., the order in which they were added to the points-to graph.
+ *
+ * The interface mirrors the one of util::HashSet.
+ *
+ * @see PointsToGraph::MemoryNode::GetIndex()
+ */
+class MemoryNodeSet final
+{
+  using IndexSet = util::SparseBitVector<size_t>;
+  using IndexIterator = decltype(std::declval<const IndexSet &>().Items().begin());
+
+  class ItemConstIterator final
+  {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = const PointsToGraph::MemoryNode *;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const PointsToGraph::MemoryNode * const *;
+    using reference = const PointsToGraph::MemoryNode * const &;
+
+  private:
+    friend MemoryNodeSet;
+
+    ItemConstIterator(const PointsToGraph * pointsToGraph, IndexIterator it, IndexIterator end)
+        : PointsToGraph_(pointsToGraph),
+          It_(it),
+          End_(end),
+          MemoryNode_(nullptr)
+    {
+      UpdateMemoryNode();
+    }
+
+  public:
+    reference
+    operator*() const
+    {
+      return MemoryNode_;
+    }
+
+    pointer
+    operator->() const
+    {
+      return &MemoryNode_;
+    }
+
+    ItemConstIterator &
+    operator++()
+    {
+      ++It_;
+      UpdateMemoryNode();
+      return *this;
+    }
+
+    ItemConstIterator
+    operator++(int)
+    {
+      ItemConstIterator tmp = *this;
+      ++*this;
+      return tmp;
+    }
+
+    bool
+    operator==(const ItemConstIterator & other) const
+    {
+      return It_ == other.It_;
+    }
+
+    bool
+    operator!=(const ItemConstIterator & other) const
+    {
+      return !operator==(other);
+    }
+
+  private:
+    void
+    UpdateMemoryNode() noexcept
+    {
+      MemoryNode_ = It_ == End_ ? nullptr : &PointsToGraph_->GetMemoryNode(*It_);
+    }
+
+    const PointsToGraph * PointsToGraph_;
+    IndexIterator It_;
+    IndexIterator End_;
+    const PointsToGraph::MemoryNode * MemoryNode_;
+  };
+
+public:
+  MemoryNodeSet() = default;
+
+  MemoryNodeSet(std::initializer_list<const PointsToGraph::MemoryNode *> initializerList)
+  {
+    for (auto memoryNode : initializerList)
+      Insert(memoryNode);
+  }
+
+  void
+  Clear() noexcept
+  {
+    Indices_.Clear();
+  }
+
+  [[nodiscard]] bool
+  Contains(const PointsToGraph::MemoryNode * memoryNode) const noexcept
+  {
+    return IsFromSameGraph(*memoryNode) && Indices_.Contains(memoryNode->GetIndex());
+  }
+
+  [[nodiscard]] bool
+  IsSubsetOf(const MemoryNodeSet & other) const noexcept
+  {
+    return Indices_.IsSubsetOf(other.Indices_);
+  }
+
+  [[nodiscard]] std::size_t
+  Size() const noexcept
+  {
+    return Indices_.Size();
+  }
+
+  [[nodiscard]] bool
+  IsEmpty() const noexcept
+  {
+    return Indices_.IsEmpty();
+  }
+
+  /**
+   * @return The number of bytes allocated for storing the memory nodes of the set.
+   */
+  [[nodiscard]] std::size_t
+  NumAllocatedBytes() const noexcept
+  {
+    return Indices_.NumAllocatedBytes();
+  }
+
+  /**
+   * Inserts \p memoryNode into the set.
+   *
+   * @return True if \p memoryNode was added to the set. False if it was already present.
+   */
+  bool
+  Insert(const PointsToGraph::MemoryNode * memoryNode)
+  {
+    SetGraph(memoryNode->Graph());
+    return Indices_.Insert(memoryNode->GetIndex());
+  }
+
+  bool
+  Remove(const PointsToGraph::MemoryNode * memoryNode)
+  {
+    return IsFromSameGraph(*memoryNode) && Indices_.Remove(memoryNode->GetIndex());
+  }
+
+  /**
+   * Get an iterator_range for iterating through the memory nodes of the set in ascending index
+   * order.
+   */
+  [[nodiscard]] util::iterator_range<ItemConstIterator>
+  Items() const noexcept
+  {
+    auto items = Indices_.Items();
+    return { ItemConstIterator(PointsToGraph_, items.begin(), items.end()),
+             ItemConstIterator(PointsToGraph_, items.end(), items.end()) };
+  }
+
+  /**
+   * Modifies the set to contain all memory nodes that are present in itself, \p other, or both.
+   *
+   * @return True if memory nodes were added to the set, otherwise false.
+   */
+  bool
+  UnionWith(const MemoryNodeSet & other)
+  {
+    if (other.IsEmpty())
+      return false;
+
+    SetGraph(*other.PointsToGraph_);
+    return Indices_.UnionWith(other.Indices_);
+  }
+
+  /**
+   * Modifies the set to contain all memory nodes of \p memoryNodes.
+   *
+   * @return True if memory nodes were added to the set, otherwise false.
+   */
+  bool
+  UnionWith(const util::HashSet<const PointsToGraph::MemoryNode *> & memoryNodes)
+  {
+    bool inserted = false;
+    for (auto memoryNode : memoryNodes.Items())
+      inserted |= Insert(memoryNode);
+
+    return inserted;
+  }
+
+  /**
+   * Modifies the set to contain only memory nodes that are present in itself and \p other.
+   */
+  void
+  IntersectWith(const MemoryNodeSet & other)
+  {
+    Indices_.IntersectWith(other.Indices_);
+  }
+
+  /**
+   * Removes all memory nodes that are present in \p other from the set.
+   */
+  void
+  DifferenceWith(const MemoryNodeSet & other)
+  {
+    Indices_.DifferenceWith(other.Indices_);
+  }
+
+  bool
+  operator==(const MemoryNodeSet & other) const noexcept
+  {
+    return Indices_ == other.Indices_;
+  }
+
+  bool
+  operator!=(const MemoryNodeSet & other) const noexcept
+  {
+    return !operator==(other);
+  }
+
+  /**
+   * Compares the set to a util::HashSet of memory nodes.
+   */
+  bool
+  operator==(const util::HashSet<const PointsToGraph::MemoryNode *> & other) const noexcept
+  {
+    if (Size() != other.Size())
+      return false;
+
+    for (auto memoryNode : other.Items())
+    {
+      if (!Contains(memoryNode))
+        return false;
+    }
+
+    return true;
+  }
+
+  bool
+  operator!=(const util::HashSet<const PointsToGraph::MemoryNode *> & other) const noexcept
+  {
+    return !operator==(other);
+  }
+
+  [[nodiscard]] std::size_t
+  Hash() const noexcept
+  {
+    return Indices_.Hash();
+  }
+
+private:
+  void
+  SetGraph(const PointsToGraph & pointsToGraph) noexcept
+  {
+    JLM_ASSERT(PointsToGraph_ == nullptr || PointsToGraph_ == &pointsToGraph);
+    PointsToGraph_ = &pointsToGraph;
+  }
+
+  [[nodiscard]] bool
+  IsFromSameGraph(const PointsToGraph::MemoryNode & memoryNode) const noexcept
+  {
+    return PointsToGraph_ == &memoryNode.Graph();
+  }
+
+  const PointsToGraph * PointsToGraph_ = nullptr;
+  IndexSet Indices_;
+};
+
+/** \brief Hash-consing pool of immutable memory node sets
+ *
+ * Many regions and calls end up with identical memory node sets, e.g., all regions of a loop nest
+ * or all call sites of the same function. Interning the final sets in a pool ensures that each
+ * distinct set is only stored once, and that all its users refer to the same instance.
+ */
+class MemoryNodeSetPool final
+{
+public:
+  MemoryNodeSetPool() = default;
+
+  MemoryNodeSetPool(const MemoryNodeSetPool &) = delete;
+
+  MemoryNodeSetPool &
+  operator=(const MemoryNodeSetPool &) = delete;
+
+  /**
+   * Returns the canonical instance of \p memoryNodes. The instance is owned by the pool, and
+   * remains valid for the lifetime of the pool.
+   */
+  const MemoryNodeSet &
+  Intern(MemoryNodeSet memoryNodes)
+  {
+    NumInternRequests_++;
+
+    auto hash = memoryNodes.Hash();
+    auto range = Sets_.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it)
+    {
+      if (*it->second == memoryNodes)
+        return *it->second;
+    }
+
+    auto set = std::make_unique<MemoryNodeSet>(std::move(memoryNodes));
+    return *Sets_.emplace(hash, std::move(set))->second;
+  }
+
+  /**
+   * @return The number of distinct sets in the pool.
+   */
+  [[nodiscard]] size_t
+  NumSets() const noexcept
+  {
+    return Sets_.size();
+  }
+
+  /**
+   * @return The number of invocations of Intern().
+   */
+  [[nodiscard]] size_t
+  NumInternRequests() const noexcept
+  {
+    return NumInternRequests_;
+  }
+
+private:
+  size_t NumInternRequests_ = 0;
+  std::unordered_multimap<std::size_t, std::unique_ptr<MemoryNodeSet>> Sets_;
+};
+
+}
+
+#endif // JLM_LLVM_OPT_ALIAS_ANALYSES_MEMORYNODESET_HPP
@@ -131,7 +131,7 @@ public:
     return MemoryNodeMap_.find(&output) != MemoryNodeMap_.end();
   }
 
-  jlm::util::HashSet<const PointsToGraph::MemoryNode *>
+  MemoryNodeSet
   GetMemoryNodes(const jlm::rvsdg::output & output)
   {
     JLM_ASSERT(is<PointerType>(output.type()));
@@ -169,10 +169,7 @@ public:
 
 private:
   const MemoryNodeProvisioning & MemoryNodeProvisioning_;
-  std::unordered_map<
-      const jlm::rvsdg::output *,
-      jlm::util::HashSet<const PointsToGraph::MemoryNode *>>
-      MemoryNodeMap_;
+  std::unordered_map<const jlm::rvsdg::output *, MemoryNodeSet> MemoryNodeMap_;
 };
 
 /** \brief Hash map for mapping points-to graph memory nodes to RVSDG memory states.
@@ -267,7 +264,7 @@ public:
   }
 
   std::vector<MemoryNodeStatePair *>
-  GetStates(const jlm::util::HashSet<const PointsToGraph::MemoryNode *> & memoryNodes)
+  GetStates(const MemoryNodeSet & memoryNodes)
   {
     std::vector<MemoryNodeStatePair *> memoryNodeStatePairs;
     for (auto & memoryNode : memoryNodes.Items())
@@ -346,9 +343,7 @@ public:
   }
 
   std::vector<StateMap::MemoryNodeStatePair *>
-  GetStates(
-      const jlm::rvsdg::region & region,
-      const jlm::util::HashSet<const PointsToGraph::MemoryNode *> & memoryNodes)
+  GetStates(const jlm::rvsdg::region & region, const MemoryNodeSet & memoryNodes)
   {
     return GetStateMap(region).GetStates(memoryNodes);
   }
@@ -359,7 +354,7 @@ public:
     return GetStateMap(region).GetState(memoryNode);
   }
 
-  jlm::util::HashSet<const PointsToGraph::MemoryNode *>
+  MemoryNodeSet
   GetMemoryNodes(const jlm::rvsdg::output & output)
   {
     auto & memoryNodeCache = GetMemoryNodeCache(*output.region());
@@ -5,7 +5,9 @@
  */
 
 #include <jlm/llvm/opt/alias-analyses/AgnosticMemoryNodeProvider.hpp>
+#include <jlm/llvm/opt/alias-analyses/AliasClassMemoryNodeEliminator.hpp>
 #include <jlm/llvm/opt/alias-analyses/Andersen.hpp>
+#include <jlm/llvm/opt/alias-analyses/EliminatedMemoryNodeProvider.hpp>
 #include <jlm/llvm/opt/alias-analyses/MemoryStateEncoder.hpp>
 #include <jlm/llvm/opt/alias-analyses/Optimization.hpp>
 #include <jlm/llvm/opt/alias-analyses/RegionAwareMemoryNodeProvider.hpp>
@@ -23,20 +25,41 @@ void
 AliasAnalysisStateEncoder<AliasAnalysisPass, MemoryNodeProviderPass>::run(
     RvsdgModule & rvsdgModule,
     util::StatisticsCollector & statisticsCollector)
+{
+  RunWithThreads(rvsdgModule, statisticsCollector, 1);
+}
+
+template<typename AliasAnalysisPass, typename MemoryNodeProviderPass>
+void
+AliasAnalysisStateEncoder<AliasAnalysisPass, MemoryNodeProviderPass>::RunWithThreads(
+    RvsdgModule & rvsdgModule,
+    util::StatisticsCollector & statisticsCollector,
+    size_t numThreads)
 {
   AliasAnalysisPass aaPass;
-  auto pointsToGraph = aaPass.Analyze(rvsdgModule, statisticsCollector);
+  auto pointsToQuery = aaPass.AnalyzeOnDemand(rvsdgModule, statisticsCollector);
+
+  std::unique_ptr<MemoryNodeProvider> provider;
+  if constexpr (std::is_constructible_v<MemoryNodeProviderPass, size_t>)
+    provider = std::make_unique<MemoryNodeProviderPass>(numThreads);
+  else
+    provider = std::make_unique<MemoryNodeProviderPass>();
   auto provisioning =
-      MemoryNodeProviderPass::Create(rvsdgModule, *pointsToGraph, statisticsCollector);
+      provider->ProvisionMemoryNodes(rvsdgModule, *pointsToQuery, statisticsCollector);
 
   MemoryStateEncoder encoder;
   encoder.Encode(rvsdgModule, *provisioning, statisticsCollector);
 }
 
+using RegionAwareAliasClassMemoryNodeProvider =
+    EliminatedMemoryNodeProvider<RegionAwareMemoryNodeProvider, AliasClassMemoryNodeEliminator>;
+
 // Explicitly initialize all combinations
 template class AliasAnalysisStateEncoder<Steensgaard, AgnosticMemoryNodeProvider>;
 template class AliasAnalysisStateEncoder<Steensgaard, RegionAwareMemoryNodeProvider>;
+template class AliasAnalysisStateEncoder<Steensgaard, RegionAwareAliasClassMemoryNodeProvider>;
 template class AliasAnalysisStateEncoder<Andersen, AgnosticMemoryNodeProvider>;
 template class AliasAnalysisStateEncoder<Andersen, RegionAwareMemoryNodeProvider>;
+template class AliasAnalysisStateEncoder<Andersen, RegionAwareAliasClassMemoryNodeProvider>;
 
 }
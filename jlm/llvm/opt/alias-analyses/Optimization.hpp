@@ -41,6 +41,16 @@ public:
 
   void
   run(RvsdgModule & rvsdgModule, util::StatisticsCollector & statisticsCollector) override;
+
+  /**
+   * Applies the alias analysis and the memory state encoding. The \p numThreads threads are
+   * passed on to the memory node provider if it supports multiple threads.
+   */
+  void
+  RunWithThreads(
+      RvsdgModule & rvsdgModule,
+      util::StatisticsCollector & statisticsCollector,
+      size_t numThreads) override;
 };
 
 }
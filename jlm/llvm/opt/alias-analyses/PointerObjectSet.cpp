@@ -6,6 +6,8 @@
 #include <jlm/llvm/opt/alias-analyses/PointerObjectSet.hpp>
 
 #include <jlm/llvm/ir/operators/call.hpp>
+
+#include <deque>
 #include <queue>
 
 namespace jlm::llvm::aa
@@ -157,7 +159,7 @@ PointerObjectSet::GetImportMap() const noexcept
   return ImportMap_;
 }
 
-const util::HashSet<PointerObject::Index> &
+const PointerObjectSet::PointsToSet &
 PointerObjectSet::GetPointsToSet(PointerObject::Index idx) const
 {
   JLM_ASSERT(idx < NumPointerObjects());
@@ -180,6 +182,22 @@ PointerObjectSet::AddToPointsToSet(PointerObject::Index pointer, PointerObject::
   return PointsToSets_[pointer].Insert(pointee);
 }
 
+// Makes all pointees members of P(pointer), and records the ones that are new
+bool
+PointerObjectSet::AddToPointsToSet(
+    PointerObject::Index pointer,
+    const PointsToSet & pointees,
+    PointsToSet & newPointees)
+{
+  JLM_ASSERT(pointer < NumPointerObjects());
+
+  // If the pointer PointerObject can not point to anything, silently ignore
+  if (!GetPointerObject(pointer).CanPoint())
+    return false;
+
+  return PointsToSets_[pointer].UnionWith(pointees, newPointees);
+}
+
 // Makes P(superset) a superset of P(subset)
 bool
 PointerObjectSet::MakePointsToSetSuperset(
@@ -443,14 +461,29 @@ PointerObjectConstraintSet::AddConstraint(ConstraintVariant c)
   Constraints_.push_back(c);
 }
 
+size_t
+PointerObjectConstraintSet::NumConstraints() const noexcept
+{
+  return Constraints_.size();
+}
+
 void
 PointerObjectConstraintSet::Solve()
 {
+  SolveUsingWorklist();
+}
+
+size_t
+PointerObjectConstraintSet::SolveNaively()
+{
+  size_t numIterations = 0;
+
   // Keep applying constraints until no sets are modified
   bool modified = true;
 
   while (modified)
   {
+    numIterations++;
     modified = false;
 
     for (auto & constraint : Constraints_)
@@ -465,6 +498,564 @@ PointerObjectConstraintSet::Solve()
 
     modified |= PropagateEscapedFlag();
   }
+
+  return numIterations;
+}
+
+/**
+ * Worklist based constraint solver.
+ *
+ * Simple superset constraints become edges in a subset graph, while the remaining constraints are
+ * attached to the PointerObject whose points-to set determines their effect. Whenever a
+ * PointerObject is popped from the worklist, only its pointees that are new since its last visit
+ * are propagated along its edges and handed to its attached constraints.
+ *
+ * PointerObjects that are found to be in a cycle of subset edges are unified using a union-find
+ * structure. All queries and modifications are performed on the representative (root) of a
+ * unification. When solving is done, the points-to sets of the roots are copied to all members.
+ */
+class PointerObjectConstraintSet::WorklistSolver final
+{
+public:
+  WorklistSolver(PointerObjectSet & set, const std::vector<ConstraintVariant> & constraints)
+      : Set_(set)
+  {
+    const auto numPointerObjects = Set_.NumPointerObjects();
+    Parent_.resize(numPointerObjects);
+    Rank_.resize(numPointerObjects, 0);
+    Successors_.resize(numPointerObjects);
+    CheckedSuccessors_.resize(numPointerObjects);
+    Stores_.resize(numPointerObjects);
+    Loads_.resize(numPointerObjects);
+    Calls_.resize(numPointerObjects);
+    IsEscapingFunctionTarget_.resize(numPointerObjects, false);
+    NewPointees_.resize(numPointerObjects);
+    NewPointsToExternal_.resize(numPointerObjects, false);
+    PointeesEscape_.resize(numPointerObjects, false);
+    NewPointeesEscape_.resize(numPointerObjects, false);
+    InWorklist_.resize(numPointerObjects, false);
+
+    for (PointerObject::Index idx = 0; idx < numPointerObjects; idx++)
+      Parent_[idx] = idx;
+
+    for (auto & constraint : constraints)
+    {
+      if (auto superset = std::get_if<SupersetConstraint>(&constraint))
+      {
+        if (superset->GetSubset() != superset->GetSuperset()
+            && Set_.GetPointerObject(superset->GetSuperset()).CanPoint())
+          Successors_[superset->GetSubset()].Insert(superset->GetSuperset());
+      }
+      else if (auto store = std::get_if<AllPointeesPointToSupersetConstraint>(&constraint))
+      {
+        Stores_[store->GetPointer1()].push_back(store->GetPointer2());
+      }
+      else if (auto load = std::get_if<SupersetOfAllPointeesConstraint>(&constraint))
+      {
+        Loads_[load->GetPointer()].push_back(load->GetLoaded());
+      }
+      else if (auto escaping = std::get_if<HandleEscapingFunctionConstraint>(&constraint))
+      {
+        IsEscapingFunctionTarget_[escaping->GetFunction()] = true;
+      }
+      else if (auto call = std::get_if<FunctionCallConstraint>(&constraint))
+      {
+        Calls_[call->GetCallTarget()].push_back(&call->GetCallNode());
+      }
+      else
+      {
+        JLM_UNREACHABLE("Unknown constraint type");
+      }
+    }
+  }
+
+  WorklistStatistics
+  Solve()
+  {
+    // Every PointerObject starts out with all its pointees being new
+    for (PointerObject::Index idx = 0; idx < Set_.NumPointerObjects(); idx++)
+    {
+      auto & pointerObject = Set_.GetPointerObject(idx);
+      NewPointees_[idx].UnionWith(Set_.GetPointsToSet(idx));
+      NewPointsToExternal_[idx] = pointerObject.PointsToExternal();
+      PointeesEscape_[idx] = pointerObject.HasEscaped();
+      Push(idx);
+    }
+
+    for (PointerObject::Index idx = 0; idx < Set_.NumPointerObjects(); idx++)
+    {
+      if (IsEscapingFunctionTarget_[idx] && Set_.GetPointerObject(idx).HasEscaped())
+        HandleEscapingFunction(idx);
+    }
+
+    while (!Worklist_.empty())
+    {
+      const auto idx = Worklist_.front();
+      Worklist_.pop_front();
+      InWorklist_[idx] = false;
+
+      // PointerObjects that have been unified with another PointerObject are handled by their root
+      if (Find(idx) != idx)
+        continue;
+
+      Statistics_.NumWorklistIterations++;
+      ProcessPointerObject(idx);
+    }
+
+    // Give all unified PointerObjects the points-to set of their root
+    for (PointerObject::Index idx = 0; idx < Set_.NumPointerObjects(); idx++)
+    {
+      const auto root = Find(idx);
+      if (root != idx)
+        Set_.MakePointsToSetSuperset(idx, root);
+    }
+
+    return Statistics_;
+  }
+
+private:
+  PointerObject::Index
+  Find(PointerObject::Index idx)
+  {
+    auto root = idx;
+    while (Parent_[root] != root)
+      root = Parent_[root];
+
+    // Path compression
+    while (Parent_[idx] != root)
+    {
+      const auto next = Parent_[idx];
+      Parent_[idx] = root;
+      idx = next;
+    }
+
+    return root;
+  }
+
+  void
+  Push(PointerObject::Index idx)
+  {
+    if (InWorklist_[idx])
+      return;
+
+    InWorklist_[idx] = true;
+    Worklist_.push_back(idx);
+  }
+
+  /**
+   * Propagates \p pointees, and the PointsToExternal flag if \p pointsToExternal is set, from
+   * the root \p subset to the root \p superset.
+   */
+  void
+  Propagate(
+      PointerObject::Index subset,
+      PointerObject::Index superset,
+      const PointerObjectSet::PointsToSet & pointees,
+      bool pointsToExternal)
+  {
+    const bool modified = Set_.AddToPointsToSet(superset, pointees, NewPointees_[superset]);
+
+    if (pointsToExternal)
+      MarkAsPointsToExternal(superset);
+
+    if (modified)
+      Push(superset);
+  }
+
+  /**
+   * Adds the subset edge P(\p superset) \supseteq P(\p subset), and propagates all current
+   * pointees of \p subset along it, if it is new.
+   */
+  void
+  AddEdge(PointerObject::Index subset, PointerObject::Index superset)
+  {
+    subset = Find(subset);
+    superset = Find(superset);
+
+    if (subset == superset || !Set_.GetPointerObject(superset).CanPoint())
+      return;
+
+    if (!Successors_[subset].Insert(superset))
+      return;
+
+    Propagate(
+        subset,
+        superset,
+        Set_.GetPointsToSet(subset),
+        Set_.GetPointerObject(subset).PointsToExternal());
+  }
+
+  void
+  MarkAsPointsToExternal(PointerObject::Index idx)
+  {
+    const auto root = Find(idx);
+    if (Set_.GetPointerObject(root).MarkAsPointsToExternal())
+    {
+      NewPointsToExternal_[root] = true;
+      Push(root);
+    }
+  }
+
+  /**
+   * Makes all current and future pointees of \p idx escape, without marking \p idx itself.
+   */
+  void
+  MarkPointeesAsEscaped(PointerObject::Index idx)
+  {
+    const auto root = Find(idx);
+    if (PointeesEscape_[root])
+      return;
+
+    PointeesEscape_[root] = true;
+    NewPointeesEscape_[root] = true;
+    Push(root);
+  }
+
+  void
+  MarkAsEscaped(PointerObject::Index idx)
+  {
+    auto & pointerObject = Set_.GetPointerObject(idx);
+    const auto hadEscaped = pointerObject.HasEscaped();
+    const auto hadPointsToExternal = pointerObject.PointsToExternal();
+    pointerObject.MarkAsEscaped();
+
+    // Escaping sets the PointsToExternal flag of idx directly, which must still be propagated
+    if (pointerObject.PointsToExternal())
+    {
+      const auto root = Find(idx);
+      if (Set_.GetPointerObject(root).MarkAsPointsToExternal() || !hadPointsToExternal)
+      {
+        NewPointsToExternal_[root] = true;
+        Push(root);
+      }
+    }
+
+    if (hadEscaped)
+      return;
+
+    MarkPointeesAsEscaped(idx);
+
+    if (IsEscapingFunctionTarget_[idx])
+      HandleEscapingFunction(idx);
+  }
+
+  /**
+   * @see HandleEscapingFunctionConstraint
+   */
+  void
+  HandleEscapingFunction(PointerObject::Index lambda)
+  {
+    auto & lambdaNode = Set_.GetLambdaNodeFromFunctionMemoryObject(lambda);
+
+    for (auto & argument : lambdaNode.fctarguments())
+    {
+      if (!is<PointerType>(argument.type()))
+        continue;
+
+      MarkAsPointsToExternal(Set_.GetRegisterPointerObject(argument));
+    }
+
+    for (auto & result : lambdaNode.fctresults())
+    {
+      if (!is<PointerType>(result.type()))
+        continue;
+
+      MarkAsEscaped(Set_.GetRegisterPointerObject(*result.origin()));
+    }
+  }
+
+  /**
+   * @see FunctionCallConstraint
+   */
+  void
+  HandleCallingExternalFunction(const CallNode & callNode)
+  {
+    for (size_t n = 0; n < callNode.NumArguments(); n++)
+    {
+      const auto & inputRegister = *callNode.Argument(n)->origin();
+      if (!is<PointerType>(inputRegister.type()))
+        continue;
+
+      MarkAsEscaped(Set_.GetRegisterPointerObject(inputRegister));
+    }
+
+    for (size_t n = 0; n < callNode.NumResults(); n++)
+    {
+      const auto & outputRegister = *callNode.Result(n);
+      if (!is<PointerType>(outputRegister.type()))
+        continue;
+
+      MarkAsPointsToExternal(Set_.GetRegisterPointerObject(outputRegister));
+    }
+  }
+
+  /**
+   * @see FunctionCallConstraint
+   */
+  void
+  HandleCallingLambdaFunction(const CallNode & callNode, PointerObject::Index lambda)
+  {
+    auto & lambdaNode = Set_.GetLambdaNodeFromFunctionMemoryObject(lambda);
+
+    if (lambdaNode.nfctarguments() != callNode.NumArguments()
+        || lambdaNode.nfctresults() != callNode.NumResults())
+      return;
+
+    for (size_t n = 0; n < callNode.NumArguments(); n++)
+    {
+      const auto & inputRegister = *callNode.Argument(n)->origin();
+      const auto & argumentRegister = *lambdaNode.fctargument(n);
+      if (!is<PointerType>(inputRegister.type()) || !is<PointerType>(argumentRegister.type()))
+        continue;
+
+      AddEdge(
+          Set_.GetRegisterPointerObject(inputRegister),
+          Set_.GetRegisterPointerObject(argumentRegister));
+    }
+
+    for (size_t n = 0; n < callNode.NumResults(); n++)
+    {
+      const auto & outputRegister = *callNode.Result(n);
+      const auto & resultRegister = *lambdaNode.fctresult(n)->origin();
+      if (!is<PointerType>(outputRegister.type()) || !is<PointerType>(resultRegister.type()))
+        continue;
+
+      AddEdge(
+          Set_.GetRegisterPointerObject(resultRegister),
+          Set_.GetRegisterPointerObject(outputRegister));
+    }
+  }
+
+  void
+  ProcessPointerObject(PointerObject::Index root)
+  {
+    PointerObjectSet::PointsToSet newPointees;
+    std::swap(newPointees, NewPointees_[root]);
+    const bool newPointsToExternal = NewPointsToExternal_[root];
+    NewPointsToExternal_[root] = false;
+
+    // If all pointees just started escaping, the old pointees must be marked as well
+    if (NewPointeesEscape_[root])
+    {
+      NewPointeesEscape_[root] = false;
+      for (const auto pointee : Set_.GetPointsToSet(root).Items())
+        MarkAsEscaped(pointee);
+    }
+    else if (PointeesEscape_[root])
+    {
+      for (const auto pointee : newPointees.Items())
+        MarkAsEscaped(pointee);
+    }
+
+    // *root = value
+    for (const auto value : Stores_[root])
+    {
+      for (const auto pointee : newPointees.Items())
+        AddEdge(value, pointee);
+
+      if (newPointsToExternal)
+        MarkPointeesAsEscaped(value);
+    }
+
+    // loaded = *root
+    for (const auto loaded : Loads_[root])
+    {
+      for (const auto pointee : newPointees.Items())
+        AddEdge(pointee, loaded);
+
+      if (newPointsToExternal)
+        MarkAsPointsToExternal(loaded);
+    }
+
+    // root is the target of function calls
+    for (const auto callNode : Calls_[root])
+    {
+      for (const auto pointee : newPointees.Items())
+      {
+        const auto kind = Set_.GetPointerObject(pointee).GetKind();
+        if (kind == PointerObjectKind::ImportMemoryObject)
+          HandleCallingExternalFunction(*callNode);
+        else if (kind == PointerObjectKind::FunctionMemoryObject)
+          HandleCallingLambdaFunction(*callNode, pointee);
+      }
+
+      if (newPointsToExternal)
+        HandleCallingExternalFunction(*callNode);
+    }
+
+    // Difference propagation along all subset edges
+    std::vector<PointerObject::Index> cycleCandidates;
+    for (const auto successor : Successors_[root].Items())
+    {
+      const auto superset = Find(successor);
+      if (superset == root)
+        continue;
+
+      Propagate(root, superset, newPointees, newPointsToExternal);
+
+      // Lazy cycle detection: an edge whose ends have identical points-to sets is likely to be
+      // part of a cycle. Each edge is only checked once.
+      const auto & subsetPointees = Set_.GetPointsToSet(root);
+      const auto & supersetPointees = Set_.GetPointsToSet(superset);
+      if (!subsetPointees.IsEmpty() && subsetPointees.Size() == supersetPointees.Size()
+          && subsetPointees == supersetPointees && CheckedSuccessors_[root].Insert(superset))
+        cycleCandidates.push_back(superset);
+    }
+
+    if (!cycleCandidates.empty())
+      CollapseCycles(root);
+  }
+
+  /**
+   * Finds all strongly connected components of subset edges reachable from \p start, using
+   * Tarjan's algorithm, and unifies the PointerObjects of each component.
+   */
+  void
+  CollapseCycles(PointerObject::Index start)
+  {
+    Statistics_.NumCycleDetections++;
+
+    std::unordered_map<PointerObject::Index, size_t> dfsIndex;
+    std::unordered_map<PointerObject::Index, size_t> lowLink;
+    std::vector<PointerObject::Index> stack;
+    util::HashSet<PointerObject::Index> onStack;
+    std::vector<std::vector<PointerObject::Index>> components;
+
+    // Each frame holds a node and the successors that remain to be visited
+    std::vector<std::pair<PointerObject::Index, std::vector<PointerObject::Index>>> frames;
+    auto enter = [&](PointerObject::Index node)
+    {
+      dfsIndex[node] = lowLink[node] = dfsIndex.size();
+      stack.push_back(node);
+      onStack.Insert(node);
+
+      std::vector<PointerObject::Index> successors;
+      for (const auto successor : Successors_[node].Items())
+        successors.push_back(Find(successor));
+      frames.emplace_back(node, std::move(successors));
+    };
+
+    enter(start);
+    while (!frames.empty())
+    {
+      auto & [node, successors] = frames.back();
+      if (!successors.empty())
+      {
+        const auto successor = successors.back();
+        successors.pop_back();
+
+        if (dfsIndex.find(successor) == dfsIndex.end())
+          enter(successor);
+        else if (onStack.Contains(successor))
+          lowLink[node] = std::min(lowLink[node], dfsIndex[successor]);
+        continue;
+      }
+
+      const auto finished = node;
+      frames.pop_back();
+      if (!frames.empty())
+      {
+        const auto parent = frames.back().first;
+        lowLink[parent] = std::min(lowLink[parent], lowLink[finished]);
+      }
+
+      if (lowLink[finished] != dfsIndex[finished])
+        continue;
+
+      std::vector<PointerObject::Index> component;
+      PointerObject::Index member;
+      do
+      {
+        member = stack.back();
+        stack.pop_back();
+        onStack.Remove(member);
+        component.push_back(member);
+      } while (member != finished);
+
+      if (component.size() > 1)
+        components.push_back(std::move(component));
+    }
+
+    for (auto & component : components)
+    {
+      for (size_t n = 1; n < component.size(); n++)
+        Unify(component[0], component[n]);
+    }
+  }
+
+  /**
+   * Unifies the PointerObjects \p a and \p b, which must have identical points-to sets in any
+   * solution, e.g., since they are part of a cycle of subset edges.
+   */
+  void
+  Unify(PointerObject::Index a, PointerObject::Index b)
+  {
+    a = Find(a);
+    b = Find(b);
+    if (a == b)
+      return;
+
+    if (Rank_[a] < Rank_[b])
+      std::swap(a, b);
+    if (Rank_[a] == Rank_[b])
+      Rank_[a]++;
+    Parent_[b] = a;
+    Statistics_.NumUnifications++;
+
+    Set_.MakePointsToSetSuperset(a, b);
+    Successors_[a].UnionWith(Successors_[b]);
+    Successors_[b].Clear();
+    Stores_[a].insert(Stores_[a].end(), Stores_[b].begin(), Stores_[b].end());
+    Stores_[b].clear();
+    Loads_[a].insert(Loads_[a].end(), Loads_[b].begin(), Loads_[b].end());
+    Loads_[b].clear();
+    Calls_[a].insert(Calls_[a].end(), Calls_[b].begin(), Calls_[b].end());
+    Calls_[b].clear();
+
+    // The points-to set of the root is new to the constraints and edges of both PointerObjects
+    NewPointees_[a].UnionWith(Set_.GetPointsToSet(a));
+    NewPointees_[b].Clear();
+    NewPointsToExternal_[a] = Set_.GetPointerObject(a).PointsToExternal();
+    PointeesEscape_[a] = PointeesEscape_[a] || PointeesEscape_[b];
+    NewPointeesEscape_[a] = NewPointeesEscape_[a] || NewPointeesEscape_[b];
+    Push(a);
+  }
+
+  PointerObjectSet & Set_;
+
+  // Union-find forest of unified PointerObjects
+  std::vector<PointerObject::Index> Parent_;
+  std::vector<uint8_t> Rank_;
+
+  // For each root, the roots whose points-to set must be a superset of its own
+  std::vector<util::HashSet<PointerObject::Index>> Successors_;
+  std::vector<util::HashSet<PointerObject::Index>> CheckedSuccessors_;
+
+  // Constraints attached to the PointerObject whose pointees determine their effect
+  std::vector<std::vector<PointerObject::Index>> Stores_;
+  std::vector<std::vector<PointerObject::Index>> Loads_;
+  std::vector<std::vector<const CallNode *>> Calls_;
+  std::vector<bool> IsEscapingFunctionTarget_;
+
+  // Changes to each root that have not yet been processed
+  std::vector<PointerObjectSet::PointsToSet> NewPointees_;
+  std::vector<bool> NewPointsToExternal_;
+
+  // Set for roots whose pointees must all be marked as escaped
+  std::vector<bool> PointeesEscape_;
+  std::vector<bool> NewPointeesEscape_;
+
+  std::deque<PointerObject::Index> Worklist_;
+  std::vector<bool> InWorklist_;
+
+  WorklistStatistics Statistics_;
+};
+
+PointerObjectConstraintSet::WorklistStatistics
+PointerObjectConstraintSet::SolveUsingWorklist()
+{
+  WorklistSolver solver(Set_, Constraints_);
+  return solver.Solve();
 }
 
 bool
@@ -12,6 +12,7 @@
 #include <jlm/util/common.hpp>
 #include <jlm/util/HashSet.hpp>
 #include <jlm/util/Math.hpp>
+#include <jlm/util/SparseBitVector.hpp>
 
 #include <cstdint>
 #include <unordered_map>
@@ -167,11 +168,21 @@ public:
  */
 class PointerObjectSet final
 {
+public:
+  /**
+   * The representation of points-to sets. Points-to sets are unioned and compared frequently
+   * during solving, which is why a sparse bit vector is used. Any set type providing the
+   * interface of util::HashSet, as well as UnionWith() with a set receiving the new items, can
+   * be used instead.
+   */
+  using PointsToSet = util::SparseBitVector<PointerObject::Index>;
+
+private:
   // All PointerObjects in the set
   std::vector<PointerObject> PointerObjects_;
 
   // For each PointerObject, a set of the other PointerObjects it points to
-  std::vector<util::HashSet<PointerObject::Index>> PointsToSets_;
+  std::vector<PointsToSet> PointsToSets_;
 
   // Mapping from register to PointerObject
   // Unlike the other maps, several rvsdg::output* can share register PointerObject
@@ -296,7 +307,7 @@ public:
   const std::unordered_map<const rvsdg::argument *, PointerObject::Index> &
   GetImportMap() const noexcept;
 
-  [[nodiscard]] const util::HashSet<PointerObject::Index> &
+  [[nodiscard]] const PointsToSet &
   GetPointsToSet(PointerObject::Index idx) const;
 
   /**
@@ -324,6 +335,23 @@ public:
   bool
   MakePointsToSetSuperset(PointerObject::Index superset, PointerObject::Index subset);
 
+  /**
+   * Adds all of \p pointees to P(\p pointer), and records the pointees that were not already
+   * members of P(\p pointer) in \p newPointees.
+   * @param pointer the index of the PointerObject that shall point to all \p pointees
+   * @param pointees the PointerObjects to add, none of which can be registers
+   * @param newPointees the set receiving the pointees that were added to P(\p pointer)
+   *
+   * If the pointer is of a PointerObjectKind that can't point, this is a no-op.
+   *
+   * @return true if P(\p pointer) was changed by this operation
+   */
+  bool
+  AddToPointsToSet(
+      PointerObject::Index pointer,
+      const PointsToSet & pointees,
+      PointsToSet & newPointees);
+
   /**
    * Adds the Escaped flag to all PointerObjects in the P(\p pointer) set
    * @param pointer the pointer whose pointees should be marked as escaped
@@ -349,6 +377,24 @@ public:
         Subset_(subset)
   {}
 
+  /**
+   * @return the PointerObject that should point to everything the subset points to
+   */
+  [[nodiscard]] PointerObject::Index
+  GetSuperset() const noexcept
+  {
+    return Superset_;
+  }
+
+  /**
+   * @return the PointerObject whose points-to set should be contained in the superset
+   */
+  [[nodiscard]] PointerObject::Index
+  GetSubset() const noexcept
+  {
+    return Subset_;
+  }
+
   /**
    * \brief Applies the constraint to the \p set
    * \return true if this operation modified any PointerObjects or points-to-sets
@@ -373,6 +419,24 @@ public:
         Pointer2_(pointer2)
   {}
 
+  /**
+   * @return the PointerObject whose pointees should point to everything pointer2 points to
+   */
+  [[nodiscard]] PointerObject::Index
+  GetPointer1() const noexcept
+  {
+    return Pointer1_;
+  }
+
+  /**
+   * @return the PointerObject whose points-to set is stored through pointer1
+   */
+  [[nodiscard]] PointerObject::Index
+  GetPointer2() const noexcept
+  {
+    return Pointer2_;
+  }
+
   /**
    * \brief Applies the constraint to the \p set
    * \return true if this operation modified any PointerObjects or points-to-sets
@@ -397,6 +461,24 @@ public:
         Pointer_(pointer)
   {}
 
+  /**
+   * @return the PointerObject that should point to everything the pointees of pointer point to
+   */
+  [[nodiscard]] PointerObject::Index
+  GetLoaded() const noexcept
+  {
+    return Loaded_;
+  }
+
+  /**
+   * @return the PointerObject that is loaded from
+   */
+  [[nodiscard]] PointerObject::Index
+  GetPointer() const noexcept
+  {
+    return Pointer_;
+  }
+
   /**
    * \brief Applies the constraint to the \p set
    * \return true if this operation modified any PointerObjects or points-to-sets
@@ -427,6 +509,15 @@ public:
         EscapeHandled_(false)
   {}
 
+  /**
+   * @return the PointerObject of FunctionMemoryObject kind that might escape
+   */
+  [[nodiscard]] PointerObject::Index
+  GetFunction() const noexcept
+  {
+    return Lambda_;
+  }
+
   /**
    * \brief Applies the constraint to the \p set
    * \return true if this operation modified any PointerObjects or points-to-sets
@@ -501,6 +592,24 @@ public:
         CallNode_(callNode)
   {}
 
+  /**
+   * @return the PointerObject of Register kind holding the called function pointer
+   */
+  [[nodiscard]] PointerObject::Index
+  GetCallTarget() const noexcept
+  {
+    return CallTarget_;
+  }
+
+  /**
+   * @return the RVSDG node representing the function call
+   */
+  [[nodiscard]] const jlm::llvm::CallNode &
+  GetCallNode() const noexcept
+  {
+    return CallNode_;
+  }
+
   /**
    * Applies the constraint to the \p set
    * @return true if this operation modified any PointerObjects or points-to-sets
@@ -518,7 +627,24 @@ public:
  */
 class PointerObjectConstraintSet final
 {
+  class WorklistSolver;
+
 public:
+  /**
+   * Counters describing the work performed by SolveUsingWorklist().
+   */
+  struct WorklistStatistics
+  {
+    // The number of PointerObjects popped from the worklist
+    size_t NumWorklistIterations = 0;
+
+    // The number of times a search for cycles among the subset edges was started
+    size_t NumCycleDetections = 0;
+
+    // The number of PointerObjects that were unified with another PointerObject due to cycles
+    size_t NumUnifications = 0;
+  };
+
   using ConstraintVariant = std::variant<
       SupersetConstraint,
       AllPointeesPointToSupersetConstraint,
@@ -571,12 +697,37 @@ public:
   AddConstraint(ConstraintVariant c);
 
   /**
-   * Iterates over and applies constraints until all points-to-sets satisfy them.
-   * This operation potentially has a long runtime, with an upper bound of O(n^3).
+   * @return the number of constraints added through AddConstraint()
+   */
+  [[nodiscard]] size_t
+  NumConstraints() const noexcept;
+
+  /**
+   * Finds a solution to all constraints, using the worklist solver.
+   * @see SolveUsingWorklist()
    */
   void
   Solve();
 
+  /**
+   * Iterates over and applies constraints until all points-to-sets satisfy them.
+   * This operation potentially has a long runtime, with an upper bound of O(n^3).
+   * @return the number of iterations over all constraints
+   */
+  size_t
+  SolveNaively();
+
+  /**
+   * Finds a solution to all constraints using a worklist of PointerObjects with new pointees.
+   * Only pointees that are new since the last visit of a PointerObject are propagated along its
+   * subset edges (difference propagation). Cycles of subset edges are detected lazily, when a
+   * propagation makes both ends of an edge point to the same set, and are collapsed into a single
+   * representative PointerObject.
+   * @return statistics about the work performed by the solver
+   */
+  WorklistStatistics
+  SolveUsingWorklist();
+
 private:
   /**
    * Ensures that the escaped flag is set for all pointees of any pointer object that is marked as
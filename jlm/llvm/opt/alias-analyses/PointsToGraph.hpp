@@ -17,6 +17,7 @@
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 namespace jlm::llvm
 {
@@ -356,6 +357,32 @@ public:
     return *it->second;
   }
 
+  /**
+   * Returns the memory node with index \p index.
+   *
+   * Memory nodes are densely indexed in the order of their creation, which permits to represent
+   * sets of memory nodes as bit sets over their indices.
+   *
+   * @see PointsToGraph::MemoryNode::GetIndex()
+   * @see MemoryNodeSet
+   */
+  [[nodiscard]] const PointsToGraph::MemoryNode &
+  GetMemoryNode(size_t index) const noexcept
+  {
+    JLM_ASSERT(index < MemoryNodesByIndex_.size());
+    return *MemoryNodesByIndex_[index];
+  }
+
+  /**
+   * @return The number of memory node indices handed out, i.e., one past the largest index of any
+   * memory node in the graph. This includes the unknown memory node.
+   */
+  [[nodiscard]] size_t
+  NumMemoryNodeIndices() const noexcept
+  {
+    return MemoryNodesByIndex_.size();
+  }
+
   /**
    * Returns all memory nodes that are marked as escaped from the module.
    *
@@ -430,6 +457,11 @@ private:
    */
   jlm::util::HashSet<const PointsToGraph::MemoryNode *> EscapedMemoryNodes_;
 
+  /**
+   * All memory nodes of the graph, indexed by PointsToGraph::MemoryNode::GetIndex().
+   */
+  std::vector<const PointsToGraph::MemoryNode *> MemoryNodesByIndex_;
+
   AllocaNodeMap AllocaNodes_;
   DeltaNodeMap DeltaNodes_;
   ImportNodeMap ImportNodes_;
@@ -629,10 +661,27 @@ public:
     Graph().AddEscapedMemoryNode(*this);
   }
 
+  /**
+   * @return The dense index of this memory node within its points-to graph.
+   *
+   * @see PointsToGraph::GetMemoryNode()
+   */
+  [[nodiscard]] size_t
+  GetIndex() const noexcept
+  {
+    return Index_;
+  }
+
 protected:
   explicit MemoryNode(PointsToGraph & pointsToGraph)
-      : Node(pointsToGraph)
-  {}
+      : Node(pointsToGraph),
+        Index_(pointsToGraph.MemoryNodesByIndex_.size())
+  {
+    pointsToGraph.MemoryNodesByIndex_.push_back(this);
+  }
+
+private:
+  size_t Index_;
 };
 
 /** \brief PointsTo graph alloca node
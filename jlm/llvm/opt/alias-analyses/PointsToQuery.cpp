@@ -0,0 +1,80 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/llvm/opt/alias-analyses/PointsToQuery.hpp>
+
+namespace jlm::llvm::aa
+{
+
+PointsToQuery::~PointsToQuery() noexcept = default;
+
+PointsToQuery::PointsToQuery(size_t cacheCapacity)
+    : Cache_(cacheCapacity)
+{}
+
+MemoryNodeSet
+PointsToQuery::GetOutputNodes(const rvsdg::output & output) const
+{
+  JLM_ASSERT(is<PointerType>(output.type()));
+
+  std::lock_guard lock(CacheMutex_);
+  if (auto memoryNodes = Cache_.Lookup(&output))
+    return *memoryNodes;
+
+  return Cache_.Insert(&output, ComputeOutputNodes(output));
+}
+
+PointsToGraphQuery::~PointsToGraphQuery() noexcept = default;
+
+PointsToGraphQuery::PointsToGraphQuery(
+    const PointsToGraph & pointsToGraph,
+    std::unique_ptr<const PointsToGraph> ownedPointsToGraph)
+    : OwnedPointsToGraph_(std::move(ownedPointsToGraph)),
+      PointsToGraph_(pointsToGraph)
+{}
+
+MemoryNodeSet
+PointsToGraphQuery::ComputeOutputNodes(const rvsdg::output & output) const
+{
+  auto collectTargets = [](const PointsToGraph::Node & node)
+  {
+    MemoryNodeSet memoryNodes;
+    for (auto & memoryNode : node.Targets())
+      memoryNodes.Insert(&memoryNode);
+
+    return memoryNodes;
+  };
+
+  try
+  {
+    return collectTargets(PointsToGraph_.GetRegisterNode(output));
+  }
+  catch (const util::error &)
+  {}
+
+  try
+  {
+    return collectTargets(PointsToGraph_.GetRegisterSetNode(output));
+  }
+  catch (const util::error &)
+  {}
+
+  throw util::error("Cannot find register in points-to graph.");
+}
+
+std::unique_ptr<PointsToGraphQuery>
+PointsToGraphQuery::Create(const PointsToGraph & pointsToGraph)
+{
+  return std::unique_ptr<PointsToGraphQuery>(new PointsToGraphQuery(pointsToGraph, nullptr));
+}
+
+std::unique_ptr<PointsToGraphQuery>
+PointsToGraphQuery::Create(std::unique_ptr<const PointsToGraph> pointsToGraph)
+{
+  auto & graph = *pointsToGraph;
+  return std::unique_ptr<PointsToGraphQuery>(new PointsToGraphQuery(graph, std::move(pointsToGraph)));
+}
+
+}
@@ -0,0 +1,132 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_LLVM_OPT_ALIAS_ANALYSES_POINTSTOQUERY_HPP
+#define JLM_LLVM_OPT_ALIAS_ANALYSES_POINTSTOQUERY_HPP
+
+#include <jlm/llvm/opt/alias-analyses/MemoryNodeSet.hpp>
+#include <jlm/llvm/opt/alias-analyses/PointsToGraph.hpp>
+#include <jlm/util/LruCache.hpp>
+
+#include <memory>
+#include <mutex>
+
+namespace jlm::llvm::aa
+{
+
+/** \brief Demand-driven points-to queries
+ *
+ * Answers which points-to graph memory nodes the value of an RVSDG output may point to. Alias
+ * analyses can implement this interface on top of their internal representation. This way, only
+ * the memory nodes of the points-to graph need to be created, while the points-to sets of the
+ * registers are computed on demand instead of being materialized as register nodes and edges.
+ *
+ * The results of the most recent queries are kept in an LRU cache with a fixed capacity. Queries
+ * are serialized by a lock, such that a query object can be shared between threads.
+ *
+ * @see AliasAnalysis::AnalyzeOnDemand()
+ */
+class PointsToQuery
+{
+public:
+  static constexpr size_t DefaultCacheCapacity = 4096;
+
+  virtual ~PointsToQuery() noexcept;
+
+  explicit PointsToQuery(size_t cacheCapacity = DefaultCacheCapacity);
+
+  PointsToQuery(const PointsToQuery &) = delete;
+
+  PointsToQuery &
+  operator=(const PointsToQuery &) = delete;
+
+  /**
+   * @return The points-to graph with the memory nodes of the queries. Depending on the
+   * implementation, the graph might contain neither register nodes nor edges.
+   */
+  [[nodiscard]] virtual const PointsToGraph &
+  GetPointsToGraph() const noexcept = 0;
+
+  /**
+   * @param output An RVSDG output of pointer type.
+   *
+   * @return The memory nodes \p output may point to.
+   *
+   * @throws util::error if \p output is unknown to the alias analysis.
+   */
+  [[nodiscard]] MemoryNodeSet
+  GetOutputNodes(const rvsdg::output & output) const;
+
+  [[nodiscard]] size_t
+  NumCacheHits() const
+  {
+    std::lock_guard lock(CacheMutex_);
+    return Cache_.NumHits();
+  }
+
+  [[nodiscard]] size_t
+  NumCacheMisses() const
+  {
+    std::lock_guard lock(CacheMutex_);
+    return Cache_.NumMisses();
+  }
+
+protected:
+  /**
+   * Computes the memory nodes \p output may point to. Invoked by GetOutputNodes() if \p output is
+   * not cached. The invocation holds the cache lock, such that implementations can lazily update
+   * their internal state without further synchronization.
+   */
+  [[nodiscard]] virtual MemoryNodeSet
+  ComputeOutputNodes(const rvsdg::output & output) const = 0;
+
+private:
+  mutable std::mutex CacheMutex_;
+  mutable util::LruCache<const rvsdg::output *, MemoryNodeSet> Cache_;
+};
+
+/** \brief Points-to queries on a fully constructed points-to graph
+ *
+ * Answers the queries from the register nodes and register set nodes of a PointsToGraph.
+ */
+class PointsToGraphQuery final : public PointsToQuery
+{
+  PointsToGraphQuery(
+      const PointsToGraph & pointsToGraph,
+      std::unique_ptr<const PointsToGraph> ownedPointsToGraph);
+
+public:
+  ~PointsToGraphQuery() noexcept override;
+
+  [[nodiscard]] const PointsToGraph &
+  GetPointsToGraph() const noexcept override
+  {
+    return PointsToGraph_;
+  }
+
+  /**
+   * Creates a PointsToGraphQuery for \p pointsToGraph. The points-to graph must outlive the query.
+   */
+  static std::unique_ptr<PointsToGraphQuery>
+  Create(const PointsToGraph & pointsToGraph);
+
+  /**
+   * Creates a PointsToGraphQuery that takes ownership of \p pointsToGraph.
+   */
+  static std::unique_ptr<PointsToGraphQuery>
+  Create(std::unique_ptr<const PointsToGraph> pointsToGraph);
+
+protected:
+  [[nodiscard]] MemoryNodeSet
+  ComputeOutputNodes(const rvsdg::output & output) const override;
+
+private:
+  std::unique_ptr<const PointsToGraph> OwnedPointsToGraph_;
+  const PointsToGraph & PointsToGraph_;
+};
+
+}
+
+#endif // JLM_LLVM_OPT_ALIAS_ANALYSES_POINTSTOQUERY_HPP
@@ -9,7 +9,10 @@
 #include <jlm/llvm/ir/RvsdgModule.hpp>
 #include <jlm/llvm/opt/alias-analyses/RegionAwareMemoryNodeProvider.hpp>
 #include <jlm/rvsdg/traverser.hpp>
+#include <jlm/util/ThreadPool.hpp>
 
+#include <functional>
+#include <limits>
 #include <typeindex>
 
 namespace jlm::llvm::aa
@@ -32,10 +35,10 @@ public:
   RegionSummary &
   operator=(RegionSummary &&) = delete;
 
-  const util::HashSet<const PointsToGraph::MemoryNode *> &
+  const MemoryNodeSet &
   GetMemoryNodes() const
   {
-    return MemoryNodes_;
+    return SharedMemoryNodes_ ? *SharedMemoryNodes_ : MemoryNodes_;
   }
 
   [[nodiscard]] const util::HashSet<const jlm::rvsdg::simple_node *> &
@@ -44,16 +47,13 @@ public:
     return UnknownMemoryNodeReferences_;
   }
 
+  /**
+   * @return The direct calls, both recursive and non-recursive, contained in the region.
+   */
   const util::HashSet<const CallNode *> &
-  GetNonRecursiveCalls() const
-  {
-    return NonRecursiveCalls_;
-  }
-
-  const util::HashSet<const CallNode *> &
-  GetRecursiveCalls() const
+  GetDirectCalls() const
   {
-    return RecursiveCalls_;
+    return DirectCalls_;
   }
 
   const util::HashSet<const jlm::rvsdg::structural_node *> &
@@ -63,33 +63,37 @@ public:
   }
 
   void
-  AddMemoryNodes(const util::HashSet<const PointsToGraph::MemoryNode *> & memoryNodes)
+  AddMemoryNodes(const MemoryNodeSet & memoryNodes)
   {
+    JLM_ASSERT(SharedMemoryNodes_ == nullptr);
     MemoryNodes_.UnionWith(memoryNodes);
   }
 
+  /**
+   * Replaces the memory nodes of the region summary with their canonical instance from \p pool.
+   * No memory nodes can be added to the region summary afterwards.
+   */
   void
-  AddUnknownMemoryNodeReferences(const util::HashSet<const jlm::rvsdg::simple_node *> & nodes)
+  ShareMemoryNodes(MemoryNodeSetPool & pool)
   {
-    UnknownMemoryNodeReferences_.UnionWith(nodes);
+    JLM_ASSERT(SharedMemoryNodes_ == nullptr);
+    SharedMemoryNodes_ = &pool.Intern(std::move(MemoryNodes_));
+    MemoryNodes_.Clear();
   }
 
   void
-  AddNonRecursiveDirectCall(const CallNode & callNode)
+  AddUnknownMemoryNodeReferences(const util::HashSet<const jlm::rvsdg::simple_node *> & nodes)
   {
-    JLM_ASSERT(
-        CallNode::ClassifyCall(callNode)->GetCallType()
-        == CallTypeClassifier::CallType::NonRecursiveDirectCall);
-    NonRecursiveCalls_.Insert(&callNode);
+    UnknownMemoryNodeReferences_.UnionWith(nodes);
   }
 
   void
-  AddRecursiveDirectCall(const CallNode & callNode)
+  AddDirectCall(const CallNode & callNode)
   {
     JLM_ASSERT(
-        CallNode::ClassifyCall(callNode)->GetCallType()
-        == CallTypeClassifier::CallType::RecursiveDirectCall);
-    RecursiveCalls_.Insert(&callNode);
+        CallNode::ClassifyCall(callNode)->IsNonRecursiveDirectCall()
+        || CallNode::ClassifyCall(callNode)->IsRecursiveDirectCall());
+    DirectCalls_.Insert(&callNode);
   }
 
   void
@@ -119,11 +123,11 @@ public:
 
 private:
   const jlm::rvsdg::region * Region_;
-  util::HashSet<const PointsToGraph::MemoryNode *> MemoryNodes_;
+  MemoryNodeSet MemoryNodes_;
+  const MemoryNodeSet * SharedMemoryNodes_ = nullptr;
   util::HashSet<const jlm::rvsdg::simple_node *> UnknownMemoryNodeReferences_;
 
-  util::HashSet<const CallNode *> RecursiveCalls_;
-  util::HashSet<const CallNode *> NonRecursiveCalls_;
+  util::HashSet<const CallNode *> DirectCalls_;
   util::HashSet<const jlm::rvsdg::structural_node *> StructuralNodes_;
 };
 
@@ -205,8 +209,12 @@ class RegionAwareMemoryNodeProvisioning final : public MemoryNodeProvisioning
   using RegionSummaryConstRange = util::iterator_range<RegionSummaryConstIterator>;
 
 public:
-  explicit RegionAwareMemoryNodeProvisioning(const PointsToGraph & pointsToGraph)
-      : PointsToGraph_(pointsToGraph)
+  RegionAwareMemoryNodeProvisioning(
+      const PointsToQuery & pointsToQuery,
+      std::unique_ptr<const PointsToQuery> ownedPointsToQuery)
+      : OwnedPointsToQuery_(std::move(ownedPointsToQuery)),
+        PointsToQuery_(pointsToQuery),
+        PointsToGraph_(pointsToQuery.GetPointsToGraph())
   {}
 
   RegionAwareMemoryNodeProvisioning(const RegionAwareMemoryNodeProvisioning &) = delete;
@@ -225,21 +233,21 @@ public:
     return PointsToGraph_;
   }
 
-  [[nodiscard]] const util::HashSet<const PointsToGraph::MemoryNode *> &
+  [[nodiscard]] const MemoryNodeSet &
   GetRegionEntryNodes(const jlm::rvsdg::region & region) const override
   {
     auto & regionSummary = GetRegionSummary(region);
     return regionSummary.GetMemoryNodes();
   }
 
-  [[nodiscard]] const util::HashSet<const PointsToGraph::MemoryNode *> &
+  [[nodiscard]] const MemoryNodeSet &
   GetRegionExitNodes(const jlm::rvsdg::region & region) const override
   {
     auto & regionSummary = GetRegionSummary(region);
     return regionSummary.GetMemoryNodes();
   }
 
-  [[nodiscard]] const util::HashSet<const PointsToGraph::MemoryNode *> &
+  [[nodiscard]] const MemoryNodeSet &
   GetCallEntryNodes(const CallNode & callNode) const override
   {
     auto callTypeClassifier = CallNode::ClassifyCall(callNode);
@@ -267,7 +275,7 @@ public:
     JLM_UNREACHABLE("Unhandled call type.");
   }
 
-  [[nodiscard]] const util::HashSet<const PointsToGraph::MemoryNode *> &
+  [[nodiscard]] const MemoryNodeSet &
   GetCallExitNodes(const CallNode & callNode) const override
   {
     auto callTypeClassifier = CallNode::ClassifyCall(callNode);
@@ -295,19 +303,10 @@ public:
     JLM_UNREACHABLE("Unhandled call type!");
   }
 
-  [[nodiscard]] util::HashSet<const PointsToGraph::MemoryNode *>
+  [[nodiscard]] MemoryNodeSet
   GetOutputNodes(const jlm::rvsdg::output & output) const override
   {
-    JLM_ASSERT(is<PointerType>(output.type()));
-
-    util::HashSet<const PointsToGraph::MemoryNode *> memoryNodes;
-    if (GetOutputNodesFromRegisterNode(output, memoryNodes))
-      return memoryNodes;
-
-    if (GetOutputNodesFromRegisterSetNode(output, memoryNodes))
-      return memoryNodes;
-
-    throw util::error("Cannot find register in points-to graph.");
+    return PointsToQuery_.GetOutputNodes(output);
   }
 
   RegionSummaryConstRange
@@ -336,12 +335,30 @@ public:
     return *RegionSummaries_.find(&region)->second;
   }
 
-  const util::HashSet<const PointsToGraph::MemoryNode *> &
+  const MemoryNodeSet &
   GetExternalFunctionNodes(const jlm::rvsdg::argument & import) const
   {
     JLM_ASSERT(ContainsExternalFunctionNodes(import));
 
-    return (*ExternalFunctionNodes_.find(&import)).second;
+    return *ExternalFunctionNodes_.find(&import)->second;
+  }
+
+  /**
+   * @return The memory nodes that are required for a call to an external function, i.e., all
+   * escaped memory nodes and the external memory node.
+   */
+  const MemoryNodeSet &
+  GetExternalCallNodes()
+  {
+    if (ExternalCallNodes_ == nullptr)
+    {
+      MemoryNodeSet memoryNodes;
+      memoryNodes.UnionWith(PointsToGraph_.GetEscapedMemoryNodes());
+      memoryNodes.Insert(&PointsToGraph_.GetExternalMemoryNode());
+      ExternalCallNodes_ = &MemoryNodeSets_.Intern(std::move(memoryNodes));
+    }
+
+    return *ExternalCallNodes_;
   }
 
   RegionSummary &
@@ -356,18 +373,48 @@ public:
   }
 
   void
-  AddExternalFunctionNodes(
-      const jlm::rvsdg::argument & import,
-      util::HashSet<const PointsToGraph::MemoryNode *> memoryNodes)
+  AddExternalFunctionNodes(const jlm::rvsdg::argument & import, const MemoryNodeSet & memoryNodes)
   {
     JLM_ASSERT(!ContainsExternalFunctionNodes(import));
-    ExternalFunctionNodes_[&import] = std::move(memoryNodes);
+    ExternalFunctionNodes_[&import] = &MemoryNodeSets_.Intern(memoryNodes);
+  }
+
+  /**
+   * Interns the memory nodes of all region summaries, such that region summaries with identical
+   * memory nodes share a single set. This must only be invoked once the provisioning is complete.
+   */
+  void
+  ShareMemoryNodeSets()
+  {
+    for (auto & [region, regionSummary] : RegionSummaries_)
+      regionSummary->ShareMemoryNodes(MemoryNodeSets_);
+  }
+
+  [[nodiscard]] const MemoryNodeSetPool &
+  GetMemoryNodeSets() const noexcept
+  {
+    return MemoryNodeSets_;
+  }
+
+  [[nodiscard]] size_t
+  NumRegionSummaries() const noexcept
+  {
+    return RegionSummaries_.size();
   }
 
+  /**
+   * Creates a provisioning that answers the points-to queries with \p pointsToQuery. The
+   * provisioning takes ownership of \p ownedPointsToQuery, which can be used to keep the query
+   * alive for as long as the provisioning exists.
+   */
   static std::unique_ptr<RegionAwareMemoryNodeProvisioning>
-  Create(const PointsToGraph & pointsToGraph)
+  Create(
+      const PointsToQuery & pointsToQuery,
+      std::unique_ptr<const PointsToQuery> ownedPointsToQuery = nullptr)
   {
-    return std::make_unique<RegionAwareMemoryNodeProvisioning>(pointsToGraph);
+    return std::make_unique<RegionAwareMemoryNodeProvisioning>(
+        pointsToQuery,
+        std::move(ownedPointsToQuery));
   }
 
   /**
@@ -443,15 +490,7 @@ public:
         }
       }
 
-      for (auto & callNode : regionSummary.GetNonRecursiveCalls().Items())
-      {
-        if (!CheckInvariantsCall(*callNode))
-        {
-          return false;
-        }
-      }
-
-      for (auto & callNode : regionSummary.GetRecursiveCalls().Items())
+      for (auto & callNode : regionSummary.GetDirectCalls().Items())
       {
         if (!CheckInvariantsCall(*callNode))
         {
@@ -464,71 +503,286 @@ public:
   }
 
 private:
+  [[nodiscard]] const MemoryNodeSet &
+  GetIndirectCallNodes(const CallNode & callNode) const
+  {
+    /*
+     * We have no idea about the function of an indirect call. This means that we have to be
+     * conservative and sequentialize this indirect call with respect to all memory references that
+     * came before and after it. These references should have been routed through the region the
+     * indirect call node lives in. Thus, we can just use here the memory nodes of the region of the
+     * indirect call node.
+     */
+    auto & regionSummary = GetRegionSummary(*callNode.region());
+    return regionSummary.GetMemoryNodes();
+  }
+
+  RegionSummaryMap RegionSummaries_;
+  std::unique_ptr<const PointsToQuery> OwnedPointsToQuery_;
+  const PointsToQuery & PointsToQuery_;
+  const PointsToGraph & PointsToGraph_;
+  std::unordered_map<const jlm::rvsdg::argument *, const MemoryNodeSet *> ExternalFunctionNodes_;
+  const MemoryNodeSet * ExternalCallNodes_ = nullptr;
+  MemoryNodeSetPool MemoryNodeSets_;
+};
+
+/** \brief Condensation of the direct call graph into strongly connected components
+ *
+ * The functions of the call graph are all lambda nodes in the root region and in phi nodes, and
+ * its edges are the direct calls annotated in the region summaries of the lambda nodes. The strongly
+ * connected components (SCCs) are computed with Tarjan's algorithm and are numbered bottom-up,
+ * i.e., an SCC has a higher index than all SCCs it calls.
+ *
+ * The SCCs are further grouped into levels. The level of an SCC is one more than the highest level
+ * of all SCCs it calls, and SCCs without calls to other SCCs form level zero. The SCCs of a level
+ * do not call each other and can therefore be processed independently.
+ */
+class CallGraphCondensation final
+{
+public:
+  CallGraphCondensation(const CallGraphCondensation &) = delete;
+
+  CallGraphCondensation &
+  operator=(const CallGraphCondensation &) = delete;
+
+  [[nodiscard]] size_t
+  NumSccs() const noexcept
+  {
+    return Sccs_.size();
+  }
+
+  [[nodiscard]] const std::vector<const lambda::node *> &
+  GetScc(size_t scc) const noexcept
+  {
+    JLM_ASSERT(scc < NumSccs());
+    return Sccs_[scc];
+  }
+
+  /**
+   * @return True if the SCC with index \p scc contains a call to one of its own lambda nodes.
+   */
   [[nodiscard]] bool
-  GetOutputNodesFromRegisterNode(
-      const rvsdg::output & output,
-      util::HashSet<const PointsToGraph::MemoryNode *> & memoryNodes) const
+  IsRecursive(size_t scc) const noexcept
+  {
+    JLM_ASSERT(scc < NumSccs());
+    return IsRecursive_[scc];
+  }
+
+  [[nodiscard]] size_t
+  GetSccIndex(const lambda::node & lambdaNode) const
+  {
+    JLM_ASSERT(Functions_.find(&lambdaNode) != Functions_.end());
+    return SccIndices_[Functions_.find(&lambdaNode)->second];
+  }
+
+  /**
+   * @return The lambda node called by the direct call \p callNode.
+   */
+  [[nodiscard]] const lambda::node &
+  GetCallee(const CallNode & callNode) const
+  {
+    JLM_ASSERT(Callees_.find(&callNode) != Callees_.end());
+    return *Callees_.find(&callNode)->second;
+  }
+
+  [[nodiscard]] size_t
+  NumLevels() const noexcept
+  {
+    return Levels_.size();
+  }
+
+  /**
+   * @return The indices of the SCCs of level \p level.
+   */
+  [[nodiscard]] const std::vector<size_t> &
+  GetLevel(size_t level) const noexcept
+  {
+    JLM_ASSERT(level < NumLevels());
+    return Levels_[level];
+  }
+
+  static std::unique_ptr<CallGraphCondensation>
+  Create(const RvsdgModule & rvsdgModule, const RegionAwareMemoryNodeProvisioning & provisioning)
   {
-    const PointsToGraph::RegisterNode * registerNode;
-    try
+    std::unique_ptr<CallGraphCondensation> callGraph(new CallGraphCondensation());
+    callGraph->CollectFunctions(*rvsdgModule.Rvsdg().root());
+    callGraph->CollectCalls(provisioning);
+    callGraph->ComputeSccs();
+    callGraph->ComputeLevels();
+    return callGraph;
+  }
+
+private:
+  CallGraphCondensation() = default;
+
+  void
+  CollectFunctions(const jlm::rvsdg::region & rootRegion)
+  {
+    auto addFunction = [&](const lambda::node & lambdaNode)
     {
-      registerNode = &PointsToGraph_.GetRegisterNode(output);
-    }
-    catch (...)
+      Functions_[&lambdaNode] = Lambdas_.size();
+      Lambdas_.push_back(&lambdaNode);
+    };
+
+    for (auto & node : rootRegion.nodes)
     {
-      return false;
+      if (auto lambdaNode = dynamic_cast<const lambda::node *>(&node))
+      {
+        addFunction(*lambdaNode);
+      }
+      else if (auto phiNode = dynamic_cast<const phi::node *>(&node))
+      {
+        for (auto lambdaNode : phi::node::ExtractLambdaNodes(*phiNode))
+          addFunction(*lambdaNode);
+      }
     }
+  }
+
+  void
+  CollectCalls(const RegionAwareMemoryNodeProvisioning & provisioning)
+  {
+    std::function<void(size_t, const jlm::rvsdg::region &)> collectCalls =
+        [&](size_t caller, const jlm::rvsdg::region & region)
+    {
+      auto & regionSummary = provisioning.GetRegionSummary(region);
+      for (auto & callNode : regionSummary.GetDirectCalls().Items())
+      {
+        auto callTypeClassifier = CallNode::ClassifyCall(*callNode);
+        auto callee = callTypeClassifier->GetLambdaOutput().node();
+        JLM_ASSERT(Functions_.find(callee) != Functions_.end());
 
-    for (auto & memoryNode : registerNode->Targets())
-      memoryNodes.Insert(&memoryNode);
+        Callees_[callNode] = callee;
+        Edges_[caller].push_back(Functions_[callee]);
+      }
 
-    return true;
+      for (auto & structuralNode : regionSummary.GetStructuralNodes().Items())
+      {
+        for (size_t n = 0; n < structuralNode->nsubregions(); n++)
+          collectCalls(caller, *structuralNode->subregion(n));
+      }
+    };
+
+    Edges_.resize(Lambdas_.size());
+    for (size_t n = 0; n < Lambdas_.size(); n++)
+      collectCalls(n, *Lambdas_[n]->subregion());
   }
 
-  [[nodiscard]] bool
-  GetOutputNodesFromRegisterSetNode(
-      const rvsdg::output & output,
-      util::HashSet<const PointsToGraph::MemoryNode *> & memoryNodes) const
+  /**
+   * Computes the SCCs with an iterative version of Tarjan's algorithm, such that deep call chains
+   * do not exhaust the stack.
+   */
+  void
+  ComputeSccs()
   {
-    const PointsToGraph::RegisterSetNode * registerSetNode;
-    try
-    {
-      registerSetNode = &PointsToGraph_.GetRegisterSetNode(output);
-    }
-    catch (...)
+    static constexpr size_t Unvisited = std::numeric_limits<size_t>::max();
+
+    const auto numFunctions = Lambdas_.size();
+    std::vector<size_t> order(numFunctions, Unvisited);
+    std::vector<size_t> lowLink(numFunctions, 0);
+    std::vector<bool> onStack(numFunctions, false);
+    std::vector<size_t> stack;
+    std::vector<std::pair<size_t, size_t>> callStack;
+    SccIndices_.resize(numFunctions);
+
+    size_t nextOrder = 0;
+    for (size_t root = 0; root < numFunctions; root++)
     {
-      return false;
-    }
+      if (order[root] != Unvisited)
+        continue;
+
+      callStack.emplace_back(root, 0);
+      while (!callStack.empty())
+      {
+        auto & [function, nextEdge] = callStack.back();
+        if (nextEdge == 0)
+        {
+          order[function] = lowLink[function] = nextOrder++;
+          stack.push_back(function);
+          onStack[function] = true;
+        }
 
-    for (auto & memoryNode : registerSetNode->Targets())
-      memoryNodes.Insert(&memoryNode);
+        if (nextEdge < Edges_[function].size())
+        {
+          auto callee = Edges_[function][nextEdge++];
+          if (order[callee] == Unvisited)
+            callStack.emplace_back(callee, 0);
+          else if (onStack[callee])
+            lowLink[function] = std::min(lowLink[function], order[callee]);
+          continue;
+        }
 
-    return true;
+        if (lowLink[function] == order[function])
+        {
+          std::vector<const lambda::node *> scc;
+          size_t member = 0;
+          do
+          {
+            member = stack.back();
+            stack.pop_back();
+            onStack[member] = false;
+            SccIndices_[member] = Sccs_.size();
+            scc.push_back(Lambdas_[member]);
+          } while (member != function);
+          Sccs_.push_back(std::move(scc));
+        }
+
+        auto finished = function;
+        callStack.pop_back();
+        if (!callStack.empty())
+        {
+          auto caller = callStack.back().first;
+          lowLink[caller] = std::min(lowLink[caller], lowLink[finished]);
+        }
+      }
+    }
   }
 
-  [[nodiscard]] const util::HashSet<const PointsToGraph::MemoryNode *> &
-  GetIndirectCallNodes(const CallNode & callNode) const
+  void
+  ComputeLevels()
   {
-    /*
-     * We have no idea about the function of an indirect call. This means that we have to be
-     * conservative and sequentialize this indirect call with respect to all memory references that
-     * came before and after it. These references should have been routed through the region the
-     * indirect call node lives in. Thus, we can just use here the memory nodes of the region of the
-     * indirect call node.
-     */
-    auto & regionSummary = GetRegionSummary(*callNode.region());
-    return regionSummary.GetMemoryNodes();
+    IsRecursive_.resize(NumSccs(), false);
+    std::vector<size_t> levels(NumSccs(), 0);
+
+    // Tarjan's algorithm emits an SCC only after all SCCs it calls
+    for (size_t scc = 0; scc < NumSccs(); scc++)
+    {
+      for (auto lambdaNode : Sccs_[scc])
+      {
+        for (auto callee : Edges_[Functions_[lambdaNode]])
+        {
+          auto calleeScc = SccIndices_[callee];
+          JLM_ASSERT(calleeScc <= scc);
+          if (calleeScc == scc)
+            IsRecursive_[scc] = true;
+          else
+            levels[scc] = std::max(levels[scc], levels[calleeScc] + 1);
+        }
+      }
+
+      if (levels[scc] >= Levels_.size())
+        Levels_.resize(levels[scc] + 1);
+      Levels_[levels[scc]].push_back(scc);
+    }
   }
 
-  RegionSummaryMap RegionSummaries_;
-  const PointsToGraph & PointsToGraph_;
-  std::unordered_map<const jlm::rvsdg::argument *, util::HashSet<const PointsToGraph::MemoryNode *>>
-      ExternalFunctionNodes_;
+  std::vector<const lambda::node *> Lambdas_;
+  std::unordered_map<const lambda::node *, size_t> Functions_;
+  std::unordered_map<const CallNode *, const lambda::node *> Callees_;
+  std::vector<std::vector<size_t>> Edges_;
+
+  std::vector<std::vector<const lambda::node *>> Sccs_;
+  std::vector<size_t> SccIndices_;
+  std::vector<bool> IsRecursive_;
+  std::vector<std::vector<size_t>> Levels_;
 };
 
 RegionAwareMemoryNodeProvider::~RegionAwareMemoryNodeProvider() noexcept = default;
 
-RegionAwareMemoryNodeProvider::RegionAwareMemoryNodeProvider() = default;
+RegionAwareMemoryNodeProvider::RegionAwareMemoryNodeProvider(size_t numThreads)
+    : NumThreads_(numThreads)
+{
+  JLM_ASSERT(NumThreads_ > 0);
+}
 
 std::unique_ptr<MemoryNodeProvisioning>
 RegionAwareMemoryNodeProvider::ProvisionMemoryNodes(
@@ -536,14 +790,44 @@ RegionAwareMemoryNodeProvider::ProvisionMemoryNodes(
     const PointsToGraph & pointsToGraph,
     util::StatisticsCollector & statisticsCollector)
 {
-  Provisioning_ = RegionAwareMemoryNodeProvisioning::Create(pointsToGraph);
+  auto pointsToQuery = PointsToGraphQuery::Create(pointsToGraph);
+  auto & pointsToQueryRef = *pointsToQuery;
+  return ProvisionMemoryNodes(
+      rvsdgModule,
+      pointsToQueryRef,
+      std::move(pointsToQuery),
+      statisticsCollector);
+}
+
+std::unique_ptr<MemoryNodeProvisioning>
+RegionAwareMemoryNodeProvider::ProvisionMemoryNodes(
+    const RvsdgModule & rvsdgModule,
+    const PointsToQuery & pointsToQuery,
+    util::StatisticsCollector & statisticsCollector)
+{
+  return ProvisionMemoryNodes(rvsdgModule, pointsToQuery, nullptr, statisticsCollector);
+}
+
+std::unique_ptr<MemoryNodeProvisioning>
+RegionAwareMemoryNodeProvider::ProvisionMemoryNodes(
+    const RvsdgModule & rvsdgModule,
+    const PointsToQuery & pointsToQuery,
+    std::unique_ptr<const PointsToQuery> ownedPointsToQuery,
+    util::StatisticsCollector & statisticsCollector)
+{
+  Provisioning_ =
+      RegionAwareMemoryNodeProvisioning::Create(pointsToQuery, std::move(ownedPointsToQuery));
 
-  auto statistics = Statistics::Create(statisticsCollector, rvsdgModule, pointsToGraph);
+  auto statistics =
+      Statistics::Create(statisticsCollector, rvsdgModule, pointsToQuery.GetPointsToGraph());
 
   statistics->StartAnnotationStatistics();
   AnnotateRegion(*rvsdgModule.Rvsdg().root());
   statistics->StopAnnotationStatistics();
 
+  CallGraph_ = CallGraphCondensation::Create(rvsdgModule, *Provisioning_);
+  statistics->AddCallGraphStatistics(CallGraph_->NumSccs(), CallGraph_->NumLevels());
+
   statistics->StartPropagationPass1Statistics();
   Propagate(rvsdgModule);
   statistics->StopPropagationPass1Statistics();
@@ -556,6 +840,12 @@ RegionAwareMemoryNodeProvider::ProvisionMemoryNodes(
   Propagate(rvsdgModule);
   statistics->StopPropagationPass2Statistics();
 
+  Provisioning_->ShareMemoryNodeSets();
+  auto & memoryNodeSets = Provisioning_->GetMemoryNodeSets();
+  statistics->AddMemoryNodeSetStatistics(
+      memoryNodeSets.NumInternRequests(),
+      memoryNodeSets.NumSets());
+
   statisticsCollector.CollectDemandedStatistics(std::move(statistics));
 
   return std::unique_ptr<MemoryNodeProvisioning>(Provisioning_.release());
@@ -565,9 +855,10 @@ std::unique_ptr<MemoryNodeProvisioning>
 RegionAwareMemoryNodeProvider::Create(
     const RvsdgModule & rvsdgModule,
     const PointsToGraph & pointsToGraph,
-    util::StatisticsCollector & statisticsCollector)
+    util::StatisticsCollector & statisticsCollector,
+    size_t numThreads)
 {
-  RegionAwareMemoryNodeProvider provider;
+  RegionAwareMemoryNodeProvider provider(numThreads);
   return provider.ProvisionMemoryNodes(rvsdgModule, pointsToGraph, statisticsCollector);
 }
 
@@ -580,6 +871,17 @@ RegionAwareMemoryNodeProvider::Create(
   return Create(rvsdgModule, pointsToGraph, statisticsCollector);
 }
 
+std::unique_ptr<MemoryNodeProvisioning>
+RegionAwareMemoryNodeProvider::Create(
+    const RvsdgModule & rvsdgModule,
+    const PointsToQuery & pointsToQuery,
+    util::StatisticsCollector & statisticsCollector,
+    size_t numThreads)
+{
+  RegionAwareMemoryNodeProvider provider(numThreads);
+  return provider.ProvisionMemoryNodes(rvsdgModule, pointsToQuery, statisticsCollector);
+}
+
 void
 RegionAwareMemoryNodeProvider::AnnotateRegion(jlm::rvsdg::region & region)
 {
@@ -716,32 +1018,19 @@ RegionAwareMemoryNodeProvider::AnnotateFree(const jlm::rvsdg::simple_node & free
 void
 RegionAwareMemoryNodeProvider::AnnotateCall(const CallNode & callNode)
 {
-  auto annotateNonRecursiveDirectCall =
-      [](auto & provider, auto & callNode, auto & callTypeClassifier)
+  auto annotateDirectCall = [](auto & provider, auto & callNode, auto & callTypeClassifier)
   {
     JLM_ASSERT(
-        callTypeClassifier.GetCallType() == CallTypeClassifier::CallType::NonRecursiveDirectCall);
+        callTypeClassifier.IsNonRecursiveDirectCall() || callTypeClassifier.IsRecursiveDirectCall());
 
     auto & regionSummary = provider.Provisioning_->GetRegionSummary(*callNode.region());
-    regionSummary.AddNonRecursiveDirectCall(callNode);
-  };
-  auto annotateRecursiveDirectCall = [](auto & provider, auto & callNode, auto & callTypeClassifier)
-  {
-    JLM_ASSERT(
-        callTypeClassifier.GetCallType() == CallTypeClassifier::CallType::RecursiveDirectCall);
-
-    auto & regionSummary = provider.Provisioning_->GetRegionSummary(*callNode.region());
-    regionSummary.AddRecursiveDirectCall(callNode);
+    regionSummary.AddDirectCall(callNode);
   };
   auto annotateExternalCall = [](auto & provider, auto & callNode, auto & callTypeClassifier)
   {
     JLM_ASSERT(callTypeClassifier.GetCallType() == CallTypeClassifier::CallType::ExternalCall);
 
-    auto & pointsToGraph = provider.Provisioning_->GetPointsToGraph();
-
-    util::HashSet<const PointsToGraph::MemoryNode *> memoryNodes;
-    memoryNodes.UnionWith(pointsToGraph.GetEscapedMemoryNodes());
-    memoryNodes.Insert(&pointsToGraph.GetExternalMemoryNode());
+    auto & memoryNodes = provider.Provisioning_->GetExternalCallNodes();
 
     auto & import = callTypeClassifier.GetImport();
     auto & regionSummary = provider.Provisioning_->GetRegionSummary(*callNode.region());
@@ -766,9 +1055,8 @@ RegionAwareMemoryNodeProvider::AnnotateCall(const CallNode & callNode)
       std::function<
           void(RegionAwareMemoryNodeProvider &, const CallNode &, const CallTypeClassifier &)>>
       callTypes(
-          { { CallTypeClassifier::CallType::NonRecursiveDirectCall,
-              annotateNonRecursiveDirectCall },
-            { CallTypeClassifier::CallType::RecursiveDirectCall, annotateRecursiveDirectCall },
+          { { CallTypeClassifier::CallType::NonRecursiveDirectCall, annotateDirectCall },
+            { CallTypeClassifier::CallType::RecursiveDirectCall, annotateDirectCall },
             { CallTypeClassifier::CallType::IndirectCall, annotateIndirectCall },
             { CallTypeClassifier::CallType::ExternalCall, annotateExternalCall } });
 
@@ -812,21 +1100,43 @@ RegionAwareMemoryNodeProvider::AnnotateStructuralNode(
 void
 RegionAwareMemoryNodeProvider::Propagate(const RvsdgModule & rvsdgModule)
 {
-  jlm::rvsdg::topdown_traverser traverser(rvsdgModule.Rvsdg().root());
-  for (auto & node : traverser)
+  // The SCCs of a level only read the region summaries of lower levels, and only write the region
+  // summaries of their own lambda nodes. They can therefore be propagated concurrently.
+  std::unique_ptr<util::ThreadPool> threadPool;
+  if (NumThreads_ > 1)
+    threadPool = std::make_unique<util::ThreadPool>(NumThreads_);
+
+  for (size_t level = 0; level < CallGraph_->NumLevels(); level++)
   {
-    if (auto lambdaNode = dynamic_cast<const lambda::node *>(node))
+    auto & sccs = CallGraph_->GetLevel(level);
+    if (!threadPool || sccs.size() == 1)
     {
-      PropagateRegion(*lambdaNode->subregion());
+      for (auto scc : sccs)
+        PropagateScc(scc);
+      continue;
     }
-    else if (auto phiNode = dynamic_cast<const phi::node *>(node))
+
+    std::vector<util::ThreadPool::Task> tasks;
+    tasks.reserve(sccs.size());
+    for (auto scc : sccs)
+      tasks.emplace_back(
+          [this, scc](size_t)
+          {
+            PropagateScc(scc);
+          });
+    threadPool->Run(std::move(tasks));
+  }
+
+  for (auto & node : rvsdgModule.Rvsdg().root()->nodes)
+  {
+    if (auto phiNode = dynamic_cast<const phi::node *>(&node))
     {
       PropagatePhi(*phiNode);
     }
-    else if (dynamic_cast<const delta::node *>(node))
+    else if (dynamic_cast<const lambda::node *>(&node) || dynamic_cast<const delta::node *>(&node))
     {
       /*
-       * Nothing needs to be done for delta nodes.
+       * Lambda nodes were already handled above, and nothing needs to be done for delta nodes.
        */
       continue;
     }
@@ -840,55 +1150,93 @@ RegionAwareMemoryNodeProvider::Propagate(const RvsdgModule & rvsdgModule)
 }
 
 void
-RegionAwareMemoryNodeProvider::PropagatePhi(const phi::node & phiNode)
+RegionAwareMemoryNodeProvider::PropagateScc(size_t scc)
 {
-  std::function<void(
-      const jlm::rvsdg::region &,
-      const util::HashSet<const PointsToGraph::MemoryNode *> &,
-      const util::HashSet<const jlm::rvsdg::simple_node *> &)>
-      assignAndPropagateMemoryNodes =
-          [&](const jlm::rvsdg::region & region,
-              const util::HashSet<const PointsToGraph::MemoryNode *> & memoryNodes,
-              const util::HashSet<const jlm::rvsdg::simple_node *> & unknownMemoryNodeReferences)
-  {
-    auto & regionSummary = Provisioning_->GetRegionSummary(region);
-    for (auto structuralNode : regionSummary.GetStructuralNodes().Items())
-    {
-      for (size_t n = 0; n < structuralNode->nsubregions(); n++)
-      {
-        auto & subregion = *structuralNode->subregion(n);
-        assignAndPropagateMemoryNodes(subregion, memoryNodes, unknownMemoryNodeReferences);
+  auto & lambdaNodes = CallGraph_->GetScc(scc);
+  for (auto lambdaNode : lambdaNodes)
+    PropagateRegion(*lambdaNode->subregion(), scc);
 
-        auto & subregionSummary = Provisioning_->GetRegionSummary(subregion);
-        if (subregionSummary.GetRecursiveCalls().Size() != 0)
-        {
-          subregionSummary.AddMemoryNodes(memoryNodes);
-          subregionSummary.AddUnknownMemoryNodeReferences(unknownMemoryNodeReferences);
-          RegionSummary::Propagate(regionSummary, subregionSummary);
-        }
-      }
-    }
-  };
-
-  auto & phiNodeSubregion = *phiNode.subregion();
-  PropagateRegion(phiNodeSubregion);
-
-  auto lambdaNodes = phi::node::ExtractLambdaNodes(phiNode);
+  if (!CallGraph_->IsRecursive(scc))
+    return;
 
-  util::HashSet<const PointsToGraph::MemoryNode *> memoryNodes;
+  /*
+   * The lambda nodes of a recursive SCC can (transitively) invoke each other. All of them, as well
+   * as all regions that contain a call to one of them, therefore require the memory nodes of the
+   * entire SCC.
+   */
+  MemoryNodeSet memoryNodes;
   util::HashSet<const jlm::rvsdg::simple_node *> unknownMemoryNodeReferences;
-  for (auto & lambdaNode : lambdaNodes)
+  for (auto lambdaNode : lambdaNodes)
   {
     auto & regionSummary = Provisioning_->GetRegionSummary(*lambdaNode->subregion());
     memoryNodes.UnionWith(regionSummary.GetMemoryNodes());
     unknownMemoryNodeReferences.UnionWith(regionSummary.GetUnknownMemoryNodeReferences());
   }
 
-  assignAndPropagateMemoryNodes(phiNodeSubregion, memoryNodes, unknownMemoryNodeReferences);
+  for (auto lambdaNode : lambdaNodes)
+  {
+    auto & lambdaSubregion = *lambdaNode->subregion();
+    AssignSccSummary(lambdaSubregion, scc, memoryNodes, unknownMemoryNodeReferences);
+
+    auto & regionSummary = Provisioning_->GetRegionSummary(lambdaSubregion);
+    regionSummary.AddMemoryNodes(memoryNodes);
+    regionSummary.AddUnknownMemoryNodeReferences(unknownMemoryNodeReferences);
+  }
+}
+
+bool
+RegionAwareMemoryNodeProvider::AssignSccSummary(
+    const jlm::rvsdg::region & region,
+    size_t scc,
+    const MemoryNodeSet & memoryNodes,
+    const util::HashSet<const jlm::rvsdg::simple_node *> & unknownMemoryNodeReferences)
+{
+  auto & regionSummary = Provisioning_->GetRegionSummary(region);
+
+  bool callsScc = false;
+  for (auto & callNode : regionSummary.GetDirectCalls().Items())
+  {
+    auto & callee = CallGraph_->GetCallee(*callNode);
+    callsScc |= CallGraph_->GetSccIndex(callee) == scc;
+  }
+
+  for (auto & structuralNode : regionSummary.GetStructuralNodes().Items())
+  {
+    for (size_t n = 0; n < structuralNode->nsubregions(); n++)
+    {
+      auto & subregion = *structuralNode->subregion(n);
+      callsScc |= AssignSccSummary(subregion, scc, memoryNodes, unknownMemoryNodeReferences);
+    }
+  }
+
+  if (callsScc)
+  {
+    regionSummary.AddMemoryNodes(memoryNodes);
+    regionSummary.AddUnknownMemoryNodeReferences(unknownMemoryNodeReferences);
+  }
+
+  return callsScc;
 }
 
 void
-RegionAwareMemoryNodeProvider::PropagateRegion(const jlm::rvsdg::region & region)
+RegionAwareMemoryNodeProvider::PropagatePhi(const phi::node & phiNode)
+{
+  auto & regionSummary = Provisioning_->GetRegionSummary(*phiNode.subregion());
+  for (auto & structuralNode : regionSummary.GetStructuralNodes().Items())
+  {
+    if (auto innerPhiNode = dynamic_cast<const phi::node *>(structuralNode))
+      PropagatePhi(*innerPhiNode);
+
+    for (size_t n = 0; n < structuralNode->nsubregions(); n++)
+    {
+      auto & subregionSummary = Provisioning_->GetRegionSummary(*structuralNode->subregion(n));
+      RegionSummary::Propagate(regionSummary, subregionSummary);
+    }
+  }
+}
+
+void
+RegionAwareMemoryNodeProvider::PropagateRegion(const jlm::rvsdg::region & region, size_t scc)
 {
   auto & regionSummary = Provisioning_->GetRegionSummary(region);
   for (auto & structuralNode : regionSummary.GetStructuralNodes().Items())
@@ -896,19 +1244,20 @@ RegionAwareMemoryNodeProvider::PropagateRegion(const jlm::rvsdg::region & region
     for (size_t n = 0; n < structuralNode->nsubregions(); n++)
     {
       auto & subregion = *structuralNode->subregion(n);
-      PropagateRegion(subregion);
+      PropagateRegion(subregion, scc);
 
       auto & subregionSummary = Provisioning_->GetRegionSummary(subregion);
       RegionSummary::Propagate(regionSummary, subregionSummary);
     }
   }
 
-  for (auto & callNode : regionSummary.GetNonRecursiveCalls().Items())
+  for (auto & callNode : regionSummary.GetDirectCalls().Items())
   {
-    auto callTypeClassifier = CallNode::ClassifyCall(*callNode);
-    auto & lambdaRegion = *callTypeClassifier->GetLambdaOutput().node()->subregion();
-    auto & lambdaRegionSummary = Provisioning_->GetRegionSummary(lambdaRegion);
+    auto & callee = CallGraph_->GetCallee(*callNode);
+    if (CallGraph_->GetSccIndex(callee) == scc)
+      continue;
 
+    auto & lambdaRegionSummary = Provisioning_->GetRegionSummary(*callee.subregion());
     RegionSummary::Propagate(regionSummary, lambdaRegionSummary);
   }
 }
@@ -14,6 +14,7 @@
 namespace jlm::llvm::aa
 {
 
+class CallGraphCondensation;
 class RegionAwareMemoryNodeProvisioning;
 
 /** \brief Region-aware memory node provider
@@ -29,7 +30,8 @@ class RegionAwareMemoryNodeProvisioning;
  *
  * 2. Propagation: The memory locations and RVSDG nodes that reference unknown memory locations are
  * propagated through the graph such that a region always has the same memory locations and RVSDG
- * nodes annotated as its contained structural nodes and function calls.
+ * nodes annotated as its contained structural nodes and function calls. The propagation proceeds
+ * bottom-up over the strongly connected components of the call graph.
  *
  * 3. Resolution of unknown memory locations: The unknown memory location references are resolved by
  * annotating the regions of the corresponding RVSDG nodes with all the memory locations that are
@@ -48,7 +50,11 @@ public:
 
   ~RegionAwareMemoryNodeProvider() noexcept override;
 
-  RegionAwareMemoryNodeProvider();
+  /**
+   * @param numThreads The number of threads used for propagating independent strongly connected
+   * components of the call graph concurrently.
+   */
+  explicit RegionAwareMemoryNodeProvider(size_t numThreads = 1);
 
   RegionAwareMemoryNodeProvider(const RegionAwareMemoryNodeProvider &) = delete;
 
@@ -66,12 +72,19 @@ public:
       const PointsToGraph & pointsToGraph,
       jlm::util::StatisticsCollector & statisticsCollector) override;
 
+  std::unique_ptr<MemoryNodeProvisioning>
+  ProvisionMemoryNodes(
+      const RvsdgModule & rvsdgModule,
+      const PointsToQuery & pointsToQuery,
+      jlm::util::StatisticsCollector & statisticsCollector) override;
+
   /**
    * Creates a RegionAwareMemoryNodeProvider and calls the ProvisionMemoryNodes() method.
    *
    * @param rvsdgModule The RVSDG module on which the provision should be performed.
    * @param pointsToGraph The PointsToGraph corresponding to the RVSDG module.
    * @param statisticsCollector The statistics collector for collecting pass statistics.
+   * @param numThreads The number of threads used for the propagation.
    *
    * @return A new instance of MemoryNodeProvisioning.
    */
@@ -79,7 +92,8 @@ public:
   Create(
       const RvsdgModule & rvsdgModule,
       const PointsToGraph & pointsToGraph,
-      jlm::util::StatisticsCollector & statisticsCollector);
+      jlm::util::StatisticsCollector & statisticsCollector,
+      size_t numThreads = 1);
 
   /**
    * Creates a RegionAwareMemoryNodeProvider and calls the ProvisionMemoryNodes() method.
@@ -92,7 +106,37 @@ public:
   static std::unique_ptr<MemoryNodeProvisioning>
   Create(const RvsdgModule & rvsdgModule, const PointsToGraph & pointsToGraph);
 
+  /**
+   * Creates a RegionAwareMemoryNodeProvider and calls the ProvisionMemoryNodes() method.
+   *
+   * @param rvsdgModule The RVSDG module on which the provision should be performed.
+   * @param pointsToQuery The points-to queries corresponding to the RVSDG module.
+   * @param statisticsCollector The statistics collector for collecting pass statistics.
+   * @param numThreads The number of threads used for the propagation.
+   *
+   * @return A new instance of MemoryNodeProvisioning.
+   */
+  static std::unique_ptr<MemoryNodeProvisioning>
+  Create(
+      const RvsdgModule & rvsdgModule,
+      const PointsToQuery & pointsToQuery,
+      jlm::util::StatisticsCollector & statisticsCollector,
+      size_t numThreads = 1);
+
 private:
+  /**
+   * Computes the memory node provisioning with the points-to queries \p pointsToQuery.
+   *
+   * @param ownedPointsToQuery Transferred to the provisioning in order to keep \p pointsToQuery
+   * alive, if the query was created by the provider itself.
+   */
+  std::unique_ptr<MemoryNodeProvisioning>
+  ProvisionMemoryNodes(
+      const RvsdgModule & rvsdgModule,
+      const PointsToQuery & pointsToQuery,
+      std::unique_ptr<const PointsToQuery> ownedPointsToQuery,
+      jlm::util::StatisticsCollector & statisticsCollector);
+
   /**
    * Annotates a region with the memory locations utilized by the contained simple RVSDG nodes,
    * e.g., load, store, etc. nodes, the contained function calls, and the simple RVSDG nodes that
@@ -136,31 +180,56 @@ private:
   AnnotateMemcpy(const jlm::rvsdg::simple_node & memcpyNode);
 
   /**
-   *  Propagates the utilized memory locations and simple RVSDG nodes that reference unknown memory
+   * Propagates the utilized memory locations and simple RVSDG nodes that reference unknown memory
    * locations through the graph such that a region always contains the memory locations and simple
    * RVSDG nodes of its contained structural nodes and function calls.
    *
-   *  The propagation phase traverses the call graph in the RVSDG root region top-down, i.e. a
-   * lambda node is always visited before its function calls. For each lambda node, it propagates
-   * the memory locations and simple RVSDG nodes from the innermost subregions outward to the lambda
-   * region. Moreover, it retrieves the locations and nodes for direct non-recursive calls from the
-   * respective lambda nodes, which have already been visited. This ensures that all required memory
-   * locations that are referenced within the lambda and all simple RVSDG nodes are annotated on the
-   * lambda region. For phi nodes, it propagates the entities similarly as for non-recursive lambda
-   *  nodes, but avoids to follow direct recursive calls to other lambda nodes within the phi
-   * region. After each lambda node of a phi node is handled, the union of the memory locations as
-   * well as the union of the simple RVSDG nodes of all lambdas in the phi node are computed, and
-   * associated with each lambda in the phi node.
+   * The propagation works on the condensation of the direct call graph into its strongly connected
+   * components (SCCs). The SCCs are visited bottom-up, i.e., an SCC is only visited after all SCCs
+   * it calls, and each SCC is visited exactly once. For each lambda node of an SCC, the memory
+   * locations and simple RVSDG nodes are propagated from the innermost subregions outward to the
+   * lambda region, retrieving those of calls to other SCCs from the already visited callees. If the
+   * SCC is recursive, all its lambdas end up with the same memory locations and simple RVSDG nodes,
+   * which are the union over all its lambdas. This union is the fix-point of the SCC, and it is
+   * assigned to all regions that contain calls within the SCC as well as their enclosing regions.
+   *
+   * SCCs that do not depend on each other are visited concurrently if more than one thread is
+   * requested.
    *
    * @param rvsdgModule The RVSDG module on which the propagation is performed.
    *
-   * @see ExtractLambdaNodes()
+   * @see CallGraphCondensation
    */
   void
   Propagate(const RvsdgModule & rvsdgModule);
 
+  /**
+   * Propagates the memory locations and simple RVSDG nodes of the lambda nodes in the SCC with
+   * index \p scc.
+   */
   void
-  PropagateRegion(const jlm::rvsdg::region & region);
+  PropagateScc(size_t scc);
+
+  /**
+   * Propagates the memory locations and simple RVSDG nodes of all subregions and all calls to
+   * lambda nodes outside the SCC with index \p scc to \p region.
+   */
+  void
+  PropagateRegion(const jlm::rvsdg::region & region, size_t scc);
+
+  /**
+   * Assigns \p memoryNodes and \p unknownMemoryNodeReferences to all regions in \p region that
+   * contain calls to lambda nodes within the SCC with index \p scc, as well as their enclosing
+   * regions.
+   *
+   * @return True if \p region was assigned the memory locations and nodes, otherwise false.
+   */
+  bool
+  AssignSccSummary(
+      const jlm::rvsdg::region & region,
+      size_t scc,
+      const MemoryNodeSet & memoryNodes,
+      const util::HashSet<const jlm::rvsdg::simple_node *> & unknownMemoryNodeReferences);
 
   void
   PropagatePhi(const phi::node & phiNode);
@@ -184,7 +253,9 @@ private:
   void
   ResolveUnknownMemoryNodeReferences(const RvsdgModule & rvsdgModule);
 
+  size_t NumThreads_;
   std::unique_ptr<RegionAwareMemoryNodeProvisioning> Provisioning_;
+  std::unique_ptr<CallGraphCondensation> CallGraph_;
 };
 
 /** \brief Region-aware memory node provider statistics
@@ -206,6 +277,10 @@ public:
         NumRvsdgNodes_(0),
         NumRvsdgRegions_(0),
         NumPointsToGraphMemoryNodes_(0),
+        NumMemoryNodeSets_(0),
+        NumDistinctMemoryNodeSets_(0),
+        NumCallGraphSccs_(0),
+        NumCallGraphLevels_(0),
         StatisticsCollector_(statisticsCollector)
   {
     if (!IsDemanded())
@@ -234,6 +309,44 @@ public:
     return NumPointsToGraphMemoryNodes_;
   }
 
+  /**
+   * @return The number of memory node sets of the provisioning, i.e., the number of region
+   * summaries and external functions.
+   */
+  [[nodiscard]] size_t
+  NumMemoryNodeSets() const noexcept
+  {
+    return NumMemoryNodeSets_;
+  }
+
+  /**
+   * @return The number of distinct memory node sets of the provisioning after hash-consing.
+   */
+  [[nodiscard]] size_t
+  NumDistinctMemoryNodeSets() const noexcept
+  {
+    return NumDistinctMemoryNodeSets_;
+  }
+
+  /**
+   * @return The number of strongly connected components of the call graph.
+   */
+  [[nodiscard]] size_t
+  NumCallGraphSccs() const noexcept
+  {
+    return NumCallGraphSccs_;
+  }
+
+  /**
+   * @return The number of levels of the call graph condensation, i.e., the number of batches of
+   * independent SCCs that are propagated one after the other.
+   */
+  [[nodiscard]] size_t
+  NumCallGraphLevels() const noexcept
+  {
+    return NumCallGraphLevels_;
+  }
+
   [[nodiscard]] size_t
   GetAnnotationStatisticsTime() const noexcept
   {
@@ -330,6 +443,20 @@ public:
     PropagationPass2Timer_.stop();
   }
 
+  void
+  AddCallGraphStatistics(size_t numSccs, size_t numLevels) noexcept
+  {
+    NumCallGraphSccs_ = numSccs;
+    NumCallGraphLevels_ = numLevels;
+  }
+
+  void
+  AddMemoryNodeSetStatistics(size_t numMemoryNodeSets, size_t numDistinctMemoryNodeSets) noexcept
+  {
+    NumMemoryNodeSets_ = numMemoryNodeSets;
+    NumDistinctMemoryNodeSets_ = numDistinctMemoryNodeSets;
+  }
+
   [[nodiscard]] std::string
   ToString() const override
   {
@@ -344,6 +471,12 @@ public:
         "#PointsToGraphMemoryNodes:",
         NumPointsToGraphMemoryNodes_,
         " ",
+        "#CallGraphSccs:",
+        NumCallGraphSccs_,
+        " ",
+        "#CallGraphLevels:",
+        NumCallGraphLevels_,
+        " ",
         "AnnotationTime[ns]:",
         AnnotationTimer_.ns(),
         " ",
@@ -355,6 +488,12 @@ public:
         " ",
         "PropagationPass2Time[ns]:",
         PropagationPass2Timer_.ns(),
+        " ",
+        "#MemoryNodeSets:",
+        NumMemoryNodeSets_,
+        " ",
+        "#DistinctMemoryNodeSets:",
+        NumDistinctMemoryNodeSets_,
         " ");
   }
 
@@ -382,6 +521,10 @@ private:
   size_t NumRvsdgNodes_;
   size_t NumRvsdgRegions_;
   size_t NumPointsToGraphMemoryNodes_;
+  size_t NumMemoryNodeSets_;
+  size_t NumDistinctMemoryNodeSets_;
+  size_t NumCallGraphSccs_;
+  size_t NumCallGraphLevels_;
 
   util::timer AnnotationTimer_;
   util::timer PropagationPass1Timer_;
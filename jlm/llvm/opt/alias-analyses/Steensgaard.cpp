@@ -6,10 +6,14 @@
 #include <jlm/llvm/ir/operators.hpp>
 #include <jlm/llvm/ir/RvsdgModule.hpp>
 #include <jlm/llvm/opt/alias-analyses/PointsToGraph.hpp>
+#include <jlm/llvm/opt/alias-analyses/PointsToQuery.hpp>
 #include <jlm/llvm/opt/alias-analyses/Steensgaard.hpp>
+#include <jlm/rvsdg/IdMap.hpp>
 #include <jlm/rvsdg/traverser.hpp>
+#include <jlm/util/SlabAllocator.hpp>
 #include <jlm/util/Statistics.hpp>
 #include <jlm/util/time.hpp>
+#include <jlm/util/UnionFind.hpp>
 
 namespace jlm::llvm::aa
 {
@@ -49,7 +53,8 @@ public:
 
   constexpr explicit Location(PointsToFlags pointsToFlags)
       : PointsToFlags_(pointsToFlags),
-        PointsTo_(nullptr)
+        PointsTo_(nullptr),
+        Index_(0)
   {}
 
   Location(const Location &) = delete;
@@ -62,9 +67,33 @@ public:
   Location &
   operator=(Location &&) = delete;
 
+  /**
+   * Locations are numerous and small, and are therefore allocated from the slab allocator.
+   */
+  static void *
+  operator new(size_t size)
+  {
+    return util::SlabAllocator::Allocate(size);
+  }
+
+  static void
+  operator delete(void * object, size_t size) noexcept
+  {
+    util::SlabAllocator::Free(object, size);
+  }
+
   [[nodiscard]] virtual std::string
   DebugString() const noexcept = 0;
 
+  /**
+   * @return The index of the location in its LocationSet.
+   */
+  [[nodiscard]] size_t
+  GetIndex() const noexcept
+  {
+    return Index_;
+  }
+
   [[nodiscard]] bool
   PointsToUnknownMemory() const noexcept
   {
@@ -122,8 +151,11 @@ public:
   }
 
 private:
+  friend class LocationSet;
+
   PointsToFlags PointsToFlags_;
   Location * PointsTo_;
+  size_t Index_;
 };
 
 /**
@@ -502,14 +534,14 @@ public:
 };
 
 /** \brief LocationSet class
+ *
+ * The locations are unified with an index-based union-find. Every location is identified by its
+ * index in Locations_, which is also its element in the union-find, and register locations are
+ * looked up through a side table indexed by the dense ids of their outputs.
  */
 class LocationSet final
 {
 public:
-  using DisjointLocationSet = typename jlm::util::disjointset<Location *>;
-
-  using const_iterator = std::unordered_map<const jlm::rvsdg::output *, Location *>::const_iterator;
-
   ~LocationSet() = default;
 
   LocationSet() = default;
@@ -524,82 +556,77 @@ public:
   LocationSet &
   operator=(LocationSet &&) = delete;
 
-  DisjointLocationSet::set_iterator
-  begin() const
+  /**
+   * @return The root locations of all disjoint sets.
+   */
+  [[nodiscard]] std::vector<Location *>
+  RootLocations() const
   {
-    return DisjointLocationSet_.begin();
+    std::vector<Location *> rootLocations;
+    rootLocations.reserve(NumDisjointSets());
+    for (size_t n = 0; n < Locations_.size(); n++)
+    {
+      if (UnionFind_.IsRoot(n))
+        rootLocations.push_back(Locations_[n].get());
+    }
+
+    return rootLocations;
   }
 
-  DisjointLocationSet::set_iterator
-  end() const
+  /**
+   * @return All locations that are in the same disjoint set as \p location.
+   */
+  [[nodiscard]] std::vector<Location *>
+  Members(const Location & location) const
   {
-    return DisjointLocationSet_.end();
+    std::vector<Location *> members;
+    members.reserve(UnionFind_.NumMembers(location.GetIndex()));
+    for (auto index : UnionFind_.Members(location.GetIndex()))
+      members.push_back(Locations_[index].get());
+
+    return members;
   }
 
   Location &
   InsertAllocaLocation(const jlm::rvsdg::node & node)
   {
-    Locations_.push_back(AllocaLocation::Create(node));
-    auto location = Locations_.back().get();
-    DisjointLocationSet_.insert(location);
-
-    return *location;
+    return Insert(AllocaLocation::Create(node));
   }
 
   Location &
   InsertMallocLocation(const jlm::rvsdg::node & node)
   {
-    Locations_.push_back(MallocLocation::Create(node));
-    auto location = Locations_.back().get();
-    DisjointLocationSet_.insert(location);
-
-    return *location;
+    return Insert(MallocLocation::Create(node));
   }
 
   Location &
   InsertLambdaLocation(const lambda::node & lambda)
   {
-    Locations_.push_back(LambdaLocation::Create(lambda));
-    auto location = Locations_.back().get();
-    DisjointLocationSet_.insert(location);
-
-    return *location;
+    return Insert(LambdaLocation::Create(lambda));
   }
 
   Location &
   InsertDeltaLocation(const delta::node & delta)
   {
-    Locations_.push_back(DeltaLocation::Create(delta));
-    auto location = Locations_.back().get();
-    DisjointLocationSet_.insert(location);
-
-    return *location;
+    return Insert(DeltaLocation::Create(delta));
   }
 
   Location &
   InsertImportLocation(const jlm::rvsdg::argument & argument)
   {
-    Locations_.push_back(ImportLocation::Create(argument));
-    auto location = Locations_.back().get();
-    DisjointLocationSet_.insert(location);
-
-    return *location;
+    return Insert(ImportLocation::Create(argument));
   }
 
   Location &
   InsertDummyLocation()
   {
-    Locations_.push_back(DummyLocation::Create());
-    auto location = Locations_.back().get();
-    DisjointLocationSet_.insert(location);
-
-    return *location;
+    return Insert(DummyLocation::Create());
   }
 
   bool
   Contains(const jlm::rvsdg::output & output) const noexcept
   {
-    return LocationMap_.find(&output) != LocationMap_.end();
+    return LocationMap_.Contains(output);
   }
 
   Location &
@@ -611,28 +638,22 @@ public:
     return InsertRegisterLocation(output, pointsToFlags);
   }
 
-  const DisjointLocationSet::set &
-  GetSet(Location & location) const
-  {
-    return *DisjointLocationSet_.find(&location);
-  }
-
   size_t
   NumDisjointSets() const noexcept
   {
-    return DisjointLocationSet_.nsets();
+    return UnionFind_.NumSets();
   }
 
   size_t
   NumLocations() const noexcept
   {
-    return DisjointLocationSet_.nvalues();
+    return UnionFind_.NumElements();
   }
 
   Location &
-  GetRootLocation(Location & location) const
+  GetRootLocation(const Location & location) const
   {
-    return *GetSet(location).value();
+    return *Locations_[UnionFind_.Find(location.GetIndex())];
   }
 
   Location &
@@ -645,21 +666,18 @@ public:
   }
 
   RegisterLocation *
-  LookupRegisterLocation(const jlm::rvsdg::output & output)
+  LookupRegisterLocation(const jlm::rvsdg::output & output) const
   {
-    auto it = LocationMap_.find(&output);
-    return it == LocationMap_.end() ? nullptr : it->second;
+    return LocationMap_.Contains(output) ? LocationMap_.Lookup(output) : nullptr;
   }
 
   std::string
   ToDot() const
   {
-    auto toDotNode = [](const DisjointLocationSet::set & set)
+    auto toDotNode = [&](const Location & rootLocation)
     {
-      auto rootLocation = set.value();
-
       std::string setLabel;
-      for (auto & location : set)
+      for (auto & location : Members(rootLocation))
       {
         auto unknownLabel = location->PointsToUnknownMemory() ? "{U}" : "";
         auto pointsToEscapedMemoryLabel = location->PointsToEscapedMemory() ? "{E}" : "";
@@ -668,7 +686,7 @@ public:
         auto pointsToLabel = jlm::util::strfmt("{pt:", (intptr_t)location->GetPointsTo(), "}");
         auto locationLabel = jlm::util::strfmt((intptr_t)location, " : ", location->DebugString());
 
-        setLabel += location == rootLocation
+        setLabel += location == &rootLocation
                       ? jlm::util::strfmt(
                           "*",
                           locationLabel,
@@ -680,28 +698,24 @@ public:
                       : jlm::util::strfmt(locationLabel, escapesModuleLabel, "\\n");
       }
 
-      return jlm::util::strfmt("{ ", (intptr_t)&set, " [label = \"", setLabel, "\"]; }");
+      return jlm::util::strfmt("{ ", (intptr_t)&rootLocation, " [label = \"", setLabel, "\"]; }");
     };
 
-    auto toDotEdge =
-        [](const DisjointLocationSet::set & set, const DisjointLocationSet::set & pointsToSet)
+    auto toDotEdge = [](const Location & rootLocation, const Location & pointsToRootLocation)
     {
-      return jlm::util::strfmt((intptr_t)&set, " -> ", (intptr_t)&pointsToSet);
+      return jlm::util::strfmt((intptr_t)&rootLocation, " -> ", (intptr_t)&pointsToRootLocation);
     };
 
     std::string str;
     str.append("digraph PointsToGraph {\n");
 
-    for (auto & set : DisjointLocationSet_)
+    for (auto rootLocation : RootLocations())
     {
-      str += toDotNode(set) + "\n";
+      str += toDotNode(*rootLocation) + "\n";
 
-      auto pointsTo = set.value()->GetPointsTo();
+      auto pointsTo = rootLocation->GetPointsTo();
       if (pointsTo != nullptr)
-      {
-        auto pointsToSet = DisjointLocationSet_.find(pointsTo);
-        str += toDotEdge(set, *pointsToSet) + "\n";
-      }
+        str += toDotEdge(*rootLocation, GetRootLocation(*pointsTo)) + "\n";
     }
 
     str.append("}\n");
@@ -751,7 +765,17 @@ private:
   Location &
   Merge(Location & location1, Location & location2)
   {
-    return *DisjointLocationSet_.merge(&location1, &location2)->value();
+    return *Locations_[UnionFind_.Union(location1.GetIndex(), location2.GetIndex())];
+  }
+
+  Location &
+  Insert(std::unique_ptr<Location> location)
+  {
+    location->Index_ = UnionFind_.Insert();
+    JLM_ASSERT(location->Index_ == Locations_.size());
+    Locations_.push_back(std::move(location));
+
+    return *Locations_.back();
   }
 
   RegisterLocation &
@@ -759,19 +783,16 @@ private:
   {
     JLM_ASSERT(!Contains(output));
 
-    auto registerLocation = RegisterLocation::Create(output, pointsToFlags);
-    auto registerLocationPointer = registerLocation.get();
+    auto & registerLocation = *util::AssertedCast<RegisterLocation>(
+        &Insert(RegisterLocation::Create(output, pointsToFlags)));
+    LocationMap_[output] = &registerLocation;
 
-    LocationMap_[&output] = registerLocationPointer;
-    DisjointLocationSet_.insert(registerLocationPointer);
-    Locations_.push_back(std::move(registerLocation));
-
-    return *registerLocationPointer;
+    return registerLocation;
   }
 
-  DisjointLocationSet DisjointLocationSet_;
+  util::UnionFind UnionFind_;
   std::vector<std::unique_ptr<Location>> Locations_;
-  std::unordered_map<const jlm::rvsdg::output *, RegisterLocation *> LocationMap_;
+  jlm::rvsdg::OutputMap<RegisterLocation *> LocationMap_;
 };
 
 /** \brief Collect statistics about Steensgaard alias analysis pass
@@ -928,6 +949,89 @@ private:
   util::timer UnknownMemoryNodeSourcesRedirectionTimer_;
 };
 
+/** \brief Demand-driven points-to queries of Steensgaard's analysis
+ *
+ * Owns the location set of the analysis and a points-to graph that only contains memory nodes. The
+ * points-to set of a register is computed from the flags and the points-to location of the
+ * disjoint set the register's location belongs to.
+ */
+class SteensgaardPointsToQuery final : public PointsToQuery
+{
+public:
+  SteensgaardPointsToQuery(
+      std::unique_ptr<LocationSet> locationSet,
+      std::unique_ptr<PointsToGraph> pointsToGraph,
+      std::vector<std::vector<PointsToGraph::MemoryNode *>> memoryNodesInSet,
+      const util::HashSet<PointsToGraph::MemoryNode *> & escapedMemoryNodes)
+      : LocationSet_(std::move(locationSet)),
+        PointsToGraph_(std::move(pointsToGraph)),
+        MemoryNodesInSet_(std::move(memoryNodesInSet))
+  {
+    for (auto memoryNode : escapedMemoryNodes.Items())
+      EscapedMemoryNodes_.Insert(memoryNode);
+
+    // Registers pointing to unknown memory are resolved to all memory nodes, mirroring
+    // Steensgaard::RedirectUnknownMemoryNodeSources()
+    for (auto & allocaNode : PointsToGraph_->AllocaNodes())
+      UnknownMemoryNodes_.Insert(&allocaNode);
+
+    for (auto & deltaNode : PointsToGraph_->DeltaNodes())
+      UnknownMemoryNodes_.Insert(&deltaNode);
+
+    for (auto & lambdaNode : PointsToGraph_->LambdaNodes())
+      UnknownMemoryNodes_.Insert(&lambdaNode);
+
+    for (auto & mallocNode : PointsToGraph_->MallocNodes())
+      UnknownMemoryNodes_.Insert(&mallocNode);
+
+    for (auto & importNode : PointsToGraph_->ImportNodes())
+      UnknownMemoryNodes_.Insert(&importNode);
+  }
+
+  [[nodiscard]] const PointsToGraph &
+  GetPointsToGraph() const noexcept override
+  {
+    return *PointsToGraph_;
+  }
+
+protected:
+  [[nodiscard]] MemoryNodeSet
+  ComputeOutputNodes(const rvsdg::output & output) const override
+  {
+    auto registerLocation = LocationSet_->LookupRegisterLocation(output);
+    if (registerLocation == nullptr)
+      throw util::error("Cannot find register in location set.");
+
+    auto & rootLocation = LocationSet_->GetRootLocation(*registerLocation);
+
+    MemoryNodeSet memoryNodes;
+    if (rootLocation.PointsToUnknownMemory())
+      memoryNodes.UnionWith(UnknownMemoryNodes_);
+
+    if (rootLocation.PointsToExternalMemory())
+      memoryNodes.Insert(&PointsToGraph_->GetExternalMemoryNode());
+
+    if (rootLocation.PointsToEscapedMemory())
+      memoryNodes.UnionWith(EscapedMemoryNodes_);
+
+    if (auto pointsToLocation = rootLocation.GetPointsTo())
+    {
+      auto & pointsToRootLocation = LocationSet_->GetRootLocation(*pointsToLocation);
+      for (auto memoryNode : MemoryNodesInSet_[pointsToRootLocation.GetIndex()])
+        memoryNodes.Insert(memoryNode);
+    }
+
+    return memoryNodes;
+  }
+
+private:
+  std::unique_ptr<LocationSet> LocationSet_;
+  std::unique_ptr<PointsToGraph> PointsToGraph_;
+  std::vector<std::vector<PointsToGraph::MemoryNode *>> MemoryNodesInSet_;
+  MemoryNodeSet EscapedMemoryNodes_;
+  MemoryNodeSet UnknownMemoryNodes_;
+};
+
 Steensgaard::~Steensgaard() = default;
 
 Steensgaard::Steensgaard() = default;
@@ -1733,6 +1837,38 @@ Steensgaard::Analyze(
   return pointsToGraph;
 }
 
+std::unique_ptr<PointsToQuery>
+Steensgaard::AnalyzeOnDemand(
+    const RvsdgModule & module,
+    jlm::util::StatisticsCollector & statisticsCollector)
+{
+  LocationSet_ = LocationSet::Create();
+  auto statistics = Statistics::Create(module.SourceFileName());
+
+  // Perform Steensgaard analysis
+  statistics->StartSteensgaardStatistics(module.Rvsdg());
+  AnalyzeRvsdg(module.Rvsdg());
+  statistics->StopSteensgaardStatistics();
+
+  // Only create the memory nodes of the points-to graph
+  statistics->StartPointsToGraphConstructionStatistics(*LocationSet_);
+  auto pointsToGraph = PointsToGraph::Create();
+  std::vector<PointsToGraph::Node *> locationMap(LocationSet_->NumLocations(), nullptr);
+  util::HashSet<PointsToGraph::MemoryNode *> escapedMemoryNodes;
+  auto memoryNodesInSet =
+      CreatePointsToGraphMemoryNodes(*pointsToGraph, locationMap, escapedMemoryNodes);
+  statistics->StopPointsToGraphConstructionStatistics(*pointsToGraph);
+
+  statisticsCollector.CollectDemandedStatistics(std::move(statistics));
+
+  // The query takes over the internal state of the analysis
+  return std::make_unique<SteensgaardPointsToQuery>(
+      std::move(LocationSet_),
+      std::move(pointsToGraph),
+      std::move(memoryNodesInSet),
+      escapedMemoryNodes);
+}
+
 PointsToGraph::MemoryNode &
 Steensgaard::CreatePointsToGraphMemoryNode(const Location & location, PointsToGraph & pointsToGraph)
 {
@@ -1757,16 +1893,14 @@ Steensgaard::CreatePointsToGraphMemoryNode(const Location & location, PointsToGr
 util::HashSet<PointsToGraph::MemoryNode *>
 Steensgaard::CollectEscapedMemoryNodes(
     const util::HashSet<RegisterLocation *> & escapingRegisterLocations,
-    const std::unordered_map<
-        const util::disjointset<Location *>::set *,
-        std::vector<PointsToGraph::MemoryNode *>> & memoryNodesInSet) const
+    const std::vector<std::vector<PointsToGraph::MemoryNode *>> & memoryNodesInSet) const
 {
   // Initialize working set
   util::HashSet<Location *> toVisit;
   for (auto registerLocation : escapingRegisterLocations.Items())
   {
-    auto & set = LocationSet_->GetSet(*registerLocation);
-    if (auto pointsToLocation = set.value()->GetPointsTo())
+    auto & rootLocation = LocationSet_->GetRootLocation(*registerLocation);
+    if (auto pointsToLocation = rootLocation.GetPointsTo())
     {
       toVisit.Insert(pointsToLocation);
     }
@@ -1774,29 +1908,29 @@ Steensgaard::CollectEscapedMemoryNodes(
 
   // Collect escaped memory nodes
   util::HashSet<PointsToGraph::MemoryNode *> escapedMemoryNodes;
-  util::HashSet<const LocationSet::DisjointLocationSet::set *> visited;
+  std::vector<bool> visited(LocationSet_->NumLocations(), false);
   while (!toVisit.IsEmpty())
   {
     auto moduleEscapingLocation = *toVisit.Items().begin();
     toVisit.Remove(moduleEscapingLocation);
 
-    auto & set = LocationSet_->GetSet(*moduleEscapingLocation);
+    auto & rootLocation = LocationSet_->GetRootLocation(*moduleEscapingLocation);
 
     // Check if we already visited this set to avoid an endless loop
-    if (visited.Contains(&set))
+    if (visited[rootLocation.GetIndex()])
     {
       continue;
     }
-    visited.Insert(&set);
+    visited[rootLocation.GetIndex()] = true;
 
-    auto & memoryNodes = memoryNodesInSet.at(&set);
+    auto & memoryNodes = memoryNodesInSet[rootLocation.GetIndex()];
     for (auto & memoryNode : memoryNodes)
     {
       memoryNode->MarkAsModuleEscaping();
       escapedMemoryNodes.Insert(memoryNode);
     }
 
-    if (auto pointsToLocation = set.value()->GetPointsTo())
+    if (auto pointsToLocation = rootLocation.GetPointsTo())
     {
       toVisit.Insert(pointsToLocation);
     }
@@ -1805,45 +1939,34 @@ Steensgaard::CollectEscapedMemoryNodes(
   return escapedMemoryNodes;
 }
 
-std::unique_ptr<PointsToGraph>
-Steensgaard::ConstructPointsToGraph() const
+std::vector<std::vector<PointsToGraph::MemoryNode *>>
+Steensgaard::CreatePointsToGraphMemoryNodes(
+    PointsToGraph & pointsToGraph,
+    std::vector<PointsToGraph::Node *> & locationMap,
+    util::HashSet<PointsToGraph::MemoryNode *> & escapedMemoryNodes) const
 {
-  auto pointsToGraph = PointsToGraph::Create();
-
-  // All the memory nodes within a LocationSet
-  std::unordered_map<
-      const util::disjointset<Location *>::set *,
-      std::vector<PointsToGraph::MemoryNode *>>
-      memoryNodesInSet;
+  // All the memory nodes within a disjoint set, indexed by the index of the set's root location
+  std::vector<std::vector<PointsToGraph::MemoryNode *>> memoryNodesInSet(
+      LocationSet_->NumLocations());
 
   // All register locations that are marked as RegisterLocation::IsEscapingModule()
   util::HashSet<RegisterLocation *> escapingRegisterLocations;
 
-  // Mapping between locations and points-to graph nodes
-  std::unordered_map<const Location *, PointsToGraph::Node *> locationMap;
-
-  // Create points-to graph nodes
-  for (auto & locationSet : *LocationSet_)
+  for (auto rootLocation : LocationSet_->RootLocations())
   {
-    memoryNodesInSet[&locationSet] = {};
-
-    util::HashSet<const rvsdg::output *> registers;
-    util::HashSet<RegisterLocation *> registerLocations;
-    for (auto & location : locationSet)
+    auto & memoryNodes = memoryNodesInSet[rootLocation->GetIndex()];
+    for (auto location : LocationSet_->Members(*rootLocation))
     {
       if (auto registerLocation = dynamic_cast<RegisterLocation *>(location))
       {
-        registers.Insert(&registerLocation->GetOutput());
-        registerLocations.Insert(registerLocation);
-
         if (registerLocation->IsEscapingModule())
           escapingRegisterLocations.Insert(registerLocation);
       }
       else if (Location::Is<MemoryLocation>(*location))
       {
-        auto & pointsToGraphNode = CreatePointsToGraphMemoryNode(*location, *pointsToGraph);
-        memoryNodesInSet[&locationSet].push_back(&pointsToGraphNode);
-        locationMap[location] = &pointsToGraphNode;
+        auto & pointsToGraphNode = CreatePointsToGraphMemoryNode(*location, pointsToGraph);
+        memoryNodes.push_back(&pointsToGraphNode);
+        locationMap[location->GetIndex()] = &pointsToGraphNode;
       }
       else if (Location::Is<DummyLocation>(*location))
       {
@@ -1855,30 +1978,59 @@ Steensgaard::ConstructPointsToGraph() const
         JLM_UNREACHABLE("Unhandled location type.");
       }
     }
+  }
+
+  escapedMemoryNodes = CollectEscapedMemoryNodes(escapingRegisterLocations, memoryNodesInSet);
+
+  return memoryNodesInSet;
+}
+
+std::unique_ptr<PointsToGraph>
+Steensgaard::ConstructPointsToGraph() const
+{
+  auto pointsToGraph = PointsToGraph::Create();
+
+  // Mapping between locations and points-to graph nodes, indexed by the index of the locations
+  std::vector<PointsToGraph::Node *> locationMap(LocationSet_->NumLocations(), nullptr);
+
+  util::HashSet<PointsToGraph::MemoryNode *> escapedMemoryNodes;
+  auto memoryNodesInSet =
+      CreatePointsToGraphMemoryNodes(*pointsToGraph, locationMap, escapedMemoryNodes);
+
+  // Create points-to graph register-set nodes
+  auto rootLocations = LocationSet_->RootLocations();
+  for (auto rootLocation : rootLocations)
+  {
+    util::HashSet<const rvsdg::output *> registers;
+    std::vector<RegisterLocation *> registerLocations;
+    for (auto location : LocationSet_->Members(*rootLocation))
+    {
+      if (auto registerLocation = dynamic_cast<RegisterLocation *>(location))
+      {
+        registers.Insert(&registerLocation->GetOutput());
+        registerLocations.push_back(registerLocation);
+      }
+    }
 
     // We found register locations in this set.
     // Create a single points-to graph register-set node for all of them.
-    if (!registerLocations.IsEmpty())
+    if (!registerLocations.empty())
     {
       auto & pointsToGraphNode = PointsToGraph::RegisterSetNode::Create(*pointsToGraph, registers);
-      for (auto registerLocation : registerLocations.Items())
-        locationMap[registerLocation] = &pointsToGraphNode;
+      for (auto registerLocation : registerLocations)
+        locationMap[registerLocation->GetIndex()] = &pointsToGraphNode;
     }
   }
 
-  auto escapedMemoryNodes = CollectEscapedMemoryNodes(escapingRegisterLocations, memoryNodesInSet);
-
   // Create points-to graph edges
-  for (auto & set : *LocationSet_)
+  for (auto rootLocation : rootLocations)
   {
-    bool pointsToUnknown = LocationSet_->GetSet(**set.begin()).value()->PointsToUnknownMemory();
-    bool pointsToExternalMemory =
-        LocationSet_->GetSet(**set.begin()).value()->PointsToExternalMemory();
-    bool pointsToEscapedMemory =
-        LocationSet_->GetSet(**set.begin()).value()->PointsToEscapedMemory();
+    bool pointsToUnknown = rootLocation->PointsToUnknownMemory();
+    bool pointsToExternalMemory = rootLocation->PointsToExternalMemory();
+    bool pointsToEscapedMemory = rootLocation->PointsToEscapedMemory();
 
     bool handledRegisterLocations = false;
-    for (auto & location : set)
+    for (auto location : LocationSet_->Members(*rootLocation))
     {
       // We can ignore dummy nodes. They only exist for structural purposes in the Steensgaard
       // analysis and have no equivalent in the points-to graph.
@@ -1896,7 +2048,7 @@ Steensgaard::ConstructPointsToGraph() const
         handledRegisterLocations = true;
       }
 
-      auto & pointsToGraphNode = *locationMap[location];
+      auto & pointsToGraphNode = *locationMap[location->GetIndex()];
 
       if (pointsToUnknown)
         pointsToGraphNode.AddEdge(pointsToGraph->GetUnknownMemoryNode());
@@ -1911,10 +2063,10 @@ Steensgaard::ConstructPointsToGraph() const
       }
 
       // Add edges to all memory nodes the location points to
-      if (auto pointsToLocation = set.value()->GetPointsTo())
+      if (auto pointsToLocation = rootLocation->GetPointsTo())
       {
-        auto & pointsToSet = LocationSet_->GetSet(*pointsToLocation);
-        auto & memoryNodes = memoryNodesInSet[&pointsToSet];
+        auto & pointsToRootLocation = LocationSet_->GetRootLocation(*pointsToLocation);
+        auto & memoryNodes = memoryNodesInSet[pointsToRootLocation.GetIndex()];
 
         for (auto & memoryNode : memoryNodes)
           pointsToGraphNode.AddEdge(*memoryNode);
@@ -7,7 +7,6 @@
 #define JLM_LLVM_OPT_ALIAS_ANALYSES_STEENSGAARD_HPP
 
 #include <jlm/llvm/opt/alias-analyses/AliasAnalysis.hpp>
-#include <jlm/util/disjointset.hpp>
 
 namespace jlm::llvm::aa
 {
@@ -56,6 +55,23 @@ public:
   std::unique_ptr<PointsToGraph>
   Analyze(const RvsdgModule & rvsdgModule);
 
+  /**
+   * \brief Analyze RVSDG module for demand-driven points-to queries
+   *
+   * Only the memory nodes of the points-to graph are created. The location set of the analysis is
+   * kept alive by the returned query, and the points-to set of a register is computed on demand
+   * from the disjoint set of the register's location. The result of a query is identical to the
+   * targets of the register's node in the points-to graph returned by Analyze().
+   *
+   * \param module RVSDG module the analysis is performed on.
+   * \param statisticsCollector Statistics collector for collecting analysis statistics.
+   *
+   * \return A PointsToQuery.
+   */
+  std::unique_ptr<PointsToQuery>
+  AnalyzeOnDemand(const RvsdgModule & module, jlm::util::StatisticsCollector & statisticsCollector)
+      override;
+
 private:
   void
   AnalyzeRvsdg(const rvsdg::graph & graph);
@@ -152,6 +168,24 @@ private:
   [[nodiscard]] std::unique_ptr<PointsToGraph>
   ConstructPointsToGraph() const;
 
+  /**
+   * Creates the points-to graph memory nodes for all memory locations, and marks the memory nodes
+   * that escape the module.
+   *
+   * @param pointsToGraph The points-to graph in which the memory nodes are created.
+   * @param locationMap Mapping between locations and points-to graph nodes, indexed by the index
+   * of the locations. The entries of the memory locations are set to their memory nodes.
+   * @param escapedMemoryNodes Set to the memory nodes that escape the module.
+   *
+   * @return The memory nodes within a disjoint set, indexed by the index of the set's root
+   * location.
+   */
+  [[nodiscard]] std::vector<std::vector<PointsToGraph::MemoryNode *>>
+  CreatePointsToGraphMemoryNodes(
+      PointsToGraph & pointsToGraph,
+      std::vector<PointsToGraph::Node *> & locationMap,
+      util::HashSet<PointsToGraph::MemoryNode *> & escapedMemoryNodes) const;
+
   /**
    * Creates a points-to graph memory node for \p location.
    *
@@ -172,16 +206,15 @@ private:
    * memory. They serve as starting point for the fix-point computation.
    *
    * @param escapingRegisterLocations All registers that point to escaped memory.
-   * @param memoryNodesInSet The points-to memory nodes that are part of a location set.
+   * @param memoryNodesInSet The points-to memory nodes that are part of a location set, indexed
+   * by the index of the set's root location.
    *
    * @return A set of memory nodes that escaped the module.
    */
   [[nodiscard]] util::HashSet<PointsToGraph::MemoryNode *>
   CollectEscapedMemoryNodes(
       const util::HashSet<RegisterLocation *> & escapingRegisterLocations,
-      const std::unordered_map<
-          const util::disjointset<Location *>::set *,
-          std::vector<PointsToGraph::MemoryNode *>> & memoryNodesInSet) const;
+      const std::vector<std::vector<PointsToGraph::MemoryNode *>> & memoryNodesInSet) const;
 
   /**
    * Resolves all points-to graph nodes that were marked throughout the analysis as pointing
@@ -6,10 +6,14 @@
 #include <jlm/llvm/ir/operators.hpp>
 #include <jlm/llvm/ir/RvsdgModule.hpp>
 #include <jlm/llvm/opt/cne.hpp>
+#include <jlm/rvsdg/EdgeBatch.hpp>
 #include <jlm/rvsdg/traverser.hpp>
+#include <jlm/util/Hash.hpp>
 #include <jlm/util/Statistics.hpp>
 #include <jlm/util/time.hpp>
 
+#include <algorithm>
+
 namespace jlm::llvm
 {
 
@@ -85,494 +89,438 @@ private:
   util::timer marktimer_, diverttimer_;
 };
 
-typedef std::unordered_set<jlm::rvsdg::output *> congruence_set;
-
+/**
+ * Congruence partition over the outputs of an RVSDG.
+ *
+ * The partition is computed by optimistic partition refinement in the style of Alpern, Wegman,
+ * and Zadeck: all outputs with the same label, i.e., the same operation, output index, and
+ * scope, start out in a single class. Classes are then split until all members of a class have
+ * congruent operands. Since the initial assumption is optimistic, cyclic values such as theta
+ * loop variables can be recognized as congruent.
+ *
+ * Each class occupies a contiguous range in a single permutation array of all outputs, such
+ * that splitting a class only requires swapping its members within its range.
+ */
 class cnectx
 {
-public:
-  inline void
-  mark(jlm::rvsdg::output * o1, jlm::rvsdg::output * o2)
+  enum class kind
   {
-    auto s1 = set(o1);
-    auto s2 = set(o2);
+    unique,
+    simple_output,
+    gamma_argument,
+    gamma_output,
+    theta_argument,
+    theta_output,
+    context_argument
+  };
+
+  struct label
+  {
+    kind kind_;
+    const void * scope;
+    const jlm::rvsdg::operation * operation;
+    size_t index;
+    size_t arity;
+
+    bool
+    operator==(const label & other) const noexcept
+    {
+      if (kind_ != other.kind_ || scope != other.scope || index != other.index
+          || arity != other.arity)
+        return false;
 
-    if (s1 == s2)
-      return;
+      if (operation == nullptr || other.operation == nullptr)
+        return operation == other.operation;
 
-    if (s2->size() < s1->size())
-    {
-      s1 = outputs_[o2];
-      s2 = outputs_[o1];
+      return *operation == *other.operation;
     }
+  };
 
-    for (auto & o : *s1)
+  struct label_hash
+  {
+    std::size_t
+    operator()(const label & l) const noexcept
     {
-      s2->insert(o);
-      outputs_[o] = s2;
+      auto operationHash = l.operation ? l.operation->hash() : 0;
+      return util::CombineHashes(l.kind_, l.scope, operationHash, l.index, l.arity);
     }
-  }
+  };
 
-  inline void
-  mark(const jlm::rvsdg::node * n1, const jlm::rvsdg::node * n2)
+public:
+  /**
+   * Enumerates all outputs of \p region and its subregions, and computes the coarsest
+   * congruence partition of them.
+   */
+  void
+  mark(jlm::rvsdg::region & region)
   {
-    JLM_ASSERT(n1->noutputs() == n2->noutputs());
-
-    for (size_t n = 0; n < n1->noutputs(); n++)
-      mark(n1->output(n), n2->output(n));
+    boundary_ = &region;
+    collect(region);
+    resolve_operands();
+    initialize_partition();
+    refine_partition();
   }
 
-  inline bool
-  congruent(jlm::rvsdg::output * o1, jlm::rvsdg::output * o2) const noexcept
+  /**
+   * Diverts the users of all outputs to a single representative of their congruence class. All
+   * users are diverted in a single edge batch.
+   */
+  void
+  divert()
   {
-    if (o1 == o2)
-      return true;
-
-    auto it = outputs_.find(o1);
-    if (it == outputs_.end())
-      return false;
+    jlm::rvsdg::EdgeBatch batch;
+    for (size_t c = 0; c < class_begin_.size(); c++)
+    {
+      if (class_end_[c] - class_begin_[c] < 2)
+        continue;
 
-    return it->second->find(o2) != it->second->end();
-  }
+      /*
+        The member that was enumerated first serves as representative. This ensures that
+        congruent gamma entry variables or theta loop variables are consistently merged into
+        the same variable in all subregions.
+      */
+      size_t representative = members_[class_begin_[c]];
+      for (size_t n = class_begin_[c] + 1; n < class_end_[c]; n++)
+        representative = std::min(representative, members_[n]);
 
-  inline bool
-  congruent(const jlm::rvsdg::input * i1, const jlm::rvsdg::input * i2) const noexcept
-  {
-    return congruent(i1->origin(), i2->origin());
-  }
+      for (size_t n = class_begin_[c]; n < class_end_[c]; n++)
+      {
+        auto member = members_[n];
+        if (member == representative)
+          continue;
 
-  congruence_set *
-  set(jlm::rvsdg::output * output) noexcept
-  {
-    if (outputs_.find(output) == outputs_.end())
-    {
-      std::unique_ptr<congruence_set> set(new congruence_set({ output }));
-      outputs_[output] = set.get();
-      sets_.insert(std::move(set));
+        JLM_ASSERT(outputs_[member]->type() == outputs_[representative]->type());
+        batch.DivertUsers(*outputs_[member], *outputs_[representative]);
+      }
     }
-
-    return outputs_[output];
+    batch.Apply();
   }
 
 private:
-  std::unordered_set<std::unique_ptr<congruence_set>> sets_;
-  std::unordered_map<const jlm::rvsdg::output *, congruence_set *> outputs_;
-};
-
-class vset
-{
-public:
   void
-  insert(const jlm::rvsdg::output * o1, const jlm::rvsdg::output * o2)
-  {
-    auto it = sets_.find(o1);
-    if (it != sets_.end())
-      sets_[o1].insert(o2);
-    else
-      sets_[o1] = { o2 };
-
-    it = sets_.find(o2);
-    if (it != sets_.end())
-      sets_[o2].insert(o1);
-    else
-      sets_[o2] = { o1 };
-  }
-
-  bool
-  visited(const jlm::rvsdg::output * o1, const jlm::rvsdg::output * o2) const
+  add(jlm::rvsdg::output * output, const label & l, std::vector<jlm::rvsdg::output *> operands)
   {
-    auto it = sets_.find(o1);
-    if (it == sets_.end())
-      return false;
+    ids_[output] = outputs_.size();
+    outputs_.push_back(output);
+    labels_.push_back(l);
 
-    return it->second.find(o2) != it->second.end();
+    for (auto & operand : operands)
+      operand_outputs_.push_back(operand);
+    operand_begin_.push_back(operand_outputs_.size());
   }
 
-private:
-  std::unordered_map<const jlm::rvsdg::output *, std::unordered_set<const jlm::rvsdg::output *>>
-      sets_;
-};
-
-/* mark phase */
-
-static bool
-congruent(jlm::rvsdg::output * o1, jlm::rvsdg::output * o2, vset & vs, cnectx & ctx)
-{
-  if (ctx.congruent(o1, o2) || vs.visited(o1, o2))
-    return true;
-
-  if (o1->type() != o2->type())
-    return false;
-
-  if (is_theta_argument(o1) && is_theta_argument(o2))
-  {
-    JLM_ASSERT(o1->region()->node() == o2->region()->node());
-    auto a1 = static_cast<jlm::rvsdg::argument *>(o1);
-    auto a2 = static_cast<jlm::rvsdg::argument *>(o2);
-    vs.insert(a1, a2);
-    auto i1 = a1->input(), i2 = a2->input();
-    if (!congruent(a1->input()->origin(), a2->input()->origin(), vs, ctx))
-      return false;
-
-    auto output1 = o1->region()->node()->output(i1->index());
-    auto output2 = o2->region()->node()->output(i2->index());
-    return congruent(output1, output2, vs, ctx);
-  }
-
-  auto n1 = jlm::rvsdg::node_output::node(o1);
-  auto n2 = jlm::rvsdg::node_output::node(o2);
-  if (jlm::rvsdg::is<jlm::rvsdg::theta_op>(n1) && jlm::rvsdg::is<jlm::rvsdg::theta_op>(n2)
-      && n1 == n2)
+  void
+  add_unique(jlm::rvsdg::output * output)
   {
-    auto so1 = static_cast<jlm::rvsdg::structural_output *>(o1);
-    auto so2 = static_cast<jlm::rvsdg::structural_output *>(o2);
-    vs.insert(o1, o2);
-    auto r1 = so1->results.first();
-    auto r2 = so2->results.first();
-    return congruent(r1->origin(), r2->origin(), vs, ctx);
+    add(output, { kind::unique, output, nullptr, 0, 0 }, {});
   }
 
-  if (jlm::rvsdg::is<jlm::rvsdg::gamma_op>(n1) && n1 == n2)
+  void
+  collect_arguments(jlm::rvsdg::region & region)
   {
-    auto so1 = static_cast<jlm::rvsdg::structural_output *>(o1);
-    auto so2 = static_cast<jlm::rvsdg::structural_output *>(o2);
-    auto r1 = so1->results.begin();
-    auto r2 = so2->results.begin();
-    for (; r1 != so1->results.end(); r1++, r2++)
+    auto node = region.node();
+    for (size_t n = 0; n < region.narguments(); n++)
     {
-      JLM_ASSERT(r1->region() == r2->region());
-      if (!congruent(r1->origin(), r2->origin(), vs, ctx))
-        return false;
-    }
-    return true;
-  }
-
-  if (is_gamma_argument(o1) && is_gamma_argument(o2))
-  {
-    JLM_ASSERT(o1->region()->node() == o2->region()->node());
-    auto a1 = static_cast<jlm::rvsdg::argument *>(o1);
-    auto a2 = static_cast<jlm::rvsdg::argument *>(o2);
-    return congruent(a1->input()->origin(), a2->input()->origin(), vs, ctx);
-  }
+      auto argument = region.argument(n);
+      auto input = argument->input();
 
-  if (jlm::rvsdg::is<jlm::rvsdg::simple_op>(n1) && jlm::rvsdg::is<jlm::rvsdg::simple_op>(n2)
-      && n1->operation() == n2->operation() && n1->ninputs() == n2->ninputs()
-      && o1->index() == o2->index())
-  {
-    for (size_t n = 0; n < n1->ninputs(); n++)
-    {
-      auto origin1 = n1->input(n)->origin();
-      auto origin2 = n2->input(n)->origin();
-      if (!congruent(origin1, origin2, vs, ctx))
-        return false;
+      if (jlm::rvsdg::is<jlm::rvsdg::gamma_op>(node) && input)
+      {
+        add(argument, { kind::gamma_argument, &region, nullptr, 0, 1 }, { input->origin() });
+      }
+      else if (jlm::rvsdg::is<jlm::rvsdg::theta_op>(node))
+      {
+        auto result = static_cast<jlm::rvsdg::theta_input *>(input)->result();
+        add(argument,
+            { kind::theta_argument, &region, nullptr, 0, 2 },
+            { input->origin(), result->origin() });
+      }
+      else if (
+          (jlm::rvsdg::is<lambda::operation>(node) || jlm::rvsdg::is<phi::operation>(node))
+          && input)
+      {
+        if (&region == boundary_)
+        {
+          /*
+            The origin lies outside of the partitioned region. Context arguments are therefore
+            labeled by their origin, such that only arguments with the same origin are congruent.
+          */
+          add(argument, { kind::context_argument, input->origin(), nullptr, 0, 0 }, {});
+        }
+        else
+        {
+          add(argument,
+              { kind::context_argument, &region, nullptr, 0, 1 },
+              { input->origin() });
+        }
+      }
+      else
+      {
+        add_unique(argument);
+      }
     }
-    return true;
   }
 
-  return false;
-}
-
-static bool
-congruent(jlm::rvsdg::output * o1, jlm::rvsdg::output * o2, cnectx & ctx)
-{
-  vset vs;
-  return congruent(o1, o2, vs, ctx);
-}
-
-static void
-mark_arguments(jlm::rvsdg::structural_input * i1, jlm::rvsdg::structural_input * i2, cnectx & ctx)
-{
-  JLM_ASSERT(i1->node() && i1->node() == i2->node());
-  JLM_ASSERT(i1->arguments.size() == i2->arguments.size());
-
-  auto a1 = i1->arguments.begin();
-  auto a2 = i2->arguments.begin();
-  for (; a1 != i1->arguments.end(); a1++, a2++)
+  void
+  collect(jlm::rvsdg::structural_node & node)
   {
-    JLM_ASSERT(a1->region() == a2->region());
-    if (congruent(a1.ptr(), a2.ptr(), ctx))
-      ctx.mark(a1.ptr(), a2.ptr());
-  }
-}
-
-static void
-mark(jlm::rvsdg::region *, cnectx &);
+    if (jlm::rvsdg::is<jlm::rvsdg::gamma_op>(&node))
+    {
+      for (size_t n = 0; n < node.nsubregions(); n++)
+        collect(*node.subregion(n));
 
-static void
-mark_gamma(const jlm::rvsdg::structural_node * node, cnectx & ctx)
-{
-  JLM_ASSERT(jlm::rvsdg::is<jlm::rvsdg::gamma_op>(node->operation()));
+      for (size_t n = 0; n < node.noutputs(); n++)
+      {
+        auto output = node.output(n);
+        std::vector<jlm::rvsdg::output *> operands;
+        for (size_t r = 0; r < node.nsubregions(); r++)
+          operands.push_back(node.subregion(r)->result(n)->origin());
 
-  /* mark entry variables */
-  for (size_t i1 = 1; i1 < node->ninputs(); i1++)
-  {
-    for (size_t i2 = i1 + 1; i2 < node->ninputs(); i2++)
-      mark_arguments(node->input(i1), node->input(i2), ctx);
-  }
+        add(output, { kind::gamma_output, &node, nullptr, 0, operands.size() }, operands);
+      }
+    }
+    else if (jlm::rvsdg::is<jlm::rvsdg::theta_op>(&node))
+    {
+      auto subregion = node.subregion(0);
+      collect(*subregion);
 
-  for (size_t n = 0; n < node->nsubregions(); n++)
-    mark(node->subregion(n), ctx);
+      for (size_t n = 0; n < node.noutputs(); n++)
+      {
+        add(node.output(n),
+            { kind::theta_output, &node, nullptr, 0, 1 },
+            { subregion->argument(n) });
+      }
+    }
+    else if (jlm::rvsdg::is<lambda::operation>(&node) || jlm::rvsdg::is<phi::operation>(&node))
+    {
+      collect(*node.subregion(0));
 
-  /* mark exit variables */
-  for (size_t o1 = 0; o1 < node->noutputs(); o1++)
-  {
-    for (size_t o2 = o1 + 1; o2 < node->noutputs(); o2++)
+      for (size_t n = 0; n < node.noutputs(); n++)
+        add_unique(node.output(n));
+    }
+    else
     {
-      if (congruent(node->output(o1), node->output(o2), ctx))
-        ctx.mark(node->output(o1), node->output(o2));
+      JLM_ASSERT(jlm::rvsdg::is<delta::operation>(&node));
+      for (size_t n = 0; n < node.noutputs(); n++)
+        add_unique(node.output(n));
     }
   }
-}
 
-static void
-mark_theta(const jlm::rvsdg::structural_node * node, cnectx & ctx)
-{
-  JLM_ASSERT(jlm::rvsdg::is<jlm::rvsdg::theta_op>(node));
-  auto theta = static_cast<const jlm::rvsdg::theta_node *>(node);
-
-  /* mark loop variables */
-  for (size_t i1 = 0; i1 < theta->ninputs(); i1++)
+  void
+  collect(jlm::rvsdg::region & region)
   {
-    for (size_t i2 = i1 + 1; i2 < theta->ninputs(); i2++)
+    collect_arguments(region);
+
+    for (auto & node : jlm::rvsdg::topdown_traverser(&region))
     {
-      auto input1 = theta->input(i1);
-      auto input2 = theta->input(i2);
-      if (congruent(input1->argument(), input2->argument(), ctx))
+      if (auto simple = dynamic_cast<jlm::rvsdg::simple_node *>(node))
+      {
+        std::vector<jlm::rvsdg::output *> operands;
+        for (size_t n = 0; n < simple->ninputs(); n++)
+          operands.push_back(simple->input(n)->origin());
+
+        for (size_t n = 0; n < simple->noutputs(); n++)
+        {
+          add(simple->output(n),
+              { kind::simple_output, &region, &simple->operation(), n, operands.size() },
+              operands);
+        }
+      }
+      else
       {
-        ctx.mark(input1->argument(), input2->argument());
-        ctx.mark(input1->output(), input2->output());
+        collect(*static_cast<jlm::rvsdg::structural_node *>(node));
       }
     }
   }
 
-  mark(node->subregion(0), ctx);
-}
-
-static void
-mark_lambda(const jlm::rvsdg::structural_node * node, cnectx & ctx)
-{
-  JLM_ASSERT(jlm::rvsdg::is<lambda::operation>(node));
-
-  /* mark dependencies */
-  for (size_t i1 = 0; i1 < node->ninputs(); i1++)
+  void
+  resolve_operands()
   {
-    for (size_t i2 = i1 + 1; i2 < node->ninputs(); i2++)
+    operands_.resize(operand_outputs_.size());
+    user_begin_.assign(outputs_.size() + 1, 0);
+    for (size_t n = 0; n < operand_outputs_.size(); n++)
     {
-      auto input1 = node->input(i1);
-      auto input2 = node->input(i2);
-      if (ctx.congruent(input1, input2))
-        ctx.mark(input1->arguments.first(), input2->arguments.first());
+      JLM_ASSERT(ids_.find(operand_outputs_[n]) != ids_.end());
+      operands_[n] = ids_[operand_outputs_[n]];
+      user_begin_[operands_[n] + 1]++;
     }
-  }
 
-  mark(node->subregion(0), ctx);
-}
+    for (size_t n = 0; n < outputs_.size(); n++)
+      user_begin_[n + 1] += user_begin_[n];
 
-static void
-mark_phi(const jlm::rvsdg::structural_node * node, cnectx & ctx)
-{
-  JLM_ASSERT(is<phi::operation>(node));
-
-  /* mark dependencies */
-  for (size_t i1 = 0; i1 < node->ninputs(); i1++)
-  {
-    for (size_t i2 = i1 + 1; i2 < node->ninputs(); i2++)
+    auto position = user_begin_;
+    users_.resize(operands_.size());
+    for (size_t id = 0; id < outputs_.size(); id++)
     {
-      auto input1 = node->input(i1);
-      auto input2 = node->input(i2);
-      if (ctx.congruent(input1, input2))
-        ctx.mark(input1->arguments.first(), input2->arguments.first());
+      for (size_t n = operand_begin_[id]; n < operand_begin_[id + 1]; n++)
+        users_[position[operands_[n]]++] = { n - operand_begin_[id], id };
     }
-  }
 
-  mark(node->subregion(0), ctx);
-}
-
-static void
-mark_delta(const jlm::rvsdg::structural_node * node, cnectx & ctx)
-{
-  JLM_ASSERT(jlm::rvsdg::is<delta::operation>(node));
-}
-
-static void
-mark(const jlm::rvsdg::structural_node * node, cnectx & ctx)
-{
-  static std::
-      unordered_map<std::type_index, void (*)(const jlm::rvsdg::structural_node *, cnectx &)>
-          map({ { std::type_index(typeid(jlm::rvsdg::gamma_op)), mark_gamma },
-                { std::type_index(typeid(jlm::rvsdg::theta_op)), mark_theta },
-                { typeid(lambda::operation), mark_lambda },
-                { typeid(phi::operation), mark_phi },
-                { typeid(delta::operation), mark_delta } });
-
-  auto & op = node->operation();
-  JLM_ASSERT(map.find(typeid(op)) != map.end());
-  map[typeid(op)](node, ctx);
-}
+    operand_outputs_.clear();
+  }
 
-static void
-mark(const jlm::rvsdg::simple_node * node, cnectx & ctx)
-{
-  if (node->ninputs() == 0)
+  void
+  initialize_partition()
   {
-    for (const auto & other : node->region()->top_nodes)
+    std::unordered_map<label, size_t, label_hash> classes;
+    std::vector<size_t> sizes;
+    class_.resize(outputs_.size());
+    for (size_t id = 0; id < outputs_.size(); id++)
     {
-      if (&other != node && node->operation() == other.operation())
+      auto it = classes.find(labels_[id]);
+      if (it == classes.end())
       {
-        ctx.mark(node, &other);
-        break;
+        it = classes.emplace(labels_[id], sizes.size()).first;
+        sizes.push_back(0);
       }
+
+      class_[id] = it->second;
+      sizes[it->second]++;
     }
-    return;
-  }
+    labels_.clear();
 
-  auto set = ctx.set(node->input(0)->origin());
-  for (const auto & origin : *set)
-  {
-    for (const auto & user : *origin)
+    class_begin_.resize(sizes.size());
+    class_end_.resize(sizes.size());
+    for (size_t c = 0, offset = 0; c < sizes.size(); c++)
     {
-      auto ni = dynamic_cast<const jlm::rvsdg::node_input *>(user);
-      auto other = ni ? ni->node() : nullptr;
-      if (!other || other == node || other->operation() != node->operation()
-          || other->ninputs() != node->ninputs())
-        continue;
+      class_begin_[c] = class_end_[c] = offset;
+      offset += sizes[c];
+    }
 
-      size_t n;
-      for (n = 0; n < node->ninputs(); n++)
-      {
-        if (!ctx.congruent(node->input(n), other->input(n)))
-          break;
-      }
-      if (n == node->ninputs())
-        ctx.mark(node, other);
+    members_.resize(outputs_.size());
+    index_.resize(outputs_.size());
+    for (size_t id = 0; id < outputs_.size(); id++)
+    {
+      auto position = class_end_[class_[id]]++;
+      members_[position] = id;
+      index_[id] = position;
     }
   }
-}
 
-static void
-mark(jlm::rvsdg::region * region, cnectx & ctx)
-{
-  for (const auto & node : jlm::rvsdg::topdown_traverser(region))
+  void
+  refine_partition()
   {
-    if (auto simple = dynamic_cast<const jlm::rvsdg::simple_node *>(node))
-      mark(simple, ctx);
-    else
-      mark(static_cast<const jlm::rvsdg::structural_node *>(node), ctx);
-  }
-}
-
-/* divert phase */
-
-static void
-divert_users(jlm::rvsdg::output * output, cnectx & ctx)
-{
-  auto set = ctx.set(output);
-  for (auto & other : *set)
-    other->divert_users(output);
-  set->clear();
-}
-
-static void
-divert_outputs(jlm::rvsdg::node * node, cnectx & ctx)
-{
-  for (size_t n = 0; n < node->noutputs(); n++)
-    divert_users(node->output(n), ctx);
-}
-
-static void
-divert_arguments(jlm::rvsdg::region * region, cnectx & ctx)
-{
-  for (size_t n = 0; n < region->narguments(); n++)
-    divert_users(region->argument(n), ctx);
-}
+    std::vector<size_t> worklist(class_begin_.size());
+    for (size_t c = 0; c < worklist.size(); c++)
+      worklist[c] = c;
+    in_worklist_.assign(class_begin_.size(), true);
+    marked_.assign(class_begin_.size(), 0);
+
+    std::vector<std::pair<size_t, size_t>> splitter;
+    while (!worklist.empty())
+    {
+      auto c = worklist.back();
+      worklist.pop_back();
+      in_worklist_[c] = false;
 
-static void
-divert(jlm::rvsdg::region *, cnectx &);
+      splitter.clear();
+      for (size_t n = class_begin_[c]; n < class_end_[c]; n++)
+      {
+        auto member = members_[n];
+        for (size_t u = user_begin_[member]; u < user_begin_[member + 1]; u++)
+          splitter.push_back(users_[u]);
+      }
+      std::sort(splitter.begin(), splitter.end());
 
-static void
-divert_gamma(jlm::rvsdg::structural_node * node, cnectx & ctx)
-{
-  JLM_ASSERT(jlm::rvsdg::is<jlm::rvsdg::gamma_op>(node));
-  auto gamma = static_cast<jlm::rvsdg::gamma_node *>(node);
+      auto begin = splitter.begin();
+      while (begin != splitter.end())
+      {
+        auto end = begin;
+        while (end != splitter.end() && end->first == begin->first)
+          end++;
 
-  for (auto ev = gamma->begin_entryvar(); ev != gamma->end_entryvar(); ev++)
-  {
-    for (size_t n = 0; n < ev->narguments(); n++)
-      divert_users(ev->argument(n), ctx);
+        split(begin, end, worklist);
+        begin = end;
+      }
+    }
   }
 
-  for (size_t r = 0; r < node->nsubregions(); r++)
-    divert(node->subregion(r), ctx);
-
-  divert_outputs(node, ctx);
-}
-
-static void
-divert_theta(jlm::rvsdg::structural_node * node, cnectx & ctx)
-{
-  JLM_ASSERT(jlm::rvsdg::is<jlm::rvsdg::theta_op>(node));
-  auto theta = static_cast<jlm::rvsdg::theta_node *>(node);
-  auto subregion = node->subregion(0);
-
-  for (const auto & lv : *theta)
+  /**
+   * Splits every class with members in [\p begin, \p end) into the members in the range and the
+   * remaining members.
+   */
+  void
+  split(
+      std::vector<std::pair<size_t, size_t>>::const_iterator begin,
+      std::vector<std::pair<size_t, size_t>>::const_iterator end,
+      std::vector<size_t> & worklist)
   {
-    JLM_ASSERT(ctx.set(lv->argument())->size() == ctx.set(lv)->size());
-    divert_users(lv->argument(), ctx);
-    divert_users(lv, ctx);
-  }
-
-  divert(subregion, ctx);
-}
-
-static void
-divert_lambda(jlm::rvsdg::structural_node * node, cnectx & ctx)
-{
-  JLM_ASSERT(jlm::rvsdg::is<lambda::operation>(node));
-
-  divert_arguments(node->subregion(0), ctx);
-  divert(node->subregion(0), ctx);
-}
-
-static void
-divert_phi(jlm::rvsdg::structural_node * node, cnectx & ctx)
-{
-  JLM_ASSERT(is<phi::operation>(node));
-
-  divert_arguments(node->subregion(0), ctx);
-  divert(node->subregion(0), ctx);
-}
-
-static void
-divert_delta(jlm::rvsdg::structural_node * node, cnectx & ctx)
-{
-  JLM_ASSERT(jlm::rvsdg::is<delta::operation>(node));
-}
+    touched_.clear();
+    for (auto it = begin; it != end; it++)
+    {
+      auto id = it->second;
+      auto c = class_[id];
+      auto & marked = marked_[c];
+
+      /* a user occurs at most once for a given operand position */
+      JLM_ASSERT(index_[id] >= class_begin_[c] + marked);
+      if (marked == 0)
+        touched_.push_back(c);
+
+      auto position = class_begin_[c] + marked++;
+      auto other = members_[position];
+      std::swap(members_[position], members_[index_[id]]);
+      index_[other] = index_[id];
+      index_[id] = position;
+    }
 
-static void
-divert(jlm::rvsdg::structural_node * node, cnectx & ctx)
-{
-  static std::unordered_map<std::type_index, void (*)(jlm::rvsdg::structural_node *, cnectx &)> map(
-      { { std::type_index(typeid(jlm::rvsdg::gamma_op)), divert_gamma },
-        { std::type_index(typeid(jlm::rvsdg::theta_op)), divert_theta },
-        { typeid(lambda::operation), divert_lambda },
-        { typeid(phi::operation), divert_phi },
-        { typeid(delta::operation), divert_delta } });
-
-  auto & op = node->operation();
-  JLM_ASSERT(map.find(typeid(op)) != map.end());
-  map[typeid(op)](node, ctx);
-}
+    for (auto c : touched_)
+    {
+      auto nmarked = marked_[c];
+      marked_[c] = 0;
+      if (nmarked == class_end_[c] - class_begin_[c])
+        continue;
 
-static void
-divert(jlm::rvsdg::region * region, cnectx & ctx)
-{
-  for (const auto & node : jlm::rvsdg::topdown_traverser(region))
-  {
-    if (auto simple = dynamic_cast<jlm::rvsdg::simple_node *>(node))
-      divert_outputs(simple, ctx);
-    else
-      divert(static_cast<jlm::rvsdg::structural_node *>(node), ctx);
+      auto d = class_begin_.size();
+      class_begin_.push_back(class_begin_[c]);
+      class_end_.push_back(class_begin_[c] + nmarked);
+      in_worklist_.push_back(false);
+      marked_.push_back(0);
+      class_begin_[c] += nmarked;
+
+      for (size_t n = class_begin_[d]; n < class_end_[d]; n++)
+        class_[members_[n]] = d;
+
+      /* Hopcroft's rule: it suffices to revisit the smaller half unless c is still pending */
+      auto sizeC = class_end_[c] - class_begin_[c];
+      auto sizeD = class_end_[d] - class_begin_[d];
+      auto next = in_worklist_[c] || sizeD <= sizeC ? d : c;
+      if (!in_worklist_[next])
+      {
+        in_worklist_[next] = true;
+        worklist.push_back(next);
+      }
+    }
   }
-}
+
+  /* region the partition is computed for */
+  const jlm::rvsdg::region * boundary_ = nullptr;
+
+  /* outputs, indexed by their id */
+  std::vector<jlm::rvsdg::output *> outputs_;
+  std::unordered_map<const jlm::rvsdg::output *, size_t> ids_;
+  std::vector<label> labels_;
+
+  /* operands of output i are operands_[operand_begin_[i]..operand_begin_[i+1]) */
+  std::vector<size_t> operand_begin_ = { 0 };
+  std::vector<jlm::rvsdg::output *> operand_outputs_;
+  std::vector<size_t> operands_;
+
+  /* (operand position, user) pairs of output i are users_[user_begin_[i]..user_begin_[i+1]) */
+  std::vector<size_t> user_begin_;
+  std::vector<std::pair<size_t, size_t>> users_;
+
+  /* members of class c are members_[class_begin_[c]..class_end_[c]) */
+  std::vector<size_t> class_;
+  std::vector<size_t> members_;
+  std::vector<size_t> index_;
+  std::vector<size_t> class_begin_;
+  std::vector<size_t> class_end_;
+
+  std::vector<bool> in_worklist_;
+  std::vector<size_t> marked_;
+  std::vector<size_t> touched_;
+};
 
 static void
 cne(RvsdgModule & rm, util::StatisticsCollector & statisticsCollector)
@@ -583,11 +531,11 @@ cne(RvsdgModule & rm, util::StatisticsCollector & statisticsCollector)
   auto statistics = cnestat::Create();
 
   statistics->start_mark_stat(graph);
-  mark(graph.root(), ctx);
+  ctx.mark(*graph.root());
   statistics->end_mark_stat();
 
   statistics->start_divert_stat();
-  divert(graph.root(), ctx);
+  ctx.divert();
   statistics->end_divert_stat(graph);
 
   statisticsCollector.CollectDemandedStatistics(std::move(statistics));
@@ -604,4 +552,18 @@ cne::run(RvsdgModule & module, util::StatisticsCollector & statisticsCollector)
   llvm::cne(module, statisticsCollector);
 }
 
+bool
+cne::IsIntraProcedural() const noexcept
+{
+  return true;
+}
+
+void
+cne::RunOnFunctionBody(jlm::rvsdg::region & body) const
+{
+  cnectx ctx;
+  ctx.mark(body);
+  ctx.divert();
+}
+
 }
@@ -23,6 +23,12 @@ public:
 
   virtual void
   run(RvsdgModule & module, jlm::util::StatisticsCollector & statisticsCollector) override;
+
+  [[nodiscard]] bool
+  IsIntraProcedural() const noexcept override;
+
+  void
+  RunOnFunctionBody(jlm::rvsdg::region & body) const override;
 };
 
 }
@@ -6,6 +6,7 @@
 #include <jlm/llvm/ir/operators.hpp>
 #include <jlm/llvm/ir/RvsdgModule.hpp>
 #include <jlm/llvm/opt/inlining.hpp>
+#include <jlm/rvsdg/EdgeBatch.hpp>
 #include <jlm/rvsdg/traverser.hpp>
 #include <jlm/util/Statistics.hpp>
 #include <jlm/util/time.hpp>
@@ -143,12 +144,14 @@ inlineCall(jlm::rvsdg::simple_node * call, const lambda::node * lambda)
 
   lambda->subregion()->copy(call->region(), smap, false, false);
 
+  jlm::rvsdg::EdgeBatch batch;
   for (size_t n = 0; n < call->noutputs(); n++)
   {
     auto output = lambda->subregion()->result(n)->origin();
     JLM_ASSERT(smap.lookup(output));
-    call->output(n)->divert_users(smap.lookup(output));
+    batch.DivertUsers(*call->output(n), *smap.lookup(output));
   }
+  batch.Apply();
   remove(call);
 }
 
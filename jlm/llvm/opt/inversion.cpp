@@ -350,4 +350,16 @@ tginversion::run(RvsdgModule & module, jlm::util::StatisticsCollector & statisti
   invert(module, statisticsCollector);
 }
 
+bool
+tginversion::IsIntraProcedural() const noexcept
+{
+  return true;
+}
+
+void
+tginversion::RunOnFunctionBody(jlm::rvsdg::region & body) const
+{
+  invert(&body);
+}
+
 }
@@ -4,6 +4,7 @@
  */
 
 #include <jlm/llvm/opt/optimization.hpp>
+#include <jlm/util/common.hpp>
 
 namespace jlm::llvm
 {
@@ -11,4 +12,25 @@ namespace jlm::llvm
 optimization::~optimization()
 {}
 
+void
+optimization::RunWithThreads(
+    RvsdgModule & module,
+    jlm::util::StatisticsCollector & statisticsCollector,
+    size_t)
+{
+  run(module, statisticsCollector);
+}
+
+bool
+optimization::IsIntraProcedural() const noexcept
+{
+  return false;
+}
+
+void
+optimization::RunOnFunctionBody(jlm::rvsdg::region &) const
+{
+  JLM_UNREACHABLE("Optimization is not intra-procedural.");
+}
+
 }
@@ -6,8 +6,14 @@
 #ifndef JLM_LLVM_OPT_OPTIMIZATION_HPP
 #define JLM_LLVM_OPT_OPTIMIZATION_HPP
 
+#include <cstddef>
 #include <vector>
 
+namespace jlm::rvsdg
+{
+class region;
+}
+
 namespace jlm::util
 {
 class StatisticsCollector;
@@ -38,6 +44,49 @@ public:
    */
   virtual void
   run(RvsdgModule & module, jlm::util::StatisticsCollector & statisticsCollector) = 0;
+
+  /**
+   * \brief Perform optimization with up to \p numThreads threads
+   *
+   * Inter-procedural optimizations that can exploit parallelism within a module override this
+   * method. The default implementation ignores \p numThreads and invokes run().
+   *
+   * \param module RVSDG module the optimization is performed on.
+   * \param statisticsCollector Statistics collector for collecting optimization statistics.
+   * \param numThreads The maximal number of threads the optimization may use.
+   */
+  virtual void
+  RunWithThreads(
+      RvsdgModule & module,
+      jlm::util::StatisticsCollector & statisticsCollector,
+      size_t numThreads);
+
+  /**
+   * \brief Determines whether the optimization is intra-procedural
+   *
+   * An intra-procedural optimization transforms every function body in isolation, and can
+   * therefore be applied to the bodies of different functions concurrently. See
+   * RunOnFunctionBody().
+   *
+   * \return True if RunOnFunctionBody() is implemented, otherwise false.
+   */
+  [[nodiscard]] virtual bool
+  IsIntraProcedural() const noexcept;
+
+  /**
+   * \brief Perform optimization on a single function body
+   *
+   * This method is only invoked on intra-procedural optimizations, and it is invoked
+   * concurrently for the bodies of different functions. An implementation is therefore
+   * required to:
+   * 1. only modify nodes, inputs, and outputs within \p body,
+   * 2. never inspect the body of any other function, and
+   * 3. not keep any state in the optimization object.
+   *
+   * \param body The subregion of a lambda node the optimization is performed on.
+   */
+  virtual void
+  RunOnFunctionBody(jlm::rvsdg::region & body) const;
 };
 
 }
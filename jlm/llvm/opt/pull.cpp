@@ -333,4 +333,16 @@ pullin::run(RvsdgModule & module, util::StatisticsCollector & statisticsCollecto
   pull(module, statisticsCollector);
 }
 
+bool
+pullin::IsIntraProcedural() const noexcept
+{
+  return true;
+}
+
+void
+pullin::RunOnFunctionBody(jlm::rvsdg::region & body) const
+{
+  pull(&body);
+}
+
 }
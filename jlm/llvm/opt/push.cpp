@@ -455,4 +455,16 @@ pushout::run(RvsdgModule & module, util::StatisticsCollector & statisticsCollect
   push(module, statisticsCollector);
 }
 
+bool
+pushout::IsIntraProcedural() const noexcept
+{
+  return true;
+}
+
+void
+pushout::RunOnFunctionBody(jlm::rvsdg::region & body) const
+{
+  push(&body);
+}
+
 }
@@ -29,6 +29,12 @@ public:
 
   virtual void
   run(RvsdgModule & module, util::StatisticsCollector & statisticsCollector) override;
+
+  [[nodiscard]] bool
+  IsIntraProcedural() const noexcept override;
+
+  void
+  RunOnFunctionBody(jlm::rvsdg::region & body) const override;
 };
 
 void
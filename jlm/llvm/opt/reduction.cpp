@@ -6,6 +6,7 @@
 #include <jlm/llvm/ir/operators.hpp>
 #include <jlm/llvm/ir/RvsdgModule.hpp>
 #include <jlm/llvm/opt/reduction.hpp>
+#include <jlm/rvsdg/IncrementalNormalizer.hpp>
 #include <jlm/rvsdg/statemux.hpp>
 #include <jlm/util/Statistics.hpp>
 #include <jlm/util/time.hpp>
@@ -24,7 +25,9 @@ public:
         nnodes_before_(0),
         nnodes_after_(0),
         ninputs_before_(0),
-        ninputs_after_(0)
+        ninputs_after_(0),
+        nvisited_(0),
+        nrevisited_(0)
   {}
 
   void
@@ -36,10 +39,14 @@ public:
   }
 
   void
-  end(const jlm::rvsdg::graph & graph) noexcept
+  end(
+      const jlm::rvsdg::graph & graph,
+      const jlm::rvsdg::IncrementalNormalizer & normalizer) noexcept
   {
     nnodes_after_ = jlm::rvsdg::nnodes(graph.root());
     ninputs_after_ = jlm::rvsdg::ninputs(graph.root());
+    nvisited_ = normalizer.NumVisitedNodes();
+    nrevisited_ = normalizer.NumRevisitedNodes();
     timer_.stop();
   }
 
@@ -56,7 +63,11 @@ public:
         " ",
         ninputs_after_,
         " ",
-        timer_.ns());
+        timer_.ns(),
+        " #VisitedNodes:",
+        nvisited_,
+        " #RevisitedNodes:",
+        nrevisited_);
   }
 
   static std::unique_ptr<redstat>
@@ -68,6 +79,7 @@ public:
 private:
   size_t nnodes_before_, nnodes_after_;
   size_t ninputs_before_, ninputs_after_;
+  size_t nvisited_, nrevisited_;
   util::timer timer_;
 };
 
@@ -158,8 +170,10 @@ reduce(RvsdgModule & rm, util::StatisticsCollector & statisticsCollector)
   enable_unary_reductions(graph);
   enable_binary_reductions(graph);
 
-  graph.normalize();
-  statistics->end(graph);
+  // Only the nodes whose operands changed are revisited after the initial visit of all nodes
+  jlm::rvsdg::IncrementalNormalizer normalizer(graph);
+  normalizer.Normalize();
+  statistics->end(graph, normalizer);
 
   statisticsCollector.CollectDemandedStatistics(std::move(statistics));
 }
@@ -539,4 +539,19 @@ loopunroll::run(RvsdgModule & module, util::StatisticsCollector & statisticsColl
   statisticsCollector.CollectDemandedStatistics(std::move(statistics));
 }
 
+bool
+loopunroll::IsIntraProcedural() const noexcept
+{
+  return true;
+}
+
+void
+loopunroll::RunOnFunctionBody(jlm::rvsdg::region & body) const
+{
+  if (factor_ < 2)
+    return;
+
+  unroll(&body, factor_);
+}
+
 }
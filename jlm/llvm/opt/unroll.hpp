@@ -39,6 +39,12 @@ public:
   virtual void
   run(RvsdgModule & module, util::StatisticsCollector & statisticsCollector) override;
 
+  [[nodiscard]] bool
+  IsIntraProcedural() const noexcept override;
+
+  void
+  RunOnFunctionBody(jlm::rvsdg::region & body) const override;
+
 private:
   size_t factor_;
 };
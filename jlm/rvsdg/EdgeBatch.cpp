@@ -0,0 +1,107 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/rvsdg/EdgeBatch.hpp>
+#include <jlm/rvsdg/graph.hpp>
+#include <jlm/rvsdg/node.hpp>
+#include <jlm/rvsdg/notifiers.hpp>
+
+#include <iterator>
+
+namespace jlm::rvsdg
+{
+
+void
+EdgeBatch::Divert(jlm::rvsdg::input & input, jlm::rvsdg::output & newOrigin)
+{
+  CheckOperation(*input.origin(), newOrigin);
+  Operations_.push_back({ &input, nullptr, &newOrigin });
+}
+
+void
+EdgeBatch::DivertUsers(jlm::rvsdg::output & output, jlm::rvsdg::output & newOrigin)
+{
+  CheckOperation(output, newOrigin);
+  Operations_.push_back({ nullptr, &output, &newOrigin });
+}
+
+void
+EdgeBatch::CheckOperation(const jlm::rvsdg::output & origin, const jlm::rvsdg::output & newOrigin)
+{
+  // Types of ports are interned and can therefore be compared by their address
+  if (&origin.type() != &newOrigin.type())
+    throw jlm::util::type_error(origin.type().debug_string(), newOrigin.type().debug_string());
+
+  if (origin.region() != newOrigin.region())
+    throw jlm::util::error("Invalid operand region.");
+
+  auto graph = origin.region()->graph();
+  if (Graph_ && Graph_ != graph)
+    throw jlm::util::error("Edges of an edge batch must belong to the same graph.");
+
+  Graph_ = graph;
+}
+
+void
+EdgeBatch::ChangeOrigin(jlm::rvsdg::input & input, jlm::rvsdg::output & newOrigin)
+{
+  if (input.origin() == &newOrigin)
+    return;
+
+  if (ChangedInputIndices_.emplace(&input, ChangedInputs_.size()).second)
+    ChangedInputs_.emplace_back(&input, input.origin());
+
+  input.ChangeOrigin(&newOrigin);
+}
+
+size_t
+EdgeBatch::Apply()
+{
+  for (const auto & operation : Operations_)
+  {
+    if (operation.Input)
+    {
+      ChangeOrigin(*operation.Input, *operation.NewOrigin);
+      continue;
+    }
+
+    auto output = operation.Output;
+    if (output == operation.NewOrigin)
+      continue;
+
+    while (output->nusers() != 0)
+      ChangeOrigin(**std::prev(output->end()), *operation.NewOrigin);
+  }
+  Operations_.clear();
+
+  std::vector<jlm::rvsdg::node *> nodes;
+  for (const auto & [input, oldOrigin] : ChangedInputs_)
+  {
+    if (is<node_input>(*input))
+      nodes.push_back(static_cast<node_input *>(input)->node());
+  }
+  node::RecomputeDepths(nodes);
+
+  size_t numChangedInputs = 0;
+  for (const auto & [input, oldOrigin] : ChangedInputs_)
+  {
+    if (input->origin() == oldOrigin)
+      continue;
+
+    on_input_change(input, oldOrigin, input->origin());
+    numChangedInputs++;
+  }
+
+  if (numChangedInputs != 0)
+    Graph_->mark_denormalized();
+
+  ChangedInputs_.clear();
+  ChangedInputIndices_.clear();
+  Graph_ = nullptr;
+
+  return numChangedInputs;
+}
+
+}
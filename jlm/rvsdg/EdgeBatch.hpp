@@ -0,0 +1,100 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_RVSDG_EDGEBATCH_HPP
+#define JLM_RVSDG_EDGEBATCH_HPP
+
+#include <cstddef>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace jlm::rvsdg
+{
+
+class graph;
+class input;
+class output;
+
+/**
+ * Collects the rewiring of many edges of a graph and applies them in a single pass.
+ *
+ * The edges are rewired in the order in which they were added to the batch, i.e., the result is
+ * the same as if each operation was performed individually. However, the depths of the affected
+ * nodes are recomputed only once for the entire batch, the graph is marked as denormalized only
+ * once, and a single on_input_change notification is emitted per input. The notification reports
+ * the origin of the input before the batch and its final origin, and it is omitted if the input
+ * ends up with its original origin.
+ *
+ * The operations are checked when they are added to the batch, such that Apply() cannot fail
+ * halfway. Operations that were not applied are discarded with the batch.
+ */
+class EdgeBatch final
+{
+  struct Operation
+  {
+    // Either a single input or all users of an output are diverted
+    jlm::rvsdg::input * Input;
+    jlm::rvsdg::output * Output;
+    jlm::rvsdg::output * NewOrigin;
+  };
+
+public:
+  EdgeBatch() = default;
+
+  EdgeBatch(const EdgeBatch &) = delete;
+
+  EdgeBatch &
+  operator=(const EdgeBatch &) = delete;
+
+  /**
+   * Adds the diversion of \p input to \p newOrigin to the batch.
+   */
+  void
+  Divert(jlm::rvsdg::input & input, jlm::rvsdg::output & newOrigin);
+
+  /**
+   * Adds the diversion of all users of \p output to \p newOrigin to the batch. The users are
+   * determined when the batch is applied.
+   */
+  void
+  DivertUsers(jlm::rvsdg::output & output, jlm::rvsdg::output & newOrigin);
+
+  /**
+   * @return The number of operations in the batch.
+   */
+  [[nodiscard]] size_t
+  NumOperations() const noexcept
+  {
+    return Operations_.size();
+  }
+
+  /**
+   * Applies all operations of the batch and clears it afterwards.
+   *
+   * @return The number of inputs whose origin was changed.
+   */
+  size_t
+  Apply();
+
+private:
+  void
+  CheckOperation(const jlm::rvsdg::output & origin, const jlm::rvsdg::output & newOrigin);
+
+  void
+  ChangeOrigin(jlm::rvsdg::input & input, jlm::rvsdg::output & newOrigin);
+
+  jlm::rvsdg::graph * Graph_ = nullptr;
+  std::vector<Operation> Operations_;
+
+  // The inputs changed by Apply() in the order of their first change, together with their
+  // origins before the batch
+  std::vector<std::pair<jlm::rvsdg::input *, jlm::rvsdg::output *>> ChangedInputs_;
+  std::unordered_map<const jlm::rvsdg::input *, size_t> ChangedInputIndices_;
+};
+
+}
+
+#endif
@@ -0,0 +1,218 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_RVSDG_IDMAP_HPP
+#define JLM_RVSDG_IDMAP_HPP
+
+#include <jlm/util/common.hpp>
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+namespace jlm::rvsdg
+{
+
+class node;
+class output;
+class region;
+
+/**
+ * Side table that associates values with the nodes, outputs, or regions of a graph. The values
+ * are stored in a flat vector indexed by the dense id of their key, such that lookups require
+ * neither hashing nor any allocation.
+ *
+ * Ids are reused after the removal of an object. Entries of removed objects must therefore be
+ * removed from the table before new objects are created.
+ *
+ * @tparam Key The key type, which must provide an Id() method.
+ * @tparam Value The value type, which must be default constructible.
+ */
+template<typename Key, typename Value>
+class IdMap final
+{
+public:
+  [[nodiscard]] bool
+  Contains(const Key & key) const noexcept
+  {
+    auto id = key.Id();
+    return id < Present_.size() && Present_[id];
+  }
+
+  /**
+   * Associates \p value with \p key if the key has no value yet.
+   *
+   * @return True if the value was inserted, otherwise false.
+   */
+  bool
+  Insert(const Key & key, Value value)
+  {
+    if (Contains(key))
+      return false;
+
+    (*this)[key] = std::move(value);
+    return true;
+  }
+
+  /**
+   * @return The value of \p key. A default constructed value is inserted if the key has no value
+   * yet.
+   */
+  Value &
+  operator[](const Key & key)
+  {
+    auto id = key.Id();
+    if (id >= Present_.size())
+    {
+      Present_.resize(id + 1, false);
+      Values_.resize(id + 1);
+    }
+
+    if (!Present_[id])
+    {
+      Present_[id] = true;
+      Size_++;
+    }
+
+    return Values_[id];
+  }
+
+  /**
+   * @return The value of \p key, which must be in the map.
+   */
+  [[nodiscard]] const Value &
+  Lookup(const Key & key) const noexcept
+  {
+    JLM_ASSERT(Contains(key));
+    return Values_[key.Id()];
+  }
+
+  /**
+   * Removes \p key and its value from the map.
+   *
+   * @return True if the key was in the map, otherwise false.
+   */
+  bool
+  Remove(const Key & key)
+  {
+    if (!Contains(key))
+      return false;
+
+    auto id = key.Id();
+    Present_[id] = false;
+    Values_[id] = Value();
+    Size_--;
+    return true;
+  }
+
+  [[nodiscard]] size_t
+  Size() const noexcept
+  {
+    return Size_;
+  }
+
+  void
+  Clear() noexcept
+  {
+    Present_.clear();
+    Values_.clear();
+    Size_ = 0;
+  }
+
+private:
+  size_t Size_ = 0;
+  std::vector<bool> Present_;
+  std::vector<Value> Values_;
+};
+
+/**
+ * Set of nodes, outputs, or regions of a graph, which is represented as a bit vector indexed by
+ * the dense ids of its items.
+ *
+ * @see IdMap
+ */
+template<typename Key>
+class IdSet final
+{
+public:
+  [[nodiscard]] bool
+  Contains(const Key & key) const noexcept
+  {
+    auto id = key.Id();
+    return id < Present_.size() && Present_[id];
+  }
+
+  /**
+   * Inserts \p key into the set.
+   *
+   * @return True if the key was inserted, false if it was already in the set.
+   */
+  bool
+  Insert(const Key & key)
+  {
+    auto id = key.Id();
+    if (id >= Present_.size())
+      Present_.resize(id + 1, false);
+
+    if (Present_[id])
+      return false;
+
+    Present_[id] = true;
+    Size_++;
+    return true;
+  }
+
+  /**
+   * Removes \p key from the set.
+   *
+   * @return True if the key was in the set, otherwise false.
+   */
+  bool
+  Remove(const Key & key) noexcept
+  {
+    if (!Contains(key))
+      return false;
+
+    Present_[key.Id()] = false;
+    Size_--;
+    return true;
+  }
+
+  [[nodiscard]] size_t
+  Size() const noexcept
+  {
+    return Size_;
+  }
+
+  void
+  Clear() noexcept
+  {
+    Present_.clear();
+    Size_ = 0;
+  }
+
+private:
+  size_t Size_ = 0;
+  std::vector<bool> Present_;
+};
+
+template<typename Value>
+using NodeMap = IdMap<node, Value>;
+
+template<typename Value>
+using OutputMap = IdMap<output, Value>;
+
+template<typename Value>
+using RegionMap = IdMap<region, Value>;
+
+using NodeSet = IdSet<node>;
+
+using OutputSet = IdSet<output>;
+
+using RegionSet = IdSet<region>;
+
+}
+
+#endif
@@ -0,0 +1,138 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/rvsdg/graph.hpp>
+#include <jlm/rvsdg/IncrementalNormalizer.hpp>
+#include <jlm/rvsdg/node-normal-form.hpp>
+#include <jlm/rvsdg/notifiers.hpp>
+#include <jlm/rvsdg/region.hpp>
+#include <jlm/rvsdg/structural-node.hpp>
+
+#include <functional>
+
+namespace jlm::rvsdg
+{
+
+IncrementalNormalizer::~IncrementalNormalizer() noexcept = default;
+
+IncrementalNormalizer::IncrementalNormalizer(jlm::rvsdg::graph & graph)
+    : Graph_(graph),
+      NumPendingNodes_(0),
+      NumVisitedNodes_(0),
+      NumRevisitedNodes_(0)
+{
+  using namespace std::placeholders;
+
+  Callbacks_.push_back(
+      on_node_create.connect(std::bind(&IncrementalNormalizer::NodeCreate, this, _1)));
+  Callbacks_.push_back(
+      on_node_destroy.connect(std::bind(&IncrementalNormalizer::NodeDestroy, this, _1)));
+  Callbacks_.push_back(
+      on_input_change.connect(std::bind(&IncrementalNormalizer::InputChange, this, _1, _2, _3)));
+
+  MarkAll();
+}
+
+void
+IncrementalNormalizer::MarkAll()
+{
+  MarkRegion(*Graph_.root());
+}
+
+void
+IncrementalNormalizer::MarkRegion(jlm::rvsdg::region & region)
+{
+  for (auto & node : region.nodes)
+  {
+    Mark(node);
+
+    if (auto structuralNode = dynamic_cast<jlm::rvsdg::structural_node *>(&node))
+    {
+      for (size_t n = 0; n < structuralNode->nsubregions(); n++)
+        MarkRegion(*structuralNode->subregion(n));
+    }
+  }
+}
+
+void
+IncrementalNormalizer::Mark(jlm::rvsdg::node & node)
+{
+  auto id = node.Id();
+  if (id >= PendingNodes_.size())
+    PendingNodes_.resize(id + 1, nullptr);
+
+  if (PendingNodes_[id] == &node)
+    return;
+
+  JLM_ASSERT(PendingNodes_[id] == nullptr);
+  PendingNodes_[id] = &node;
+  NumPendingNodes_++;
+  Worklist_.emplace(node.depth(), id, &node);
+}
+
+size_t
+IncrementalNormalizer::Normalize()
+{
+  size_t numVisitedNodes = 0;
+  NodeSet visitedNodes;
+  while (!Worklist_.empty())
+  {
+    auto [depth, id, node] = Worklist_.top();
+    Worklist_.pop();
+
+    if (PendingNodes_[id] != node)
+      continue;
+
+    PendingNodes_[id] = nullptr;
+    NumPendingNodes_--;
+
+    numVisitedNodes++;
+    if (!visitedNodes.Insert(*node))
+      NumRevisitedNodes_++;
+
+    const auto & operation = node->operation();
+    Graph_.node_normal_form(typeid(operation))->normalize_node(node);
+  }
+
+  JLM_ASSERT(NumPendingNodes_ == 0);
+  NumVisitedNodes_ += numVisitedNodes;
+  return numVisitedNodes;
+}
+
+void
+IncrementalNormalizer::NodeCreate(jlm::rvsdg::node * node)
+{
+  if (node->graph() == &Graph_)
+    Mark(*node);
+}
+
+void
+IncrementalNormalizer::NodeDestroy(jlm::rvsdg::node * node)
+{
+  auto id = node->Id();
+  if (node->graph() != &Graph_ || id >= PendingNodes_.size() || PendingNodes_[id] != node)
+    return;
+
+  PendingNodes_[id] = nullptr;
+  NumPendingNodes_--;
+}
+
+void
+IncrementalNormalizer::InputChange(
+    jlm::rvsdg::input * input,
+    jlm::rvsdg::output *,
+    jlm::rvsdg::output *)
+{
+  if (input->region()->graph() != &Graph_)
+    return;
+
+  // The results of a region are operands of the structural node that contains the region
+  if (auto node = input::GetNode(*input))
+    Mark(*node);
+  else if (auto node = input->region()->node())
+    Mark(*node);
+}
+
+}
@@ -0,0 +1,132 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_RVSDG_INCREMENTALNORMALIZER_HPP
+#define JLM_RVSDG_INCREMENTALNORMALIZER_HPP
+
+#include <jlm/rvsdg/IdMap.hpp>
+#include <jlm/util/callbacks.hpp>
+
+#include <cstddef>
+#include <queue>
+#include <tuple>
+#include <vector>
+
+namespace jlm::rvsdg
+{
+
+class graph;
+class input;
+class node;
+class output;
+class region;
+
+/**
+ * Worklist-driven normalization of a graph.
+ *
+ * The normalizer observes the creation of nodes and the changes of node operands, and only
+ * revisits the affected nodes instead of sweeping the entire graph. All nodes of the graph are
+ * pending when the normalizer is created. Normalize() then normalizes pending nodes until no node
+ * is pending anymore, i.e., until a fixpoint is reached. Later invocations only revisit the nodes
+ * that were created or whose operands changed since the last invocation.
+ *
+ * The normalizer relies on the thread-local notifiers, and therefore only observes the changes
+ * that are performed by the thread that created it. The normal forms of the graph are not
+ * observed either, such that MarkAll() must be invoked after a normal form was reconfigured.
+ */
+class IncrementalNormalizer final
+{
+  // The depth of a node at the time it was added to the worklist, its id, and the node itself
+  using WorklistItem = std::tuple<size_t, size_t, jlm::rvsdg::node *>;
+
+public:
+  ~IncrementalNormalizer() noexcept;
+
+  explicit IncrementalNormalizer(jlm::rvsdg::graph & graph);
+
+  IncrementalNormalizer(const IncrementalNormalizer &) = delete;
+
+  IncrementalNormalizer &
+  operator=(const IncrementalNormalizer &) = delete;
+
+  /**
+   * Marks all nodes of the graph as pending.
+   */
+  void
+  MarkAll();
+
+  /**
+   * Normalizes all pending nodes until a fixpoint is reached.
+   *
+   * @return The number of node visits of this invocation.
+   */
+  size_t
+  Normalize();
+
+  /**
+   * @return The number of pending nodes.
+   */
+  [[nodiscard]] size_t
+  NumPendingNodes() const noexcept
+  {
+    return NumPendingNodes_;
+  }
+
+  /**
+   * @return The number of node visits of all invocations of Normalize().
+   */
+  [[nodiscard]] size_t
+  NumVisitedNodes() const noexcept
+  {
+    return NumVisitedNodes_;
+  }
+
+  /**
+   * @return The number of node visits of all invocations of Normalize() that visited a node that
+   * was already visited before in the same invocation.
+   */
+  [[nodiscard]] size_t
+  NumRevisitedNodes() const noexcept
+  {
+    return NumRevisitedNodes_;
+  }
+
+private:
+  void
+  Mark(jlm::rvsdg::node & node);
+
+  void
+  MarkRegion(jlm::rvsdg::region & region);
+
+  void
+  NodeCreate(jlm::rvsdg::node * node);
+
+  void
+  NodeDestroy(jlm::rvsdg::node * node);
+
+  void
+  InputChange(
+      jlm::rvsdg::input * input,
+      jlm::rvsdg::output * oldOrigin,
+      jlm::rvsdg::output * newOrigin);
+
+  jlm::rvsdg::graph & Graph_;
+
+  // Pending nodes indexed by their id. The worklist can contain stale items of removed nodes,
+  // which are detected by comparing the node of an item with the pending node of its id.
+  std::vector<jlm::rvsdg::node *> PendingNodes_;
+  size_t NumPendingNodes_;
+  std::priority_queue<WorklistItem, std::vector<WorklistItem>, std::greater<WorklistItem>>
+      Worklist_;
+
+  size_t NumVisitedNodes_;
+  size_t NumRevisitedNodes_;
+
+  std::vector<jlm::util::callback> Callbacks_;
+};
+
+}
+
+#endif
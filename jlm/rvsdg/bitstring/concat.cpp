@@ -9,8 +9,6 @@
 #include <jlm/rvsdg/bitstring/slice.hpp>
 #include <jlm/rvsdg/reduction-helpers.hpp>
 
-#include <string.h>
-
 namespace jlm::rvsdg
 {
 
@@ -44,16 +42,9 @@ concat_reduce_arg_pair(jlm::rvsdg::output * arg1, jlm::rvsdg::output * arg2)
   auto arg2_constant = dynamic_cast<const bitconstant_op *>(&node2->operation());
   if (arg1_constant && arg2_constant)
   {
-    size_t nbits = arg1_constant->value().nbits() + arg2_constant->value().nbits();
-    std::vector<char> bits(nbits);
-    memcpy(&bits[0], &arg1_constant->value()[0], arg1_constant->value().nbits());
-    memcpy(
-        &bits[0] + arg1_constant->value().nbits(),
-        &arg2_constant->value()[0],
-        arg2_constant->value().nbits());
-
-    std::string s(&bits[0], nbits);
-    return create_bitconstant(node1->region(), s.c_str());
+    return create_bitconstant(
+        node1->region(),
+        arg1_constant->value().concat(arg2_constant->value()));
   }
 
   auto arg1_slice = dynamic_cast<const bitslice_op *>(&node1->operation());
@@ -337,15 +328,9 @@ bitconcat_op::reduce_operand_pair(
     auto & arg1_constant = static_cast<const bitconstant_op &>(node1->operation());
     auto & arg2_constant = static_cast<const bitconstant_op &>(node2->operation());
 
-    size_t nbits = arg1_constant.value().nbits() + arg2_constant.value().nbits();
-    std::vector<char> bits(nbits);
-    memcpy(&bits[0], &arg1_constant.value()[0], arg1_constant.value().nbits());
-    memcpy(
-        &bits[0] + arg1_constant.value().nbits(),
-        &arg2_constant.value()[0],
-        arg2_constant.value().nbits());
-
-    return create_bitconstant(arg1->region(), &bits[0]);
+    return create_bitconstant(
+        arg1->region(),
+        arg1_constant.value().concat(arg2_constant.value()));
   }
 
   if (path == binop_reduction_merge)
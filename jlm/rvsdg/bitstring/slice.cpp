@@ -68,8 +68,7 @@ bitslice_op::reduce_operand(unop_reduction_path_t path, jlm::rvsdg::output * arg
   if (path == unop_reduction_constant)
   {
     auto op = static_cast<const bitconstant_op &>(node->operation());
-    std::string s(&op.value()[0] + low(), high() - low());
-    return create_bitconstant(arg->region(), s.c_str());
+    return create_bitconstant(arg->region(), op.value().slice(low(), high()));
   }
 
   if (path == unop_reduction_distribute)
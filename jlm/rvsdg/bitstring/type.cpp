@@ -6,6 +6,7 @@
 
 #include <jlm/rvsdg/bitstring/type.hpp>
 #include <jlm/rvsdg/graph.hpp>
+#include <jlm/util/Hash.hpp>
 
 namespace jlm::rvsdg
 {
@@ -28,6 +29,12 @@ bittype::operator==(const jlm::rvsdg::type & other) const noexcept
   return type != nullptr && this->nbits() == type->nbits();
 }
 
+std::size_t
+bittype::hash() const noexcept
+{
+  return util::CombineHashes(typeid(bittype).hash_code(), nbits());
+}
+
 std::unique_ptr<jlm::rvsdg::type>
 bittype::copy() const
 {
@@ -39,6 +39,9 @@ public:
   virtual bool
   operator==(const jlm::rvsdg::type & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  hash() const noexcept override;
+
   virtual std::unique_ptr<jlm::rvsdg::type>
   copy() const override;
 
@@ -5,20 +5,242 @@
  */
 
 #include <jlm/rvsdg/bitstring/value-representation.hpp>
+#include <jlm/util/Hash.hpp>
 
+#include <cstring>
 #include <stdexcept>
 
 namespace jlm::rvsdg
 {
 
+bitvalue_repr::bitvalue_repr(size_t nbits, int64_t value)
+    : nbits_(nbits),
+      word_({ 0, 0 })
+{
+  if (nbits == 0)
+    throw jlm::util::error("Number of bits is zero.");
+
+  if (nbits < 64 && (value >> nbits) != 0 && (value >> nbits != -1))
+    throw jlm::util::error("Value cannot be represented with the given number of bits.");
+
+  words_.resize(nwords() - 1);
+  for (size_t n = 0; n < nwords(); n++)
+  {
+    auto & w = word(n);
+    w.Known = ~uint64_t(0);
+    w.Value = n == 0 ? static_cast<uint64_t>(value) : (value < 0 ? ~uint64_t(0) : 0);
+  }
+  normalize();
+}
+
+bitvalue_repr::bitvalue_repr(const char * s)
+    : nbits_(strlen(s)),
+      word_({ 0, 0 })
+{
+  if (nbits_ == 0)
+    throw jlm::util::error("Number of bits is zero.");
+
+  words_.resize(nwords() - 1, { 0, 0 });
+  for (size_t n = 0; n < nbits_; n++)
+  {
+    if (s[n] != '0' && s[n] != '1' && s[n] != 'X' && s[n] != 'D')
+      throw jlm::util::error("Not a valid bit.");
+    set(n, s[n]);
+  }
+}
+
+bitvalue_repr::bitvalue_repr(size_t nbits, Uninitialized)
+    : nbits_(nbits),
+      word_({ 0, 0 }),
+      words_(nwords() - 1, { 0, 0 })
+{
+  JLM_ASSERT(nbits != 0);
+}
+
+bitvalue_repr
+bitvalue_repr::repeat(size_t nbits, char bit)
+{
+  if (nbits == 0)
+    throw jlm::util::error("Number of bits is zero.");
+
+  if (bit != '0' && bit != '1' && bit != 'X' && bit != 'D')
+    throw jlm::util::error("Not a valid bit.");
+
+  bitvalue_repr result(nbits, Uninitialized());
+  for (size_t n = 0; n < result.nwords(); n++)
+  {
+    auto & w = result.word(n);
+    w.Known = bit == '0' || bit == '1' ? ~uint64_t(0) : 0;
+    w.Value = bit == '1' || bit == 'D' ? ~uint64_t(0) : 0;
+  }
+  result.normalize();
+
+  return result;
+}
+
+void
+bitvalue_repr::set(size_t n, char bit)
+{
+  JLM_ASSERT(n < nbits());
+
+  auto mask = uint64_t(1) << (n % WordSize);
+  auto & w = word(n / WordSize);
+  w.Known &= ~mask;
+  w.Value &= ~mask;
+  switch (bit)
+  {
+  case '0':
+    w.Known |= mask;
+    break;
+  case '1':
+    w.Known |= mask;
+    w.Value |= mask;
+    break;
+  case 'D':
+    w.Value |= mask;
+    break;
+  case 'X':
+    break;
+  default:
+    JLM_UNREACHABLE("Not a valid bit.");
+  }
+}
+
+uint64_t
+bitvalue_repr::extract(uint64_t Word::*plane, size_t offset) const noexcept
+{
+  auto n = offset / WordSize;
+  auto shift = offset % WordSize;
+  if (n >= nwords())
+    return 0;
+
+  auto bits = word(n).*plane >> shift;
+  if (shift != 0 && n + 1 < nwords())
+    bits |= word(n + 1).*plane << (WordSize - shift);
+
+  return bits;
+}
+
+bool
+bitvalue_repr::operator==(const bitvalue_repr & other) const noexcept
+{
+  if (nbits() != other.nbits())
+    return false;
+
+  for (size_t n = 0; n < nwords(); n++)
+  {
+    if (word(n).Known != other.word(n).Known || word(n).Value != other.word(n).Value)
+      return false;
+  }
+
+  return true;
+}
+
+std::size_t
+bitvalue_repr::hash() const noexcept
+{
+  auto seed = std::hash<size_t>()(nbits());
+  for (size_t n = 0; n < nwords(); n++)
+  {
+    util::CombineHashesWithSeed(seed, word(n).Known);
+    util::CombineHashesWithSeed(seed, word(n).Value);
+  }
+
+  return seed;
+}
+
+bool
+bitvalue_repr::is_defined() const noexcept
+{
+  for (size_t n = 0; n < nwords(); n++)
+  {
+    auto & w = word(n);
+    if (~w.Known & ~w.Value & mask(n))
+      return false;
+  }
+
+  return true;
+}
+
+bool
+bitvalue_repr::is_known() const noexcept
+{
+  for (size_t n = 0; n < nwords(); n++)
+  {
+    if (word(n).Known != mask(n))
+      return false;
+  }
+
+  return true;
+}
+
+bitvalue_repr
+bitvalue_repr::concat(const bitvalue_repr & other) const
+{
+  bitvalue_repr result(nbits() + other.nbits(), Uninitialized());
+  for (size_t n = 0; n < nwords(); n++)
+    result.word(n) = word(n);
+
+  // The unused bits of both operands are clear, such that the words of other can be merged in
+  for (size_t n = 0; n < other.nwords(); n++)
+  {
+    auto offset = nbits() + n * WordSize;
+    auto index = offset / WordSize;
+    auto shift = offset % WordSize;
+    auto & w = other.word(n);
+
+    result.word(index).Known |= w.Known << shift;
+    result.word(index).Value |= w.Value << shift;
+    if (shift != 0 && index + 1 < result.nwords())
+    {
+      result.word(index + 1).Known |= w.Known >> (WordSize - shift);
+      result.word(index + 1).Value |= w.Value >> (WordSize - shift);
+    }
+  }
+
+  return result;
+}
+
+bitvalue_repr
+bitvalue_repr::slice(size_t low, size_t high) const
+{
+  if (high <= low || high > nbits())
+  {
+    throw jlm::util::error("Slice is out of bound.");
+  }
+
+  bitvalue_repr result(high - low, Uninitialized());
+  for (size_t n = 0; n < result.nwords(); n++)
+  {
+    result.word(n).Known = extract(&Word::Known, low + n * WordSize);
+    result.word(n).Value = extract(&Word::Value, low + n * WordSize);
+  }
+  result.normalize();
+
+  return result;
+}
+
+std::string
+bitvalue_repr::str() const
+{
+  std::string s(nbits(), '0');
+  for (size_t n = 0; n < nbits(); n++)
+    s[n] = (*this)[n];
+
+  return s;
+}
+
 uint64_t
 bitvalue_repr::to_uint() const
 {
+  if (nbits() <= 64 && is_known())
+    return word(0).Value;
+
   size_t limit = std::min(nbits(), size_t(64));
   /* bits beyond 64 must be zero, else value is not representable as uint64_t */
   for (size_t n = limit; n < nbits(); ++n)
   {
-    if (data_[n] != '0')
+    if ((*this)[n] != '0')
       throw std::range_error("Bit constant value exceeds uint64 range");
   }
 
@@ -26,7 +248,7 @@ bitvalue_repr::to_uint() const
   uint64_t pos_value = 1;
   for (size_t n = 0; n < limit; ++n)
   {
-    switch (data_[n])
+    switch ((*this)[n])
     {
     case '0':
     {
@@ -50,12 +272,21 @@ bitvalue_repr::to_uint() const
 int64_t
 bitvalue_repr::to_int() const
 {
+  if (nbits() <= 64 && is_known())
+  {
+    auto value = word(0).Value;
+    if (nbits() < 64 && is_negative())
+      value |= ~mask(0);
+
+    return static_cast<int64_t>(value);
+  }
+
   /* all bits from 63 on must be identical, else value is not representable as int64_t */
-  char sign_bit = data_[nbits() - 1];
+  char sign_bit = sign();
   size_t limit = std::min(nbits(), size_t(63));
   for (size_t n = limit; n < nbits(); ++n)
   {
-    if (data_[n] != sign_bit)
+    if ((*this)[n] != sign_bit)
       throw std::range_error("Bit constant value exceeds int64 range");
   }
 
@@ -63,7 +294,7 @@ bitvalue_repr::to_int() const
   uint64_t pos_value = 1;
   for (size_t n = 0; n < 64; ++n)
   {
-    switch (n < nbits() ? data_[n] : sign_bit)
+    switch (n < nbits() ? (*this)[n] : sign_bit)
     {
     case '0':
     {
@@ -84,4 +315,333 @@ bitvalue_repr::to_int() const
   return result;
 }
 
+char
+bitvalue_repr::ult(const bitvalue_repr & other) const
+{
+  if (nbits() != other.nbits())
+    throw jlm::util::error("Unequal number of bits.");
+
+  if (is_known() && other.is_known())
+  {
+    for (size_t n = nwords(); n > 0; n--)
+    {
+      if (word(n - 1).Value != other.word(n - 1).Value)
+        return word(n - 1).Value < other.word(n - 1).Value ? '1' : '0';
+    }
+
+    return '0';
+  }
+
+  char v = land(lnot((*this)[0]), other[0]);
+  for (size_t n = 1; n < nbits(); n++)
+    v = land(lor(lnot((*this)[n]), other[n]), lor(land(lnot((*this)[n]), other[n]), v));
+
+  return v;
+}
+
+char
+bitvalue_repr::ule(const bitvalue_repr & other) const
+{
+  if (nbits() != other.nbits())
+    throw jlm::util::error("Unequal number of bits.");
+
+  if (is_known() && other.is_known())
+  {
+    for (size_t n = nwords(); n > 0; n--)
+    {
+      if (word(n - 1).Value != other.word(n - 1).Value)
+        return word(n - 1).Value < other.word(n - 1).Value ? '1' : '0';
+    }
+
+    return '1';
+  }
+
+  char v = '1';
+  for (size_t n = 0; n < nbits(); n++)
+  {
+    auto a = (*this)[n];
+    auto b = other[n];
+    v = land(land(lor(lnot(a), b), lor(lnot(a), v)), lor(v, b));
+  }
+
+  return v;
+}
+
+char
+bitvalue_repr::ne(const bitvalue_repr & other) const
+{
+  if (nbits() != other.nbits())
+    throw jlm::util::error("Unequal number of bits.");
+
+  if (is_known() && other.is_known())
+    return *this == other ? '0' : '1';
+
+  char v = '0';
+  for (size_t n = 0; n < nbits(); n++)
+    v = lor(v, lxor((*this)[n], other[n]));
+  return v;
+}
+
+bitvalue_repr
+bitvalue_repr::add(const bitvalue_repr & other) const
+{
+  if (nbits() != other.nbits())
+    throw jlm::util::error("Unequal number of bits.");
+
+  bitvalue_repr sum(nbits(), Uninitialized());
+  if (is_known() && other.is_known())
+  {
+    uint64_t c = 0;
+    for (size_t n = 0; n < nwords(); n++)
+    {
+      auto a = word(n).Value;
+      auto s = a + other.word(n).Value;
+      auto nc = s < a;
+      s += c;
+      c = nc || s < c;
+      sum.word(n) = { ~uint64_t(0), s };
+    }
+    sum.normalize();
+
+    return sum;
+  }
+
+  char c = '0';
+  for (size_t n = 0; n < nbits(); n++)
+  {
+    auto a = (*this)[n];
+    auto b = other[n];
+    sum.set(n, add(a, b, c));
+    c = carry(a, b, c);
+  }
+
+  return sum;
+}
+
+/*
+ * The bitwise operations are evaluated on all bits of a word at once. The result of a bit is known
+ * if it is already determined by the known operand bits. Otherwise, it is 'X' if one of the
+ * operand bits is 'X', and 'D' if not.
+ */
+
+bitvalue_repr
+bitvalue_repr::land(const bitvalue_repr & other) const
+{
+  if (nbits() != other.nbits())
+    throw jlm::util::error("Unequal number of bits.");
+
+  bitvalue_repr result(nbits(), Uninitialized());
+  for (size_t n = 0; n < nwords(); n++)
+  {
+    auto & a = word(n);
+    auto & b = other.word(n);
+    auto zero = (a.Known & ~a.Value) | (b.Known & ~b.Value);
+    auto one = a.Known & a.Value & b.Known & b.Value;
+    auto undefined = (~a.Known & ~a.Value) | (~b.Known & ~b.Value);
+    auto known = zero | one;
+    result.word(n) = { known, one | (~known & ~undefined) };
+  }
+  result.normalize();
+
+  return result;
+}
+
+bitvalue_repr
+bitvalue_repr::lor(const bitvalue_repr & other) const
+{
+  if (nbits() != other.nbits())
+    throw jlm::util::error("Unequal number of bits.");
+
+  bitvalue_repr result(nbits(), Uninitialized());
+  for (size_t n = 0; n < nwords(); n++)
+  {
+    auto & a = word(n);
+    auto & b = other.word(n);
+    auto zero = a.Known & ~a.Value & b.Known & ~b.Value;
+    auto one = (a.Known & a.Value) | (b.Known & b.Value);
+    auto undefined = (~a.Known & ~a.Value) | (~b.Known & ~b.Value);
+    auto known = zero | one;
+    result.word(n) = { known, one | (~known & ~undefined) };
+  }
+  result.normalize();
+
+  return result;
+}
+
+bitvalue_repr
+bitvalue_repr::lxor(const bitvalue_repr & other) const
+{
+  if (nbits() != other.nbits())
+    throw jlm::util::error("Unequal number of bits.");
+
+  bitvalue_repr result(nbits(), Uninitialized());
+  for (size_t n = 0; n < nwords(); n++)
+  {
+    auto & a = word(n);
+    auto & b = other.word(n);
+    auto undefined = (~a.Known & ~a.Value) | (~b.Known & ~b.Value);
+    auto known = a.Known & b.Known;
+    result.word(n) = { known, (known & (a.Value ^ b.Value)) | (~known & ~undefined) };
+  }
+  result.normalize();
+
+  return result;
+}
+
+bitvalue_repr
+bitvalue_repr::lnot() const
+{
+  // Known bits are inverted, while 'D' and 'X' bits remain unchanged
+  bitvalue_repr result(nbits(), Uninitialized());
+  for (size_t n = 0; n < nwords(); n++)
+    result.word(n) = { word(n).Known, word(n).Value ^ word(n).Known };
+
+  return result;
+}
+
+bitvalue_repr
+bitvalue_repr::neg() const
+{
+  bitvalue_repr result(nbits(), Uninitialized());
+  if (is_known())
+  {
+    uint64_t c = 1;
+    for (size_t n = 0; n < nwords(); n++)
+    {
+      auto s = ~word(n).Value + c;
+      c = c && s == 0;
+      result.word(n) = { ~uint64_t(0), s };
+    }
+    result.normalize();
+
+    return result;
+  }
+
+  char c = '1';
+  for (size_t n = 0; n < nbits(); n++)
+  {
+    char tmp = lxor((*this)[n], '1');
+    result.set(n, add(tmp, '0', c));
+    c = carry(tmp, '0', c);
+  }
+
+  return result;
+}
+
+void
+bitvalue_repr::udiv(
+    const bitvalue_repr & divisor,
+    bitvalue_repr & quotient,
+    bitvalue_repr & remainder) const
+{
+  JLM_ASSERT(quotient == 0);
+  JLM_ASSERT(remainder == 0);
+
+  if (divisor.nbits() != nbits())
+    throw jlm::util::error("Unequal number of bits.");
+
+  /*
+    FIXME: This should check whether divisor is zero, not whether nbits() is zero.
+  */
+  if (divisor.nbits() == 0)
+    throw jlm::util::error("Division by zero.");
+
+  if (nbits() <= WordSize && is_known() && divisor.is_known())
+  {
+    // A division by zero yields the same result as the bitwise division below
+    auto dividendValue = word(0).Value;
+    auto divisorValue = divisor.word(0).Value;
+    quotient.word(0).Value = divisorValue == 0 ? mask(0) : dividendValue / divisorValue;
+    remainder.word(0).Value = divisorValue == 0 ? dividendValue : dividendValue % divisorValue;
+    return;
+  }
+
+  for (size_t n = 0; n < nbits(); n++)
+  {
+    remainder = remainder.shl(1);
+    remainder.set(0, (*this)[nbits() - n - 1]);
+    if (remainder.uge(divisor) == '1')
+    {
+      remainder = remainder.sub(divisor);
+      quotient.set(nbits() - n - 1, '1');
+    }
+  }
+}
+
+void
+bitvalue_repr::mul(
+    const bitvalue_repr & factor1,
+    const bitvalue_repr & factor2,
+    bitvalue_repr & product)
+{
+  JLM_ASSERT(product == 0);
+
+  if (factor1.is_known() && factor2.is_known())
+  {
+    if (product.nwords() == 1)
+    {
+      product.word(0).Value = factor1.word(0).Value * factor2.word(0).Value;
+      product.normalize();
+      return;
+    }
+
+    // Multiply half words, such that the partial products fit into a word
+    auto halfWords = [](const bitvalue_repr & value, size_t size)
+    {
+      std::vector<uint64_t> digits(size, 0);
+      for (size_t n = 0; n < value.nwords() && 2 * n < size; n++)
+      {
+        digits[2 * n] = value.word(n).Value & 0xffffffff;
+        if (2 * n + 1 < size)
+          digits[2 * n + 1] = value.word(n).Value >> 32;
+      }
+      return digits;
+    };
+
+    auto size = 2 * product.nwords();
+    auto digits1 = halfWords(factor1, size);
+    auto digits2 = halfWords(factor2, size);
+    std::vector<uint64_t> digits(size, 0);
+    for (size_t i = 0; i < size; i++)
+    {
+      uint64_t c = 0;
+      for (size_t j = 0; i + j < size; j++)
+      {
+        auto t = digits1[i] * digits2[j] + digits[i + j] + c;
+        digits[i + j] = t & 0xffffffff;
+        c = t >> 32;
+      }
+    }
+
+    for (size_t n = 0; n < product.nwords(); n++)
+      product.word(n).Value = digits[2 * n] | (digits[2 * n + 1] << 32);
+    product.normalize();
+
+    return;
+  }
+
+  for (size_t i = 0; i < factor1.nbits() && i < product.nbits(); i++)
+  {
+    char c = '0';
+    for (size_t j = 0; j < factor2.nbits() && i + j < product.nbits(); j++)
+    {
+      char s = product.land(factor1[i], factor2[j]);
+      char nc = product.carry(s, product[i + j], c);
+      product.set(i + j, product.add(s, product[i + j], c));
+      c = nc;
+    }
+  }
+}
+
+bitvalue_repr
+bitvalue_repr::mul(const bitvalue_repr & other) const
+{
+  if (nbits() != other.nbits())
+    throw jlm::util::error("Unequal number of bits.");
+
+  bitvalue_repr product(nbits(), 0);
+  mul(*this, other, product);
+  return product;
+}
+
 }
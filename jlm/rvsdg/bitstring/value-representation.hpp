@@ -10,7 +10,7 @@
 #include <jlm/util/common.hpp>
 
 #include <cstdint>
-#include <cstring>
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -24,54 +24,95 @@ namespace jlm::rvsdg
   - '1' : one
   - 'D' : defined, but unknown
   - 'X' : undefined and unknown
+
+ The bits are packed into 64-bit words with two planes each. A bit is set in the known plane if it
+ is '0' or '1'. The value plane holds the value of known bits and is set for 'D' bits. 'X' bits are
+ clear in both planes, as are the unused bits of the last word. Values of up to 64 bits are stored
+ without any allocation. Operations on fully known values are evaluated with word arithmetic,
+ while values with unknown bits are evaluated bit by bit.
 */
 
 class bitvalue_repr
 {
 public:
-  inline bitvalue_repr(size_t nbits, int64_t value)
+  bitvalue_repr(size_t nbits, int64_t value);
+
+  bitvalue_repr(const char * s);
+
+  bitvalue_repr(const bitvalue_repr & other) = default;
+
+  bitvalue_repr(bitvalue_repr && other) noexcept = default;
+
+  static bitvalue_repr
+  repeat(size_t nbits, char bit);
+
+private:
+  struct Word
   {
-    if (nbits == 0)
-      throw jlm::util::error("Number of bits is zero.");
+    uint64_t Known;
+    uint64_t Value;
+  };
 
-    if (nbits < 64 && (value >> nbits) != 0 && (value >> nbits != -1))
-      throw jlm::util::error("Value cannot be represented with the given number of bits.");
+  struct Uninitialized
+  {};
 
-    for (size_t n = 0; n < nbits; ++n)
-    {
-      data_.push_back('0' + (value & 1));
-      value = value >> 1;
-    }
-  }
+  /**
+   * Creates a value of \p nbits bits, which are all 'X'.
+   */
+  bitvalue_repr(size_t nbits, Uninitialized);
+
+  static constexpr size_t WordSize = 64;
 
-  inline bitvalue_repr(const char * s)
+  inline size_t
+  nwords() const noexcept
   {
-    if (strlen(s) == 0)
-      throw jlm::util::error("Number of bits is zero.");
+    return (nbits_ + WordSize - 1) / WordSize;
+  }
 
-    for (size_t n = 0; n < strlen(s); n++)
-    {
-      if (s[n] != '0' && s[n] != '1' && s[n] != 'X' && s[n] != 'D')
-        throw jlm::util::error("Not a valid bit.");
-      data_.push_back(s[n]);
-    }
+  inline Word &
+  word(size_t n) noexcept
+  {
+    JLM_ASSERT(n < nwords());
+    return n == 0 ? word_ : words_[n - 1];
   }
 
-  bitvalue_repr(const bitvalue_repr & other)
-      : data_(other.data_)
-  {}
+  inline const Word &
+  word(size_t n) const noexcept
+  {
+    JLM_ASSERT(n < nwords());
+    return n == 0 ? word_ : words_[n - 1];
+  }
 
-  bitvalue_repr(bitvalue_repr && other)
-      : data_(std::move(other.data_))
-  {}
+  /**
+   * @return The mask of the used bits of word \p n.
+   */
+  inline uint64_t
+  mask(size_t n) const noexcept
+  {
+    auto nbits = nbits_ - n * WordSize;
+    return nbits >= WordSize ? ~uint64_t(0) : (uint64_t(1) << nbits) - 1;
+  }
 
-  inline static bitvalue_repr
-  repeat(size_t nbits, char bit)
+  /**
+   * Clears the unused bits of the last word.
+   */
+  inline void
+  normalize() noexcept
   {
-    return bitvalue_repr(std::string(nbits, bit).c_str());
+    auto & last = word(nwords() - 1);
+    last.Known &= mask(nwords() - 1);
+    last.Value &= mask(nwords() - 1);
   }
 
-private:
+  void
+  set(size_t n, char bit);
+
+  /**
+   * @return The \p WordSize bits of \p plane that start at bit \p offset.
+   */
+  uint64_t
+  extract(uint64_t Word::*plane, size_t offset) const noexcept;
+
   inline char
   lor(char a, char b) const noexcept
   {
@@ -162,91 +203,40 @@ private:
     return lxor(lxor(a, b), c);
   }
 
-  inline void
-  udiv(const bitvalue_repr & divisor, bitvalue_repr & quotient, bitvalue_repr & remainder) const
-  {
-    JLM_ASSERT(quotient == 0);
-    JLM_ASSERT(remainder == 0);
-
-    if (divisor.nbits() != nbits())
-      throw jlm::util::error("Unequal number of bits.");
+  void
+  udiv(const bitvalue_repr & divisor, bitvalue_repr & quotient, bitvalue_repr & remainder) const;
 
-    /*
-      FIXME: This should check whether divisor is zero, not whether nbits() is zero.
-    */
-    if (divisor.nbits() == 0)
-      throw jlm::util::error("Division by zero.");
-
-    for (size_t n = 0; n < nbits(); n++)
-    {
-      remainder = remainder.shl(1);
-      remainder[0] = data_[nbits() - n - 1];
-      if (remainder.uge(divisor) == '1')
-      {
-        remainder = remainder.sub(divisor);
-        quotient[nbits() - n - 1] = '1';
-      }
-    }
-  }
-
-  inline void
-  mul(const bitvalue_repr & factor1, const bitvalue_repr & factor2, bitvalue_repr & product) const
-  {
-    JLM_ASSERT(product.nbits() == factor1.nbits() + factor2.nbits());
-
-    for (size_t i = 0; i < factor1.nbits(); i++)
-    {
-      char c = '0';
-      for (size_t j = 0; j < factor2.nbits(); j++)
-      {
-        char s = land(factor1[i], factor2[j]);
-        char nc = carry(s, product[i + j], c);
-        product[i + j] = add(s, product[i + j], c);
-        c = nc;
-      }
-    }
-  }
+  /**
+   * Computes the \p product.nbits() least significant bits of the product of \p factor1 and
+   * \p factor2.
+   */
+  static void
+  mul(const bitvalue_repr & factor1, const bitvalue_repr & factor2, bitvalue_repr & product);
 
 public:
   /*
     FIXME: add <, <=, >, >= operator for uint64_t and int64_t
   */
-  inline bitvalue_repr &
-  operator=(const bitvalue_repr & other)
-  {
-    data_ = other.data_;
-    return *this;
-  }
-
   bitvalue_repr &
-  operator=(bitvalue_repr && other)
-  {
-    if (this == &other)
-      return *this;
+  operator=(const bitvalue_repr & other) = default;
 
-    data_ = std::move(other.data_);
-    return *this;
-  }
+  bitvalue_repr &
+  operator=(bitvalue_repr && other) noexcept = default;
 
-  inline char &
-  operator[](size_t n)
+  inline char
+  operator[](size_t n) const noexcept
   {
     JLM_ASSERT(n < nbits());
-    return data_[n];
-  }
+    auto bit = uint64_t(1) << (n % WordSize);
+    auto & w = word(n / WordSize);
+    if (w.Known & bit)
+      return w.Value & bit ? '1' : '0';
 
-  inline const char &
-  operator[](size_t n) const
-  {
-    JLM_ASSERT(n < nbits());
-    return data_[n];
+    return w.Value & bit ? 'D' : 'X';
   }
 
-  inline bool
-  operator==(const bitvalue_repr & other) const noexcept
-  {
-    return data_ == other.data_;
-  }
+  bool
+  operator==(const bitvalue_repr & other) const noexcept;
 
   inline bool
   operator!=(const bitvalue_repr & other) const noexcept
@@ -274,7 +264,7 @@ public:
 
     for (size_t n = 0; n < other.size(); n++)
     {
-      if (data_[n] != other[n])
+      if ((*this)[n] != other[n])
         return false;
     }
 
@@ -287,35 +277,23 @@ public:
     return !(*this == other);
   }
 
+  /**
+   * @return A hash of the bit pattern. Equal bit patterns have equal hashes.
+   */
+  [[nodiscard]] std::size_t
+  hash() const noexcept;
+
   inline char
   sign() const noexcept
   {
-    return data_[nbits() - 1];
-  }
-
-  inline bool
-  is_defined() const noexcept
-  {
-    for (auto bit : data_)
-    {
-      if (bit == 'X')
-        return false;
-    }
-
-    return true;
+    return (*this)[nbits() - 1];
   }
 
-  inline bool
-  is_known() const noexcept
-  {
-    for (auto bit : data_)
-    {
-      if (bit == 'X' || bit == 'D')
-        return false;
-    }
+  bool
+  is_defined() const noexcept;
 
-    return true;
-  }
+  bool
+  is_known() const noexcept;
 
   inline bool
   is_negative() const noexcept
@@ -323,24 +301,11 @@ public:
     return sign() == '1';
   }
 
-  inline bitvalue_repr
-  concat(const bitvalue_repr & other) const
-  {
-    bitvalue_repr result(*this);
-    result.data_.insert(result.data_.end(), other.data_.begin(), other.data_.end());
-    return result;
-  }
+  bitvalue_repr
+  concat(const bitvalue_repr & other) const;
 
-  inline bitvalue_repr
-  slice(size_t low, size_t high) const
-  {
-    if (high <= low || high > nbits())
-    {
-      throw jlm::util::error("Slice is out of bound.");
-    }
-
-    return bitvalue_repr(std::string(&data_[low], high - low).c_str());
-  }
+  bitvalue_repr
+  slice(size_t low, size_t high) const;
 
   inline bitvalue_repr
   zext(size_t nbits) const
@@ -363,14 +328,11 @@ public:
   inline size_t
   nbits() const noexcept
   {
-    return data_.size();
+    return nbits_;
   }
 
-  inline std::string
-  str() const
-  {
-    return std::string(data_.begin(), data_.end());
-  }
+  std::string
+  str() const;
 
   uint64_t
   to_uint() const;
@@ -378,61 +340,32 @@ public:
   int64_t
   to_int() const;
 
-  inline char
-  ult(const bitvalue_repr & other) const
-  {
-    if (nbits() != other.nbits())
-      throw jlm::util::error("Unequal number of bits.");
-
-    char v = land(lnot(data_[0]), other[0]);
-    for (size_t n = 1; n < nbits(); n++)
-      v = land(lor(lnot(data_[n]), other[n]), lor(land(lnot(data_[n]), other[n]), v));
-
-    return v;
-  }
+  char
+  ult(const bitvalue_repr & other) const;
 
   inline char
   slt(const bitvalue_repr & other) const
   {
     bitvalue_repr t1(*this), t2(other);
-    t1[t1.nbits() - 1] = lnot(t1.sign());
-    t2[t2.nbits() - 1] = lnot(t2.sign());
+    t1.set(t1.nbits() - 1, lnot(t1.sign()));
+    t2.set(t2.nbits() - 1, lnot(t2.sign()));
     return t1.ult(t2);
   }
 
-  inline char
-  ule(const bitvalue_repr & other) const
-  {
-    if (nbits() != other.nbits())
-      throw jlm::util::error("Unequal number of bits.");
-
-    char v = '1';
-    for (size_t n = 0; n < nbits(); n++)
-      v = land(land(lor(lnot(data_[n]), other[n]), lor(lnot(data_[n]), v)), lor(v, other[n]));
-
-    return v;
-  }
+  char
+  ule(const bitvalue_repr & other) const;
 
   inline char
   sle(const bitvalue_repr & other) const
   {
     bitvalue_repr t1(*this), t2(other);
-    t1[t1.nbits() - 1] = lnot(t1.sign());
-    t2[t2.nbits() - 1] = lnot(t2.sign());
+    t1.set(t1.nbits() - 1, lnot(t1.sign()));
+    t2.set(t2.nbits() - 1, lnot(t2.sign()));
     return t1.ule(t2);
   }
 
-  inline char
-  ne(const bitvalue_repr & other) const
-  {
-    if (nbits() != other.nbits())
-      throw jlm::util::error("Unequal number of bits.");
-
-    char v = '0';
-    for (size_t n = 0; n < nbits(); n++)
-      v = lor(v, lxor(data_[n], other[n]));
-    return v;
-  }
+  char
+  ne(const bitvalue_repr & other) const;
 
   inline char
   eq(const bitvalue_repr & other) const
@@ -464,82 +397,23 @@ public:
     return lnot(ule(other));
   }
 
-  inline bitvalue_repr
-  add(const bitvalue_repr & other) const
-  {
-    if (nbits() != other.nbits())
-      throw jlm::util::error("Unequal number of bits.");
-
-    char c = '0';
-    bitvalue_repr sum = repeat(nbits(), 'X');
-    for (size_t n = 0; n < nbits(); n++)
-    {
-      sum[n] = add(data_[n], other[n], c);
-      c = carry(data_[n], other[n], c);
-    }
-
-    return sum;
-  }
-
-  inline bitvalue_repr
-  land(const bitvalue_repr & other) const
-  {
-    if (nbits() != other.nbits())
-      throw jlm::util::error("Unequal number of bits.");
-
-    bitvalue_repr result = repeat(nbits(), 'X');
-    for (size_t n = 0; n < nbits(); n++)
-      result[n] = land(data_[n], other[n]);
-
-    return result;
-  }
-
-  inline bitvalue_repr
-  lor(const bitvalue_repr & other) const
-  {
-    if (nbits() != other.nbits())
-      throw jlm::util::error("Unequal number of bits.");
+  bitvalue_repr
+  add(const bitvalue_repr & other) const;
 
-    bitvalue_repr result = repeat(nbits(), 'X');
-    for (size_t n = 0; n < nbits(); n++)
-      result[n] = lor(data_[n], other[n]);
+  bitvalue_repr
+  land(const bitvalue_repr & other) const;
 
-    return result;
-  }
-
-  inline bitvalue_repr
-  lxor(const bitvalue_repr & other) const
-  {
-    if (nbits() != other.nbits())
-      throw jlm::util::error("Unequal number of bits.");
-
-    bitvalue_repr result = repeat(nbits(), 'X');
-    for (size_t n = 0; n < nbits(); n++)
-      result[n] = lxor(data_[n], other[n]);
-
-    return result;
-  }
+  bitvalue_repr
+  lor(const bitvalue_repr & other) const;
 
-  inline bitvalue_repr
-  lnot() const
-  {
-    return lxor(repeat(nbits(), '1'));
-  }
+  bitvalue_repr
+  lxor(const bitvalue_repr & other) const;
 
-  inline bitvalue_repr
-  neg() const
-  {
-    char c = '1';
-    bitvalue_repr result = repeat(nbits(), 'X');
-    for (size_t n = 0; n < nbits(); n++)
-    {
-      char tmp = lxor(data_[n], '1');
-      result[n] = add(tmp, '0', c);
-      c = carry(tmp, '0', c);
-    }
+  bitvalue_repr
+  lnot() const;
 
-    return result;
-  }
+  bitvalue_repr
+  neg() const;
 
   inline bitvalue_repr
   sub(const bitvalue_repr & other) const
@@ -553,8 +427,7 @@ public:
     if (shift >= nbits())
       return repeat(nbits(), '0');
 
-    bitvalue_repr result(std::string(&data_[shift], nbits() - shift).c_str());
-    return result.zext(shift);
+    return slice(shift, nbits()).zext(shift);
   }
 
   inline bitvalue_repr
@@ -563,8 +436,7 @@ public:
     if (shift >= nbits())
       return repeat(nbits(), sign());
 
-    bitvalue_repr result(std::string(&data_[shift], nbits() - shift).c_str());
-    return result.sext(shift);
+    return slice(shift, nbits()).sext(shift);
   }
 
   inline bitvalue_repr
@@ -640,16 +512,8 @@ public:
     return remainder;
   }
 
-  inline bitvalue_repr
-  mul(const bitvalue_repr & other) const
-  {
-    if (nbits() != other.nbits())
-      throw jlm::util::error("Unequal number of bits.");
-
-    bitvalue_repr product(2 * nbits(), 0);
-    mul(*this, other, product);
-    return product.slice(0, nbits());
-  }
+  bitvalue_repr
+  mul(const bitvalue_repr & other) const;
 
   inline bitvalue_repr
   umulh(const bitvalue_repr & other) const
@@ -657,11 +521,7 @@ public:
     if (nbits() != other.nbits())
       throw jlm::util::error("Unequal number of bits.");
 
-    bitvalue_repr product(4 * nbits(), 0);
-    bitvalue_repr factor1 = this->zext(nbits());
-    bitvalue_repr factor2 = other.zext(nbits());
-    mul(factor1, factor2, product);
-    return product.slice(nbits(), 2 * nbits());
+    return zext(nbits()).mul(other.zext(nbits())).slice(nbits(), 2 * nbits());
   }
 
   inline bitvalue_repr
@@ -670,18 +530,27 @@ public:
     if (nbits() != other.nbits())
       throw jlm::util::error("Unequal number of bits.");
 
-    bitvalue_repr product(4 * nbits(), 0);
-    bitvalue_repr factor1 = this->sext(nbits());
-    bitvalue_repr factor2 = other.sext(nbits());
-    mul(factor1, factor2, product);
-    return product.slice(nbits(), 2 * nbits());
+    return sext(nbits()).mul(other.sext(nbits())).slice(nbits(), 2 * nbits());
   }
 
 private:
+  size_t nbits_;
   /* [lsb ... msb] */
-  std::vector<char> data_;
+  Word word_;
+  // Words beyond the first one, which are only needed for values with more than WordSize bits
+  std::vector<Word> words_;
 };
 
 }
 
+template<>
+struct std::hash<jlm::rvsdg::bitvalue_repr>
+{
+  std::size_t
+  operator()(const jlm::rvsdg::bitvalue_repr & repr) const noexcept
+  {
+    return repr.hash();
+  }
+};
+
 #endif
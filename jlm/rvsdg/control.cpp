@@ -6,6 +6,7 @@
 
 #include <jlm/rvsdg/bitstring/constant.hpp>
 #include <jlm/rvsdg/control.hpp>
+#include <jlm/util/Hash.hpp>
 
 namespace jlm::rvsdg
 {
@@ -41,6 +42,12 @@ ctltype::operator==(const jlm::rvsdg::type & other) const noexcept
   return type && type->nalternatives_ == nalternatives_;
 }
 
+std::size_t
+ctltype::hash() const noexcept
+{
+  return util::CombineHashes(typeid(ctltype).hash_code(), nalternatives_);
+}
+
 std::unique_ptr<jlm::rvsdg::type>
 ctltype::copy() const
 {
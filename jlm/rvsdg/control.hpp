@@ -11,6 +11,7 @@
 #include <jlm/rvsdg/node.hpp>
 #include <jlm/rvsdg/nullary.hpp>
 #include <jlm/rvsdg/unary.hpp>
+#include <jlm/util/Hash.hpp>
 #include <jlm/util/strfmt.hpp>
 
 #include <unordered_map>
@@ -35,6 +36,9 @@ public:
   virtual bool
   operator==(const jlm::rvsdg::type & other) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  hash() const noexcept override;
+
   virtual std::unique_ptr<jlm::rvsdg::type>
   copy() const override;
 
@@ -90,6 +94,21 @@ private:
   size_t nalternatives_;
 };
 
+}
+
+template<>
+struct std::hash<jlm::rvsdg::ctlvalue_repr>
+{
+  std::size_t
+  operator()(const jlm::rvsdg::ctlvalue_repr & repr) const noexcept
+  {
+    return jlm::util::CombineHashes(repr.alternative(), repr.nalternatives());
+  }
+};
+
+namespace jlm::rvsdg
+{
+
 /* control constant */
 
 struct ctltype_of_value
@@ -21,7 +21,7 @@ bool
 impport::operator==(const port & other) const noexcept
 {
   auto p = dynamic_cast<const impport *>(&other);
-  return p && p->type() == type() && p->name() == name();
+  return p && &p->type() == &type() && p->name() == name();
 }
 
 std::unique_ptr<port>
@@ -39,7 +39,7 @@ bool
 expport::operator==(const port & other) const noexcept
 {
   auto p = dynamic_cast<const expport *>(&other);
-  return p && p->type() == type() && p->name() == name();
+  return p && &p->type() == &type() && p->name() == name();
 }
 
 std::unique_ptr<port>
@@ -74,6 +74,8 @@ graph::copy() const
 jlm::rvsdg::node_normal_form *
 graph::node_normal_form(const std::type_info & type) noexcept
 {
+  std::lock_guard<std::recursive_mutex> guard(node_normal_forms_mutex_);
+
   auto i = node_normal_forms_.find(std::type_index(type));
   if (i != node_normal_forms_.end())
     return i.ptr();
@@ -10,6 +10,8 @@
 #include <stdbool.h>
 #include <stdlib.h>
 
+#include <atomic>
+#include <mutex>
 #include <typeindex>
 
 #include <jlm/rvsdg/node-normal-form.hpp>
@@ -18,6 +20,7 @@
 #include <jlm/rvsdg/tracker.hpp>
 
 #include <jlm/util/common.hpp>
+#include <jlm/util/DenseIdAllocator.hpp>
 
 namespace jlm::rvsdg
 {
@@ -174,10 +177,69 @@ public:
   static std::vector<rvsdg::node *>
   ExtractTailNodes(const graph & rvsdg);
 
+  /**
+   * @return An upper bound on the ids of all nodes of the graph.
+   *
+   * @see node::Id()
+   */
+  [[nodiscard]] size_t
+  NodeIdBound() const
+  {
+    return NodeIds_.Bound();
+  }
+
+  /**
+   * @return An upper bound on the ids of all outputs of the graph.
+   *
+   * @see output::Id()
+   */
+  [[nodiscard]] size_t
+  OutputIdBound() const
+  {
+    return OutputIds_.Bound();
+  }
+
+  /**
+   * @return An upper bound on the ids of all regions of the graph.
+   *
+   * @see region::Id()
+   */
+  [[nodiscard]] size_t
+  RegionIdBound() const
+  {
+    return RegionIds_.Bound();
+  }
+
+  /**
+   * Announces whether disjoint regions of the graph are transformed on different threads. Node,
+   * output and region ids are only allocated under a lock while this is enabled. It must only be
+   * toggled while no other thread modifies the graph.
+   */
+  void
+  SetConcurrentModification(bool concurrent) noexcept
+  {
+    NodeIds_.SetConcurrent(concurrent);
+    OutputIds_.SetConcurrent(concurrent);
+    RegionIds_.SetConcurrent(concurrent);
+  }
+
 private:
-  bool normalized_;
+  friend jlm::rvsdg::node;
+  friend jlm::rvsdg::output;
+  friend jlm::rvsdg::region;
+
+  std::atomic<bool> normalized_;
+  // The id allocators must outlive the root region, whose destruction releases all ids.
+  util::DenseIdAllocator NodeIds_;
+  util::DenseIdAllocator OutputIds_;
+  util::DenseIdAllocator RegionIds_;
   jlm::rvsdg::region * root_;
   jlm::rvsdg::node_normal_form_hash node_normal_forms_;
+  /*
+   * Normal forms are created lazily upon their first request, which can happen concurrently when
+   * disjoint regions of the graph are transformed on different threads.
+   */
+  std::recursive_mutex node_normal_forms_mutex_;
 };
 
 }
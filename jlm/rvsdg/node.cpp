@@ -4,6 +4,7 @@
  * See COPYING for terms of redistribution.
  */
 
+#include <jlm/rvsdg/graph.hpp>
 #include <jlm/rvsdg/node-normal-form.hpp>
 #include <jlm/rvsdg/notifiers.hpp>
 #include <jlm/rvsdg/region.hpp>
@@ -11,6 +12,8 @@
 #include <jlm/rvsdg/substitution.hpp>
 #include <jlm/rvsdg/theta.hpp>
 
+#include <queue>
+
 namespace jlm::rvsdg
 {
 
@@ -26,6 +29,7 @@ input::input(
     jlm::rvsdg::region * region,
     const jlm::rvsdg::port & port)
     : index_(0),
+      UserIndex_(0),
       origin_(origin),
       region_(region),
       port_(port.copy())
@@ -33,7 +37,8 @@ input::input(
   if (region != origin->region())
     throw jlm::util::error("Invalid operand region.");
 
-  if (port.type() != origin->type())
+  // Types of ports are interned and can therefore be compared by their address
+  if (&port.type() != &origin->type())
     throw jlm::util::type_error(port.type().debug_string(), origin->type().debug_string());
 
   origin->add_user(this);
@@ -51,7 +56,19 @@ input::divert_to(jlm::rvsdg::output * new_origin)
   if (origin() == new_origin)
     return;
 
-  if (type() != new_origin->type())
+  auto old_origin = ChangeOrigin(new_origin);
+
+  if (is<node_input>(*this))
+    static_cast<node_input *>(this)->node()->recompute_depth();
+
+  region()->graph()->mark_denormalized();
+  on_input_change(this, old_origin, new_origin);
+}
+
+jlm::rvsdg::output *
+input::ChangeOrigin(jlm::rvsdg::output * new_origin)
+{
+  if (&type() != &new_origin->type())
     throw jlm::util::type_error(type().debug_string(), new_origin->type().debug_string());
 
   if (region() != new_origin->region())
@@ -62,11 +79,10 @@ input::divert_to(jlm::rvsdg::output * new_origin)
   this->origin_ = new_origin;
   new_origin->add_user(this);
 
-  if (is<node_input>(*this))
-    static_cast<node_input *>(this)->node()->recompute_depth();
+  if (auto simpleInput = dynamic_cast<simple_input *>(this))
+    region()->ReindexSimpleNode(*simpleInput->node());
 
-  region()->graph()->mark_denormalized();
-  on_input_change(this, old_origin, new_origin);
+  return old_origin;
 }
 
 jlm::rvsdg::node *
@@ -81,10 +97,13 @@ input::GetNode(const jlm::rvsdg::input & input) noexcept
 output::~output() noexcept
 {
   JLM_ASSERT(nusers() == 0);
+
+  region()->graph()->OutputIds_.Free(Id_);
 }
 
 output::output(jlm::rvsdg::region * region, const jlm::rvsdg::port & port)
     : index_(0),
+      Id_(region->graph()->OutputIds_.Allocate()),
       region_(region),
       port_(port.copy())
 {}
@@ -98,9 +117,12 @@ output::debug_string() const
 void
 output::remove_user(jlm::rvsdg::input * user)
 {
-  JLM_ASSERT(users_.find(user) != users_.end());
+  JLM_ASSERT(user->UserIndex_ < nusers() && users_[user->UserIndex_] == user);
 
-  users_.erase(user);
+  auto last = users_.back();
+  users_[user->UserIndex_] = last;
+  last->UserIndex_ = user->UserIndex_;
+  users_.pop_back();
 
   if (auto node = node_output::node(this))
   {
@@ -112,14 +134,13 @@ output::remove_user(jlm::rvsdg::input * user)
 void
 output::add_user(jlm::rvsdg::input * user)
 {
-  JLM_ASSERT(users_.find(user) == users_.end());
-
   if (auto node = node_output::node(this))
   {
     if (!node->has_users())
       region()->bottom_nodes.erase(node);
   }
-  users_.insert(user);
+  user->UserIndex_ = nusers();
+  users_.push_back(user);
 }
 
 }
@@ -153,6 +174,32 @@ node_input::node_input(
       node_(node)
 {}
 
+void
+output::divert_users(jlm::rvsdg::output * new_origin)
+{
+  if (this == new_origin || users_.empty())
+    return;
+
+  std::vector<jlm::rvsdg::input *> inputs;
+  std::vector<jlm::rvsdg::node *> nodes;
+  while (users_.size())
+  {
+    auto user = users_.back();
+    user->ChangeOrigin(new_origin);
+    inputs.push_back(user);
+    if (is<node_input>(*user))
+      nodes.push_back(static_cast<node_input *>(user)->node());
+  }
+
+  // The depths are recomputed before the notifications are emitted, such that observers see
+  // consistent depths. This is the same order as in input::divert_to().
+  node::RecomputeDepths(nodes);
+  region()->graph()->mark_denormalized();
+
+  for (auto input : inputs)
+    on_input_change(input, this, new_origin);
+}
+
 /* node_output class */
 
 node_output::node_output(jlm::rvsdg::node * node, const jlm::rvsdg::port & port)
@@ -164,6 +211,7 @@ node_output::node_output(jlm::rvsdg::node * node, const jlm::rvsdg::port & port)
 
 node::node(std::unique_ptr<jlm::rvsdg::operation> op, jlm::rvsdg::region * region)
     : depth_(0),
+      Id_(region->graph()->NodeIds_.Allocate()),
       graph_(region->graph()),
       region_(region),
       operation_(std::move(op))
@@ -183,6 +231,8 @@ node::~node()
   inputs_.clear();
 
   region()->nodes.erase(this);
+
+  graph()->NodeIds_.Free(Id_);
 }
 
 node_input *
@@ -201,7 +251,20 @@ node::add_input(std::unique_ptr<node_input> input)
 
   auto new_depth = producer ? producer->depth() + 1 : 0;
   if (new_depth > depth())
-    recompute_depth();
+  {
+    // A node without successors cannot propagate its depth change, which is always the case for
+    // the inputs that are added while a node is created.
+    if (has_successors())
+    {
+      recompute_depth();
+    }
+    else
+    {
+      auto old_depth = depth();
+      depth_ = new_depth;
+      on_node_depth_change(this, old_depth);
+    }
+  }
 
   return this->input(ninputs() - 1);
 }
@@ -254,36 +317,82 @@ node::RemoveOutput(size_t index)
 void
 node::recompute_depth() noexcept
 {
-  /*
-    FIXME: This function is inefficient, as it can visit the
-    node's successors multiple times. Optimally, we would like
-    to visit the node's successors in top down order to ensure
-    that each node is only visited once.
-  */
-  size_t new_depth = 0;
-  for (size_t n = 0; n < ninputs(); n++)
+  if (ComputeDepth() != depth())
+    RecomputeDepths({ this });
+}
+
+void
+node::RecomputeDepths(const std::vector<jlm::rvsdg::node *> & nodes) noexcept
+{
+  // The worklist is ordered by the depths of the nodes at the time they were added. If only a
+  // single node changed, then this is a topological order and every node is recomputed once.
+  // However, if the origins of several nodes changed, then the old depths do not necessarily
+  // reflect the order of the nodes in the new graph. A node is therefore added to the worklist
+  // again whenever the depth of one of its predecessors changes, until a fixpoint is reached.
+  using WorklistItem = std::pair<size_t, jlm::rvsdg::node *>;
+  auto compare = [](const WorklistItem & a, const WorklistItem & b)
   {
-    auto producer = node_output::node(input(n)->origin());
-    new_depth = std::max(new_depth, producer ? producer->depth() + 1 : 0);
-  }
-  if (new_depth == depth())
-    return;
+    return a.first > b.first;
+  };
+  std::priority_queue<WorklistItem, std::vector<WorklistItem>, decltype(compare)> worklist(compare);
+  std::unordered_set<jlm::rvsdg::node *> queued;
 
-  size_t old_depth = depth();
-  depth_ = new_depth;
-  on_node_depth_change(this, old_depth);
+  auto push = [&](jlm::rvsdg::node * node)
+  {
+    if (queued.insert(node).second)
+      worklist.emplace(node->depth(), node);
+  };
+
+  for (auto node : nodes)
+    push(node);
 
-  for (size_t n = 0; n < noutputs(); n++)
+  // The depths of the nodes before the recomputation in the order of their first change
+  std::vector<std::pair<jlm::rvsdg::node *, size_t>> changedNodes;
+  std::unordered_set<jlm::rvsdg::node *> changedNodeSet;
+  while (!worklist.empty())
   {
-    for (auto user : *(output(n)))
-    {
-      if (!is<node_input>(*user))
-        continue;
+    auto node = worklist.top().second;
+    worklist.pop();
+    queued.erase(node);
 
-      auto node = static_cast<node_input *>(user)->node();
-      node->recompute_depth();
+    auto new_depth = node->ComputeDepth();
+    if (new_depth == node->depth())
+      continue;
+
+    if (changedNodeSet.insert(node).second)
+      changedNodes.emplace_back(node, node->depth());
+    node->depth_ = new_depth;
+
+    for (size_t n = 0; n < node->noutputs(); n++)
+    {
+      for (auto user : *node->output(n))
+      {
+        if (is<node_input>(*user))
+          push(static_cast<node_input *>(user)->node());
+      }
     }
   }
+
+  // The notifications are emitted after all depths are consistent again, such that observers
+  // never see intermediate depths and each node is reported at most once.
+  for (auto [node, old_depth] : changedNodes)
+  {
+    if (node->depth() != old_depth)
+      on_node_depth_change(node, old_depth);
+  }
+}
+
+size_t
+node::ComputeDepth() const noexcept
+{
+  size_t depth = 0;
+  for (size_t n = 0; n < ninputs(); n++)
+  {
+    auto producer = node_output::node(input(n)->origin());
+    depth = std::max(depth, producer ? producer->depth() + 1 : 0);
+  }
+
+  return depth;
 }
 
 jlm::rvsdg::node *
@@ -16,6 +16,8 @@
 #include <jlm/rvsdg/operation.hpp>
 #include <jlm/util/common.hpp>
 #include <jlm/util/intrusive-list.hpp>
+#include <jlm/util/SlabAllocator.hpp>
+#include <jlm/util/SmallVector.hpp>
 #include <jlm/util/strfmt.hpp>
 
 namespace jlm::rvsdg
@@ -25,6 +27,7 @@ namespace base
 class type;
 }
 
+class EdgeBatch;
 class graph;
 class node_normal_form;
 class output;
@@ -34,7 +37,9 @@ class substitution_map;
 
 class input
 {
+  friend EdgeBatch;
   friend jlm::rvsdg::node;
+  friend jlm::rvsdg::output;
   friend jlm::rvsdg::region;
 
 public:
@@ -52,6 +57,21 @@ public:
   input &
   operator=(input &&) = delete;
 
+  /**
+   * Allocates the input with the util::SlabAllocator, as a graph contains many of them.
+   */
+  static void *
+  operator new(size_t size)
+  {
+    return util::SlabAllocator::Allocate(size);
+  }
+
+  static void
+  operator delete(void * object, size_t size) noexcept
+  {
+    util::SlabAllocator::Free(object, size);
+  }
+
   inline size_t
   index() const noexcept
   {
@@ -268,7 +288,18 @@ public:
   };
 
 private:
+  /**
+   * Changes the origin of the input to \p new_origin without recomputing the depth of the
+   * input's node, emitting notifications, or marking the graph as denormalized.
+   *
+   * @return The old origin of the input.
+   */
+  jlm::rvsdg::output *
+  ChangeOrigin(jlm::rvsdg::output * new_origin);
+
   size_t index_;
+  // Position of the input in the users of its origin
+  size_t UserIndex_;
   jlm::rvsdg::output * origin_;
   jlm::rvsdg::region * region_;
   std::unique_ptr<jlm::rvsdg::port> port_;
@@ -293,7 +324,7 @@ class output
   friend jlm::rvsdg::node;
   friend jlm::rvsdg::region;
 
-  typedef std::unordered_set<jlm::rvsdg::input *>::const_iterator user_iterator;
+  typedef util::SmallVector<jlm::rvsdg::input *, 2>::const_iterator user_iterator;
 
 public:
   virtual ~output() noexcept;
@@ -310,12 +341,39 @@ public:
   output &
   operator=(output &&) = delete;
 
+  /**
+   * Allocates the output with the util::SlabAllocator, as a graph contains many of them.
+   */
+  static void *
+  operator new(size_t size)
+  {
+    return util::SlabAllocator::Allocate(size);
+  }
+
+  static void
+  operator delete(void * object, size_t size) noexcept
+  {
+    util::SlabAllocator::Free(object, size);
+  }
+
   inline size_t
   index() const noexcept
   {
     return index_;
   }
 
+  /**
+   * @return The id of the output, which is unique among all outputs of the graph. Ids are dense
+   * and reused after the removal of an output, such that they can index flat side tables.
+   *
+   * @see OutputMap
+   */
+  [[nodiscard]] size_t
+  Id() const noexcept
+  {
+    return Id_;
+  }
+
   inline size_t
   nusers() const noexcept
   {
@@ -337,15 +395,14 @@ public:
     return nusers() == 0;
   }
 
-  inline void
-  divert_users(jlm::rvsdg::output * new_origin)
-  {
-    if (this == new_origin)
-      return;
-
-    while (users_.size())
-      (*users_.begin())->divert_to(new_origin);
-  }
+  /**
+   * Diverts all users of the output to \p new_origin. The depths of the users' nodes are
+   * recomputed in a single batch after all users were diverted.
+   *
+   * \see node::RecomputeDepths()
+   */
+  void
+  divert_users(jlm::rvsdg::output * new_origin);
 
   inline user_iterator
   begin() const noexcept
@@ -557,9 +614,12 @@ private:
   add_user(jlm::rvsdg::input * user);
 
   size_t index_;
+  size_t Id_;
   jlm::rvsdg::region * region_;
   std::unique_ptr<jlm::rvsdg::port> port_;
-  std::unordered_set<jlm::rvsdg::input *> users_;
+  // Most outputs have only one or two users. Every user knows its position in the list, such that
+  // it can be removed in constant time.
+  util::SmallVector<jlm::rvsdg::input *, 2> users_;
 };
 
 template<class T>
@@ -633,11 +693,33 @@ private:
 
 class node
 {
+  friend struct tracker;
+
 public:
+  /**
+   * Number of trackers that can simultaneously keep the state of a node in the node itself.
+   */
+  static constexpr size_t NumTrackerSlots = 4;
+
   virtual ~node();
 
   node(std::unique_ptr<jlm::rvsdg::operation> op, jlm::rvsdg::region * region);
 
+  /**
+   * Allocates the node with the util::SlabAllocator, as a graph contains many of them.
+   */
+  static void *
+  operator new(size_t size)
+  {
+    return util::SlabAllocator::Allocate(size);
+  }
+
+  static void
+  operator delete(void * object, size_t size) noexcept
+  {
+    util::SlabAllocator::Free(object, size);
+  }
+
   inline const jlm::rvsdg::operation &
   operation() const noexcept
   {
@@ -712,10 +794,33 @@ public:
   inline void
   recompute_depth() noexcept;
 
+  /**
+   * Recomputes the depths of \p nodes and propagates the changes to their successors.
+   *
+   * The affected nodes are visited in increasing order of their depth, and a node is visited again
+   * whenever the depth of one of its predecessors changes. This permits \p nodes to contain several
+   * nodes whose origins changed at once. The on_node_depth_change notifications are emitted after
+   * all depths were recomputed, and at most once per node. This requires that the depths of all
+   * nodes are consistent except for the nodes in \p nodes and their successors.
+   */
+  static void
+  RecomputeDepths(const std::vector<jlm::rvsdg::node *> & nodes) noexcept;
+
 protected:
   node_input *
   add_input(std::unique_ptr<node_input> input);
 
+  /**
+   * Reserves space for \p ninputs inputs and \p noutputs outputs, such that a node whose number
+   * of ports is known upfront can add them without reallocations.
+   */
+  void
+  ReservePorts(size_t ninputs, size_t noutputs)
+  {
+    inputs_.reserve(ninputs);
+    outputs_.reserve(noutputs);
+  }
+
   /**
    * Removes an input from the node given the inputs' index.
    *
@@ -844,6 +949,18 @@ public:
     return depth_;
   }
 
+  /**
+   * @return The id of the node, which is unique among all nodes of the graph. Ids are dense and
+   * reused after the removal of a node, such that they can index flat side tables.
+   *
+   * @see NodeMap
+   */
+  [[nodiscard]] size_t
+  Id() const noexcept
+  {
+    return Id_;
+  }
+
 private:
   jlm::util::intrusive_list_anchor<jlm::rvsdg::node> region_node_list_anchor_;
 
@@ -865,10 +982,16 @@ public:
           region_bottom_node_list_accessor;
 
 private:
+  [[nodiscard]] size_t
+  ComputeDepth() const noexcept;
+
   size_t depth_;
+  size_t Id_;
   jlm::rvsdg::graph * graph_;
   jlm::rvsdg::region * region_;
   std::unique_ptr<jlm::rvsdg::operation> operation_;
+  // Index of the node's state plus one for every tracker slot, or zero if it has no state
+  uint32_t TrackerSlots_[NumTrackerSlots] = {};
   std::vector<std::unique_ptr<node_input>> inputs_;
   std::vector<std::unique_ptr<node_output>> outputs_;
 };
@@ -8,23 +8,23 @@
 namespace jlm::rvsdg
 {
 
-jlm::util::notifier<jlm::rvsdg::region *> on_region_create;
-jlm::util::notifier<jlm::rvsdg::region *> on_region_destroy;
+thread_local jlm::util::notifier<jlm::rvsdg::region *> on_region_create;
+thread_local jlm::util::notifier<jlm::rvsdg::region *> on_region_destroy;
 
-jlm::util::notifier<jlm::rvsdg::node *> on_node_create;
-jlm::util::notifier<jlm::rvsdg::node *> on_node_destroy;
-jlm::util::notifier<jlm::rvsdg::node *, size_t> on_node_depth_change;
+thread_local jlm::util::notifier<jlm::rvsdg::node *> on_node_create;
+thread_local jlm::util::notifier<jlm::rvsdg::node *> on_node_destroy;
+thread_local jlm::util::notifier<jlm::rvsdg::node *, size_t> on_node_depth_change;
 
-jlm::util::notifier<jlm::rvsdg::input *> on_input_create;
-jlm::util::notifier<
+thread_local jlm::util::notifier<jlm::rvsdg::input *> on_input_create;
+thread_local jlm::util::notifier<
     jlm::rvsdg::input *,
     jlm::rvsdg::output *, /* old */
     jlm::rvsdg::output *  /* new */
     >
     on_input_change;
-jlm::util::notifier<jlm::rvsdg::input *> on_input_destroy;
+thread_local jlm::util::notifier<jlm::rvsdg::input *> on_input_destroy;
 
-jlm::util::notifier<jlm::rvsdg::output *> on_output_create;
-jlm::util::notifier<jlm::rvsdg::output *> on_output_destroy;
+thread_local jlm::util::notifier<jlm::rvsdg::output *> on_output_create;
+thread_local jlm::util::notifier<jlm::rvsdg::output *> on_output_destroy;
 
 }
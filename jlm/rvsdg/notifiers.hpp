@@ -16,24 +16,30 @@ class node;
 class output;
 class region;
 
-extern jlm::util::notifier<jlm::rvsdg::region *> on_region_create;
-extern jlm::util::notifier<jlm::rvsdg::region *> on_region_destroy;
+/*
+ * The notifiers are thread-local: a callback only observes the changes that are performed by the
+ * thread that connected it. This permits to transform disjoint regions of the same graph
+ * concurrently, as long as every traverser or tracker stays on the thread that created it.
+ */
+
+extern thread_local jlm::util::notifier<jlm::rvsdg::region *> on_region_create;
+extern thread_local jlm::util::notifier<jlm::rvsdg::region *> on_region_destroy;
 
-extern jlm::util::notifier<jlm::rvsdg::node *> on_node_create;
-extern jlm::util::notifier<jlm::rvsdg::node *> on_node_destroy;
-extern jlm::util::notifier<jlm::rvsdg::node *, size_t> on_node_depth_change;
+extern thread_local jlm::util::notifier<jlm::rvsdg::node *> on_node_create;
+extern thread_local jlm::util::notifier<jlm::rvsdg::node *> on_node_destroy;
+extern thread_local jlm::util::notifier<jlm::rvsdg::node *, size_t> on_node_depth_change;
 
-extern jlm::util::notifier<jlm::rvsdg::input *> on_input_create;
-extern jlm::util::notifier<
+extern thread_local jlm::util::notifier<jlm::rvsdg::input *> on_input_create;
+extern thread_local jlm::util::notifier<
     jlm::rvsdg::input *,
     jlm::rvsdg::output *, /* old */
     jlm::rvsdg::output *  /* new */
     >
     on_input_change;
-extern jlm::util::notifier<jlm::rvsdg::input *> on_input_destroy;
+extern thread_local jlm::util::notifier<jlm::rvsdg::input *> on_input_destroy;
 
-extern jlm::util::notifier<jlm::rvsdg::output *> on_output_create;
-extern jlm::util::notifier<jlm::rvsdg::output *> on_output_destroy;
+extern thread_local jlm::util::notifier<jlm::rvsdg::output *> on_output_create;
+extern thread_local jlm::util::notifier<jlm::rvsdg::output *> on_output_destroy;
 
 }
 
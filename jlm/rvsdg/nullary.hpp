@@ -11,6 +11,7 @@
 #include <jlm/rvsdg/node.hpp>
 #include <jlm/rvsdg/simple-node.hpp>
 #include <jlm/util/common.hpp>
+#include <jlm/util/Hash.hpp>
 
 namespace jlm::rvsdg
 {
@@ -45,7 +46,7 @@ struct default_type_of_value
  *
  * Template argument requirements:
  * - Type: type class of the constants represented
- * - ValueRepr: representation of values
+ * - ValueRepr: representation of values, hashable through std::hash
  * - FormatValue: functional that takes a ValueRepr instance and returns
  *   as std::string a human-readable representation of the value
  * - TypeOfValue: functional that takes a ValueRepr instance and returns
@@ -76,6 +77,12 @@ public:
     return op && op->value_ == value_;
   }
 
+  [[nodiscard]] std::size_t
+  hash() const noexcept override
+  {
+    return util::CombineHashes(typeid(*this).hash_code(), value_);
+  }
+
   virtual std::string
   debug_string() const override
   {
@@ -8,6 +8,7 @@
 #define JLM_RVSDG_OPERATION_HPP
 
 #include <jlm/rvsdg/type.hpp>
+#include <jlm/util/SlabAllocator.hpp>
 
 #include <memory>
 #include <string>
@@ -35,34 +36,29 @@ public:
 
   port(std::unique_ptr<jlm::rvsdg::type> type);
 
-  inline port(const port & other)
-      : type_(other.type_->copy())
-  {}
+  port(const port & other) = default;
 
-  inline port(port && other)
-      : type_(std::move(other.type_))
-  {}
+  port(port && other) = default;
 
-  inline port &
-  operator=(const port & other)
-  {
-    if (&other == this)
-      return *this;
+  port &
+  operator=(const port & other) = default;
 
-    type_ = other.type_->copy();
+  port &
+  operator=(port && other) = default;
 
-    return *this;
+  /**
+   * Allocates the port with the util::SlabAllocator, as a graph contains many of them.
+   */
+  static void *
+  operator new(size_t size)
+  {
+    return util::SlabAllocator::Allocate(size);
   }
 
-  inline port &
-  operator=(port && other)
+  static void
+  operator delete(void * object, size_t size) noexcept
   {
-    if (&other == this)
-      return *this;
-
-    type_ = std::move(other.type_);
-
-    return *this;
+    util::SlabAllocator::Free(object, size);
   }
 
   virtual bool
@@ -84,7 +80,8 @@ public:
   copy() const;
 
 private:
-  std::unique_ptr<jlm::rvsdg::type> type_;
+  /* interned type, see type::Intern() */
+  const jlm::rvsdg::type * type_;
 };
 
 /* operation */
@@ -103,6 +100,19 @@ public:
   virtual std::unique_ptr<jlm::rvsdg::operation>
   copy() const = 0;
 
+  /**
+   * Computes a hash of the operation. Two operations that compare equal with operator==() must
+   * return the same hash.
+   *
+   * The default implementation only hashes the dynamic type of the operation. Operations that
+   * carry parameters distinguishing otherwise identical nodes, e.g., the value of a constant,
+   * should override this method.
+   *
+   * @return The hash of the operation.
+   */
+  [[nodiscard]] virtual std::size_t
+  hash() const noexcept;
+
   inline bool
   operator!=(const operation & other) const noexcept
   {
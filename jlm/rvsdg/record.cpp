@@ -5,10 +5,53 @@
  */
 
 #include <jlm/rvsdg/record.hpp>
+#include <jlm/util/Hash.hpp>
+
+#include <typeinfo>
 
 namespace jlm::rvsdg
 {
 
+/* declaration */
+
+bool
+rcddeclaration::operator==(const rcddeclaration & other) const noexcept
+{
+  if (this == &other)
+    return true;
+
+  if (nelements() != other.nelements())
+    return false;
+
+  for (size_t n = 0; n < nelements(); n++)
+  {
+    if (element(n) != other.element(n))
+      return false;
+  }
+
+  return true;
+}
+
+std::size_t
+rcddeclaration::hash() const noexcept
+{
+  auto seed = util::CombineHashes(nelements());
+  for (auto & type : types_)
+    util::CombineHashesWithSeed(seed, type->hash());
+
+  return seed;
+}
+
+std::unique_ptr<rcddeclaration>
+rcddeclaration::CopyWithInternedTypes() const
+{
+  auto declaration = create();
+  for (size_t n = 0; n < nelements(); n++)
+    declaration->append(*static_cast<const valuetype *>(&element(n).Intern()));
+
+  return declaration;
+}
+
 /* record type */
 
 rcdtype::~rcdtype() noexcept
@@ -24,7 +67,13 @@ bool
 rcdtype::operator==(const jlm::rvsdg::type & other) const noexcept
 {
   auto type = dynamic_cast<const rcdtype *>(&other);
-  return type != nullptr && declaration() == type->declaration();
+  return type != nullptr && *declaration() == *type->declaration();
+}
+
+std::size_t
+rcdtype::hash() const noexcept
+{
+  return util::CombineHashes(typeid(rcdtype).hash_code(), declaration()->hash());
 }
 
 std::unique_ptr<jlm::rvsdg::type>
@@ -33,4 +82,13 @@ rcdtype::copy() const
   return std::unique_ptr<jlm::rvsdg::type>(new rcdtype(*this));
 }
 
+std::unique_ptr<jlm::rvsdg::type>
+rcdtype::CreateCanonicalCopy() const
+{
+  auto declaration = dcl_->CopyWithInternedTypes();
+  auto type = std::make_unique<rcdtype>(declaration.get());
+  type->OwnedDeclaration_ = std::move(declaration);
+  return type;
+}
+
 }
@@ -51,6 +51,31 @@ public:
     types_.push_back(type.copy());
   }
 
+  /**
+   * Compares the element types of the declarations.
+   */
+  bool
+  operator==(const rcddeclaration & other) const noexcept;
+
+  inline bool
+  operator!=(const rcddeclaration & other) const noexcept
+  {
+    return !(*this == other);
+  }
+
+  /**
+   * Computes a hash value of the element types. Equal declarations have the same hash value.
+   */
+  [[nodiscard]] std::size_t
+  hash() const noexcept;
+
+  /**
+   * Creates a copy of the declaration with interned element types. The copy therefore does not
+   * refer to any object that can be freed before the canonical types.
+   */
+  [[nodiscard]] std::unique_ptr<rcddeclaration>
+  CopyWithInternedTypes() const;
+
   static inline std::unique_ptr<rcddeclaration>
   create()
   {
@@ -85,6 +110,14 @@ public:
       : dcl_(dcl)
   {}
 
+  /**
+   * Copies refer to the declaration of \p other, but never own it.
+   */
+  inline rcdtype(const rcdtype & other) noexcept
+      : jlm::rvsdg::valuetype(other),
+        dcl_(other.dcl_)
+  {}
+
   inline const rcddeclaration *
   declaration() const noexcept
   {
@@ -97,11 +130,24 @@ public:
   virtual bool
   operator==(const jlm::rvsdg::type & type) const noexcept override;
 
+  [[nodiscard]] std::size_t
+  hash() const noexcept override;
+
   virtual std::unique_ptr<jlm::rvsdg::type>
   copy() const override;
 
+protected:
+  [[nodiscard]] std::unique_ptr<jlm::rvsdg::type>
+  CreateCanonicalCopy() const override;
+
 private:
   const rcddeclaration * dcl_;
+
+  /**
+   * The declaration of a canonical instance, which must not refer to a declaration that is freed
+   * before it.
+   */
+  std::unique_ptr<const rcddeclaration> OwnedDeclaration_;
 };
 
 }
@@ -6,9 +6,11 @@
 
 #include <jlm/rvsdg/graph.hpp>
 #include <jlm/rvsdg/notifiers.hpp>
+#include <jlm/rvsdg/simple-node.hpp>
 #include <jlm/rvsdg/structural-node.hpp>
 #include <jlm/rvsdg/substitution.hpp>
 #include <jlm/rvsdg/traverser.hpp>
+#include <jlm/util/Hash.hpp>
 
 namespace jlm::rvsdg
 {
@@ -105,10 +107,13 @@ region::~region()
 
   while (arguments_.size())
     RemoveArgument(arguments_.size() - 1);
+
+  graph_->RegionIds_.Free(Id_);
 }
 
 region::region(jlm::rvsdg::region * parent, jlm::rvsdg::graph * graph)
     : index_(0),
+      Id_(graph->RegionIds_.Allocate()),
       graph_(graph),
       node_(nullptr)
 {
@@ -117,6 +122,7 @@ region::region(jlm::rvsdg::region * parent, jlm::rvsdg::graph * graph)
 
 region::region(jlm::rvsdg::structural_node * node, size_t index)
     : index_(index),
+      Id_(node->graph()->RegionIds_.Allocate()),
       graph_(node->graph()),
       node_(node)
 {
@@ -195,18 +201,103 @@ region::remove_node(jlm::rvsdg::node * node)
   delete node;
 }
 
+std::size_t
+region::ComputeSimpleNodeHash(
+    const jlm::rvsdg::simple_op & op,
+    const std::vector<jlm::rvsdg::output *> & operands) noexcept
+{
+  auto hash = op.hash();
+  for (auto operand : operands)
+    util::CombineHashesWithSeed(hash, operand);
+
+  return hash;
+}
+
+jlm::rvsdg::simple_node *
+region::FindSimpleNode(
+    const jlm::rvsdg::simple_op & op,
+    const std::vector<jlm::rvsdg::output *> & operands,
+    const jlm::rvsdg::simple_node * exclude) const noexcept
+{
+  auto range = SimpleNodeIndex_.equal_range(ComputeSimpleNodeHash(op, operands));
+  for (auto it = range.first; it != range.second; it++)
+  {
+    auto node = it->second;
+    if (node == exclude || node->ninputs() != operands.size())
+      continue;
+
+    if (node->operation() != op)
+      continue;
+
+    bool operandsMatch = true;
+    for (size_t n = 0; n < operands.size() && operandsMatch; n++)
+      operandsMatch = node->input(n)->origin() == operands[n];
+
+    if (operandsMatch)
+      return node;
+  }
+
+  return nullptr;
+}
+
+void
+region::IndexSimpleNode(jlm::rvsdg::simple_node & node)
+{
+  JLM_ASSERT(node.region() == this);
+
+  // This must compute the same hash as ComputeSimpleNodeHash() for the node's operands
+  auto hash = node.operation().hash();
+  for (size_t n = 0; n < node.ninputs(); n++)
+    util::CombineHashesWithSeed(hash, node.input(n)->origin());
+
+  node.IndexHash_ = hash;
+  SimpleNodeIndex_.emplace(node.IndexHash_, &node);
+}
+
+void
+region::UnindexSimpleNode(jlm::rvsdg::simple_node & node) noexcept
+{
+  auto range = SimpleNodeIndex_.equal_range(node.IndexHash_);
+  for (auto it = range.first; it != range.second; it++)
+  {
+    if (it->second == &node)
+    {
+      SimpleNodeIndex_.erase(it);
+      return;
+    }
+  }
+
+  JLM_UNREACHABLE("Simple node is not indexed in its region.");
+}
+
+void
+region::ReindexSimpleNode(jlm::rvsdg::simple_node & node)
+{
+  UnindexSimpleNode(node);
+  IndexSimpleNode(node);
+}
+
 void
 region::copy(region * target, substitution_map & smap, bool copy_arguments, bool copy_results) const
 {
   smap.insert(this, target);
 
-  /* order nodes top-down */
-  std::vector<std::vector<const jlm::rvsdg::node *>> context(nnodes());
+  /* order nodes top-down by counting them into one flat vector per depth bucket */
+  std::vector<size_t> bucketOffsets(nnodes() + 1, 0);
   for (const auto & node : nodes)
   {
-    JLM_ASSERT(node.depth() < context.size());
-    context[node.depth()].push_back(&node);
+    JLM_ASSERT(node.depth() < nnodes());
+    bucketOffsets[node.depth() + 1]++;
   }
+  for (size_t n = 1; n < bucketOffsets.size(); n++)
+    bucketOffsets[n] += bucketOffsets[n - 1];
+
+  std::vector<const jlm::rvsdg::node *> context(nnodes());
+  for (const auto & node : nodes)
+    context[bucketOffsets[node.depth()]++] = &node;
+
+  // Avoid rehashing the structural hash index of the target while the copied nodes are added
+  target->SimpleNodeIndex_.reserve(target->SimpleNodeIndex_.size() + nnodes());
 
   /* copy arguments */
   if (copy_arguments)
@@ -220,13 +311,10 @@ region::copy(region * target, substitution_map & smap, bool copy_arguments, bool
   }
 
   /* copy nodes */
-  for (size_t n = 0; n < context.size(); n++)
+  for (const auto node : context)
   {
-    for (const auto node : context[n])
-    {
-      JLM_ASSERT(target == smap.lookup(node->region()));
-      node->copy(target, smap);
-    }
+    JLM_ASSERT(target == smap.lookup(node->region()));
+    node->copy(target, smap);
   }
 
   /* copy results */
@@ -13,6 +13,8 @@
 #include <jlm/rvsdg/node.hpp>
 #include <jlm/util/common.hpp>
 
+#include <unordered_map>
+
 namespace jlm::rvsdg
 {
 
@@ -114,6 +116,9 @@ private:
 
 class region
 {
+  friend jlm::rvsdg::input;
+  friend jlm::rvsdg::simple_node;
+
   typedef jlm::util::intrusive_list<jlm::rvsdg::node, jlm::rvsdg::node::region_node_list_accessor>
       region_nodes_list;
 
@@ -174,6 +179,18 @@ public:
     return index_;
   }
 
+  /**
+   * @return The id of the region, which is unique among all regions of the graph. Ids are dense
+   * and reused after the removal of a region, such that they can index flat side tables.
+   *
+   * @see RegionMap
+   */
+  [[nodiscard]] size_t
+  Id() const noexcept
+  {
+    return Id_;
+  }
+
   /**
    * Checks if the region is the RVSDG root region.
    *
@@ -321,6 +338,26 @@ public:
   void
   remove_node(jlm::rvsdg::node * node);
 
+  /**
+   * Finds a simple node in the region that performs operation \p op on \p operands.
+   *
+   * The lookup uses a structural hash index over all simple nodes of the region, keyed on the
+   * operation's hash and the origins of the node's inputs. Its runtime is therefore O(1) on
+   * average and independent of the number of users of the operands.
+   *
+   * @param op The operation of the node.
+   * @param operands The origins of the node's inputs.
+   * @param exclude A node that is never returned, or nullptr.
+   * @return A node that is equivalent to (\p op, \p operands), or nullptr if none exists.
+   *
+   * \see operation::hash()
+   */
+  [[nodiscard]] jlm::rvsdg::simple_node *
+  FindSimpleNode(
+      const jlm::rvsdg::simple_op & op,
+      const std::vector<jlm::rvsdg::output *> & operands,
+      const jlm::rvsdg::simple_node * exclude = nullptr) const noexcept;
+
   /**
     \brief Copy a region with substitutions
     \param target Target region to create nodes in
@@ -373,11 +410,35 @@ public:
   region_bottom_node_list bottom_nodes;
 
 private:
+  static std::size_t
+  ComputeSimpleNodeHash(
+      const jlm::rvsdg::simple_op & op,
+      const std::vector<jlm::rvsdg::output *> & operands) noexcept;
+
+  /**
+   * Adds \p node to the region's simple node index. Must be invoked after all inputs of \p node
+   * have been created.
+   */
+  void
+  IndexSimpleNode(jlm::rvsdg::simple_node & node);
+
+  void
+  UnindexSimpleNode(jlm::rvsdg::simple_node & node) noexcept;
+
+  /**
+   * Moves \p node to its new position in the simple node index after one of its inputs was
+   * diverted.
+   */
+  void
+  ReindexSimpleNode(jlm::rvsdg::simple_node & node);
+
   size_t index_;
+  size_t Id_;
   jlm::rvsdg::graph * graph_;
   jlm::rvsdg::structural_node * node_;
   std::vector<jlm::rvsdg::result *> results_;
   std::vector<jlm::rvsdg::argument *> arguments_;
+  std::unordered_multimap<std::size_t, jlm::rvsdg::simple_node *> SimpleNodeIndex_;
 };
 
 static inline void
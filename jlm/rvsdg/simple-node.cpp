@@ -41,6 +41,7 @@ simple_output::~simple_output() noexcept
 simple_node::~simple_node()
 {
   on_node_destroy(this);
+  region()->UnindexSimpleNode(*this);
 }
 
 simple_node::simple_node(
@@ -57,6 +58,7 @@ simple_node::simple_node(
         operands.size(),
         " arguments."));
 
+  ReservePorts(operation().narguments(), operation().nresults());
   for (size_t n = 0; n < operation().narguments(); n++)
   {
     node::add_input(
@@ -66,6 +68,7 @@ simple_node::simple_node(
   for (size_t n = 0; n < operation().nresults(); n++)
     node::add_output(std::unique_ptr<node_output>(new simple_output(this, operation().result(n))));
 
+  region->IndexSimpleNode(*this);
   on_node_create(this);
 }
 
@@ -22,6 +22,8 @@ class simple_output;
 
 class simple_node : public node
 {
+  friend jlm::rvsdg::region;
+
 public:
   virtual ~simple_node();
 
@@ -66,6 +68,14 @@ public:
     auto nf = static_cast<simple_normal_form *>(region->graph()->node_normal_form(typeid(op)));
     return nf->normalized_create(region, op, operands);
   }
+
+private:
+  /**
+   * The hash under which the node is registered in its region's simple node index.
+   *
+   * \see region::FindSimpleNode()
+   */
+  std::size_t IndexHash_;
 };
 
 /* inputs */
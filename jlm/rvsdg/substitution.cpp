@@ -0,0 +1,101 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/rvsdg/region.hpp>
+#include <jlm/rvsdg/substitution.hpp>
+
+#include <algorithm>
+
+namespace jlm::rvsdg
+{
+
+template<typename Key, typename Value>
+Value *
+substitution_map::IdTable<Key, Value>::Lookup(const Key * original) const noexcept
+{
+  if (original == nullptr)
+    return nullptr;
+
+  auto id = original->Id();
+  if (id >= Base_ && id - Base_ < Entries_.size())
+  {
+    auto & entry = Entries_[id - Base_];
+    if (entry.first == original)
+      return entry.second;
+  }
+
+  if (Overflow_.empty())
+    return nullptr;
+
+  auto it = Overflow_.find(original);
+  return it != Overflow_.end() ? it->second : nullptr;
+}
+
+template<typename Key, typename Value>
+void
+substitution_map::IdTable<Key, Value>::Insert(const Key * original, Value * substitute)
+{
+  auto id = original->Id();
+  if (Cover(id))
+  {
+    auto & entry = Entries_[id - Base_];
+    if (entry.first == nullptr)
+    {
+      entry = { original, substitute };
+      NumEntries_++;
+      return;
+    }
+
+    if (entry.first == original)
+    {
+      entry.second = substitute;
+      return;
+    }
+  }
+
+  Overflow_[original] = substitute;
+}
+
+template<typename Key, typename Value>
+bool
+substitution_map::IdTable<Key, Value>::Cover(size_t id)
+{
+  if (Entries_.empty())
+  {
+    Base_ = id;
+    Entries_.resize(1, { nullptr, nullptr });
+    return true;
+  }
+
+  auto end = Base_ + Entries_.size();
+  if (id >= Base_ && id < end)
+    return true;
+
+  auto maxSpan = std::max(MinSpan, MaxSparsity * (NumEntries_ + 1));
+  if (id >= end)
+  {
+    if (id + 1 - Base_ > maxSpan)
+      return false;
+
+    Entries_.resize(id + 1 - Base_, { nullptr, nullptr });
+    return true;
+  }
+
+  if (end - id > maxSpan)
+    return false;
+
+  // Grow the table by at least its current size to amortize the costs of moving the entries. The
+  // growth never exceeds the maximal span and never extends the table below id zero.
+  auto growth = std::max(Base_ - id, Entries_.size());
+  growth = std::min({ growth, Base_, maxSpan - Entries_.size() });
+  Entries_.insert(Entries_.begin(), growth, { nullptr, nullptr });
+  Base_ -= growth;
+  return true;
+}
+
+template class substitution_map::IdTable<region, region>;
+template class substitution_map::IdTable<output, output>;
+
+}
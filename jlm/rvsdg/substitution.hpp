@@ -9,7 +9,10 @@
 
 #include <jlm/util/common.hpp>
 
+#include <cstddef>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 namespace jlm::rvsdg
 {
@@ -18,19 +21,66 @@ class output;
 class region;
 class structural_input;
 
+/**
+ * Maps the outputs, regions, and structural inputs of a graph to their substitutes, e.g., when
+ * copying a region.
+ *
+ * Outputs and regions are stored in flat tables indexed by their dense ids relative to the
+ * smallest id in the table, such that the lookups of a copy do not require any hashing. The ids
+ * are unique within a graph, but the ids of the objects of a copied region are not necessarily
+ * close to each other. A table therefore only spans a bounded multiple of the number of its
+ * entries, and keys whose id lies outside of this span are kept in a hashed overflow table. The
+ * same holds for keys whose id slot is already occupied by an object of another graph. The memory
+ * of a substitution map is therefore proportional to the number of substituted objects, and not to
+ * the size of the graph.
+ */
 class substitution_map final
 {
+  /**
+   * Flat table from keys with dense ids to their substitutes.
+   */
+  template<typename Key, typename Value>
+  class IdTable final
+  {
+  public:
+    [[nodiscard]] Value *
+    Lookup(const Key * original) const noexcept;
+
+    void
+    Insert(const Key * original, Value * substitute);
+
+  private:
+    /**
+     * Grows the table such that it covers \p id.
+     *
+     * @return True if the table covers \p id, false if the table would become too sparse.
+     */
+    bool
+    Cover(size_t id);
+
+    // The minimal number of ids a table may span regardless of its number of entries
+    static constexpr size_t MinSpan = 64;
+
+    // The maximal ratio between the number of ids a table spans and its number of entries
+    static constexpr size_t MaxSparsity = 4;
+
+    size_t Base_ = 0;
+    size_t NumEntries_ = 0;
+    std::vector<std::pair<const Key *, Value *>> Entries_;
+    std::unordered_map<const Key *, Value *> Overflow_;
+  };
+
 public:
   bool
   contains(const output & original) const noexcept
   {
-    return output_map_.find(&original) != output_map_.end();
+    return output_map_.Lookup(&original) != nullptr;
   }
 
   bool
   contains(const region & original) const noexcept
   {
-    return region_map_.find(&original) != region_map_.end();
+    return region_map_.Lookup(&original) != nullptr;
   }
 
   bool
@@ -42,19 +92,21 @@ public:
   output &
   lookup(const output & original) const
   {
-    if (!contains(original))
+    auto substitute = output_map_.Lookup(&original);
+    if (substitute == nullptr)
       throw jlm::util::error("Output not in substitution map.");
 
-    return *output_map_.find(&original)->second;
+    return *substitute;
   }
 
   region &
   lookup(const region & original) const
   {
-    if (!contains(original))
+    auto substitute = region_map_.Lookup(&original);
+    if (substitute == nullptr)
       throw jlm::util::error("Region not in substitution map.");
 
-    return *region_map_.find(&original)->second;
+    return *substitute;
   }
 
   structural_input &
@@ -69,15 +121,13 @@ public:
   inline jlm::rvsdg::output *
   lookup(const jlm::rvsdg::output * original) const noexcept
   {
-    auto i = output_map_.find(original);
-    return i != output_map_.end() ? i->second : nullptr;
+    return output_map_.Lookup(original);
   }
 
   inline jlm::rvsdg::region *
   lookup(const jlm::rvsdg::region * original) const noexcept
   {
-    auto i = region_map_.find(original);
-    return i != region_map_.end() ? i->second : nullptr;
+    return region_map_.Lookup(original);
   }
 
   inline jlm::rvsdg::structural_input *
@@ -90,13 +140,13 @@ public:
   inline void
   insert(const jlm::rvsdg::output * original, jlm::rvsdg::output * substitute)
   {
-    output_map_[original] = substitute;
+    output_map_.Insert(original, substitute);
   }
 
   inline void
   insert(const jlm::rvsdg::region * original, jlm::rvsdg::region * substitute)
   {
-    region_map_[original] = substitute;
+    region_map_.Insert(original, substitute);
   }
 
   inline void
@@ -106,8 +156,8 @@ public:
   }
 
 private:
-  std::unordered_map<const jlm::rvsdg::region *, jlm::rvsdg::region *> region_map_;
-  std::unordered_map<const jlm::rvsdg::output *, jlm::rvsdg::output *> output_map_;
+  IdTable<jlm::rvsdg::region, jlm::rvsdg::region> region_map_;
+  IdTable<jlm::rvsdg::output, jlm::rvsdg::output> output_map_;
   std::unordered_map<const jlm::rvsdg::structural_input *, jlm::rvsdg::structural_input *>
       structinput_map_;
 };
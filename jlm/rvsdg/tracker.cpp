@@ -14,14 +14,14 @@ namespace
 
 typedef std::unordered_set<const jlm::rvsdg::graph *> tracker_set;
 
+/*
+ * Trackers are registered per thread, mirroring the thread-local notifiers they connect to.
+ */
 tracker_set *
 active_trackers()
 {
-  static std::unique_ptr<tracker_set> trackers;
-  if (!trackers)
-    trackers.reset(new tracker_set());
-
-  return trackers.get();
+  static thread_local tracker_set trackers;
+  return &trackers;
 }
 
 void
@@ -36,6 +36,40 @@ unregister_tracker(const jlm::rvsdg::tracker * tracker)
   active_trackers()->erase(tracker->graph());
 }
 
+/*
+ * The node slots that are taken by the trackers of the current thread. Graphs are only modified
+ * by a single thread, mirroring the thread-local notifiers, such that a slot can be shared by
+ * trackers of different threads.
+ */
+uint32_t &
+used_tracker_slots()
+{
+  static thread_local uint32_t slots = 0;
+  return slots;
+}
+
+size_t
+acquire_tracker_slot()
+{
+  auto & slots = used_tracker_slots();
+  for (size_t n = 0; n < jlm::rvsdg::node::NumTrackerSlots; n++)
+  {
+    if (!(slots & (1u << n)))
+    {
+      slots |= 1u << n;
+      return n;
+    }
+  }
+
+  return jlm::rvsdg::node::NumTrackerSlots;
+}
+
+void
+release_tracker_slot(size_t slot)
+{
+  used_tracker_slots() &= ~(1u << slot);
+}
+
 }
 
 namespace jlm::rvsdg
@@ -50,13 +84,19 @@ has_active_trackers(const jlm::rvsdg::graph * graph)
 
 /* tracker depth state */
 
+/*
+ * The nodes of a single tracked state, bucketed by depth. The nodes of a bucket form an intrusive
+ * list through their tracker_nodestate, such that nodes are added and removed in constant time
+ * and without allocation. Nodes are returned in the order they were added to a bucket.
+ */
 class tracker_depth_state
 {
 public:
-  inline tracker_depth_state()
+  inline explicit tracker_depth_state(std::vector<tracker_nodestate> & nodestates)
       : count_(0),
         top_depth_(0),
-        bottom_depth_(0)
+        bottom_depth_(0),
+        nodestates_(nodestates)
   {}
 
   tracker_depth_state(const tracker_depth_state &) = delete;
@@ -69,26 +109,33 @@ public:
   tracker_depth_state &
   operator=(tracker_depth_state &&) = delete;
 
-  inline tracker_nodestate *
+  inline uint32_t
   peek_top() const noexcept
   {
-    return count_ ? *nodestates_.at(top_depth_).begin() : nullptr;
+    return count_ ? buckets_[top_depth_].first : tracker_nodestate::none;
   }
 
-  inline tracker_nodestate *
+  inline uint32_t
   peek_bottom() const noexcept
   {
-    return count_ ? *nodestates_.at(bottom_depth_).begin() : nullptr;
+    return count_ ? buckets_[bottom_depth_].first : tracker_nodestate::none;
   }
 
   inline void
-  add(tracker_nodestate * nodestate, size_t depth)
+  add(uint32_t index, size_t depth)
   {
-    auto it = nodestates_.find(depth);
-    if (it != nodestates_.end())
-      it->second.insert(nodestate);
+    if (depth >= buckets_.size())
+      buckets_.resize(depth + 1);
+
+    auto & bucket = buckets_[depth];
+    auto & nodestate = nodestates_[index];
+    nodestate.previous_ = bucket.last;
+    nodestate.next_ = tracker_nodestate::none;
+    if (bucket.last != tracker_nodestate::none)
+      nodestates_[bucket.last].next_ = index;
     else
-      nodestates_[depth] = { nodestate };
+      bucket.first = index;
+    bucket.last = index;
 
     count_++;
     if (count_ == 1)
@@ -106,9 +153,22 @@ public:
   }
 
   inline void
-  remove(tracker_nodestate * nodestate, size_t depth)
+  remove(uint32_t index, size_t depth)
   {
-    nodestates_[depth].erase(nodestate);
+    JLM_ASSERT(depth < buckets_.size());
+
+    auto & bucket = buckets_[depth];
+    auto & nodestate = nodestates_[index];
+    if (nodestate.previous_ != tracker_nodestate::none)
+      nodestates_[nodestate.previous_].next_ = nodestate.next_;
+    else
+      bucket.first = nodestate.next_;
+    if (nodestate.next_ != tracker_nodestate::none)
+      nodestates_[nodestate.next_].previous_ = nodestate.previous_;
+    else
+      bucket.last = nodestate.previous_;
+    nodestate.previous_ = tracker_nodestate::none;
+    nodestate.next_ = tracker_nodestate::none;
 
     count_--;
     if (count_ == 0)
@@ -116,59 +176,78 @@ public:
 
     if (depth == top_depth_)
     {
-      while (nodestates_[top_depth_].empty())
+      while (buckets_[top_depth_].first == tracker_nodestate::none)
         top_depth_++;
     }
 
     if (depth == bottom_depth_)
     {
-      while (nodestates_[bottom_depth_].empty())
+      while (buckets_[bottom_depth_].first == tracker_nodestate::none)
         bottom_depth_--;
     }
 
     JLM_ASSERT(top_depth_ <= bottom_depth_);
   }
 
-  inline tracker_nodestate *
+  inline uint32_t
   pop_top()
   {
-    auto nodestate = peek_top();
-    if (nodestate)
-      remove(nodestate, top_depth_);
+    auto index = peek_top();
+    if (index != tracker_nodestate::none)
+      remove(index, top_depth_);
 
-    return nodestate;
+    return index;
   }
 
-  inline tracker_nodestate *
+  inline uint32_t
   pop_bottom()
   {
-    auto nodestate = peek_bottom();
-    if (nodestate)
-      remove(nodestate, bottom_depth_);
+    auto index = peek_bottom();
+    if (index != tracker_nodestate::none)
+      remove(index, bottom_depth_);
 
-    return nodestate;
+    return index;
   }
 
 private:
+  struct bucket
+  {
+    uint32_t first = tracker_nodestate::none;
+    uint32_t last = tracker_nodestate::none;
+  };
+
   size_t count_;
   size_t top_depth_;
   size_t bottom_depth_;
-  std::unordered_map<size_t, std::unordered_set<tracker_nodestate *>> nodestates_;
+  std::vector<bucket> buckets_;
+  std::vector<tracker_nodestate> & nodestates_;
 };
 
 /* tracker */
 
 tracker::~tracker() noexcept
 {
+  if (slot_ < node::NumTrackerSlots)
+  {
+    for (auto & nodestate : nodestates_)
+    {
+      if (nodestate.node())
+        nodestate.node()->TrackerSlots_[slot_] = 0;
+    }
+
+    release_tracker_slot(slot_);
+  }
+
   unregister_tracker(this);
 }
 
 tracker::tracker(jlm::rvsdg::graph * graph, size_t nstates)
     : graph_(graph),
-      states_(nstates)
+      states_(nstates),
+      slot_(acquire_tracker_slot())
 {
   for (size_t n = 0; n < states_.size(); n++)
-    states_[n] = std::make_unique<tracker_depth_state>();
+    states_[n] = std::make_unique<tracker_depth_state>(nodestates_);
 
   depth_callback_ =
       on_node_depth_change.connect(std::bind(&tracker::node_depth_change, this, _1, _2));
@@ -180,42 +259,58 @@ tracker::tracker(jlm::rvsdg::graph * graph, size_t nstates)
 void
 tracker::node_depth_change(jlm::rvsdg::node * node, size_t old_depth)
 {
-  auto nstate = nodestate(node);
-  if (nstate->state() < states_.size())
+  auto index = find_nodestate(node);
+  if (index == tracker_nodestate::none)
+    return;
+
+  auto state = nodestates_[index].state();
+  if (state < states_.size())
   {
-    states_[nstate->state()]->remove(nstate, old_depth);
-    states_[nstate->state()]->add(nstate, node->depth());
+    states_[state]->remove(index, old_depth);
+    states_[state]->add(index, node->depth());
   }
 }
 
 void
 tracker::node_destroy(jlm::rvsdg::node * node)
 {
-  auto nstate = nodestate(node);
-  if (nstate->state() < states_.size())
-    states_[nstate->state()]->remove(nstate, node->depth());
+  auto index = find_nodestate(node);
+  if (index == tracker_nodestate::none)
+    return;
+
+  auto state = nodestates_[index].state();
+  if (state < states_.size())
+    states_[state]->remove(index, node->depth());
 
-  nodestates_.erase(node);
+  if (slot_ < node::NumTrackerSlots)
+    node->TrackerSlots_[slot_] = 0;
+  else
+    slot_map_.erase(node);
+
+  nodestates_[index] = tracker_nodestate(nullptr);
+  free_nodestates_.push_back(index);
 }
 
 ssize_t
 tracker::get_nodestate(jlm::rvsdg::node * node)
 {
-  return nodestate(node)->state();
+  auto index = find_nodestate(node);
+  return index != tracker_nodestate::none ? nodestates_[index].state() : tracker_nodestate_none;
 }
 
 void
 tracker::set_nodestate(jlm::rvsdg::node * node, size_t state)
 {
-  auto nstate = nodestate(node);
-  if (nstate->state() != state)
+  auto index = nodestate(node);
+  auto & nodestate = nodestates_[index];
+  if (nodestate.state() != state)
   {
-    if (nstate->state() < states_.size())
-      states_[nstate->state()]->remove(nstate, node->depth());
+    if (nodestate.state() < states_.size())
+      states_[nodestate.state()]->remove(index, node->depth());
 
-    nstate->state_ = state;
-    if (nstate->state() < states_.size())
-      states_[nstate->state()]->add(nstate, node->depth());
+    nodestate.state_ = state;
+    if (nodestate.state() < states_.size())
+      states_[nodestate.state()]->add(index, node->depth());
   }
 }
 
@@ -224,11 +319,11 @@ tracker::peek_top(size_t state) const
 {
   JLM_ASSERT(state < states_.size());
 
-  auto nodestate = states_[state]->pop_top();
-  if (nodestate)
+  auto index = states_[state]->pop_top();
+  if (index != tracker_nodestate::none)
   {
-    nodestate->state_ = tracker_nodestate_none;
-    return nodestate->node();
+    nodestates_[index].state_ = tracker_nodestate_none;
+    return nodestates_[index].node();
   }
 
   return nullptr;
@@ -239,25 +334,52 @@ tracker::peek_bottom(size_t state) const
 {
   JLM_ASSERT(state < states_.size());
 
-  auto nodestate = states_[state]->pop_bottom();
-  if (nodestate)
+  auto index = states_[state]->pop_bottom();
+  if (index != tracker_nodestate::none)
   {
-    nodestate->state_ = tracker_nodestate_none;
-    return nodestate->node();
+    nodestates_[index].state_ = tracker_nodestate_none;
+    return nodestates_[index].node();
   }
 
   return nullptr;
 }
 
-jlm::rvsdg::tracker_nodestate *
+uint32_t
+tracker::find_nodestate(const jlm::rvsdg::node * node) const noexcept
+{
+  if (slot_ < node::NumTrackerSlots)
+    return node->TrackerSlots_[slot_] - 1;
+
+  auto it = slot_map_.find(node);
+  return it != slot_map_.end() ? it->second : tracker_nodestate::none;
+}
+
+uint32_t
 tracker::nodestate(jlm::rvsdg::node * node)
 {
-  auto it = nodestates_.find(node);
-  if (it != nodestates_.end())
-    return it->second.get();
+  auto index = find_nodestate(node);
+  if (index != tracker_nodestate::none)
+    return index;
+
+  if (!free_nodestates_.empty())
+  {
+    index = free_nodestates_.back();
+    free_nodestates_.pop_back();
+    nodestates_[index] = tracker_nodestate(node);
+  }
+  else
+  {
+    JLM_ASSERT(nodestates_.size() < tracker_nodestate::none - 1);
+    index = nodestates_.size();
+    nodestates_.emplace_back(node);
+  }
+
+  if (slot_ < node::NumTrackerSlots)
+    node->TrackerSlots_[slot_] = index + 1;
+  else
+    slot_map_[node] = index;
 
-  nodestates_[node] = std::make_unique<jlm::rvsdg::tracker_nodestate>(node);
-  return nodestates_[node].get();
+  return index;
 }
 
 }
@@ -10,7 +10,10 @@
 #include <stdbool.h>
 #include <stddef.h>
 
+#include <cstdint>
+#include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include <jlm/util/callbacks.hpp>
 
@@ -23,14 +26,56 @@ class graph;
 class node;
 class region;
 class tracker_depth_state;
-class tracker_nodestate;
 
 bool
 has_active_trackers(const jlm::rvsdg::graph * graph);
 
+/**
+ * State of a single node within a tracker. The states of all nodes known to a tracker are kept
+ * in a flat array and referenced by their index. The nodes of the same tracked state and depth are
+ * linked into an intrusive list through the indices of their predecessor and successor.
+ */
+class tracker_nodestate
+{
+public:
+  static constexpr uint32_t none = (uint32_t)-1;
+
+  inline explicit tracker_nodestate(jlm::rvsdg::node * node)
+      : node_(node),
+        state_(tracker_nodestate_none),
+        previous_(none),
+        next_(none)
+  {}
+
+  inline jlm::rvsdg::node *
+  node() const noexcept
+  {
+    return node_;
+  }
+
+  inline size_t
+  state() const noexcept
+  {
+    return state_;
+  }
+
+private:
+  friend struct tracker;
+  friend class tracker_depth_state;
+
+  jlm::rvsdg::node * node_;
+  size_t state_;
+  uint32_t previous_;
+  uint32_t next_;
+};
+
 /* Track states of nodes within the graph. Each node can logically be in
  * one of the numbered states, plus another "initial" state. All nodes are
- * at the beginning assumed to be implicitly in this "initial" state. */
+ * at the beginning assumed to be implicitly in this "initial" state.
+ *
+ * Every tracker claims one of the node::NumTrackerSlots slots of the nodes, in which it stores
+ * the index of a node's state in its state array. Node states are therefore found without a
+ * lookup. Trackers that find all slots taken fall back to a hash map. */
 struct tracker
 {
 public:
@@ -38,6 +83,11 @@ public:
 
   tracker(jlm::rvsdg::graph * graph, size_t nstates);
 
+  tracker(const tracker &) = delete;
+
+  tracker &
+  operator=(const tracker &) = delete;
+
   /* get state of the node */
   ssize_t
   get_nodestate(jlm::rvsdg::node * node);
@@ -61,7 +111,17 @@ public:
   }
 
 private:
-  jlm::rvsdg::tracker_nodestate *
+  /**
+   * @return The index of the state of \p node, or tracker_nodestate::none if the node has no
+   * state yet.
+   */
+  [[nodiscard]] uint32_t
+  find_nodestate(const jlm::rvsdg::node * node) const noexcept;
+
+  /**
+   * @return The index of the state of \p node. A state is created if the node has none yet.
+   */
+  uint32_t
   nodestate(jlm::rvsdg::node * node);
 
   void
@@ -77,45 +137,15 @@ private:
 
   jlm::util::callback depth_callback_, destroy_callback_;
 
-  std::unordered_map<jlm::rvsdg::node *, std::unique_ptr<jlm::rvsdg::tracker_nodestate>>
-      nodestates_;
-};
+  // The slot of the nodes used by this tracker, or node::NumTrackerSlots if it uses slot_map_.
+  size_t slot_;
 
-class tracker_nodestate
-{
-  friend tracker;
-
-public:
-  inline tracker_nodestate(jlm::rvsdg::node * node)
-      : state_(tracker_nodestate_none),
-        node_(node)
-  {}
+  std::unordered_map<const jlm::rvsdg::node *, uint32_t> slot_map_;
 
-  tracker_nodestate(const tracker_nodestate &) = delete;
+  mutable std::vector<tracker_nodestate> nodestates_;
 
-  tracker_nodestate(tracker_nodestate &&) = delete;
-
-  tracker_nodestate &
-  operator=(const tracker_nodestate &) = delete;
-
-  tracker_nodestate &
-  operator=(tracker_nodestate &&) = delete;
-
-  inline jlm::rvsdg::node *
-  node() const noexcept
-  {
-    return node_;
-  }
-
-  inline size_t
-  state() const noexcept
-  {
-    return state_;
-  }
-
-private:
-  size_t state_;
-  jlm::rvsdg::node * node_;
+  // Indices of nodestates_ that belonged to destroyed nodes and can be reused
+  std::vector<uint32_t> free_nodestates_;
 };
 
 }
@@ -6,12 +6,126 @@
 
 #include <jlm/rvsdg/type.hpp>
 
+#include <mutex>
+#include <typeinfo>
+#include <unordered_map>
+
 namespace jlm::rvsdg
 {
 
+namespace
+{
+
+/**
+ * The table of the canonical type instances. It is split into independently locked shards to
+ * reduce the contention between threads.
+ */
+class InterningTable final
+{
+  struct Shard
+  {
+    std::mutex Mutex;
+    std::unordered_multimap<std::size_t, std::unique_ptr<type>> Types;
+  };
+
+public:
+  /**
+   * Returns the canonical instance of \p type with hash value \p hash, or nullptr if there is
+   * none yet.
+   */
+  const type *
+  Find(const type & type, std::size_t hash)
+  {
+    auto & shard = GetShard(hash);
+    std::lock_guard lock(shard.Mutex);
+    return Find(shard, type, hash);
+  }
+
+  /**
+   * Inserts \p type with hash value \p hash unless an equal type was inserted concurrently.
+   *
+   * @return The canonical instance of \p type.
+   */
+  const type &
+  Insert(std::unique_ptr<type> type, std::size_t hash)
+  {
+    auto & shard = GetShard(hash);
+    std::lock_guard lock(shard.Mutex);
+    if (auto canonicalType = Find(shard, *type, hash))
+      return *canonicalType;
+
+    return *shard.Types.emplace(hash, std::move(type))->second;
+  }
+
+private:
+  static const jlm::rvsdg::type *
+  Find(const Shard & shard, const jlm::rvsdg::type & type, std::size_t hash)
+  {
+    auto [begin, end] = shard.Types.equal_range(hash);
+    for (auto it = begin; it != end; it++)
+    {
+      if (*it->second == type)
+        return it->second.get();
+    }
+
+    return nullptr;
+  }
+
+  Shard &
+  GetShard(std::size_t hash) noexcept
+  {
+    return Shards_[hash % NumShards];
+  }
+
+  static constexpr std::size_t NumShards = 16;
+  Shard Shards_[NumShards];
+};
+
+/**
+ * The table is never destroyed, such that canonical types remain valid during the destruction of
+ * static objects.
+ */
+InterningTable &
+GetInterningTable()
+{
+  static auto table = new InterningTable();
+  return *table;
+}
+
+}
+
 type::~type() noexcept
 {}
 
+std::size_t
+type::hash() const noexcept
+{
+  return typeid(*this).hash_code();
+}
+
+std::unique_ptr<type>
+type::CreateCanonicalCopy() const
+{
+  return copy();
+}
+
+const type &
+type::Intern() const
+{
+  if (IsInterned())
+    return *this;
+
+  auto & table = GetInterningTable();
+  auto hash = this->hash();
+  if (auto canonicalType = table.Find(*this, hash))
+    return *canonicalType;
+
+  // The copy is created outside of the table's locks, as copying a type can intern other types
+  auto canonicalType = CreateCanonicalCopy();
+  canonicalType->IsInterned_ = true;
+  return table.Insert(std::move(canonicalType), hash);
+}
+
 valuetype::~valuetype() noexcept
 {}
 
@@ -20,8 +20,22 @@ public:
 
 protected:
   inline constexpr type() noexcept
+      : IsInterned_(false)
   {}
 
+  /**
+   * Copies are never interned, as only the instance in the interning table is canonical.
+   */
+  inline constexpr type(const type &) noexcept
+      : IsInterned_(false)
+  {}
+
+  type &
+  operator=(const type &) noexcept
+  {
+    return *this;
+  }
+
 public:
   virtual bool
   operator==(const jlm::rvsdg::type & other) const noexcept = 0;
@@ -37,6 +51,40 @@ public:
 
   virtual std::string
   debug_string() const = 0;
+
+  /**
+   * Computes a hash value of the type. Types that are equal must have the same hash value.
+   */
+  [[nodiscard]] virtual std::size_t
+  hash() const noexcept;
+
+  /**
+   * Returns the canonical instance of all types that are equal to this type. The canonical
+   * instance is immutable and lives until the end of the program, such that two interned types
+   * are equal if and only if they are the same object.
+   *
+   * This method is thread-safe.
+   */
+  [[nodiscard]] const type &
+  Intern() const;
+
+  [[nodiscard]] bool
+  IsInterned() const noexcept
+  {
+    return IsInterned_;
+  }
+
+protected:
+  /**
+   * Creates the copy of the type that becomes its canonical instance in Intern(). The canonical
+   * instance is never freed and must therefore not refer to objects with a shorter lifetime. Types
+   * that refer to such objects override this method to copy them.
+   */
+  [[nodiscard]] virtual std::unique_ptr<type>
+  CreateCanonicalCopy() const;
+
+private:
+  bool IsInterned_;
 };
 
 class valuetype : public jlm::rvsdg::type
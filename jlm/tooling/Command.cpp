@@ -9,19 +9,34 @@
 #include <jlm/llvm/frontend/LlvmModuleConversion.hpp>
 #include <jlm/llvm/ir/ipgraph-module.hpp>
 #include <jlm/llvm/ir/RvsdgModule.hpp>
+#include <jlm/llvm/ir/RvsdgSerialization.hpp>
 #include <jlm/llvm/opt/OptimizationSequence.hpp>
 #include <jlm/rvsdg/view.hpp>
 #include <jlm/tooling/Command.hpp>
 #include <jlm/tooling/CommandPaths.hpp>
 
+// BitcodeWriter.h pulls in ModuleSummaryIndex.h, which trips -Wuninitialized with GCC 12
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#include <llvm/Bitcode/BitcodeWriter.h>
+#pragma GCC diagnostic pop
+#include <llvm/IR/LegacyPassManager.h>
 #include <llvm/IR/LLVMContext.h>
 #include <llvm/IR/Module.h>
 #include <llvm/IRReader/IRReader.h>
+#include <llvm/MC/TargetRegistry.h>
+#include <llvm/Support/Host.h>
+#include <llvm/Support/MemoryBufferRef.h>
 #include <llvm/Support/raw_os_ostream.h>
 #include <llvm/Support/SourceMgr.h>
+#include <llvm/Support/TargetSelect.h>
+#include <llvm/Target/TargetMachine.h>
+#include <llvm/Target/TargetOptions.h>
 
 #include <sys/stat.h>
+#include <unistd.h>
 
+#include <cstdio>
 #include <filesystem>
 #include <unordered_map>
 
@@ -30,6 +45,68 @@ namespace jlm::tooling
 
 Command::~Command() = default;
 
+pid_t
+Command::Start() const
+{
+  // Flush all buffers to avoid that their content is emitted by both processes
+  std::cout.flush();
+  std::cerr.flush();
+
+  auto pid = fork();
+  if (pid < 0)
+    throw util::error("fork failed: " + ToString());
+
+  if (pid == 0)
+  {
+    auto status = EXIT_SUCCESS;
+    try
+    {
+      Run();
+    }
+    catch (std::exception & e)
+    {
+      std::cerr << e.what() << "\n";
+      status = EXIT_FAILURE;
+    }
+
+    std::cout.flush();
+    std::cerr.flush();
+    _exit(status);
+  }
+
+  return pid;
+}
+
+ExternalCommand::~ExternalCommand() = default;
+
+void
+ExternalCommand::Run() const
+{
+  if (CommandGraph::WaitForProcess(Start()) != EXIT_SUCCESS)
+    exit(EXIT_FAILURE);
+}
+
+pid_t
+ExternalCommand::Start() const
+{
+  auto commandLine = ToString();
+
+  std::cout.flush();
+  std::cerr.flush();
+
+  auto pid = fork();
+  if (pid < 0)
+    throw util::error("fork failed: " + commandLine);
+
+  if (pid == 0)
+  {
+    execl("/bin/sh", "sh", "-c", commandLine.c_str(), static_cast<char *>(nullptr));
+    _exit(127);
+  }
+
+  return pid;
+}
+
 PrintCommandsCommand::~PrintCommandsCommand() = default;
 
 std::string
@@ -41,19 +118,40 @@ PrintCommandsCommand::ToString() const
 void
 PrintCommandsCommand::Run() const
 {
+  if (NumJobs_.has_value())
+    CommandGraph_->Run(*NumJobs_);
+
   for (auto & node : CommandGraph::SortNodesTopological(*CommandGraph_))
   {
-    if (node != &CommandGraph_->GetEntryNode() && node != &CommandGraph_->GetExitNode())
-      std::cout << node->GetCommand().ToString() << "\n";
+    if (node == &CommandGraph_->GetEntryNode() || node == &CommandGraph_->GetExitNode())
+      continue;
+
+    if (NumJobs_.has_value())
+      std::cout << "[" << node->GetWallTime() / 1000000 << " ms] ";
+
+    std::cout << node->GetCommand().ToString() << "\n";
   }
 }
 
 std::unique_ptr<CommandGraph>
 PrintCommandsCommand::Create(std::unique_ptr<CommandGraph> commandGraph)
+{
+  return Create(std::make_unique<PrintCommandsCommand>(std::move(commandGraph)));
+}
+
+std::unique_ptr<CommandGraph>
+PrintCommandsCommand::CreateWithWallTimes(
+    std::unique_ptr<CommandGraph> commandGraph,
+    size_t numJobs)
+{
+  return Create(std::make_unique<PrintCommandsCommand>(std::move(commandGraph), numJobs));
+}
+
+std::unique_ptr<CommandGraph>
+PrintCommandsCommand::Create(std::unique_ptr<PrintCommandsCommand> command)
 {
   std::unique_ptr<CommandGraph> newCommandGraph(new CommandGraph());
-  auto & printCommandsNode =
-      PrintCommandsCommand::Create(*newCommandGraph, std::move(commandGraph));
+  auto & printCommandsNode = CommandGraph::Node::Create(*newCommandGraph, std::move(command));
   newCommandGraph->GetEntryNode().AddEdge(printCommandsNode);
   printCommandsNode.AddEdge(newCommandGraph->GetExitNode());
   return newCommandGraph;
@@ -154,7 +252,7 @@ ClangCommand::ToString() const
         " ",
         includePaths,
         " ",
-        "-S -emit-llvm ",
+        EmitBitcode_ ? "-c -emit-llvm " : "-S -emit-llvm ",
         clangArguments,
         "-o ",
         OutputFile_.to_str(),
@@ -205,13 +303,6 @@ ClangCommand::ReplaceAll(std::string str, const std::string & from, const std::s
   return str;
 }
 
-void
-ClangCommand::Run() const
-{
-  if (system(ToString().c_str()))
-    exit(EXIT_FAILURE);
-}
-
 LlcCommand::~LlcCommand() = default;
 
 std::string
@@ -233,10 +324,52 @@ LlcCommand::ToString() const
 }
 
 void
-LlcCommand::Run() const
+LlcCommand::EmitObjectFile(::llvm::Module & llvmModule) const
 {
-  if (system(ToString().c_str()))
-    exit(EXIT_FAILURE);
+  ::llvm::InitializeNativeTarget();
+  ::llvm::InitializeNativeTargetAsmPrinter();
+
+  auto targetTriple = llvmModule.getTargetTriple();
+  if (targetTriple.empty())
+    targetTriple = ::llvm::sys::getDefaultTargetTriple();
+
+  std::string error;
+  auto target = ::llvm::TargetRegistry::lookupTarget(targetTriple, error);
+  if (!target)
+    throw util::error(error);
+
+  static std::unordered_map<OptimizationLevel, ::llvm::CodeGenOpt::Level> optimizationLevels(
+      { { OptimizationLevel::O0, ::llvm::CodeGenOpt::None },
+        { OptimizationLevel::O1, ::llvm::CodeGenOpt::Less },
+        { OptimizationLevel::O2, ::llvm::CodeGenOpt::Default },
+        { OptimizationLevel::O3, ::llvm::CodeGenOpt::Aggressive } });
+
+  static std::unordered_map<RelocationModel, ::llvm::Reloc::Model> relocationModels(
+      { { RelocationModel::Static, ::llvm::Reloc::Static },
+        { RelocationModel::Pic, ::llvm::Reloc::PIC_ } });
+
+  std::unique_ptr<::llvm::TargetMachine> targetMachine(target->createTargetMachine(
+      targetTriple,
+      "",
+      "",
+      ::llvm::TargetOptions(),
+      relocationModels[RelocationModel_],
+      {},
+      optimizationLevels[OptimizationLevel_]));
+
+  llvmModule.setTargetTriple(targetTriple);
+  llvmModule.setDataLayout(targetMachine->createDataLayout());
+
+  std::error_code errorCode;
+  ::llvm::raw_fd_ostream os(OutputFile_.to_str(), errorCode);
+  if (errorCode)
+    throw util::error("Cannot open " + OutputFile_.to_str() + ": " + errorCode.message());
+
+  ::llvm::legacy::PassManager passManager;
+  if (targetMachine->addPassesToEmitFile(passManager, os, nullptr, ::llvm::CGFT_ObjectFile))
+    throw util::error("Cannot emit object files for target " + targetTriple);
+
+  passManager.run(llvmModule);
 }
 
 std::string
@@ -279,6 +412,14 @@ JlmOptCommand::ToString() const
                                 CommandLineOptions_.GetOutputFormat()))
                             + " ";
 
+  auto inputFormatArgument =
+      CommandLineOptions_.GetInputFormat() != JlmOptCommandLineOptions::InputFormat::Llvm
+          ? "--input-format="
+                + std::string(JlmOptCommandLineOptions::ToCommandLineArgument(
+                    CommandLineOptions_.GetInputFormat()))
+                + " "
+          : "";
+
   auto outputFileArgument = !CommandLineOptions_.GetOutputFile().to_str().empty()
                               ? "-o " + CommandLineOptions_.GetOutputFile().to_str() + " "
                               : "";
@@ -295,10 +436,16 @@ JlmOptCommand::ToString() const
   std::string statisticsDirArgument =
       "-s " + CommandLineOptions_.GetStatisticsCollectorSettings().GetFilePath().path() + " ";
 
+  auto numThreadsArgument = CommandLineOptions_.GetNumThreads() > 1
+                              ? "-j " + std::to_string(CommandLineOptions_.GetNumThreads()) + " "
+                              : "";
+
   return util::strfmt(
       ProgramName_ + " ",
+      inputFormatArgument,
       outputFormatArgument,
       optimizationArguments,
+      numThreadsArgument,
       statisticsDirArgument,
       statisticsArguments,
       outputFileArgument,
@@ -308,9 +455,55 @@ JlmOptCommand::ToString() const
 void
 JlmOptCommand::Run() const
 {
-  ::llvm::LLVMContext llvmContext;
-  auto llvmModule = ParseLlvmIrFile(CommandLineOptions_.GetInputFile(), llvmContext);
+  jlm::util::StatisticsCollector statisticsCollector(
+      CommandLineOptions_.GetStatisticsCollectorSettings());
+
+  std::unique_ptr<llvm::RvsdgModule> rvsdgModule;
+  if (CommandLineOptions_.GetInputFormat() == JlmOptCommandLineOptions::InputFormat::Rvsdg)
+  {
+    rvsdgModule = llvm::ReadRvsdgModuleFile(CommandLineOptions_.GetInputFile());
+    OptimizeRvsdgModule(*rvsdgModule, statisticsCollector);
+  }
+  else
+  {
+    ::llvm::LLVMContext llvmContext;
+    auto llvmModule = ParseLlvmIrFile(CommandLineOptions_.GetInputFile(), llvmContext);
+    rvsdgModule = CreateOptimizedRvsdgModule(std::move(llvmModule), statisticsCollector);
+  }
+
+  PrintRvsdgModule(
+      *rvsdgModule,
+      CommandLineOptions_.GetOutputFile(),
+      CommandLineOptions_.GetOutputFormat(),
+      statisticsCollector);
+
+  statisticsCollector.PrintStatistics();
+}
+
+std::unique_ptr<::llvm::Module>
+JlmOptCommand::OptimizeLlvmModule(
+    std::unique_ptr<::llvm::Module> llvmModule,
+    ::llvm::LLVMContext & llvmContext) const
+{
+  jlm::util::StatisticsCollector statisticsCollector(
+      CommandLineOptions_.GetStatisticsCollectorSettings());
+
+  auto rvsdgModule = CreateOptimizedRvsdgModule(std::move(llvmModule), statisticsCollector);
+  auto interProceduralGraphModule = llvm::rvsdg2jlm::rvsdg2jlm(*rvsdgModule, statisticsCollector);
+  rvsdgModule.reset();
+
+  auto optimizedLlvmModule = llvm::jlm2llvm::convert(*interProceduralGraphModule, llvmContext);
 
+  statisticsCollector.PrintStatistics();
+
+  return optimizedLlvmModule;
+}
+
+std::unique_ptr<llvm::RvsdgModule>
+JlmOptCommand::CreateOptimizedRvsdgModule(
+    std::unique_ptr<::llvm::Module> llvmModule,
+    util::StatisticsCollector & statisticsCollector) const
+{
   auto interProceduralGraphModule = llvm::ConvertLlvmModule(*llvmModule);
 
   /*
@@ -318,24 +511,24 @@ JlmOptCommand::Run() const
    */
   llvmModule.reset();
 
-  jlm::util::StatisticsCollector statisticsCollector(
-      CommandLineOptions_.GetStatisticsCollectorSettings());
-
   auto rvsdgModule =
       llvm::ConvertInterProceduralGraphModule(*interProceduralGraphModule, statisticsCollector);
 
-  llvm::OptimizationSequence::CreateAndRun(
-      *rvsdgModule,
-      statisticsCollector,
-      CommandLineOptions_.GetOptimizations());
+  OptimizeRvsdgModule(*rvsdgModule, statisticsCollector);
 
-  PrintRvsdgModule(
-      *rvsdgModule,
-      CommandLineOptions_.GetOutputFile(),
-      CommandLineOptions_.GetOutputFormat(),
-      statisticsCollector);
+  return rvsdgModule;
+}
 
-  statisticsCollector.PrintStatistics();
+void
+JlmOptCommand::OptimizeRvsdgModule(
+    llvm::RvsdgModule & rvsdgModule,
+    util::StatisticsCollector & statisticsCollector) const
+{
+  llvm::OptimizationSequence::CreateAndRun(
+      rvsdgModule,
+      statisticsCollector,
+      CommandLineOptions_.GetOptimizations(),
+      CommandLineOptions_.GetNumThreads());
 }
 
 std::unique_ptr<::llvm::Module>
@@ -365,7 +558,9 @@ JlmOptCommand::PrintRvsdgModule(
                        const util::filepath & outputFile,
                        util::StatisticsCollector &)
   {
-    auto fd = outputFile == "" ? stdout : fopen(outputFile.to_str().c_str(), "w");
+    auto fd = IsStandardOutput(outputFile) ? stdout : fopen(outputFile.to_str().c_str(), "w");
+    if (fd == nullptr)
+      throw util::error("Cannot open " + outputFile.to_str());
 
     jlm::rvsdg::view_xml(rvsdgModule.Rvsdg().root(), fd);
 
@@ -382,17 +577,31 @@ JlmOptCommand::PrintRvsdgModule(
     ::llvm::LLVMContext ctx;
     auto llvm_module = jlm::llvm::jlm2llvm::convert(*jlm_module, ctx);
 
-    if (outputFile == "")
-    {
-      ::llvm::raw_os_ostream os(std::cout);
-      llvm_module->print(os, nullptr);
-    }
-    else
-    {
-      std::error_code ec;
-      ::llvm::raw_fd_ostream os(outputFile.to_str(), ec);
-      llvm_module->print(os, nullptr);
-    }
+    auto os = CreateOutputStream(outputFile);
+    llvm_module->print(*os, nullptr);
+  };
+
+  auto printAsBitcode = [](const llvm::RvsdgModule & rvsdgModule,
+                           const util::filepath & outputFile,
+                           util::StatisticsCollector & statisticsCollector)
+  {
+    auto jlm_module = llvm::rvsdg2jlm::rvsdg2jlm(rvsdgModule, statisticsCollector);
+
+    ::llvm::LLVMContext ctx;
+    auto llvm_module = jlm::llvm::jlm2llvm::convert(*jlm_module, ctx);
+
+    auto os = CreateOutputStream(outputFile);
+    ::llvm::WriteBitcodeToFile(*llvm_module, *os);
+  };
+
+  auto printAsRvsdg = [](const llvm::RvsdgModule & rvsdgModule,
+                         const util::filepath & outputFile,
+                         util::StatisticsCollector &)
+  {
+    auto bytes = llvm::SerializeRvsdgModule(rvsdgModule);
+
+    auto os = CreateOutputStream(outputFile);
+    os->write(reinterpret_cast<const char *>(bytes.data()), bytes.size());
   };
 
   static std::unordered_map<
@@ -400,12 +609,155 @@ JlmOptCommand::PrintRvsdgModule(
       std::function<
           void(const llvm::RvsdgModule &, const util::filepath &, util::StatisticsCollector &)>>
       printers({ { tooling::JlmOptCommandLineOptions::OutputFormat::Xml, printAsXml },
-                 { tooling::JlmOptCommandLineOptions::OutputFormat::Llvm, printAsLlvm } });
+                 { tooling::JlmOptCommandLineOptions::OutputFormat::Llvm, printAsLlvm },
+                 { tooling::JlmOptCommandLineOptions::OutputFormat::Bitcode, printAsBitcode },
+                 { tooling::JlmOptCommandLineOptions::OutputFormat::Rvsdg, printAsRvsdg } });
 
   JLM_ASSERT(printers.find(outputFormat) != printers.end());
   printers[outputFormat](rvsdgModule, outputFile, statisticsCollector);
 }
 
+bool
+JlmOptCommand::IsStandardOutput(const util::filepath & outputFile)
+{
+  return outputFile == "" || outputFile == "-";
+}
+
+std::unique_ptr<::llvm::raw_fd_ostream>
+JlmOptCommand::CreateOutputStream(const util::filepath & outputFile)
+{
+  if (IsStandardOutput(outputFile))
+  {
+    std::cout.flush();
+    return std::make_unique<::llvm::raw_fd_ostream>(STDOUT_FILENO, false);
+  }
+
+  std::error_code errorCode;
+  auto os = std::make_unique<::llvm::raw_fd_ostream>(outputFile.to_str(), errorCode);
+  if (errorCode)
+    throw util::error("Cannot open " + outputFile.to_str() + ": " + errorCode.message());
+
+  return os;
+}
+
+InMemoryCompilationCommand::~InMemoryCompilationCommand() noexcept = default;
+
+std::string
+InMemoryCompilationCommand::ToString() const
+{
+  return util::strfmt(
+      ClangCommand_->ToString(),
+      " | ",
+      JlmOptCommand_->ToString(),
+      " | ",
+      LlcCommand_->ToString());
+}
+
+void
+InMemoryCompilationCommand::Run() const
+{
+  ::llvm::LLVMContext llvmContext;
+  auto llvmModule = ReadClangOutput(llvmContext);
+  auto optimizedLlvmModule = JlmOptCommand_->OptimizeLlvmModule(std::move(llvmModule), llvmContext);
+  LlcCommand_->EmitObjectFile(*optimizedLlvmModule);
+}
+
+std::unique_ptr<::llvm::Module>
+InMemoryCompilationCommand::ReadClangOutput(::llvm::LLVMContext & llvmContext) const
+{
+  auto commandLine = ClangCommand_->ToString();
+  auto pipe = popen(commandLine.c_str(), "r");
+  if (!pipe)
+    throw util::error("popen failed: " + commandLine);
+
+  std::string bitcode;
+  char buffer[1 << 16];
+  size_t numBytes = 0;
+  while ((numBytes = fread(buffer, 1, sizeof(buffer), pipe)) > 0)
+    bitcode.append(buffer, numBytes);
+
+  if (pclose(pipe) != 0)
+    throw util::error("Command failed: " + commandLine);
+
+  ::llvm::SMDiagnostic diagnostic;
+  ::llvm::MemoryBufferRef memoryBuffer(bitcode, "clang");
+  if (auto llvmModule = ::llvm::parseIR(memoryBuffer, diagnostic, llvmContext))
+    return llvmModule;
+
+  std::string errors;
+  ::llvm::raw_string_ostream os(errors);
+  diagnostic.print("clang", os);
+  throw util::error(errors);
+}
+
+CachedCommand::~CachedCommand() noexcept = default;
+
+std::string
+CachedCommand::ToString() const
+{
+  return Command_->ToString();
+}
+
+void
+CachedCommand::Run() const
+{
+  auto key = CompilationCache_->ComputeKey(CreateKeyCommandLine(), InputFile_, Tools_);
+  if (CompilationCache_->Retrieve(key, OutputFile_))
+    return;
+
+  Command_->Run();
+  CompilationCache_->Store(key, OutputFile_);
+}
+
+std::string
+CachedCommand::CreateKeyCommandLine() const
+{
+  auto replaceAll = [](std::string & string, const std::string & from, const std::string & to)
+  {
+    if (from.empty())
+      return;
+
+    for (auto pos = string.find(from); pos != std::string::npos;
+         pos = string.find(from, pos + to.size()))
+      string.replace(pos, from.size(), to);
+  };
+
+  auto commandLine = Command_->ToString();
+  auto inputFile = InputFile_.to_str();
+  auto outputFile = OutputFile_.to_str();
+
+  // Replace the longer path first, as it might contain the shorter one
+  if (inputFile.size() >= outputFile.size())
+  {
+    replaceAll(commandLine, inputFile, "<input>");
+    replaceAll(commandLine, outputFile, "<output>");
+  }
+  else
+  {
+    replaceAll(commandLine, outputFile, "<output>");
+    replaceAll(commandLine, inputFile, "<input>");
+  }
+
+  return commandLine;
+}
+
+PrintCompilationCacheStatisticsCommand::~PrintCompilationCacheStatisticsCommand() noexcept =
+    default;
+
+std::string
+PrintCompilationCacheStatisticsCommand::ToString() const
+{
+  return "PrintCompilationCacheStatistics";
+}
+
+void
+PrintCompilationCacheStatisticsCommand::Run() const
+{
+  std::cerr << "Compilation cache " << CompilationCache_->GetDirectory().to_str() << ": "
+            << CompilationCache_->NumHits() << " hits, " << CompilationCache_->NumMisses()
+            << " misses\n";
+}
+
 MkdirCommand::~MkdirCommand() noexcept = default;
 
 std::string
@@ -455,13 +807,6 @@ LlvmOptCommand::ToString() const
       InputFile_.to_str());
 }
 
-void
-LlvmOptCommand::Run() const
-{
-  if (system(ToString().c_str()))
-    exit(EXIT_FAILURE);
-}
-
 std::string
 LlvmOptCommand::ToString(const Optimization & optimization)
 {
@@ -493,13 +838,6 @@ LlvmLinkCommand::ToString() const
       inputFilesArgument);
 }
 
-void
-LlvmLinkCommand::Run() const
-{
-  if (system(ToString().c_str()))
-    exit(EXIT_FAILURE);
-}
-
 JlmHlsCommand::~JlmHlsCommand() noexcept = default;
 
 std::string
@@ -514,13 +852,6 @@ JlmHlsCommand::ToString() const
       InputFile_.to_str());
 }
 
-void
-JlmHlsCommand::Run() const
-{
-  if (system(ToString().c_str()))
-    exit(EXIT_FAILURE);
-}
-
 JlmHlsExtractCommand::~JlmHlsExtractCommand() noexcept = default;
 
 std::string
@@ -538,13 +869,6 @@ JlmHlsExtractCommand::ToString() const
       InputFile().to_str());
 }
 
-void
-JlmHlsExtractCommand::Run() const
-{
-  if (system(ToString().c_str()))
-    exit(EXIT_FAILURE);
-}
-
 FirtoolCommand::~FirtoolCommand() noexcept = default;
 
 std::string
@@ -559,13 +883,6 @@ FirtoolCommand::ToString() const
       OutputFile().to_str());
 }
 
-void
-FirtoolCommand::Run() const
-{
-  if (system(ToString().c_str()))
-    exit(EXIT_FAILURE);
-}
-
 VerilatorCommand::~VerilatorCommand() noexcept = default;
 
 std::string
@@ -628,11 +945,4 @@ VerilatorCommand::ToString() const
       objectFiles);
 }
 
-void
-VerilatorCommand::Run() const
-{
-  if (system(ToString().c_str()))
-    exit(EXIT_FAILURE);
-}
-
 }
@@ -8,12 +8,18 @@
 
 #include <jlm/tooling/CommandGraph.hpp>
 #include <jlm/tooling/CommandLine.hpp>
+#include <jlm/tooling/CompilationCache.hpp>
 #include <jlm/util/file.hpp>
 
 #include <llvm/IR/Module.h>
+#include <llvm/Support/raw_ostream.h>
+
+#include <sys/types.h>
 
 #include <memory>
+#include <optional>
 #include <string>
+#include <vector>
 
 namespace jlm::tooling
 {
@@ -33,10 +39,48 @@ public:
 
   virtual void
   Run() const = 0;
+
+  /**
+   * \brief Starts the command in a child process
+   *
+   * The default implementation forks the current process and invokes Run() in the child. The
+   * child terminates with EXIT_FAILURE if Run() throws.
+   *
+   * @return The process id of the child process.
+   */
+  [[nodiscard]] virtual pid_t
+  Start() const;
+};
+
+/**
+ * The ExternalCommand class represents commands that execute an external tool. The command line
+ * of the tool is given by ToString() and is interpreted by /bin/sh.
+ */
+class ExternalCommand : public Command
+{
+public:
+  ~ExternalCommand() override;
+
+  /**
+   * Executes the command line and waits for its termination. The current process exits with
+   * EXIT_FAILURE if the command line fails.
+   */
+  void
+  Run() const override;
+
+  /**
+   * Executes the command line in a child process without waiting for its termination.
+   *
+   * @return The process id of the child process.
+   */
+  [[nodiscard]] pid_t
+  Start() const override;
 };
 
 /**
  * The PrintCommandsCommand class prints the commands of a command graph in topological order.
+ * Optionally, it first executes the command graph and prints every command along with its wall
+ * time.
  */
 class PrintCommandsCommand final : public Command
 {
@@ -47,6 +91,11 @@ public:
       : CommandGraph_(std::move(commandGraph))
   {}
 
+  PrintCommandsCommand(std::unique_ptr<CommandGraph> commandGraph, size_t numJobs)
+      : CommandGraph_(std::move(commandGraph)),
+        NumJobs_(numJobs)
+  {}
+
   PrintCommandsCommand(const PrintCommandsCommand &) = delete;
 
   PrintCommandsCommand(PrintCommandsCommand &&) = delete;
@@ -66,21 +115,25 @@ public:
   static std::unique_ptr<CommandGraph>
   Create(std::unique_ptr<CommandGraph> commandGraph);
 
+  /**
+   * Creates a command graph that executes \p commandGraph with \p numJobs jobs, and afterwards
+   * prints its commands along with their wall times.
+   */
+  static std::unique_ptr<CommandGraph>
+  CreateWithWallTimes(std::unique_ptr<CommandGraph> commandGraph, size_t numJobs);
+
 private:
-  static CommandGraph::Node &
-  Create(CommandGraph & commandGraph, std::unique_ptr<CommandGraph> printedCommandGraph)
-  {
-    auto command = std::make_unique<PrintCommandsCommand>(std::move(printedCommandGraph));
-    return CommandGraph::Node::Create(commandGraph, std::move(command));
-  }
+  static std::unique_ptr<CommandGraph>
+  Create(std::unique_ptr<PrintCommandsCommand> command);
 
   std::unique_ptr<CommandGraph> CommandGraph_;
+  std::optional<size_t> NumJobs_;
 };
 
 /**
  * The ClangCommand class represents the clang command line tool.
  */
-class ClangCommand final : public Command
+class ClangCommand final : public ExternalCommand
 {
 public:
   enum class LanguageStandard
@@ -121,6 +174,7 @@ public:
         Suppress_(false),
         Md_(false),
         LanguageStandard_(LanguageStandard::Unspecified),
+        EmitBitcode_(false),
         LinkerCommand_(true)
   {}
 
@@ -139,7 +193,8 @@ public:
       bool mD,
       std::string mT,
       const LanguageStandard & languageStandard,
-      std::vector<ClangArgument> clangArguments)
+      std::vector<ClangArgument> clangArguments,
+      bool emitBitcode = false)
       : InputFiles_({ inputFile }),
         OutputFile_(std::move(outputFile)),
         DependencyFile_(std::move(dependencyFile)),
@@ -155,15 +210,13 @@ public:
         Mt_(std::move(mT)),
         LanguageStandard_(languageStandard),
         ClangArguments_(std::move(clangArguments)),
+        EmitBitcode_(emitBitcode),
         LinkerCommand_(false)
   {}
 
   [[nodiscard]] std::string
   ToString() const override;
 
-  void
-  Run() const override;
-
   [[nodiscard]] const util::filepath &
   OutputFile() const noexcept
   {
@@ -259,13 +312,14 @@ private:
   LanguageStandard LanguageStandard_;
   std::vector<ClangArgument> ClangArguments_;
 
+  bool EmitBitcode_;
   bool LinkerCommand_;
 };
 
 /**
  * The LlcCommand class represents the llc command line tool.
  */
-class LlcCommand final : public Command
+class LlcCommand final : public ExternalCommand
 {
 public:
   enum class OptimizationLevel
@@ -298,15 +352,22 @@ public:
   [[nodiscard]] std::string
   ToString() const override;
 
-  void
-  Run() const override;
-
   [[nodiscard]] const util::filepath &
   OutputFile() const noexcept
   {
     return OutputFile_;
   }
 
+  /**
+   * Generates the object file for \p llvmModule within the current process. This is equivalent
+   * to running the command with \p llvmModule as input, but avoids printing and re-parsing the
+   * module.
+   *
+   * @param llvmModule The module that is compiled to OutputFile().
+   */
+  void
+  EmitObjectFile(::llvm::Module & llvmModule) const;
+
   static CommandGraph::Node &
   Create(
       CommandGraph & commandGraph,
@@ -369,10 +430,36 @@ public:
     return CommandLineOptions_;
   }
 
+  /**
+   * Applies the optimizations of the command to \p llvmModule within the current process. The
+   * input and output file of the command line options are ignored.
+   *
+   * @param llvmModule The module that is optimized. It is disposed of as soon as it was converted.
+   * @param llvmContext The context in which the optimized module is created.
+   * @return The optimized module.
+   */
+  [[nodiscard]] std::unique_ptr<::llvm::Module>
+  OptimizeLlvmModule(std::unique_ptr<::llvm::Module> llvmModule, ::llvm::LLVMContext & llvmContext)
+      const;
+
 private:
+  /**
+   * Parses \p llvmIrFile, which can either contain textual LLVM IR or LLVM bitcode. The format is
+   * detected from the file content. The standard input is read if \p llvmIrFile is '-'.
+   */
   std::unique_ptr<::llvm::Module>
   ParseLlvmIrFile(const util::filepath & llvmIrFile, ::llvm::LLVMContext & llvmContext) const;
 
+  std::unique_ptr<llvm::RvsdgModule>
+  CreateOptimizedRvsdgModule(
+      std::unique_ptr<::llvm::Module> llvmModule,
+      util::StatisticsCollector & statisticsCollector) const;
+
+  void
+  OptimizeRvsdgModule(
+      llvm::RvsdgModule & rvsdgModule,
+      util::StatisticsCollector & statisticsCollector) const;
+
   static void
   PrintRvsdgModule(
       const llvm::RvsdgModule & rvsdgModule,
@@ -380,10 +467,189 @@ private:
       const JlmOptCommandLineOptions::OutputFormat & outputFormat,
       util::StatisticsCollector & statisticsCollector);
 
+  [[nodiscard]] static bool
+  IsStandardOutput(const util::filepath & outputFile);
+
+  /**
+   * Creates a stream that writes directly to the file descriptor of \p outputFile, or of the
+   * standard output if IsStandardOutput() holds. This permits to stream the output through pipes.
+   */
+  static std::unique_ptr<::llvm::raw_fd_ostream>
+  CreateOutputStream(const util::filepath & outputFile);
+
   std::string ProgramName_;
   JlmOptCommandLineOptions CommandLineOptions_;
 };
 
+/**
+ * The InMemoryCompilationCommand class compiles a single source file to an object file without
+ * intermediate files. Clang emits LLVM bitcode into a pipe, from which the module is read, and
+ * the jlm-opt and llc stages are performed within the current process on the in-memory modules.
+ * The command is equivalent to the shell pipeline returned by ToString().
+ */
+class InMemoryCompilationCommand final : public Command
+{
+public:
+  ~InMemoryCompilationCommand() noexcept override;
+
+  /**
+   * @param clangCommand The parsing command. It must emit bitcode to the standard output.
+   * @param jlmOptCommand The jlm-opt command that is applied to the output of \p clangCommand.
+   * @param llcCommand The llc command that is applied to the output of \p jlmOptCommand.
+   */
+  InMemoryCompilationCommand(
+      std::unique_ptr<ClangCommand> clangCommand,
+      std::unique_ptr<JlmOptCommand> jlmOptCommand,
+      std::unique_ptr<LlcCommand> llcCommand)
+      : ClangCommand_(std::move(clangCommand)),
+        JlmOptCommand_(std::move(jlmOptCommand)),
+        LlcCommand_(std::move(llcCommand))
+  {}
+
+  [[nodiscard]] std::string
+  ToString() const override;
+
+  void
+  Run() const override;
+
+  [[nodiscard]] const util::filepath &
+  OutputFile() const noexcept
+  {
+    return LlcCommand_->OutputFile();
+  }
+
+  static CommandGraph::Node &
+  Create(
+      CommandGraph & commandGraph,
+      std::unique_ptr<ClangCommand> clangCommand,
+      std::unique_ptr<JlmOptCommand> jlmOptCommand,
+      std::unique_ptr<LlcCommand> llcCommand)
+  {
+    auto command = std::make_unique<InMemoryCompilationCommand>(
+        std::move(clangCommand),
+        std::move(jlmOptCommand),
+        std::move(llcCommand));
+    return CommandGraph::Node::Create(commandGraph, std::move(command));
+  }
+
+private:
+  std::unique_ptr<::llvm::Module>
+  ReadClangOutput(::llvm::LLVMContext & llvmContext) const;
+
+  std::unique_ptr<ClangCommand> ClangCommand_;
+  std::unique_ptr<JlmOptCommand> JlmOptCommand_;
+  std::unique_ptr<LlcCommand> LlcCommand_;
+};
+
+/**
+ * The CachedCommand class runs a command through a compilation cache. The output file of the
+ * command is retrieved from the cache if the cache contains an entry for the command's input file
+ * and command line, and the command is skipped. Otherwise, the command is run and its output file
+ * is stored in the cache.
+ *
+ * The key of the cache entry is derived from the command line of the command with the paths of
+ * the input and output file removed, as these are usually temporary files with unique names, and
+ * from the versions of the external tools that the command executes.
+ */
+class CachedCommand final : public Command
+{
+public:
+  ~CachedCommand() noexcept override;
+
+  /**
+   * @param command The cached command. It must only read \p inputFile and only write \p
+   * outputFile.
+   * @param compilationCache The cache in which the output file of \p command is stored.
+   * @param inputFile The input file of \p command.
+   * @param outputFile The output file of \p command.
+   * @param tools The external tools that are executed by \p command.
+   */
+  CachedCommand(
+      std::unique_ptr<Command> command,
+      std::shared_ptr<CompilationCache> compilationCache,
+      util::filepath inputFile,
+      util::filepath outputFile,
+      std::vector<util::filepath> tools)
+      : Command_(std::move(command)),
+        CompilationCache_(std::move(compilationCache)),
+        InputFile_(std::move(inputFile)),
+        OutputFile_(std::move(outputFile)),
+        Tools_(std::move(tools))
+  {}
+
+  [[nodiscard]] std::string
+  ToString() const override;
+
+  void
+  Run() const override;
+
+  [[nodiscard]] const Command &
+  GetCommand() const noexcept
+  {
+    return *Command_;
+  }
+
+  static CommandGraph::Node &
+  Create(
+      CommandGraph & commandGraph,
+      std::unique_ptr<Command> command,
+      std::shared_ptr<CompilationCache> compilationCache,
+      util::filepath inputFile,
+      util::filepath outputFile,
+      std::vector<util::filepath> tools)
+  {
+    auto cachedCommand = std::make_unique<CachedCommand>(
+        std::move(command),
+        std::move(compilationCache),
+        std::move(inputFile),
+        std::move(outputFile),
+        std::move(tools));
+    return CommandGraph::Node::Create(commandGraph, std::move(cachedCommand));
+  }
+
+private:
+  [[nodiscard]] std::string
+  CreateKeyCommandLine() const;
+
+  std::unique_ptr<Command> Command_;
+  std::shared_ptr<CompilationCache> CompilationCache_;
+  util::filepath InputFile_;
+  util::filepath OutputFile_;
+  std::vector<util::filepath> Tools_;
+};
+
+/**
+ * The PrintCompilationCacheStatisticsCommand class prints the number of cache hits and misses of
+ * a compilation cache to the standard error output.
+ */
+class PrintCompilationCacheStatisticsCommand final : public Command
+{
+public:
+  ~PrintCompilationCacheStatisticsCommand() noexcept override;
+
+  explicit PrintCompilationCacheStatisticsCommand(
+      std::shared_ptr<const CompilationCache> compilationCache)
+      : CompilationCache_(std::move(compilationCache))
+  {}
+
+  [[nodiscard]] std::string
+  ToString() const override;
+
+  void
+  Run() const override;
+
+  static CommandGraph::Node &
+  Create(CommandGraph & commandGraph, std::shared_ptr<const CompilationCache> compilationCache)
+  {
+    auto command =
+        std::make_unique<PrintCompilationCacheStatisticsCommand>(std::move(compilationCache));
+    return CommandGraph::Node::Create(commandGraph, std::move(command));
+  }
+
+private:
+  std::shared_ptr<const CompilationCache> CompilationCache_;
+};
+
 /**
  * The MkdirCommand class represents the mkdir command line tool.
  */
@@ -416,7 +682,7 @@ private:
 /**
  * The LlvmOptCommand class represents the LLVM opt command line tool.
  */
-class LlvmOptCommand final : public Command
+class LlvmOptCommand final : public ExternalCommand
 {
 public:
   enum class Optimization
@@ -446,9 +712,6 @@ public:
     return OutputFile_;
   }
 
-  void
-  Run() const override;
-
   static CommandGraph::Node &
   Create(
       CommandGraph & commandGraph,
@@ -477,7 +740,7 @@ private:
 /**
  * The LlvmLinkCommand class represents the llvm-link command line tool.
  */
-class LlvmLinkCommand final : public Command
+class LlvmLinkCommand final : public ExternalCommand
 {
 public:
   ~LlvmLinkCommand() noexcept override;
@@ -496,9 +759,6 @@ public:
   [[nodiscard]] std::string
   ToString() const override;
 
-  void
-  Run() const override;
-
   [[nodiscard]] const util::filepath &
   OutputFile() const noexcept
   {
@@ -535,7 +795,7 @@ private:
 /**
  * The JlmHlsCommand class represents the jlm-hls command line tool.
  */
-class JlmHlsCommand final : public Command
+class JlmHlsCommand final : public ExternalCommand
 {
 public:
   ~JlmHlsCommand() noexcept override;
@@ -549,9 +809,6 @@ public:
   [[nodiscard]] std::string
   ToString() const override;
 
-  void
-  Run() const override;
-
   [[nodiscard]] util::filepath
   FirrtlFile() const noexcept
   {
@@ -597,7 +854,7 @@ private:
  * The JlmHlsExtractCommand class represents the jlm-hls command line tool with the --extract
  * command line argument provided.
  */
-class JlmHlsExtractCommand final : public Command
+class JlmHlsExtractCommand final : public ExternalCommand
 {
 public:
   ~JlmHlsExtractCommand() noexcept override;
@@ -614,9 +871,6 @@ public:
   [[nodiscard]] std::string
   ToString() const override;
 
-  void
-  Run() const override;
-
   [[nodiscard]] util::filepath
   HlsFunctionFile() const noexcept
   {
@@ -663,7 +917,7 @@ private:
 /**
  * The FirtoolCommand class represents the firtool command line tool.
  */
-class FirtoolCommand final : public Command
+class FirtoolCommand final : public ExternalCommand
 {
 public:
   ~FirtoolCommand() noexcept override;
@@ -676,9 +930,6 @@ public:
   [[nodiscard]] std::string
   ToString() const override;
 
-  void
-  Run() const override;
-
   [[nodiscard]] const util::filepath &
   OutputFile() const noexcept
   {
@@ -709,7 +960,7 @@ private:
 /**
  * The VerilatorCommand class represents the verilator command line tool.
  */
-class VerilatorCommand final : public Command
+class VerilatorCommand final : public ExternalCommand
 {
 public:
   ~VerilatorCommand() noexcept override;
@@ -734,9 +985,6 @@ public:
   [[nodiscard]] std::string
   ToString() const override;
 
-  void
-  Run() const override;
-
   [[nodiscard]] const util::filepath &
   VerilogFile() const noexcept
   {
@@ -4,9 +4,14 @@
  */
 
 #include <jlm/tooling/Command.hpp>
+#include <jlm/util/time.hpp>
 
+#include <sys/wait.h>
+
+#include <cerrno>
 #include <deque>
 #include <functional>
+#include <unordered_map>
 
 namespace jlm::tooling
 {
@@ -80,17 +85,124 @@ CommandGraph::SortNodesTopological(const CommandGraph & commandGraph)
 }
 
 void
-CommandGraph::Run() const
+CommandGraph::Run(size_t numJobs) const
+{
+  JLM_ASSERT(numJobs > 0);
+
+  if (numJobs == 1)
+  {
+    for (auto & node : CommandGraph::SortNodesTopological(*this))
+    {
+      util::timer timer;
+      timer.start();
+      node->GetCommand().Run();
+      timer.stop();
+      node->SetWallTime(timer.ns());
+    }
+    return;
+  }
+
+  // A node becomes ready once all the nodes it depends on are finished
+  std::unordered_map<const Node *, size_t> numUnfinishedDependencies;
+  std::deque<Node *> readyNodes({ &GetEntryNode() });
+  std::unordered_map<pid_t, std::pair<Node *, util::timer>> runningNodes;
+  std::vector<const Node *> failedNodes;
+
+  auto finishNode = [&](Node & node)
+  {
+    for (auto & edge : node.OutgoingEdges())
+    {
+      auto & sink = edge.GetSink();
+      auto it = numUnfinishedDependencies.find(&sink);
+      if (it == numUnfinishedDependencies.end())
+        it = numUnfinishedDependencies.emplace(&sink, sink.NumIncomingEdges()).first;
+
+      if (--it->second == 0)
+        readyNodes.push_back(&sink);
+    }
+  };
+
+  while (!readyNodes.empty() || !runningNodes.empty())
+  {
+    // Stop starting new commands once a command failed, but wait for the running ones
+    while (failedNodes.empty() && !readyNodes.empty() && runningNodes.size() < numJobs)
+    {
+      auto node = readyNodes.front();
+      readyNodes.pop_front();
+
+      // The entry and exit nodes do not perform any work
+      if (node == &GetEntryNode() || node == &GetExitNode())
+      {
+        finishNode(*node);
+        continue;
+      }
+
+      util::timer timer;
+      timer.start();
+      auto pid = node->GetCommand().Start();
+      runningNodes.emplace(pid, std::make_pair(node, timer));
+    }
+
+    if (runningNodes.empty())
+    {
+      if (!failedNodes.empty())
+        break;
+
+      continue;
+    }
+
+    int status = 0;
+    auto pid = waitpid(-1, &status, 0);
+    if (pid < 0)
+    {
+      if (errno == EINTR)
+        continue;
+
+      throw util::error("waitpid failed.");
+    }
+
+    auto it = runningNodes.find(pid);
+    if (it == runningNodes.end())
+      continue;
+
+    auto node = it->second.first;
+    auto & timer = it->second.second;
+    timer.stop();
+    node->SetWallTime(timer.ns());
+    runningNodes.erase(it);
+
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != EXIT_SUCCESS)
+    {
+      failedNodes.push_back(node);
+      continue;
+    }
+
+    finishNode(*node);
+  }
+
+  if (!failedNodes.empty())
+    throw util::error("Command failed: " + failedNodes.front()->GetCommand().ToString());
+}
+
+int
+CommandGraph::WaitForProcess(pid_t pid)
 {
-  for (auto & node : CommandGraph::SortNodesTopological(*this))
-    node->GetCommand().Run();
+  int status = 0;
+  while (waitpid(pid, &status, 0) < 0)
+  {
+    if (errno != EINTR)
+      throw util::error("waitpid failed.");
+  }
+
+  return WIFEXITED(status) ? WEXITSTATUS(status) : EXIT_FAILURE;
 }
 
 CommandGraph::Node::~Node() = default;
 
 CommandGraph::Node::Node(const CommandGraph & commandGraph, std::unique_ptr<Command> command)
     : CommandGraph_(commandGraph),
-      Command_(std::move(command))
+      Command_(std::move(command)),
+      WallTime_(0)
 {}
 
 CommandGraph::Node::IncomingEdgeConstRange
@@ -9,6 +9,8 @@
 #include <jlm/util/common.hpp>
 #include <jlm/util/iterator_range.hpp>
 
+#include <sys/types.h>
+
 #include <memory>
 #include <unordered_set>
 #include <vector>
@@ -67,12 +69,32 @@ public:
     return *pointer;
   }
 
+  /**
+   * Executes all commands of the command graph. A command is only started after all the commands
+   * it depends on are finished. The wall time of every command is recorded in its node.
+   *
+   * With a single job, all commands are executed one after another in the current process.
+   * Otherwise, up to \p numJobs commands are executed concurrently in child processes (see
+   * Command::Start()).
+   *
+   * @param numJobs The maximal number of commands that are executed concurrently.
+   *
+   * \throws util::error if a command executed in a child process fails.
+   */
   void
-  Run() const;
+  Run(size_t numJobs = 1) const;
 
   static std::vector<CommandGraph::Node *>
   SortNodesTopological(const CommandGraph & commandGraph);
 
+  /**
+   * Waits for the termination of the child process \p pid.
+   *
+   * @return The exit status of the process, or EXIT_FAILURE if it did not exit normally.
+   */
+  static int
+  WaitForProcess(pid_t pid);
+
   static std::unique_ptr<CommandGraph>
   Create()
   {
@@ -173,6 +195,22 @@ public:
   OutgoingEdgeConstRange
   OutgoingEdges() const;
 
+  /**
+   * @return The wall time of the last execution of the node's command in nanoseconds, or zero if
+   * the command was never executed. See CommandGraph::Run().
+   */
+  [[nodiscard]] size_t
+  GetWallTime() const noexcept
+  {
+    return WallTime_;
+  }
+
+  void
+  SetWallTime(size_t wallTime) noexcept
+  {
+    WallTime_ = wallTime;
+  }
+
   void
   AddEdge(Node & sink)
   {
@@ -188,6 +226,7 @@ public:
 private:
   const CommandGraph & CommandGraph_;
   std::unique_ptr<Command> Command_;
+  size_t WallTime_;
   std::unordered_set<Edge *> IncomingEdges_;
   std::unordered_set<std::unique_ptr<Edge>> OutgoingEdges_;
 };
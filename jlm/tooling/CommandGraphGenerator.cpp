@@ -6,6 +6,7 @@
 #include <jlm/tooling/Command.hpp>
 #include <jlm/tooling/CommandGraph.hpp>
 #include <jlm/tooling/CommandGraphGenerator.hpp>
+#include <jlm/tooling/CommandPaths.hpp>
 #include <jlm/util/strfmt.hpp>
 
 #include <unordered_map>
@@ -83,8 +84,19 @@ JlcCommandGraphGenerator::CreateParserCommand(
     const JlcCommandLineOptions::Compilation & compilation,
     const JlcCommandLineOptions & commandLineOptions)
 {
-  return ClangCommand::CreateParsingCommand(
+  return CommandGraph::Node::Create(
       commandGraph,
+      CreateClangCommand(outputFile, compilation, commandLineOptions, false));
+}
+
+std::unique_ptr<ClangCommand>
+JlcCommandGraphGenerator::CreateClangCommand(
+    const util::filepath & outputFile,
+    const JlcCommandLineOptions::Compilation & compilation,
+    const JlcCommandLineOptions & commandLineOptions,
+    bool emitBitcode)
+{
+  return std::make_unique<ClangCommand>(
       compilation.InputFile(),
       outputFile,
       compilation.DependencyFile(),
@@ -99,7 +111,64 @@ JlcCommandGraphGenerator::CreateParserCommand(
       commandLineOptions.Md_,
       compilation.Mt(),
       ConvertLanguageStandard(commandLineOptions.LanguageStandard_),
-      {});
+      std::vector<ClangCommand::ClangArgument>(),
+      emitBitcode);
+}
+
+std::unique_ptr<JlmOptCommand>
+JlcCommandGraphGenerator::CreateJlmOptCommand(
+    const util::filepath & inputFile,
+    const util::filepath & outputFile,
+    const JlcCommandLineOptions::Compilation & compilation,
+    const JlcCommandLineOptions & commandLineOptions)
+{
+  auto statisticsFilePath = util::StatisticsCollectorSettings::CreateUniqueStatisticsFile(
+      util::filepath(std::filesystem::temp_directory_path()),
+      compilation.InputFile());
+  util::StatisticsCollectorSettings statisticsCollectorSettings(
+      statisticsFilePath,
+      commandLineOptions.JlmOptPassStatistics_);
+
+  JlmOptCommandLineOptions jlmOptCommandLineOptions(
+      inputFile,
+      outputFile,
+      JlmOptCommandLineOptions::OutputFormat::Llvm,
+      statisticsCollectorSettings,
+      commandLineOptions.JlmOptOptimizations_,
+      commandLineOptions.JlmOptNumThreads_);
+
+  return std::make_unique<JlmOptCommand>("jlm-opt", std::move(jlmOptCommandLineOptions));
+}
+
+CommandGraph::Node &
+JlcCommandGraphGenerator::CreateCommandNode(
+    CommandGraph & commandGraph,
+    std::unique_ptr<Command> command,
+    const util::filepath & inputFile,
+    const util::filepath & outputFile,
+    std::shared_ptr<CompilationCache> compilationCache,
+    std::vector<util::filepath> tools)
+{
+  if (!compilationCache)
+    return CommandGraph::Node::Create(commandGraph, std::move(command));
+
+  return CachedCommand::Create(
+      commandGraph,
+      std::move(command),
+      std::move(compilationCache),
+      inputFile,
+      outputFile,
+      std::move(tools));
+}
+
+template<class T>
+const T &
+JlcCommandGraphGenerator::GetCommand(const CommandGraph::Node & node)
+{
+  if (auto cachedCommand = dynamic_cast<const CachedCommand *>(&node.GetCommand()))
+    return *util::AssertedCast<const T>(&cachedCommand->GetCommand());
+
+  return *util::AssertedCast<const T>(&node.GetCommand());
 }
 
 std::unique_ptr<CommandGraph>
@@ -107,11 +176,34 @@ JlcCommandGraphGenerator::GenerateCommandGraph(const JlcCommandLineOptions & com
 {
   auto commandGraph = CommandGraph::Create();
 
+  std::shared_ptr<CompilationCache> compilationCache;
+  if (!commandLineOptions.CacheDirectory_.to_str().empty()
+      && !commandLineOptions.OnlyPrintCommands_)
+    compilationCache = CompilationCache::Create(commandLineOptions.CacheDirectory_);
+
   std::vector<CommandGraph::Node *> leafNodes;
   for (auto & compilation : commandLineOptions.Compilations_)
   {
     auto lastNode = &commandGraph->GetEntryNode();
 
+    if (commandLineOptions.InMemoryPipeline_ && compilation.RequiresParsing()
+        && compilation.RequiresOptimization() && compilation.RequiresAssembly())
+    {
+      auto & compilationCommandNode = InMemoryCompilationCommand::Create(
+          *commandGraph,
+          CreateClangCommand({ "-" }, compilation, commandLineOptions, true),
+          CreateJlmOptCommand({ "-" }, { "" }, compilation, commandLineOptions),
+          std::make_unique<LlcCommand>(
+              util::filepath("-"),
+              compilation.OutputFile(),
+              ConvertOptimizationLevel(commandLineOptions.OptimizationLevel_),
+              LlcCommand::RelocationModel::Static));
+
+      lastNode->AddEdge(compilationCommandNode);
+      leafNodes.push_back(&compilationCommandNode);
+      continue;
+    }
+
     if (compilation.RequiresParsing())
     {
       auto & parserCommandNode = CreateParserCommand(
@@ -127,35 +219,39 @@ JlcCommandGraphGenerator::GenerateCommandGraph(const JlcCommandLineOptions & com
     if (compilation.RequiresOptimization())
     {
       auto clangCommand = util::AssertedCast<ClangCommand>(&lastNode->GetCommand());
-      auto statisticsFilePath = util::StatisticsCollectorSettings::CreateUniqueStatisticsFile(
-          util::filepath(std::filesystem::temp_directory_path()),
-          compilation.InputFile());
-      util::StatisticsCollectorSettings statisticsCollectorSettings(
-          statisticsFilePath,
-          commandLineOptions.JlmOptPassStatistics_);
-
-      JlmOptCommandLineOptions jlmOptCommandLineOptions(
-          clangCommand->OutputFile(),
-          CreateJlmOptCommandOutputFile(compilation.InputFile()),
-          JlmOptCommandLineOptions::OutputFormat::Llvm,
-          statisticsCollectorSettings,
-          commandLineOptions.JlmOptOptimizations_);
+      auto outputFile = CreateJlmOptCommandOutputFile(compilation.InputFile());
 
-      auto & jlmOptCommandNode =
-          JlmOptCommand::Create(*commandGraph, "jlm-opt", std::move(jlmOptCommandLineOptions));
+      // The statistics of jlm-opt cannot be reproduced from a cache entry
+      auto & jlmOptCommandNode = CreateCommandNode(
+          *commandGraph,
+          CreateJlmOptCommand(
+              clangCommand->OutputFile(),
+              outputFile,
+              compilation,
+              commandLineOptions),
+          clangCommand->OutputFile(),
+          outputFile,
+          commandLineOptions.JlmOptPassStatistics_.IsEmpty() ? compilationCache : nullptr,
+          {});
       lastNode->AddEdge(jlmOptCommandNode);
       lastNode = &jlmOptCommandNode;
     }
 
     if (compilation.RequiresAssembly())
     {
-      auto jlmOptCommand = util::AssertedCast<JlmOptCommand>(&lastNode->GetCommand());
-      auto & llvmLlcCommandNode = LlcCommand::Create(
+      auto & jlmOptCommand = GetCommand<JlmOptCommand>(*lastNode);
+      auto & inputFile = jlmOptCommand.GetCommandLineOptions().GetOutputFile();
+      auto & llvmLlcCommandNode = CreateCommandNode(
           *commandGraph,
-          jlmOptCommand->GetCommandLineOptions().GetOutputFile(),
+          std::make_unique<LlcCommand>(
+              inputFile,
+              compilation.OutputFile(),
+              ConvertOptimizationLevel(commandLineOptions.OptimizationLevel_),
+              LlcCommand::RelocationModel::Static),
+          inputFile,
           compilation.OutputFile(),
-          ConvertOptimizationLevel(commandLineOptions.OptimizationLevel_),
-          LlcCommand::RelocationModel::Static);
+          compilationCache,
+          { llcpath });
       lastNode->AddEdge(llvmLlcCommandNode);
       lastNode = &llvmLlcCommandNode;
     }
@@ -187,11 +283,27 @@ JlcCommandGraphGenerator::GenerateCommandGraph(const JlcCommandLineOptions & com
     leafNodes.push_back(&linkerCommandNode);
   }
 
+  if (compilationCache)
+  {
+    auto & statisticsCommandNode =
+        PrintCompilationCacheStatisticsCommand::Create(*commandGraph, compilationCache);
+
+    for (const auto & leafNode : leafNodes)
+      leafNode->AddEdge(statisticsCommandNode);
+
+    leafNodes.clear();
+    leafNodes.push_back(&statisticsCommandNode);
+  }
+
   for (auto & leafNode : leafNodes)
     leafNode->AddEdge(commandGraph->GetExitNode());
 
   if (commandLineOptions.OnlyPrintCommands_)
     commandGraph = PrintCommandsCommand::Create(std::move(commandGraph));
+  else if (commandLineOptions.PrintCommandTimes_)
+    commandGraph = PrintCommandsCommand::CreateWithWallTimes(
+        std::move(commandGraph),
+        commandLineOptions.NumJobs_);
 
   return commandGraph;
 }
@@ -411,6 +523,10 @@ JhlsCommandGraphGenerator::GenerateCommandGraph(const JhlsCommandLineOptions & c
 
   if (commandLineOptions.OnlyPrintCommands_)
     commandGraph = PrintCommandsCommand::Create(std::move(commandGraph));
+  else if (commandLineOptions.PrintCommandTimes_)
+    commandGraph = PrintCommandsCommand::CreateWithWallTimes(
+        std::move(commandGraph),
+        commandLineOptions.NumJobs_);
 
   return commandGraph;
 }
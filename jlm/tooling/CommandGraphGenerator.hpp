@@ -78,6 +78,42 @@ private:
       const util::filepath & outputFile,
       const JlcCommandLineOptions::Compilation & compilation,
       const JlcCommandLineOptions & commandLineOptions);
+
+  static std::unique_ptr<ClangCommand>
+  CreateClangCommand(
+      const util::filepath & outputFile,
+      const JlcCommandLineOptions::Compilation & compilation,
+      const JlcCommandLineOptions & commandLineOptions,
+      bool emitBitcode);
+
+  static std::unique_ptr<JlmOptCommand>
+  CreateJlmOptCommand(
+      const util::filepath & inputFile,
+      const util::filepath & outputFile,
+      const JlcCommandLineOptions::Compilation & compilation,
+      const JlcCommandLineOptions & commandLineOptions);
+
+  /**
+   * Creates a command graph node for \p command. The node reuses the output file of \p command
+   * from \p compilationCache if a cache is given.
+   *
+   * @param tools The external tools that are executed by \p command.
+   */
+  static CommandGraph::Node &
+  CreateCommandNode(
+      CommandGraph & commandGraph,
+      std::unique_ptr<Command> command,
+      const util::filepath & inputFile,
+      const util::filepath & outputFile,
+      std::shared_ptr<CompilationCache> compilationCache,
+      std::vector<util::filepath> tools);
+
+  /**
+   * Returns the command of type \p T of \p node, looking through a cached command.
+   */
+  template<class T>
+  static const T &
+  GetCommand(const CommandGraph::Node & node);
 };
 
 /**
@@ -4,7 +4,9 @@
  */
 
 #include <jlm/llvm/opt/alias-analyses/AgnosticMemoryNodeProvider.hpp>
+#include <jlm/llvm/opt/alias-analyses/AliasClassMemoryNodeEliminator.hpp>
 #include <jlm/llvm/opt/alias-analyses/Andersen.hpp>
+#include <jlm/llvm/opt/alias-analyses/EliminatedMemoryNodeProvider.hpp>
 #include <jlm/llvm/opt/alias-analyses/Optimization.hpp>
 #include <jlm/llvm/opt/alias-analyses/RegionAwareMemoryNodeProvider.hpp>
 #include <jlm/llvm/opt/alias-analyses/Steensgaard.hpp>
@@ -65,6 +67,7 @@ void
 JlcCommandLineOptions::Reset() noexcept
 {
   OnlyPrintCommands_ = false;
+  PrintCommandTimes_ = false;
   GenerateDebugInformation_ = false;
   Verbose_ = false;
   Rdynamic_ = false;
@@ -73,10 +76,15 @@ JlcCommandLineOptions::Reset() noexcept
 
   Md_ = false;
 
+  InMemoryPipeline_ = false;
+  NumJobs_ = 1;
+  JlmOptNumThreads_ = 1;
+
   OptimizationLevel_ = OptimizationLevel::O0;
   LanguageStandard_ = LanguageStandard::None;
 
   OutputFile_ = util::filepath("a.out");
+  CacheDirectory_ = util::filepath("");
   Libraries_.clear();
   MacroDefinitions_.clear();
   LibraryPaths_.clear();
@@ -92,10 +100,12 @@ void
 JlmOptCommandLineOptions::Reset() noexcept
 {
   InputFile_ = util::filepath("");
+  InputFormat_ = InputFormat::Llvm;
   OutputFile_ = util::filepath("");
   OutputFormat_ = OutputFormat::Llvm;
   StatisticsCollectorSettings_ = util::StatisticsCollectorSettings();
   OptimizationIds_.clear();
+  NumThreads_ = 1;
 }
 
 std::vector<llvm::optimization *>
@@ -121,10 +131,14 @@ JlmOptCommandLineOptions::FromCommandLineArgumentToOptimizationId(
           OptimizationId::AAAndersenAgnostic },
         { OptimizationCommandLineArgument::AaAndersenRegionAware_,
           OptimizationId::AAAndersenRegionAware },
+        { OptimizationCommandLineArgument::AaAndersenRegionAwareAliasClasses_,
+          OptimizationId::AAAndersenRegionAwareAliasClasses },
         { OptimizationCommandLineArgument::AaSteensgaardAgnostic_,
           OptimizationId::AASteensgaardAgnostic },
         { OptimizationCommandLineArgument::AaSteensgaardRegionAware_,
           OptimizationId::AASteensgaardRegionAware },
+        { OptimizationCommandLineArgument::AaSteensgaardRegionAwareAliasClasses_,
+          OptimizationId::AASteensgaardRegionAwareAliasClasses },
         { OptimizationCommandLineArgument::CommonNodeElimination_,
           OptimizationId::CommonNodeElimination },
         { OptimizationCommandLineArgument::DeadNodeElimination_,
@@ -153,10 +167,14 @@ JlmOptCommandLineOptions::ToCommandLineArgument(OptimizationId optimizationId)
           OptimizationCommandLineArgument::AaAndersenAgnostic_ },
         { OptimizationId::AAAndersenRegionAware,
           OptimizationCommandLineArgument::AaAndersenRegionAware_ },
+        { OptimizationId::AAAndersenRegionAwareAliasClasses,
+          OptimizationCommandLineArgument::AaAndersenRegionAwareAliasClasses_ },
         { OptimizationId::AASteensgaardAgnostic,
           OptimizationCommandLineArgument::AaSteensgaardAgnostic_ },
         { OptimizationId::AASteensgaardRegionAware,
           OptimizationCommandLineArgument::AaSteensgaardRegionAware_ },
+        { OptimizationId::AASteensgaardRegionAwareAliasClasses,
+          OptimizationCommandLineArgument::AaSteensgaardRegionAwareAliasClasses_ },
         { OptimizationId::CommonNodeElimination,
           OptimizationCommandLineArgument::CommonNodeElimination_ },
         { OptimizationId::DeadNodeElimination,
@@ -183,6 +201,8 @@ JlmOptCommandLineOptions::FromCommandLineArgumentToStatisticsId(
 {
   static std::unordered_map<std::string, util::Statistics::Id> map(
       { { StatisticsCommandLineArgument::Aggregation_, util::Statistics::Id::Aggregation },
+        { StatisticsCommandLineArgument::AndersenAnalysis_,
+          util::Statistics::Id::AndersenAnalysis },
         { StatisticsCommandLineArgument::BasicEncoderEncoding_,
           util::Statistics::Id::BasicEncoderEncoding },
         { StatisticsCommandLineArgument::Annotation_, util::Statistics::Id::Annotation },
@@ -200,6 +220,8 @@ JlmOptCommandLineOptions::FromCommandLineArgumentToStatisticsId(
         { StatisticsCommandLineArgument::JlmToRvsdgConversion_,
           util::Statistics::Id::JlmToRvsdgConversion },
         { StatisticsCommandLineArgument::LoopUnrolling_, util::Statistics::Id::LoopUnrolling },
+        { StatisticsCommandLineArgument::MemoryNodeElimination_,
+          util::Statistics::Id::MemoryNodeElimination },
         { StatisticsCommandLineArgument::MemoryNodeProvisioning_,
           util::Statistics::Id::MemoryNodeProvisioning },
         { StatisticsCommandLineArgument::PullNodes_, util::Statistics::Id::PullNodes },
@@ -227,6 +249,8 @@ JlmOptCommandLineOptions::ToCommandLineArgument(jlm::util::Statistics::Id statis
 {
   static std::unordered_map<util::Statistics::Id, const char *> map(
       { { util::Statistics::Id::Aggregation, StatisticsCommandLineArgument::Aggregation_ },
+        { util::Statistics::Id::AndersenAnalysis,
+          StatisticsCommandLineArgument::AndersenAnalysis_ },
         { util::Statistics::Id::BasicEncoderEncoding,
           StatisticsCommandLineArgument::BasicEncoderEncoding_ },
         { util::Statistics::Id::Annotation, StatisticsCommandLineArgument::Annotation_ },
@@ -244,6 +268,8 @@ JlmOptCommandLineOptions::ToCommandLineArgument(jlm::util::Statistics::Id statis
         { util::Statistics::Id::JlmToRvsdgConversion,
           StatisticsCommandLineArgument::JlmToRvsdgConversion_ },
         { util::Statistics::Id::LoopUnrolling, StatisticsCommandLineArgument::LoopUnrolling_ },
+        { util::Statistics::Id::MemoryNodeElimination,
+          StatisticsCommandLineArgument::MemoryNodeElimination_ },
         { util::Statistics::Id::MemoryNodeProvisioning,
           StatisticsCommandLineArgument::MemoryNodeProvisioning_ },
         { util::Statistics::Id::PullNodes, StatisticsCommandLineArgument::PullNodes_ },
@@ -266,11 +292,26 @@ JlmOptCommandLineOptions::ToCommandLineArgument(jlm::util::Statistics::Id statis
   throw util::error("Unknown statistics identifier");
 }
 
+const char *
+JlmOptCommandLineOptions::ToCommandLineArgument(InputFormat inputFormat)
+{
+  static std::unordered_map<InputFormat, const char *> map(
+      { { InputFormat::Llvm, "llvm" }, { InputFormat::Rvsdg, "rvsdg" } });
+
+  if (map.find(inputFormat) != map.end())
+    return map[inputFormat];
+
+  JLM_UNREACHABLE("Unknown input format");
+}
+
 const char *
 JlmOptCommandLineOptions::ToCommandLineArgument(OutputFormat outputFormat)
 {
   static std::unordered_map<OutputFormat, const char *> map(
-      { { OutputFormat::Llvm, "llvm" }, { OutputFormat::Xml, "xml" } });
+      { { OutputFormat::Bitcode, "bitcode" },
+        { OutputFormat::Llvm, "llvm" },
+        { OutputFormat::Rvsdg, "rvsdg" },
+        { OutputFormat::Xml, "xml" } });
 
   if (map.find(outputFormat) != map.end())
     return map[outputFormat];
@@ -285,10 +326,16 @@ JlmOptCommandLineOptions::GetOptimization(enum OptimizationId id)
   using Steensgaard = llvm::aa::Steensgaard;
   using AgnosticMNP = llvm::aa::AgnosticMemoryNodeProvider;
   using RegionAwareMNP = llvm::aa::RegionAwareMemoryNodeProvider;
+  using RegionAwareAliasClassMNP = llvm::aa::
+      EliminatedMemoryNodeProvider<RegionAwareMNP, llvm::aa::AliasClassMemoryNodeEliminator>;
   static llvm::aa::AliasAnalysisStateEncoder<Andersen, AgnosticMNP> andersenAgnostic;
   static llvm::aa::AliasAnalysisStateEncoder<Andersen, RegionAwareMNP> andersenRegionAware;
+  static llvm::aa::AliasAnalysisStateEncoder<Andersen, RegionAwareAliasClassMNP>
+      andersenRegionAwareAliasClasses;
   static llvm::aa::AliasAnalysisStateEncoder<Steensgaard, AgnosticMNP> steensgaardAgnostic;
   static llvm::aa::AliasAnalysisStateEncoder<Steensgaard, RegionAwareMNP> steensgaardRegionAware;
+  static llvm::aa::AliasAnalysisStateEncoder<Steensgaard, RegionAwareAliasClassMNP>
+      steensgaardRegionAwareAliasClasses;
   static llvm::cne commonNodeElimination;
   static llvm::DeadNodeElimination deadNodeElimination;
   static llvm::fctinline functionInlining;
@@ -302,8 +349,11 @@ JlmOptCommandLineOptions::GetOptimization(enum OptimizationId id)
   static std::unordered_map<OptimizationId, llvm::optimization *> map(
       { { OptimizationId::AAAndersenAgnostic, &andersenAgnostic },
         { OptimizationId::AAAndersenRegionAware, &andersenRegionAware },
+        { OptimizationId::AAAndersenRegionAwareAliasClasses, &andersenRegionAwareAliasClasses },
         { OptimizationId::AASteensgaardAgnostic, &steensgaardAgnostic },
         { OptimizationId::AASteensgaardRegionAware, &steensgaardRegionAware },
+        { OptimizationId::AASteensgaardRegionAwareAliasClasses,
+          &steensgaardRegionAwareAliasClasses },
         { OptimizationId::CommonNodeElimination, &commonNodeElimination },
         { OptimizationId::DeadNodeElimination, &deadNodeElimination },
         { OptimizationId::FunctionInlining, &functionInlining },
@@ -411,6 +461,33 @@ JlcCommandLineParser::ParseCommandLineArguments(int argc, char ** argv)
       cl::ValueDisallowed,
       cl::desc("Print (but do not run) the commands for this compilation."));
 
+  cl::opt<bool> printCommandTimes(
+      "print-command-times",
+      cl::ValueDisallowed,
+      cl::desc("Run the commands for this compilation and print their wall times."));
+
+  cl::opt<bool> inMemoryPipeline(
+      "in-memory-pipeline",
+      cl::ValueDisallowed,
+      cl::desc("Pass LLVM modules between clang, jlm-opt, and llc without intermediate files."));
+
+  cl::opt<size_t> numJobs(
+      "j",
+      cl::init(1),
+      cl::desc("Run up to <N> commands of this compilation in parallel."),
+      cl::value_desc("N"));
+
+  cl::opt<size_t> jlmOptNumThreads(
+      "jlm-opt-threads",
+      cl::init(1),
+      cl::desc("Apply jlm-opt's intra-procedural optimizations to functions using <N> threads."),
+      cl::value_desc("N"));
+
+  cl::opt<std::string> cacheDirectory(
+      "cache-dir",
+      cl::desc("Reuse the jlm-opt and llc outputs of previous compilations cached in <dir>."),
+      cl::value_desc("dir"));
+
   cl::list<std::string> inputFiles(cl::Positional, cl::desc("<inputs>"));
 
   cl::list<std::string> includePaths(
@@ -508,6 +585,7 @@ JlcCommandLineParser::ParseCommandLineArguments(int argc, char ** argv)
       cl::value_desc("value"));
 
   auto aggregationStatisticsId = util::Statistics::Id::Aggregation;
+  auto andersenAnalysisStatisticsId = util::Statistics::Id::AndersenAnalysis;
   auto annotationStatisticsId = util::Statistics::Id::Annotation;
   auto basicEncoderEncodingStatisticsId = util::Statistics::Id::BasicEncoderEncoding;
   auto commonNodeEliminationStatisticsId = util::Statistics::Id::CommonNodeElimination;
@@ -518,6 +596,7 @@ JlcCommandLineParser::ParseCommandLineArguments(int argc, char ** argv)
   auto invariantValueRedirectionStatisticsId = util::Statistics::Id::InvariantValueRedirection;
   auto jlmToRvsdgConversionStatisticsId = util::Statistics::Id::JlmToRvsdgConversion;
   auto loopUnrollingStatisticsId = util::Statistics::Id::LoopUnrolling;
+  auto memoryNodeEliminationStatisticsId = util::Statistics::Id::MemoryNodeElimination;
   auto memoryNodeProvisioningStatisticsId = util::Statistics::Id::MemoryNodeProvisioning;
   auto pullNodesStatisticsId = util::Statistics::Id::PullNodes;
   auto pushNodesStatisticsId = util::Statistics::Id::PushNodes;
@@ -535,6 +614,10 @@ JlcCommandLineParser::ParseCommandLineArguments(int argc, char ** argv)
               aggregationStatisticsId,
               JlmOptCommandLineOptions::ToCommandLineArgument(aggregationStatisticsId),
               "Collect control flow graph aggregation pass statistics."),
+          ::clEnumValN(
+              andersenAnalysisStatisticsId,
+              JlmOptCommandLineOptions::ToCommandLineArgument(andersenAnalysisStatisticsId),
+              "Collect Andersen alias analysis pass statistics."),
           ::clEnumValN(
               annotationStatisticsId,
               JlmOptCommandLineOptions::ToCommandLineArgument(annotationStatisticsId),
@@ -576,6 +659,10 @@ JlcCommandLineParser::ParseCommandLineArguments(int argc, char ** argv)
               loopUnrollingStatisticsId,
               JlmOptCommandLineOptions::ToCommandLineArgument(loopUnrollingStatisticsId),
               "Collect loop unrolling pass statistics."),
+          ::clEnumValN(
+              memoryNodeEliminationStatisticsId,
+              JlmOptCommandLineOptions::ToCommandLineArgument(memoryNodeEliminationStatisticsId),
+              "Collect memory node elimination pass statistics."),
           ::clEnumValN(
               memoryNodeProvisioningStatisticsId,
               JlmOptCommandLineOptions::ToCommandLineArgument(memoryNodeProvisioningStatisticsId),
@@ -618,6 +705,12 @@ JlcCommandLineParser::ParseCommandLineArguments(int argc, char ** argv)
 
   /* Process parsed options */
 
+  if (numJobs == 0)
+    throw CommandLineParser::Exception("The number of jobs must be at least one.");
+
+  if (jlmOptNumThreads == 0)
+    throw CommandLineParser::Exception("The number of jlm-opt threads must be at least one.");
+
   static std::unordered_map<std::string, JlcCommandLineOptions::OptimizationLevel>
       optimizationLevelMap({ { "0", JlcCommandLineOptions::OptimizationLevel::O0 },
                              { "1", JlcCommandLineOptions::OptimizationLevel::O1 },
@@ -679,6 +772,11 @@ JlcCommandLineParser::ParseCommandLineArguments(int argc, char ** argv)
   CommandLineOptions_.Warnings_ = warnings;
   CommandLineOptions_.IncludePaths_ = includePaths;
   CommandLineOptions_.OnlyPrintCommands_ = onlyPrintCommands;
+  CommandLineOptions_.PrintCommandTimes_ = printCommandTimes;
+  CommandLineOptions_.InMemoryPipeline_ = inMemoryPipeline;
+  CommandLineOptions_.NumJobs_ = numJobs;
+  CommandLineOptions_.JlmOptNumThreads_ = jlmOptNumThreads;
+  CommandLineOptions_.CacheDirectory_ = util::filepath(cacheDirectory);
   CommandLineOptions_.GenerateDebugInformation_ = generateDebugInformation;
   CommandLineOptions_.Flags_ = flags;
   CommandLineOptions_.JlmOptOptimizations_ = jlmOptOptimizations;
@@ -749,7 +847,7 @@ JlmOptCommandLineParser::ParseCommandLineArguments(int argc, char ** argv)
   cl::opt<std::string> outputFile(
       "o",
       cl::init(""),
-      cl::desc("Write output to <file>"),
+      cl::desc("Write output to <file>. Standard output is used if <file> is omitted or '-'"),
       cl::value_desc("file"));
 
   std::string statisticsDirectoryDefault = std::filesystem::temp_directory_path();
@@ -762,6 +860,7 @@ JlmOptCommandLineParser::ParseCommandLineArguments(int argc, char ** argv)
       cl::value_desc("dir"));
 
   auto aggregationStatisticsId = util::Statistics::Id::Aggregation;
+  auto andersenAnalysisStatisticsId = util::Statistics::Id::AndersenAnalysis;
   auto annotationStatisticsId = util::Statistics::Id::Annotation;
   auto basicEncoderEncodingStatisticsId = util::Statistics::Id::BasicEncoderEncoding;
   auto commonNodeEliminationStatisticsId = util::Statistics::Id::CommonNodeElimination;
@@ -772,6 +871,7 @@ JlmOptCommandLineParser::ParseCommandLineArguments(int argc, char ** argv)
   auto invariantValueRedirectionStatisticsId = util::Statistics::Id::InvariantValueRedirection;
   auto jlmToRvsdgConversionStatisticsId = util::Statistics::Id::JlmToRvsdgConversion;
   auto loopUnrollingStatisticsId = util::Statistics::Id::LoopUnrolling;
+  auto memoryNodeEliminationStatisticsId = util::Statistics::Id::MemoryNodeElimination;
   auto memoryNodeProvisioningStatisticsId = util::Statistics::Id::MemoryNodeProvisioning;
   auto pullNodesStatisticsId = util::Statistics::Id::PullNodes;
   auto pushNodesStatisticsId = util::Statistics::Id::PushNodes;
@@ -788,6 +888,10 @@ JlmOptCommandLineParser::ParseCommandLineArguments(int argc, char ** argv)
               aggregationStatisticsId,
               JlmOptCommandLineOptions::ToCommandLineArgument(aggregationStatisticsId),
               "Write aggregation statistics to file."),
+          ::clEnumValN(
+              andersenAnalysisStatisticsId,
+              JlmOptCommandLineOptions::ToCommandLineArgument(andersenAnalysisStatisticsId),
+              "Write Andersen alias analysis statistics to file."),
           ::clEnumValN(
               annotationStatisticsId,
               JlmOptCommandLineOptions::ToCommandLineArgument(annotationStatisticsId),
@@ -829,6 +933,10 @@ JlmOptCommandLineParser::ParseCommandLineArguments(int argc, char ** argv)
               loopUnrollingStatisticsId,
               JlmOptCommandLineOptions::ToCommandLineArgument(loopUnrollingStatisticsId),
               "Write loop unrolling statistics to file."),
+          ::clEnumValN(
+              memoryNodeEliminationStatisticsId,
+              JlmOptCommandLineOptions::ToCommandLineArgument(memoryNodeEliminationStatisticsId),
+              "Write memory node elimination statistics to file."),
           ::clEnumValN(
               memoryNodeProvisioningStatisticsId,
               JlmOptCommandLineOptions::ToCommandLineArgument(memoryNodeProvisioningStatisticsId),
@@ -867,15 +975,42 @@ JlmOptCommandLineParser::ParseCommandLineArguments(int argc, char ** argv)
               "Write theta-gamma inversion statistics to file.")),
       cl::desc("Write statistics"));
 
+  auto llvmInputFormat = JlmOptCommandLineOptions::InputFormat::Llvm;
+  auto rvsdgInputFormat = JlmOptCommandLineOptions::InputFormat::Rvsdg;
+
+  cl::opt<JlmOptCommandLineOptions::InputFormat> inputFormat(
+      "input-format",
+      cl::values(
+          ::clEnumValN(
+              llvmInputFormat,
+              JlmOptCommandLineOptions::ToCommandLineArgument(llvmInputFormat),
+              "Read LLVM IR or bitcode [default]"),
+          ::clEnumValN(
+              rvsdgInputFormat,
+              JlmOptCommandLineOptions::ToCommandLineArgument(rvsdgInputFormat),
+              "Read binary RVSDG")),
+      cl::init(llvmInputFormat),
+      cl::desc("Select input format"));
+
+  auto bitcodeOutputFormat = JlmOptCommandLineOptions::OutputFormat::Bitcode;
   auto llvmOutputFormat = JlmOptCommandLineOptions::OutputFormat::Llvm;
+  auto rvsdgOutputFormat = JlmOptCommandLineOptions::OutputFormat::Rvsdg;
   auto xmlOutputFormat = JlmOptCommandLineOptions::OutputFormat::Xml;
 
   cl::opt<JlmOptCommandLineOptions::OutputFormat> outputFormat(
       cl::values(
+          ::clEnumValN(
+              bitcodeOutputFormat,
+              JlmOptCommandLineOptions::ToCommandLineArgument(bitcodeOutputFormat),
+              "Output LLVM bitcode"),
           ::clEnumValN(
               llvmOutputFormat,
               JlmOptCommandLineOptions::ToCommandLineArgument(llvmOutputFormat),
               "Output LLVM IR [default]"),
+          ::clEnumValN(
+              rvsdgOutputFormat,
+              JlmOptCommandLineOptions::ToCommandLineArgument(rvsdgOutputFormat),
+              "Output binary RVSDG"),
           ::clEnumValN(
               xmlOutputFormat,
               JlmOptCommandLineOptions::ToCommandLineArgument(xmlOutputFormat),
@@ -885,9 +1020,13 @@ JlmOptCommandLineParser::ParseCommandLineArguments(int argc, char ** argv)
 
   auto aAAndersenAgnostic = JlmOptCommandLineOptions::OptimizationId::AAAndersenAgnostic;
   auto aAAndersenRegionAware = JlmOptCommandLineOptions::OptimizationId::AAAndersenRegionAware;
+  auto aAAndersenRegionAwareAliasClasses =
+      JlmOptCommandLineOptions::OptimizationId::AAAndersenRegionAwareAliasClasses;
   auto aASteensgaardAgnostic = JlmOptCommandLineOptions::OptimizationId::AASteensgaardAgnostic;
   auto aASteensgaardRegionAware =
       JlmOptCommandLineOptions::OptimizationId::AASteensgaardRegionAware;
+  auto aASteensgaardRegionAwareAliasClasses =
+      JlmOptCommandLineOptions::OptimizationId::AASteensgaardRegionAwareAliasClasses;
   auto commonNodeElimination = JlmOptCommandLineOptions::OptimizationId::CommonNodeElimination;
   auto deadNodeElimination = JlmOptCommandLineOptions::OptimizationId::DeadNodeElimination;
   auto functionInlining = JlmOptCommandLineOptions::OptimizationId::FunctionInlining;
@@ -909,6 +1048,10 @@ JlmOptCommandLineParser::ParseCommandLineArguments(int argc, char ** argv)
               aAAndersenRegionAware,
               JlmOptCommandLineOptions::ToCommandLineArgument(aAAndersenRegionAware),
               "Andersen alias analysis with region-aware memory state encoding"),
+          ::clEnumValN(
+              aAAndersenRegionAwareAliasClasses,
+              JlmOptCommandLineOptions::ToCommandLineArgument(aAAndersenRegionAwareAliasClasses),
+              "Andersen alias analysis with region-aware memory state encoding of alias classes"),
           ::clEnumValN(
               aASteensgaardAgnostic,
               JlmOptCommandLineOptions::ToCommandLineArgument(aASteensgaardAgnostic),
@@ -917,6 +1060,12 @@ JlmOptCommandLineParser::ParseCommandLineArguments(int argc, char ** argv)
               aASteensgaardRegionAware,
               JlmOptCommandLineOptions::ToCommandLineArgument(aASteensgaardRegionAware),
               "Steensgaard alias analysis with region-aware memory state encoding"),
+          ::clEnumValN(
+              aASteensgaardRegionAwareAliasClasses,
+              JlmOptCommandLineOptions::ToCommandLineArgument(
+                  aASteensgaardRegionAwareAliasClasses),
+              "Steensgaard alias analysis with region-aware memory state encoding of alias "
+              "classes"),
           ::clEnumValN(
               commonNodeElimination,
               JlmOptCommandLineOptions::ToCommandLineArgument(commonNodeElimination),
@@ -955,8 +1104,17 @@ JlmOptCommandLineParser::ParseCommandLineArguments(int argc, char ** argv)
               "Loop Unrolling")),
       cl::desc("Perform optimization"));
 
+  cl::opt<size_t> numThreads(
+      "j",
+      cl::init(1),
+      cl::desc("Apply intra-procedural optimizations to functions using <N> threads"),
+      cl::value_desc("N"));
+
   cl::ParseCommandLineOptions(argc, argv);
 
+  if (numThreads == 0)
+    throw CommandLineParser::Exception("The number of threads must be at least one.");
+
   jlm::util::filepath statisticsDirectoryFilePath(statisticDirectory);
   if (!statisticsDirectoryFilePath.Exists() && !statisticsDirectoryFilePath.IsDirectory())
   {
@@ -982,7 +1140,9 @@ JlmOptCommandLineParser::ParseCommandLineArguments(int argc, char ** argv)
       outputFile,
       outputFormat,
       std::move(statisticsCollectorSettings),
-      std::move(optimizationIds));
+      std::move(optimizationIds),
+      numThreads,
+      inputFormat);
 
   return *CommandLineOptions_;
 }
@@ -1090,6 +1250,17 @@ JhlsCommandLineParser::ParseCommandLineArguments(int argc, char ** argv)
       cl::ValueDisallowed,
       cl::desc("Print (but do not run) the commands for this compilation."));
 
+  cl::opt<bool> printCommandTimes(
+      "print-command-times",
+      cl::ValueDisallowed,
+      cl::desc("Run the commands for this compilation and print their wall times."));
+
+  cl::opt<size_t> numJobs(
+      "j",
+      cl::init(1),
+      cl::desc("Run up to <N> commands of this compilation in parallel."),
+      cl::value_desc("N"));
+
   cl::list<std::string> inputFiles(cl::Positional, cl::desc("<inputs>"));
 
   cl::list<std::string> includePaths(
@@ -1200,6 +1371,12 @@ JhlsCommandLineParser::ParseCommandLineArguments(int argc, char ** argv)
 
   /* Process parsed options */
 
+  if (numJobs == 0)
+  {
+    std::cerr << "jhls: the number of jobs must be at least one\n";
+    exit(EXIT_FAILURE);
+  }
+
   static std::unordered_map<std::string, JhlsCommandLineOptions::OptimizationLevel> Olvlmap(
       { { "0", JhlsCommandLineOptions::OptimizationLevel::O0 },
         { "1", JhlsCommandLineOptions::OptimizationLevel::O1 },
@@ -1269,6 +1446,8 @@ JhlsCommandLineParser::ParseCommandLineArguments(int argc, char ** argv)
   CommandLineOptions_.Warnings_ = warnings;
   CommandLineOptions_.IncludePaths_ = includePaths;
   CommandLineOptions_.OnlyPrintCommands_ = onlyPrintCommands;
+  CommandLineOptions_.PrintCommandTimes_ = printCommandTimes;
+  CommandLineOptions_.NumJobs_ = numJobs;
   CommandLineOptions_.GenerateDebugInformation_ = generateDebugInformation;
   CommandLineOptions_.Flags_ = flags;
   CommandLineOptions_.JlmHls_ = jlmHlsOptimizations;
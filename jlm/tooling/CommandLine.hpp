@@ -40,9 +40,17 @@ class optimization;
 class JlmOptCommandLineOptions final : public CommandLineOptions
 {
 public:
+  enum class InputFormat
+  {
+    Llvm,
+    Rvsdg
+  };
+
   enum class OutputFormat
   {
+    Bitcode,
     Llvm,
+    Rvsdg,
     Xml
   };
 
@@ -52,8 +60,10 @@ public:
 
     AAAndersenAgnostic,
     AAAndersenRegionAware,
+    AAAndersenRegionAwareAliasClasses,
     AASteensgaardAgnostic,
     AASteensgaardRegionAware,
+    AASteensgaardRegionAwareAliasClasses,
     CommonNodeElimination,
     DeadNodeElimination,
     FunctionInlining,
@@ -72,12 +82,16 @@ public:
       util::filepath outputFile,
       OutputFormat outputFormat,
       util::StatisticsCollectorSettings statisticsCollectorSettings,
-      std::vector<OptimizationId> optimizations)
+      std::vector<OptimizationId> optimizations,
+      size_t numThreads,
+      InputFormat inputFormat = InputFormat::Llvm)
       : InputFile_(std::move(inputFile)),
+        InputFormat_(inputFormat),
         OutputFile_(std::move(outputFile)),
         OutputFormat_(outputFormat),
         StatisticsCollectorSettings_(std::move(statisticsCollectorSettings)),
-        OptimizationIds_(std::move(optimizations))
+        OptimizationIds_(std::move(optimizations)),
+        NumThreads_(numThreads)
   {}
 
   void
@@ -89,6 +103,12 @@ public:
     return InputFile_;
   }
 
+  [[nodiscard]] InputFormat
+  GetInputFormat() const noexcept
+  {
+    return InputFormat_;
+  }
+
   [[nodiscard]] const util::filepath &
   GetOutputFile() const noexcept
   {
@@ -116,6 +136,15 @@ public:
   [[nodiscard]] std::vector<llvm::optimization *>
   GetOptimizations() const noexcept;
 
+  /**
+   * @return The number of threads that are used to apply intra-procedural optimizations.
+   */
+  [[nodiscard]] size_t
+  GetNumThreads() const noexcept
+  {
+    return NumThreads_;
+  }
+
   static OptimizationId
   FromCommandLineArgumentToOptimizationId(const std::string & commandLineArgument);
 
@@ -128,6 +157,9 @@ public:
   static const char *
   ToCommandLineArgument(util::Statistics::Id statisticsId);
 
+  static const char *
+  ToCommandLineArgument(InputFormat inputFormat);
+
   static const char *
   ToCommandLineArgument(OutputFormat outputFormat);
 
@@ -140,29 +172,39 @@ public:
       util::filepath outputFile,
       OutputFormat outputFormat,
       util::StatisticsCollectorSettings statisticsCollectorSettings,
-      std::vector<OptimizationId> optimizations)
+      std::vector<OptimizationId> optimizations,
+      size_t numThreads,
+      InputFormat inputFormat = InputFormat::Llvm)
   {
     return std::make_unique<JlmOptCommandLineOptions>(
         std::move(inputFile),
         std::move(outputFile),
         outputFormat,
         std::move(statisticsCollectorSettings),
-        std::move(optimizations));
+        std::move(optimizations),
+        numThreads,
+        inputFormat);
   }
 
 private:
   util::filepath InputFile_;
+  InputFormat InputFormat_;
   util::filepath OutputFile_;
   OutputFormat OutputFormat_;
   util::StatisticsCollectorSettings StatisticsCollectorSettings_;
   std::vector<OptimizationId> OptimizationIds_;
+  size_t NumThreads_;
 
   struct OptimizationCommandLineArgument
   {
     inline static const char * AaAndersenAgnostic_ = "AAAndersenAgnostic";
     inline static const char * AaAndersenRegionAware_ = "AAAndersenRegionAware";
+    inline static const char * AaAndersenRegionAwareAliasClasses_ =
+        "AAAndersenRegionAwareAliasClasses";
     inline static const char * AaSteensgaardAgnostic_ = "AASteensgaardAgnostic";
     inline static const char * AaSteensgaardRegionAware_ = "AASteensgaardRegionAware";
+    inline static const char * AaSteensgaardRegionAwareAliasClasses_ =
+        "AASteensgaardRegionAwareAliasClasses";
     inline static const char * CommonNodeElimination_ = "CommonNodeElimination";
     inline static const char * DeadNodeElimination_ = "DeadNodeElimination";
     inline static const char * FunctionInlining_ = "FunctionInlining";
@@ -177,6 +219,7 @@ private:
   struct StatisticsCommandLineArgument
   {
     inline static const char * Aggregation_ = "print-aggregation-time";
+    inline static const char * AndersenAnalysis_ = "print-andersen-analysis";
     inline static const char * Annotation_ = "print-annotation-time";
     inline static const char * BasicEncoderEncoding_ = "print-basicencoder-encoding";
     inline static const char * CommonNodeElimination_ = "print-cne-stat";
@@ -187,6 +230,7 @@ private:
     inline static const char * InvariantValueRedirection_ = "printInvariantValueRedirection";
     inline static const char * JlmToRvsdgConversion_ = "print-jlm-rvsdg-conversion";
     inline static const char * LoopUnrolling_ = "print-unroll-stat";
+    inline static const char * MemoryNodeElimination_ = "print-memory-node-elimination";
     inline static const char * MemoryNodeProvisioning_ = "print-memory-node-provisioning";
     inline static const char * PullNodes_ = "print-pull-stat";
     inline static const char * PushNodes_ = "print-push-stat";
@@ -228,15 +272,20 @@ public:
 
   JlcCommandLineOptions()
       : OnlyPrintCommands_(false),
+        PrintCommandTimes_(false),
         GenerateDebugInformation_(false),
         Verbose_(false),
         Rdynamic_(false),
         Suppress_(false),
         UsePthreads_(false),
         Md_(false),
+        InMemoryPipeline_(false),
+        NumJobs_(1),
+        JlmOptNumThreads_(1),
         OptimizationLevel_(OptimizationLevel::O0),
         LanguageStandard_(LanguageStandard::None),
-        OutputFile_("a.out")
+        OutputFile_("a.out"),
+        CacheDirectory_("")
   {}
 
   static std::string
@@ -249,6 +298,7 @@ public:
   Reset() noexcept override;
 
   bool OnlyPrintCommands_;
+  bool PrintCommandTimes_;
   bool GenerateDebugInformation_;
   bool Verbose_;
   bool Rdynamic_;
@@ -257,10 +307,31 @@ public:
 
   bool Md_;
 
+  /**
+   * Compile every source file to an object file within a single command that passes the LLVM
+   * modules between clang, jlm-opt, and llc in memory instead of through files.
+   */
+  bool InMemoryPipeline_;
+
+  size_t NumJobs_;
+
+  /**
+   * The number of threads jlm-opt uses to optimize the functions of a module. This is independent
+   * of NumJobs_, which only runs the commands of distinct compilation units in parallel.
+   */
+  size_t JlmOptNumThreads_;
+
   OptimizationLevel OptimizationLevel_;
   LanguageStandard LanguageStandard_;
 
   util::filepath OutputFile_;
+
+  /**
+   * The directory of the compilation cache. The outputs of the jlm-opt and llc commands are
+   * cached in this directory and reused for identical inputs. The cache is disabled if empty.
+   */
+  util::filepath CacheDirectory_;
+
   std::vector<std::string> Libraries_;
   std::vector<std::string> MacroDefinitions_;
   std::vector<std::string> LibraryPaths_;
@@ -423,6 +494,7 @@ public:
 
   JhlsCommandLineOptions()
       : OnlyPrintCommands_(false),
+        PrintCommandTimes_(false),
         GenerateDebugInformation_(false),
         Verbose_(false),
         Rdynamic_(false),
@@ -432,6 +504,7 @@ public:
         UseCirct_(false),
         Hls_(false),
         Md_(false),
+        NumJobs_(1),
         OptimizationLevel_(OptimizationLevel::O0),
         LanguageStandard_(LanguageStandard::None),
         OutputFile_("a.out")
@@ -441,6 +514,7 @@ public:
   Reset() noexcept override;
 
   bool OnlyPrintCommands_;
+  bool PrintCommandTimes_;
   bool GenerateDebugInformation_;
   bool Verbose_;
   bool Rdynamic_;
@@ -452,6 +526,8 @@ public:
 
   bool Md_;
 
+  size_t NumJobs_;
+
   OptimizationLevel OptimizationLevel_;
   LanguageStandard LanguageStandard_;
   util::filepath OutputFile_;
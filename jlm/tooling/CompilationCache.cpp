@@ -0,0 +1,239 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/tooling/CompilationCache.hpp>
+#include <jlm/util/common.hpp>
+
+#include <llvm/ADT/SmallString.h>
+#include <llvm/Support/MD5.h>
+
+#include <link.h>
+#include <sys/mman.h>
+
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+namespace jlm::tooling
+{
+
+/**
+ * Version of the cache layout. It must be incremented whenever the keys or the format of the
+ * cache entries change.
+ */
+static const char * CacheVersion = "jlm-compilation-cache-2";
+
+/**
+ * Stores the GNU build id of the executable in \p data, which points to a std::string.
+ */
+static int
+FindBuildId(dl_phdr_info * info, size_t, void * data)
+{
+  // The executable is always the first object that is visited
+  auto & buildId = *static_cast<std::string *>(data);
+  for (size_t n = 0; n < info->dlpi_phnum; n++)
+  {
+    auto & programHeader = info->dlpi_phdr[n];
+    if (programHeader.p_type != PT_NOTE)
+      continue;
+
+    size_t alignment = programHeader.p_align == 8 ? 8 : 4;
+    auto align = [&](size_t size)
+    {
+      return (size + alignment - 1) & ~(alignment - 1);
+    };
+
+    auto note = reinterpret_cast<const char *>(info->dlpi_addr + programHeader.p_vaddr);
+    auto end = note + programHeader.p_memsz;
+    while (note + sizeof(ElfW(Nhdr)) <= end)
+    {
+      auto noteHeader = reinterpret_cast<const ElfW(Nhdr) *>(note);
+      auto name = note + sizeof(ElfW(Nhdr));
+      auto description = name + align(noteHeader->n_namesz);
+      if (noteHeader->n_type == NT_GNU_BUILD_ID && noteHeader->n_namesz == 4
+          && std::memcmp(name, "GNU", 4) == 0)
+      {
+        buildId.assign(description, noteHeader->n_descsz);
+        return 1;
+      }
+
+      note = description + align(noteHeader->n_descsz);
+    }
+  }
+
+  return 1;
+}
+
+/**
+ * @return An identifier of the running jlc build. It is the GNU build id of the executable, or the
+ * hash of the executable's contents if the executable was linked without a build id.
+ */
+static std::string
+GetBuildId()
+{
+  std::string buildId;
+  dl_iterate_phdr(FindBuildId, &buildId);
+  if (!buildId.empty())
+    return buildId;
+
+  std::ifstream executable("/proc/self/exe", std::ios::binary);
+  ::llvm::MD5 hash;
+  char buffer[1 << 16];
+  while (executable.read(buffer, sizeof(buffer)) || executable.gcount() > 0)
+    hash.update(::llvm::StringRef(buffer, executable.gcount()));
+
+  ::llvm::MD5::MD5Result result;
+  hash.final(result);
+  return result.digest().str().str();
+}
+
+CompilationCache::~CompilationCache() noexcept
+{
+  munmap(Counters_, sizeof(Counters));
+}
+
+CompilationCache::CompilationCache(util::filepath directory)
+    : Directory_(std::move(directory))
+{
+  auto memory = mmap(
+      nullptr,
+      sizeof(Counters),
+      PROT_READ | PROT_WRITE,
+      MAP_SHARED | MAP_ANONYMOUS,
+      -1,
+      0);
+  if (memory == MAP_FAILED)
+    throw util::error("Cannot allocate compilation cache counters.");
+
+  Counters_ = new (memory) Counters();
+  Counters_->NumHits = 0;
+  Counters_->NumMisses = 0;
+}
+
+std::string
+CompilationCache::ComputeKey(
+    const std::string & commandLine,
+    const util::filepath & inputFile,
+    const std::vector<util::filepath> & tools) const
+{
+  std::ifstream input(inputFile.to_str(), std::ios::binary);
+  if (!input)
+    return "";
+
+  ::llvm::MD5 hash;
+  hash.update(CacheVersion);
+  hash.update(::llvm::StringRef("", 1));
+
+  // The running executable performs the in-process commands, and the external tools all others
+  static const std::string buildId = GetBuildId();
+  hash.update(buildId);
+  hash.update(::llvm::StringRef("", 1));
+
+  for (auto & tool : tools)
+  {
+    hash.update(tool.to_str());
+    hash.update(::llvm::StringRef("", 1));
+    hash.update(GetToolVersion(tool));
+    hash.update(::llvm::StringRef("", 1));
+  }
+
+  hash.update(commandLine);
+  hash.update(::llvm::StringRef("", 1));
+
+  char buffer[1 << 16];
+  while (input.read(buffer, sizeof(buffer)) || input.gcount() > 0)
+    hash.update(::llvm::StringRef(buffer, input.gcount()));
+
+  if (input.bad())
+    return "";
+
+  ::llvm::MD5::MD5Result result;
+  hash.final(result);
+  return result.digest().str().str();
+}
+
+bool
+CompilationCache::Retrieve(const std::string & key, const util::filepath & outputFile)
+{
+  std::error_code errorCode;
+  if (key.empty()
+      || !std::filesystem::copy_file(
+          GetEntryFile(key).to_str(),
+          outputFile.to_str(),
+          std::filesystem::copy_options::overwrite_existing,
+          errorCode))
+  {
+    Counters_->NumMisses++;
+    return false;
+  }
+
+  Counters_->NumHits++;
+  return true;
+}
+
+void
+CompilationCache::Store(const std::string & key, const util::filepath & outputFile) const
+{
+  if (key.empty())
+    return;
+
+  auto entryFile = GetEntryFile(key);
+  auto entryDirectory = util::filepath(entryFile.path());
+
+  std::error_code errorCode;
+  std::filesystem::create_directories(entryDirectory.to_str(), errorCode);
+  if (errorCode)
+    return;
+
+  // Publish the entry atomically, such that concurrent compilations never observe a partially
+  // written entry.
+  auto temporaryFile = util::filepath::CreateUniqueFileName(entryDirectory, key + "-", ".tmp");
+  std::filesystem::copy_file(outputFile.to_str(), temporaryFile.to_str(), errorCode);
+  if (!errorCode)
+    std::filesystem::rename(temporaryFile.to_str(), entryFile.to_str(), errorCode);
+
+  if (errorCode)
+    std::filesystem::remove(temporaryFile.to_str(), errorCode);
+}
+
+std::string
+CompilationCache::GetToolVersion(const util::filepath & tool) const
+{
+  std::lock_guard lock(ToolVersionsMutex_);
+  if (auto it = ToolVersions_.find(tool.to_str()); it != ToolVersions_.end())
+    return it->second;
+
+  std::string output;
+  if (auto pipe = popen((tool.to_str() + " --version 2>&1").c_str(), "r"))
+  {
+    char buffer[1 << 12];
+    size_t numBytes = 0;
+    while ((numBytes = fread(buffer, 1, sizeof(buffer), pipe)) > 0)
+      output.append(buffer, numBytes);
+    pclose(pipe);
+  }
+
+  // The host CPU is reported by LLVM tools, but only affects the output with -mcpu=native
+  std::istringstream lines(output);
+  std::string version;
+  for (std::string line; std::getline(lines, line);)
+  {
+    if (line.find("Host CPU:") == std::string::npos)
+      version += line + "\n";
+  }
+
+  return ToolVersions_[tool.to_str()] = version;
+}
+
+util::filepath
+CompilationCache::GetEntryFile(const std::string & key) const
+{
+  JLM_ASSERT(key.size() > 2);
+  return Directory_.to_str() + "/" + key.substr(0, 2) + "/" + key.substr(2);
+}
+
+}
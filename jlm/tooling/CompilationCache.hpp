@@ -0,0 +1,128 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_TOOLING_COMPILATIONCACHE_HPP
+#define JLM_TOOLING_COMPILATIONCACHE_HPP
+
+#include <jlm/util/file.hpp>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace jlm::tooling
+{
+
+/**
+ * The CompilationCache class represents an on-disk cache for the output files of commands. An
+ * output file is stored under a key that is derived from the contents of the command's input
+ * file, its command line, the build of jlc, and the external tools that produce the output file,
+ * such that the output can be reused by any later command with identical input, command line and
+ * tools.
+ *
+ * The cache can be shared between concurrently running processes. Entries are published
+ * atomically, and the hit and miss counters are kept in shared memory such that they also
+ * account for lookups in forked child processes.
+ */
+class CompilationCache final
+{
+  struct Counters
+  {
+    std::atomic<size_t> NumHits;
+    std::atomic<size_t> NumMisses;
+  };
+
+public:
+  ~CompilationCache() noexcept;
+
+  explicit CompilationCache(util::filepath directory);
+
+  CompilationCache(const CompilationCache &) = delete;
+
+  CompilationCache(CompilationCache &&) = delete;
+
+  CompilationCache &
+  operator=(const CompilationCache &) = delete;
+
+  CompilationCache &
+  operator=(CompilationCache &&) = delete;
+
+  [[nodiscard]] const util::filepath &
+  GetDirectory() const noexcept
+  {
+    return Directory_;
+  }
+
+  /**
+   * Computes the key of a command's output.
+   *
+   * @param commandLine The command line of the command. It must not contain any paths of
+   * temporary files.
+   * @param inputFile The input file of the command.
+   * @param tools The external tools that are executed by the command.
+   * @return The key, or an empty string if \p inputFile cannot be read.
+   */
+  [[nodiscard]] std::string
+  ComputeKey(
+      const std::string & commandLine,
+      const util::filepath & inputFile,
+      const std::vector<util::filepath> & tools) const;
+
+  /**
+   * Copies the cache entry \p key to \p outputFile, and counts the lookup as hit or miss.
+   *
+   * @return True if the cache contains an entry for \p key, otherwise false.
+   */
+  bool
+  Retrieve(const std::string & key, const util::filepath & outputFile);
+
+  /**
+   * Stores \p outputFile as the cache entry \p key. Failures to write the cache entry are
+   * ignored, as they only affect later compilations.
+   */
+  void
+  Store(const std::string & key, const util::filepath & outputFile) const;
+
+  [[nodiscard]] size_t
+  NumHits() const noexcept
+  {
+    return Counters_->NumHits;
+  }
+
+  [[nodiscard]] size_t
+  NumMisses() const noexcept
+  {
+    return Counters_->NumMisses;
+  }
+
+  static std::shared_ptr<CompilationCache>
+  Create(util::filepath directory)
+  {
+    return std::make_shared<CompilationCache>(std::move(directory));
+  }
+
+private:
+  [[nodiscard]] util::filepath
+  GetEntryFile(const std::string & key) const;
+
+  /**
+   * @return The version output of \p tool. It is computed once per tool and process.
+   */
+  [[nodiscard]] std::string
+  GetToolVersion(const util::filepath & tool) const;
+
+  util::filepath Directory_;
+  Counters * Counters_;
+
+  mutable std::mutex ToolVersionsMutex_;
+  mutable std::unordered_map<std::string, std::string> ToolVersions_;
+};
+
+}
+
+#endif
@@ -0,0 +1,105 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_UTIL_DENSEIDALLOCATOR_HPP
+#define JLM_UTIL_DENSEIDALLOCATOR_HPP
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace jlm::util
+{
+
+/**
+ * Hands out small integer ids, which are kept dense by reusing the ids of released objects. The
+ * ids can therefore be used to index flat side tables. Ids are only allocated and released under a
+ * lock while the allocator is in concurrent mode, such that the sequential path stays lock-free.
+ *
+ * @see SetConcurrent()
+ */
+class DenseIdAllocator final
+{
+public:
+  DenseIdAllocator() = default;
+
+  DenseIdAllocator(const DenseIdAllocator &) = delete;
+
+  DenseIdAllocator &
+  operator=(const DenseIdAllocator &) = delete;
+
+  /**
+   * @return An id that is currently not in use. The most recently released id is reused first.
+   */
+  [[nodiscard]] size_t
+  Allocate()
+  {
+    if (!Concurrent_)
+      return AllocateUnsynchronized();
+
+    std::lock_guard lock(Mutex_);
+    return AllocateUnsynchronized();
+  }
+
+  /**
+   * Releases \p id, such that it can be handed out again.
+   */
+  void
+  Free(size_t id)
+  {
+    if (!Concurrent_)
+    {
+      FreeIds_.push_back(id);
+      return;
+    }
+
+    std::lock_guard lock(Mutex_);
+    FreeIds_.push_back(id);
+  }
+
+  /**
+   * @return An upper bound on all ids that are currently in use.
+   */
+  [[nodiscard]] size_t
+  Bound() const
+  {
+    if (!Concurrent_)
+      return NumIds_;
+
+    std::lock_guard lock(Mutex_);
+    return NumIds_;
+  }
+
+  /**
+   * Enables or disables concurrent mode. Concurrent mode must be enabled while more than one thread
+   * allocates or releases ids, and must only be toggled while no other thread uses the allocator.
+   */
+  void
+  SetConcurrent(bool concurrent) noexcept
+  {
+    Concurrent_ = concurrent;
+  }
+
+private:
+  [[nodiscard]] size_t
+  AllocateUnsynchronized()
+  {
+    if (FreeIds_.empty())
+      return NumIds_++;
+
+    auto id = FreeIds_.back();
+    FreeIds_.pop_back();
+    return id;
+  }
+
+  bool Concurrent_ = false;
+  mutable std::mutex Mutex_;
+  size_t NumIds_ = 0;
+  std::vector<size_t> FreeIds_;
+};
+
+}
+
+#endif
@@ -0,0 +1,43 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_UTIL_HASH_HPP
+#define JLM_UTIL_HASH_HPP
+
+#include <cstddef>
+#include <functional>
+
+namespace jlm::util
+{
+
+/**
+ * Combines \p seed with the hash of \p value. The mixing function is the one used by
+ * boost::hash_combine.
+ *
+ * @param seed The hash to combine with. It is updated in place.
+ * @param value The value whose hash is mixed into \p seed.
+ */
+template<typename T>
+void
+CombineHashesWithSeed(std::size_t & seed, const T & value)
+{
+  seed ^= std::hash<T>()(value) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+/**
+ * Computes a combined hash of all \p args. The result depends on the order of the arguments.
+ */
+template<typename... Args>
+std::size_t
+CombineHashes(const Args &... args)
+{
+  std::size_t seed = 0;
+  (CombineHashesWithSeed(seed, args), ...);
+  return seed;
+}
+
+}
+
+#endif // JLM_UTIL_HASH_HPP
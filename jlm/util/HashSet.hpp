@@ -8,6 +8,7 @@
 
 #include <jlm/util/iterator_range.hpp>
 
+#include <cstddef>
 #include <unordered_set>
 
 namespace jlm::util
@@ -0,0 +1,184 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_UTIL_LRUCACHE_HPP
+#define JLM_UTIL_LRUCACHE_HPP
+
+#include <jlm/util/common.hpp>
+
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <unordered_map>
+#include <utility>
+
+namespace jlm::util
+{
+
+/**
+ * Cache with a fixed capacity that evicts the least recently used entry once the capacity is
+ * exceeded.
+ *
+ * The entries are kept in a list that is ordered by recency, and a hash map maps each key to its
+ * list element. Lookups, insertions, and evictions are therefore constant time operations.
+ *
+ * @tparam K The type of the keys.
+ * @tparam V The type of the cached values.
+ */
+template<typename K, typename V, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>>
+class LruCache final
+{
+  using Entry = std::pair<K, V>;
+  using EntryList = std::list<Entry>;
+
+public:
+  explicit LruCache(size_t capacity)
+      : Capacity_(capacity)
+  {
+    JLM_ASSERT(capacity > 0);
+  }
+
+  LruCache(const LruCache &) = delete;
+
+  LruCache &
+  operator=(const LruCache &) = delete;
+
+  /**
+   * @return The maximal number of entries in the cache.
+   */
+  [[nodiscard]] size_t
+  Capacity() const noexcept
+  {
+    return Capacity_;
+  }
+
+  [[nodiscard]] size_t
+  Size() const noexcept
+  {
+    return Map_.size();
+  }
+
+  [[nodiscard]] bool
+  IsEmpty() const noexcept
+  {
+    return Map_.empty();
+  }
+
+  /**
+   * Checks whether \p key is cached. In contrast to Lookup(), this does not affect the recency of
+   * the entry or the hit and miss counts.
+   */
+  [[nodiscard]] bool
+  Contains(const K & key) const
+  {
+    return Map_.find(key) != Map_.end();
+  }
+
+  /**
+   * Looks up the value cached for \p key and marks the entry as most recently used.
+   *
+   * @return A pointer to the cached value, or nullptr if \p key is not cached. The pointer is
+   * invalidated by the next call to Insert(), as it might evict the entry.
+   */
+  const V *
+  Lookup(const K & key)
+  {
+    auto it = Map_.find(key);
+    if (it == Map_.end())
+    {
+      NumMisses_++;
+      return nullptr;
+    }
+
+    NumHits_++;
+    Entries_.splice(Entries_.begin(), Entries_, it->second);
+    return &it->second->second;
+  }
+
+  /**
+   * Caches \p value for \p key, replacing any previously cached value. If the capacity of the
+   * cache is exceeded, the least recently used entry is evicted.
+   *
+   * @return A reference to the cached value.
+   */
+  const V &
+  Insert(const K & key, V value)
+  {
+    auto it = Map_.find(key);
+    if (it != Map_.end())
+    {
+      it->second->second = std::move(value);
+      Entries_.splice(Entries_.begin(), Entries_, it->second);
+      return it->second->second;
+    }
+
+    if (Map_.size() == Capacity_)
+    {
+      Map_.erase(Entries_.back().first);
+      Entries_.pop_back();
+      NumEvictions_++;
+    }
+
+    Entries_.emplace_front(key, std::move(value));
+    Map_[key] = Entries_.begin();
+    return Entries_.front().second;
+  }
+
+  /**
+   * Removes the entry of \p key from the cache.
+   *
+   * @return True if \p key was cached, otherwise false.
+   */
+  bool
+  Remove(const K & key)
+  {
+    auto it = Map_.find(key);
+    if (it == Map_.end())
+      return false;
+
+    Entries_.erase(it->second);
+    Map_.erase(it);
+    return true;
+  }
+
+  void
+  Clear() noexcept
+  {
+    Map_.clear();
+    Entries_.clear();
+  }
+
+  [[nodiscard]] size_t
+  NumHits() const noexcept
+  {
+    return NumHits_;
+  }
+
+  [[nodiscard]] size_t
+  NumMisses() const noexcept
+  {
+    return NumMisses_;
+  }
+
+  [[nodiscard]] size_t
+  NumEvictions() const noexcept
+  {
+    return NumEvictions_;
+  }
+
+private:
+  size_t Capacity_;
+  size_t NumHits_ = 0;
+  size_t NumMisses_ = 0;
+  size_t NumEvictions_ = 0;
+
+  // Ordered from the most to the least recently used entry
+  EntryList Entries_;
+  std::unordered_map<K, typename EntryList::iterator, Hash, KeyEqual> Map_;
+};
+
+}
+
+#endif // JLM_UTIL_LRUCACHE_HPP
@@ -0,0 +1,648 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/util/SlabAllocator.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <unordered_set>
+#include <vector>
+
+namespace jlm::util
+{
+
+static constexpr size_t NumSizeClasses = SlabAllocator::MaxObjectSize / SlabAllocator::Granularity;
+
+static_assert(
+    (SlabAllocator::ChunkSize & (SlabAllocator::ChunkSize - 1)) == 0,
+    "The chunk size must be a power of two.");
+
+namespace
+{
+
+/**
+ * A released object, which links to the next released object of the same chunk.
+ */
+struct FreeObject
+{
+  FreeObject * Next;
+};
+
+class ThreadCache;
+
+/**
+ * Header of a chunk, which is placed at the beginning of the chunk. Chunks are aligned to
+ * ChunkSize, such that the chunk of an object is determined by its address.
+ *
+ * A chunk only contains objects of a single size class and is owned by the thread cache that
+ * allocates from it. Only the owner accesses the free list, the bump region, and the number of used
+ * objects. Other threads push the objects they release onto the remote free list, which the owner
+ * collects. A chunk whose owner terminated is abandoned and guarded by the mutex of the global
+ * pool until another thread adopts it.
+ */
+struct Chunk
+{
+  Chunk(size_t sizeClass, ThreadCache * owner);
+
+  Chunk(const Chunk &) = delete;
+
+  Chunk &
+  operator=(const Chunk &) = delete;
+
+  [[nodiscard]] static Chunk &
+  Of(void * object) noexcept
+  {
+    auto address = reinterpret_cast<uintptr_t>(object) & ~(SlabAllocator::ChunkSize - 1);
+    return *reinterpret_cast<Chunk *>(address);
+  }
+
+  [[nodiscard]] bool
+  HasSpace() const noexcept
+  {
+    return FreeList != nullptr || static_cast<size_t>(End() - Position) >= ObjectSize;
+  }
+
+  void *
+  TryAllocate() noexcept
+  {
+    if (!HasSpace())
+      CollectRemoteObjects();
+
+    void * object = nullptr;
+    if (auto freeObject = FreeList)
+    {
+      FreeList = freeObject->Next;
+      object = freeObject;
+    }
+    else if (static_cast<size_t>(End() - Position) >= ObjectSize)
+    {
+      object = Position;
+      Position += ObjectSize;
+    }
+    else
+    {
+      return nullptr;
+    }
+
+    NumUsed++;
+    return object;
+  }
+
+  void
+  Push(void * object) noexcept
+  {
+    auto freeObject = static_cast<FreeObject *>(object);
+    freeObject->Next = FreeList;
+    FreeList = freeObject;
+    NumUsed--;
+  }
+
+  /**
+   * Moves the objects released by other threads to the free list.
+   */
+  void
+  CollectRemoteObjects() noexcept
+  {
+    auto freeObject = RemoteFreeList.exchange(nullptr, std::memory_order_acquire);
+    while (freeObject)
+    {
+      auto next = freeObject->Next;
+      Push(freeObject);
+      freeObject = next;
+    }
+  }
+
+  [[nodiscard]] const char *
+  End() const noexcept
+  {
+    return reinterpret_cast<const char *>(this) + SlabAllocator::ChunkSize;
+  }
+
+  const size_t SizeClass;
+  const size_t ObjectSize;
+
+  std::atomic<ThreadCache *> Owner;
+  std::atomic<FreeObject *> RemoteFreeList = nullptr;
+
+  FreeObject * FreeList = nullptr;
+  char * Position;
+
+  /**
+   * The number of objects that were handed out and not yet returned to the free list. Objects on
+   * the remote free list are still counted as used.
+   */
+  size_t NumUsed = 0;
+
+  /**
+   * Whether the chunk is behind the chunks with space in the chunk list of its owner.
+   */
+  bool Full = false;
+
+  /**
+   * Whether the chunk is in the pending chunks of its owner. Guarded by the global pool mutex.
+   */
+  bool Pending = false;
+
+  Chunk * Prev = nullptr;
+  Chunk * Next = nullptr;
+};
+
+static constexpr size_t ChunkHeaderSize =
+    (sizeof(Chunk) + SlabAllocator::Granularity - 1) / SlabAllocator::Granularity
+    * SlabAllocator::Granularity;
+
+Chunk::Chunk(size_t sizeClass, ThreadCache * owner)
+    : SizeClass(sizeClass),
+      ObjectSize((sizeClass + 1) * SlabAllocator::Granularity),
+      Owner(owner),
+      Position(reinterpret_cast<char *>(this) + ChunkHeaderSize)
+{}
+
+/**
+ * Doubly linked list of chunks.
+ */
+class ChunkList final
+{
+public:
+  [[nodiscard]] Chunk *
+  First() const noexcept
+  {
+    return First_;
+  }
+
+  void
+  PushFront(Chunk & chunk) noexcept
+  {
+    chunk.Prev = nullptr;
+    chunk.Next = First_;
+    if (First_)
+      First_->Prev = &chunk;
+    else
+      Last_ = &chunk;
+    First_ = &chunk;
+  }
+
+  void
+  PushBack(Chunk & chunk) noexcept
+  {
+    chunk.Prev = Last_;
+    chunk.Next = nullptr;
+    if (Last_)
+      Last_->Next = &chunk;
+    else
+      First_ = &chunk;
+    Last_ = &chunk;
+  }
+
+  void
+  Remove(Chunk & chunk) noexcept
+  {
+    if (chunk.Prev)
+      chunk.Prev->Next = chunk.Next;
+    else
+      First_ = chunk.Next;
+
+    if (chunk.Next)
+      chunk.Next->Prev = chunk.Prev;
+    else
+      Last_ = chunk.Prev;
+
+    chunk.Prev = chunk.Next = nullptr;
+  }
+
+private:
+  Chunk * First_ = nullptr;
+  Chunk * Last_ = nullptr;
+};
+
+/**
+ * State shared by all threads. It is never destroyed, such that objects can still be released
+ * during the destruction of static objects.
+ */
+struct GlobalPool
+{
+  std::mutex Mutex;
+  ChunkList AbandonedChunks[NumSizeClasses];
+  size_t NumChunks = 0;
+  std::unordered_set<const ThreadCache *> ThreadCaches;
+  size_t NumRetiredAllocations = 0;
+};
+
+GlobalPool &
+GetGlobalPool()
+{
+  static auto globalPool = new GlobalPool();
+  return *globalPool;
+}
+
+/**
+ * Requests a chunk from the heap. Requires the global pool mutex.
+ */
+Chunk &
+CreateChunk(GlobalPool & globalPool, size_t sizeClass, ThreadCache * owner)
+{
+  auto memory = ::operator new(SlabAllocator::ChunkSize, std::align_val_t(SlabAllocator::ChunkSize));
+  globalPool.NumChunks++;
+  return *new (memory) Chunk(sizeClass, owner);
+}
+
+/**
+ * Returns \p chunk to the heap. Requires the global pool mutex.
+ */
+void
+DestroyChunk(GlobalPool & globalPool, Chunk & chunk) noexcept
+{
+  chunk.~Chunk();
+  ::operator delete(&chunk, std::align_val_t(SlabAllocator::ChunkSize));
+  globalPool.NumChunks--;
+}
+
+/**
+ * Releases \p object of the abandoned \p chunk. Requires the global pool mutex.
+ */
+void
+FreeAbandoned(GlobalPool & globalPool, Chunk & chunk, void * object) noexcept
+{
+  chunk.CollectRemoteObjects();
+  chunk.Push(object);
+  if (chunk.NumUsed == 0)
+  {
+    globalPool.AbandonedChunks[chunk.SizeClass].Remove(chunk);
+    DestroyChunk(globalPool, chunk);
+  }
+}
+
+/**
+ * Chunks of a single thread.
+ */
+class ThreadCache final
+{
+public:
+  ~ThreadCache() noexcept;
+
+  ThreadCache();
+
+  void *
+  Allocate(size_t sizeClass)
+  {
+    NumAllocations_.store(
+        NumAllocations_.load(std::memory_order_relaxed) + 1,
+        std::memory_order_relaxed);
+
+    if (auto chunk = Chunks_[sizeClass].First())
+    {
+      if (auto object = chunk->TryAllocate())
+        return object;
+    }
+
+    return AllocateSlow(sizeClass);
+  }
+
+  /**
+   * Releases \p object of \p chunk, which is owned by this thread cache.
+   */
+  void
+  Free(Chunk & chunk, void * object) noexcept
+  {
+    chunk.Push(object);
+    if (chunk.NumUsed == 0)
+    {
+      auto & globalPool = GetGlobalPool();
+      std::lock_guard lock(globalPool.Mutex);
+      RetireChunk(globalPool, chunk);
+    }
+    else if (chunk.Full)
+    {
+      MoveToFront(chunk);
+    }
+  }
+
+  /**
+   * Registers \p chunk for the collection of its remote objects. Requires the global pool mutex.
+   */
+  void
+  AddPendingChunk(Chunk & chunk)
+  {
+    if (chunk.Pending)
+      return;
+
+    chunk.Pending = true;
+    PendingChunks_.push_back(&chunk);
+  }
+
+  [[nodiscard]] size_t
+  NumAllocations() const noexcept
+  {
+    return NumAllocations_.load(std::memory_order_relaxed);
+  }
+
+private:
+  void *
+  AllocateSlow(size_t sizeClass);
+
+  void
+  CollectPendingChunks(GlobalPool & globalPool) noexcept;
+
+  void
+  MoveToFront(Chunk & chunk) noexcept
+  {
+    auto & chunks = Chunks_[chunk.SizeClass];
+    chunks.Remove(chunk);
+    chunks.PushFront(chunk);
+    chunk.Full = false;
+  }
+
+  /**
+   * Removes the empty \p chunk from its chunk list. It is kept as spare chunk of its size class,
+   * such that alternating allocations and releases do not request a new chunk each time, and the
+   * previous spare chunk is returned to the heap. Requires the global pool mutex.
+   */
+  void
+  RetireChunk(GlobalPool & globalPool, Chunk & chunk) noexcept;
+
+  ChunkList Chunks_[NumSizeClasses];
+  Chunk * SpareChunks_[NumSizeClasses] = {};
+
+  // Chunks with objects on their remote free list. Guarded by the global pool mutex.
+  std::vector<Chunk *> PendingChunks_;
+
+  // Only written by the owning thread, but read by NumAllocations() from any thread.
+  std::atomic<size_t> NumAllocations_ = 0;
+};
+
+/**
+ * Set once the cache of the current thread is destroyed. Objects that are allocated afterwards by
+ * the thread are served from abandoned chunks.
+ */
+thread_local bool ThreadCacheDestroyed = false;
+
+ThreadCache::~ThreadCache() noexcept
+{
+  auto & globalPool = GetGlobalPool();
+  std::lock_guard lock(globalPool.Mutex);
+
+  for (auto chunk : PendingChunks_)
+    chunk->Pending = false;
+  PendingChunks_.clear();
+
+  for (size_t n = 0; n < NumSizeClasses; n++)
+  {
+    if (auto spareChunk = SpareChunks_[n])
+      DestroyChunk(globalPool, *spareChunk);
+
+    while (auto chunk = Chunks_[n].First())
+    {
+      Chunks_[n].Remove(*chunk);
+      chunk->CollectRemoteObjects();
+      if (chunk->NumUsed == 0)
+      {
+        DestroyChunk(globalPool, *chunk);
+        continue;
+      }
+
+      chunk->Owner.store(nullptr, std::memory_order_relaxed);
+      chunk->Full = false;
+      globalPool.AbandonedChunks[n].PushBack(*chunk);
+    }
+  }
+
+  globalPool.NumRetiredAllocations += NumAllocations();
+  globalPool.ThreadCaches.erase(this);
+  ThreadCacheDestroyed = true;
+}
+
+ThreadCache::ThreadCache()
+{
+  auto & globalPool = GetGlobalPool();
+  std::lock_guard lock(globalPool.Mutex);
+  globalPool.ThreadCaches.insert(this);
+}
+
+void *
+ThreadCache::AllocateSlow(size_t sizeClass)
+{
+  auto & globalPool = GetGlobalPool();
+  std::lock_guard lock(globalPool.Mutex);
+
+  CollectPendingChunks(globalPool);
+
+  // Move exhausted chunks behind the chunks with space
+  auto & chunks = Chunks_[sizeClass];
+  while (auto chunk = chunks.First())
+  {
+    if (auto object = chunk->TryAllocate())
+      return object;
+
+    if (chunk->Full)
+      break;
+
+    chunks.Remove(*chunk);
+    chunks.PushBack(*chunk);
+    chunk->Full = true;
+  }
+
+  if (auto spareChunk = SpareChunks_[sizeClass])
+  {
+    SpareChunks_[sizeClass] = nullptr;
+    chunks.PushFront(*spareChunk);
+    return spareChunk->TryAllocate();
+  }
+
+  // Adopt the chunks of terminated threads before a new chunk is requested
+  auto & abandonedChunks = globalPool.AbandonedChunks[sizeClass];
+  while (auto chunk = abandonedChunks.First())
+  {
+    abandonedChunks.Remove(*chunk);
+    chunk->CollectRemoteObjects();
+    if (chunk->NumUsed == 0)
+    {
+      DestroyChunk(globalPool, *chunk);
+      continue;
+    }
+
+    chunk->Owner.store(this, std::memory_order_relaxed);
+    if (chunk->HasSpace())
+    {
+      chunks.PushFront(*chunk);
+      return chunk->TryAllocate();
+    }
+
+    chunks.PushBack(*chunk);
+    chunk->Full = true;
+  }
+
+  auto & chunk = CreateChunk(globalPool, sizeClass, this);
+  chunks.PushFront(chunk);
+  return chunk.TryAllocate();
+}
+
+void
+ThreadCache::CollectPendingChunks(GlobalPool & globalPool) noexcept
+{
+  auto pendingChunks = std::move(PendingChunks_);
+  PendingChunks_.clear();
+
+  for (auto chunk : pendingChunks)
+  {
+    chunk->Pending = false;
+    chunk->CollectRemoteObjects();
+    if (chunk->NumUsed == 0)
+    {
+      RetireChunk(globalPool, *chunk);
+    }
+    else if (chunk->Full && chunk->HasSpace())
+    {
+      MoveToFront(*chunk);
+    }
+  }
+}
+
+void
+ThreadCache::RetireChunk(GlobalPool & globalPool, Chunk & chunk) noexcept
+{
+  if (chunk.Pending)
+  {
+    PendingChunks_.erase(std::find(PendingChunks_.begin(), PendingChunks_.end(), &chunk));
+    chunk.Pending = false;
+  }
+
+  Chunks_[chunk.SizeClass].Remove(chunk);
+  chunk.Full = false;
+
+  if (auto spareChunk = SpareChunks_[chunk.SizeClass])
+    DestroyChunk(globalPool, *spareChunk);
+  SpareChunks_[chunk.SizeClass] = &chunk;
+}
+
+ThreadCache *
+GetThreadCache()
+{
+  if (ThreadCacheDestroyed)
+    return nullptr;
+
+  thread_local ThreadCache threadCache;
+  return &threadCache;
+}
+
+/**
+ * Releases \p object of \p chunk, which is not owned by the current thread.
+ */
+void
+FreeRemote(Chunk & chunk, void * object) noexcept
+{
+  auto freeObject = static_cast<FreeObject *>(object);
+
+  // The owner already knows about a non-empty remote free list
+  auto head = chunk.RemoteFreeList.load(std::memory_order_relaxed);
+  while (head)
+  {
+    freeObject->Next = head;
+    if (chunk.RemoteFreeList.compare_exchange_weak(
+            head,
+            freeObject,
+            std::memory_order_release,
+            std::memory_order_relaxed))
+      return;
+  }
+
+  auto & globalPool = GetGlobalPool();
+  std::lock_guard lock(globalPool.Mutex);
+
+  auto owner = chunk.Owner.load(std::memory_order_relaxed);
+  if (owner == nullptr)
+  {
+    FreeAbandoned(globalPool, chunk, object);
+    return;
+  }
+
+  head = chunk.RemoteFreeList.load(std::memory_order_relaxed);
+  do
+  {
+    freeObject->Next = head;
+  } while (!chunk.RemoteFreeList.compare_exchange_weak(
+      head,
+      freeObject,
+      std::memory_order_release,
+      std::memory_order_relaxed));
+
+  owner->AddPendingChunk(chunk);
+}
+
+}
+
+void *
+SlabAllocator::Allocate(size_t size)
+{
+  if (size > MaxObjectSize)
+    return ::operator new(size);
+
+  auto sizeClass = size == 0 ? 0 : (size - 1) / Granularity;
+  if (auto threadCache = GetThreadCache())
+    return threadCache->Allocate(sizeClass);
+
+  auto & globalPool = GetGlobalPool();
+  std::lock_guard lock(globalPool.Mutex);
+  globalPool.NumRetiredAllocations++;
+
+  auto & abandonedChunks = globalPool.AbandonedChunks[sizeClass];
+  for (auto chunk = abandonedChunks.First(); chunk; chunk = chunk->Next)
+  {
+    if (auto object = chunk->TryAllocate())
+      return object;
+  }
+
+  auto & chunk = CreateChunk(globalPool, sizeClass, nullptr);
+  abandonedChunks.PushFront(chunk);
+  return chunk.TryAllocate();
+}
+
+void
+SlabAllocator::Free(void * object, size_t size) noexcept
+{
+  if (object == nullptr)
+    return;
+
+  if (size > MaxObjectSize)
+  {
+    ::operator delete(object);
+    return;
+  }
+
+  auto & chunk = Chunk::Of(object);
+  auto threadCache = GetThreadCache();
+  if (threadCache && chunk.Owner.load(std::memory_order_relaxed) == threadCache)
+  {
+    threadCache->Free(chunk, object);
+    return;
+  }
+
+  FreeRemote(chunk, object);
+}
+
+size_t
+SlabAllocator::NumAllocations() noexcept
+{
+  auto & globalPool = GetGlobalPool();
+  std::lock_guard lock(globalPool.Mutex);
+
+  auto numAllocations = globalPool.NumRetiredAllocations;
+  for (auto threadCache : globalPool.ThreadCaches)
+    numAllocations += threadCache->NumAllocations();
+
+  return numAllocations;
+}
+
+size_t
+SlabAllocator::NumChunks() noexcept
+{
+  auto & globalPool = GetGlobalPool();
+  std::lock_guard lock(globalPool.Mutex);
+  return globalPool.NumChunks;
+}
+
+}
@@ -0,0 +1,67 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_UTIL_SLABALLOCATOR_HPP
+#define JLM_UTIL_SLABALLOCATOR_HPP
+
+#include <cstddef>
+
+namespace jlm::util
+{
+
+/**
+ * Allocator for large numbers of small objects with a short and irregular lifetime, such as the
+ * nodes and ports of an RVSDG.
+ *
+ * Objects are rounded up to a multiple of Granularity bytes and carved out of chunks of ChunkSize
+ * bytes, where each chunk only holds objects of a single size class. A chunk is owned by the
+ * thread that allocates from it and keeps its own free list, such that neither allocations nor
+ * releases of the owning thread need any synchronization. Objects can be released by any thread.
+ * They are handed back to the owning thread, which reuses them. The chunks of a terminating thread
+ * are adopted by the other threads.
+ *
+ * A chunk is returned to the heap as soon as all of its objects are released, except for a single
+ * spare chunk per size class and thread. The memory of a destroyed graph is therefore given back
+ * to the heap, and a long-lived process does not keep its peak memory usage.
+ *
+ * Objects larger than MaxObjectSize are directly allocated from the heap.
+ */
+class SlabAllocator final
+{
+public:
+  static constexpr size_t Granularity = 16;
+
+  static constexpr size_t MaxObjectSize = 512;
+
+  static constexpr size_t ChunkSize = 64 * 1024;
+
+  /**
+   * Allocates \p size bytes aligned to Granularity.
+   */
+  [[nodiscard]] static void *
+  Allocate(size_t size);
+
+  /**
+   * Releases \p object, which was allocated by Allocate() with the same \p size.
+   */
+  static void
+  Free(void * object, size_t size) noexcept;
+
+  /**
+   * @return The number of objects allocated so far by all threads.
+   */
+  [[nodiscard]] static size_t
+  NumAllocations() noexcept;
+
+  /**
+   * @return The number of chunks currently allocated from the heap.
+   */
+  [[nodiscard]] static size_t
+  NumChunks() noexcept;
+};
+
+}
+
+#endif
@@ -0,0 +1,155 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_UTIL_SMALLVECTOR_HPP
+#define JLM_UTIL_SMALLVECTOR_HPP
+
+#include <jlm/util/common.hpp>
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <type_traits>
+
+namespace jlm::util
+{
+
+/**
+ * Vector of trivially copyable items, which stores up to \p N items inline and only allocates
+ * heap memory if it grows beyond that. It is meant for the many short sequences of a graph, such
+ * as the users of an output, where the bookkeeping of a std::vector or a hash set would dominate.
+ *
+ * @tparam T The item type.
+ * @tparam N The number of items stored inline.
+ */
+template<typename T, size_t N>
+class SmallVector final
+{
+  static_assert(std::is_trivially_copyable_v<T>, "Items must be trivially copyable.");
+  static_assert(N > 0, "At least one item must be stored inline.");
+
+public:
+  using const_iterator = const T *;
+
+  ~SmallVector() noexcept
+  {
+    if (!IsInline())
+      std::free(Data_);
+  }
+
+  SmallVector() noexcept
+      : Data_(Inline_),
+        Size_(0),
+        Capacity_(N)
+  {}
+
+  SmallVector(const SmallVector &) = delete;
+
+  SmallVector &
+  operator=(const SmallVector &) = delete;
+
+  [[nodiscard]] size_t
+  size() const noexcept
+  {
+    return Size_;
+  }
+
+  [[nodiscard]] bool
+  empty() const noexcept
+  {
+    return Size_ == 0;
+  }
+
+  [[nodiscard]] const T &
+  operator[](size_t index) const noexcept
+  {
+    JLM_ASSERT(index < Size_);
+    return Data_[index];
+  }
+
+  [[nodiscard]] T &
+  operator[](size_t index) noexcept
+  {
+    JLM_ASSERT(index < Size_);
+    return Data_[index];
+  }
+
+  [[nodiscard]] const T &
+  back() const noexcept
+  {
+    JLM_ASSERT(Size_ > 0);
+    return Data_[Size_ - 1];
+  }
+
+  void
+  push_back(const T & item)
+  {
+    if (Size_ == Capacity_)
+      Grow();
+
+    Data_[Size_++] = item;
+  }
+
+  void
+  pop_back() noexcept
+  {
+    JLM_ASSERT(Size_ > 0);
+    Size_--;
+  }
+
+  [[nodiscard]] const_iterator
+  begin() const noexcept
+  {
+    return Data_;
+  }
+
+  [[nodiscard]] const_iterator
+  end() const noexcept
+  {
+    return Data_ + Size_;
+  }
+
+  /**
+   * @return The number of heap bytes held by the vector.
+   */
+  [[nodiscard]] size_t
+  HeapSize() const noexcept
+  {
+    return IsInline() ? 0 : Capacity_ * sizeof(T);
+  }
+
+private:
+  [[nodiscard]] bool
+  IsInline() const noexcept
+  {
+    return Data_ == Inline_;
+  }
+
+  void
+  Grow()
+  {
+    auto capacity = 2 * static_cast<size_t>(Capacity_);
+    auto data = static_cast<T *>(IsInline() ? std::malloc(capacity * sizeof(T))
+                                            : std::realloc(Data_, capacity * sizeof(T)));
+    if (data == nullptr)
+      throw std::bad_alloc();
+
+    if (IsInline())
+      std::memcpy(data, Inline_, Size_ * sizeof(T));
+
+    Data_ = data;
+    Capacity_ = capacity;
+  }
+
+  T * Data_;
+  uint32_t Size_;
+  uint32_t Capacity_;
+  T Inline_[N];
+};
+
+}
+
+#endif
@@ -0,0 +1,572 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_UTIL_SPARSEBITVECTOR_HPP
+#define JLM_UTIL_SPARSEBITVECTOR_HPP
+
+#include <jlm/util/common.hpp>
+#include <jlm/util/Hash.hpp>
+#include <jlm/util/iterator_range.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+namespace jlm::util
+{
+
+/**
+ * Represents a set of unsigned integers as a sparse bit vector. The set is stored as a sorted
+ * vector of 64-bit words, where only words containing at least one item are present. Compared to
+ * HashSet, this makes unions, intersections, and comparisons of sets linear scans over contiguous
+ * memory, and iteration visits the items in ascending order.
+ *
+ * The interface mirrors the one of HashSet, such that the two can be used interchangeably.
+ *
+ * @tparam ItemType The unsigned integer type of the items in the set.
+ */
+template<typename ItemType>
+class SparseBitVector final
+{
+  static_assert(std::is_unsigned_v<ItemType>, "SparseBitVector requires unsigned item types.");
+
+  using WordType = uint64_t;
+
+  static constexpr size_t BitsPerWord = 64;
+
+  struct Word
+  {
+    // The index of the word, i.e., the word contains the items [Index * 64, Index * 64 + 63]
+    size_t Index;
+    WordType Bits;
+
+    bool
+    operator==(const Word & other) const noexcept
+    {
+      return Index == other.Index && Bits == other.Bits;
+    }
+  };
+
+  class ItemConstIterator final
+  {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = ItemType;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const ItemType *;
+    using reference = const ItemType &;
+
+  private:
+    friend SparseBitVector;
+
+    ItemConstIterator(
+        typename std::vector<Word>::const_iterator it,
+        typename std::vector<Word>::const_iterator end)
+        : It_(it),
+          End_(end),
+          RemainingBits_(it == end ? 0 : it->Bits),
+          Item_(0)
+    {
+      UpdateItem();
+    }
+
+  public:
+    const ItemType &
+    operator*() const
+    {
+      return Item_;
+    }
+
+    const ItemType *
+    operator->() const
+    {
+      return &Item_;
+    }
+
+    ItemConstIterator &
+    operator++()
+    {
+      // Clear the lowest set bit, and move on to the next word if none remain
+      RemainingBits_ &= RemainingBits_ - 1;
+      if (RemainingBits_ == 0)
+      {
+        ++It_;
+        RemainingBits_ = It_ == End_ ? 0 : It_->Bits;
+      }
+      UpdateItem();
+      return *this;
+    }
+
+    ItemConstIterator
+    operator++(int)
+    {
+      ItemConstIterator tmp = *this;
+      ++*this;
+      return tmp;
+    }
+
+    bool
+    operator==(const ItemConstIterator & other) const
+    {
+      return It_ == other.It_ && RemainingBits_ == other.RemainingBits_;
+    }
+
+    bool
+    operator!=(const ItemConstIterator & other) const
+    {
+      return !operator==(other);
+    }
+
+  private:
+    void
+    UpdateItem() noexcept
+    {
+      if (RemainingBits_ != 0)
+        Item_ = static_cast<ItemType>(It_->Index * BitsPerWord + __builtin_ctzll(RemainingBits_));
+    }
+
+    typename std::vector<Word>::const_iterator It_;
+    typename std::vector<Word>::const_iterator End_;
+    WordType RemainingBits_;
+    ItemType Item_;
+  };
+
+public:
+  ~SparseBitVector() noexcept = default;
+
+  SparseBitVector() = default;
+
+  SparseBitVector(std::initializer_list<ItemType> initializerList)
+  {
+    for (auto item : initializerList)
+      Insert(item);
+  }
+
+  SparseBitVector(const SparseBitVector & other) = default;
+
+  SparseBitVector(SparseBitVector && other) noexcept
+      : Words_(std::move(other.Words_)),
+        Size_(other.Size_)
+  {
+    other.Words_.clear();
+    other.Size_ = 0;
+  }
+
+  SparseBitVector &
+  operator=(const SparseBitVector & other) = default;
+
+  SparseBitVector &
+  operator=(SparseBitVector && other) noexcept
+  {
+    Words_ = std::move(other.Words_);
+    Size_ = other.Size_;
+    other.Words_.clear();
+    other.Size_ = 0;
+    return *this;
+  }
+
+  /**
+   * Removes all items from the set.
+   */
+  void
+  Clear() noexcept
+  {
+    Words_.clear();
+    Size_ = 0;
+  }
+
+  /**
+   * Determines whether the set contains the specified item.
+   *
+   * @param item The item to locate in the set.
+   * @return True if the set contains \p item, otherwise false.
+   */
+  bool
+  Contains(ItemType item) const noexcept
+  {
+    auto it = FindWord(item / BitsPerWord);
+    return it != Words_.end() && it->Index == item / BitsPerWord && (it->Bits & Mask(item)) != 0;
+  }
+
+  /**
+   * Determines whether the set is a subset of \p other.
+   *
+   * @param other The set to compare to.
+   * @return True if the set is a subset of \p other or equal to \p other, otherwise false.
+   */
+  bool
+  IsSubsetOf(const SparseBitVector & other) const noexcept
+  {
+    if (Size() > other.Size())
+      return false;
+
+    auto otherIt = other.Words_.begin();
+    for (auto & word : Words_)
+    {
+      while (otherIt != other.Words_.end() && otherIt->Index < word.Index)
+        ++otherIt;
+
+      if (otherIt == other.Words_.end() || otherIt->Index != word.Index
+          || (word.Bits & ~otherIt->Bits) != 0)
+        return false;
+    }
+
+    return true;
+  }
+
+  /**
+   * @return The number of items contained in the set.
+   */
+  [[nodiscard]] std::size_t
+  Size() const noexcept
+  {
+    return Size_;
+  }
+
+  /**
+   * @return True if the set is empty, otherwise false.
+   */
+  [[nodiscard]] bool
+  IsEmpty() const noexcept
+  {
+    return Size_ == 0;
+  }
+
+  /**
+   * @return The number of bytes allocated for storing the items of the set.
+   */
+  [[nodiscard]] std::size_t
+  NumAllocatedBytes() const noexcept
+  {
+    return Words_.capacity() * sizeof(Word);
+  }
+
+  /**
+   * Inserts the specified item into the set.
+   *
+   * @param item The item to add.
+   * @return True if \p item was added to the set. False if \p item was already present.
+   */
+  bool
+  Insert(ItemType item)
+  {
+    const size_t index = item / BitsPerWord;
+    auto it = FindWord(index);
+    if (it == Words_.end() || it->Index != index)
+      it = Words_.insert(it, { index, 0 });
+
+    if (it->Bits & Mask(item))
+      return false;
+
+    it->Bits |= Mask(item);
+    Size_++;
+    return true;
+  }
+
+  /**
+   * Removes the specified item from the set.
+   *
+   * @param item The item to remove.
+   * @return True if \p item was found and removed. False if \p item was not found.
+   */
+  bool
+  Remove(ItemType item)
+  {
+    const size_t index = item / BitsPerWord;
+    auto it = FindWord(index);
+    if (it == Words_.end() || it->Index != index || (it->Bits & Mask(item)) == 0)
+      return false;
+
+    it->Bits &= ~Mask(item);
+    if (it->Bits == 0)
+      Words_.erase(it);
+    Size_--;
+    return true;
+  }
+
+  /**
+   * Get an iterator_range for iterating through the items of the set in ascending order.
+   *
+   * @return An iterator_range.
+   */
+  [[nodiscard]] iterator_range<ItemConstIterator>
+  Items() const noexcept
+  {
+    return { ItemConstIterator(Words_.begin(), Words_.end()),
+             ItemConstIterator(Words_.end(), Words_.end()) };
+  }
+
+  /**
+   * Modifies the set to contain all items that are present in itself, \p other, or both.
+   *
+   * @param other A set to union with.
+   * @return True if items were added to the set, otherwise false.
+   */
+  bool
+  UnionWith(const SparseBitVector & other)
+  {
+    return UnionWith(other, nullptr);
+  }
+
+  /**
+   * Modifies the set to contain all items that are present in itself, \p other, or both. All
+   * items that were not present in the set before are also added to \p newItems.
+   *
+   * @param other A set to union with.
+   * @param newItems The set receiving the items that were added. Can not be \p other or this set.
+   * @return True if items were added to the set, otherwise false.
+   */
+  bool
+  UnionWith(const SparseBitVector & other, SparseBitVector & newItems)
+  {
+    JLM_ASSERT(&newItems != this && &newItems != &other);
+    return UnionWith(other, &newItems);
+  }
+
+  /**
+   * Modifies the set to contain only items that are present in itself and \p other.
+   *
+   * @param other A set to intersect with.
+   */
+  void
+  IntersectWith(const SparseBitVector & other)
+  {
+    auto otherIt = other.Words_.begin();
+    auto out = Words_.begin();
+    Size_ = 0;
+    for (auto & word : Words_)
+    {
+      while (otherIt != other.Words_.end() && otherIt->Index < word.Index)
+        ++otherIt;
+
+      if (otherIt == other.Words_.end())
+        break;
+
+      if (otherIt->Index == word.Index && (word.Bits & otherIt->Bits) != 0)
+      {
+        *out = { word.Index, word.Bits & otherIt->Bits };
+        Size_ += __builtin_popcountll(out->Bits);
+        ++out;
+      }
+    }
+    Words_.erase(out, Words_.end());
+  }
+
+  /**
+   * Removes all items that are present in \p other from the set.
+   *
+   * @param other The set of items to remove.
+   */
+  void
+  DifferenceWith(const SparseBitVector & other)
+  {
+    auto otherIt = other.Words_.begin();
+    auto out = Words_.begin();
+    Size_ = 0;
+    for (auto & word : Words_)
+    {
+      while (otherIt != other.Words_.end() && otherIt->Index < word.Index)
+        ++otherIt;
+
+      auto bits = word.Bits;
+      if (otherIt != other.Words_.end() && otherIt->Index == word.Index)
+        bits &= ~otherIt->Bits;
+
+      if (bits != 0)
+      {
+        *out = { word.Index, bits };
+        Size_ += __builtin_popcountll(bits);
+        ++out;
+      }
+    }
+    Words_.erase(out, Words_.end());
+  }
+
+  /**
+   * Removes all items that match the condition defined by \p match from the set.
+   *
+   * @tparam F A type supporting function call operator: bool operator(const ItemType&)
+   * @param match Defines the condition of the items to remove.
+   * @return The number of items that were removed from the set.
+   */
+  template<typename F>
+  size_t
+  RemoveWhere(const F & match)
+  {
+    std::vector<ItemType> toRemove;
+    for (auto item : Items())
+    {
+      if (match(item))
+        toRemove.push_back(item);
+    }
+
+    for (auto item : toRemove)
+      Remove(item);
+
+    return toRemove.size();
+  }
+
+  bool
+  operator==(const SparseBitVector & other) const noexcept
+  {
+    return Size_ == other.Size_ && Words_ == other.Words_;
+  }
+
+  bool
+  operator!=(const SparseBitVector & other) const noexcept
+  {
+    return !operator==(other);
+  }
+
+  /**
+   * @return A hash value of the items in the set. Equal sets have equal hash values.
+   */
+  [[nodiscard]] std::size_t
+  Hash() const noexcept
+  {
+    std::size_t seed = 0;
+    for (auto & word : Words_)
+    {
+      CombineHashesWithSeed(seed, word.Index);
+      CombineHashesWithSeed(seed, word.Bits);
+    }
+
+    return seed;
+  }
+
+private:
+  static constexpr WordType
+  Mask(ItemType item) noexcept
+  {
+    return WordType(1) << (item % BitsPerWord);
+  }
+
+  /**
+   * @return the first word with an index that is not less than \p index
+   */
+  typename std::vector<Word>::iterator
+  FindWord(size_t index) noexcept
+  {
+    return std::lower_bound(
+        Words_.begin(),
+        Words_.end(),
+        index,
+        [](const Word & word, size_t index)
+        {
+          return word.Index < index;
+        });
+  }
+
+  typename std::vector<Word>::const_iterator
+  FindWord(size_t index) const noexcept
+  {
+    return const_cast<SparseBitVector *>(this)->FindWord(index);
+  }
+
+  bool
+  UnionWith(const SparseBitVector & other, SparseBitVector * newItems)
+  {
+    if (&other == this || other.IsEmpty())
+      return false;
+
+    // Merge both sorted word vectors into a new vector, unless other only adds bits to existing
+    // words, in which case the words are updated in place.
+    bool needsNewWords = false;
+    auto it = Words_.begin();
+    for (auto & otherWord : other.Words_)
+    {
+      while (it != Words_.end() && it->Index < otherWord.Index)
+        ++it;
+
+      if (it == Words_.end() || it->Index != otherWord.Index)
+      {
+        needsNewWords = true;
+        break;
+      }
+    }
+
+    const auto sizeBefore = Size_;
+    if (!needsNewWords)
+    {
+      it = Words_.begin();
+      for (auto & otherWord : other.Words_)
+      {
+        while (it->Index < otherWord.Index)
+          ++it;
+
+        UnionWord(*it, otherWord.Bits, newItems);
+      }
+      return Size_ != sizeBefore;
+    }
+
+    std::vector<Word> words;
+    words.reserve(Words_.size() + other.Words_.size());
+    it = Words_.begin();
+    auto otherIt = other.Words_.begin();
+    while (it != Words_.end() || otherIt != other.Words_.end())
+    {
+      if (otherIt == other.Words_.end() || (it != Words_.end() && it->Index < otherIt->Index))
+      {
+        words.push_back(*it++);
+      }
+      else if (it == Words_.end() || otherIt->Index < it->Index)
+      {
+        words.push_back({ otherIt->Index, 0 });
+        UnionWord(words.back(), otherIt->Bits, newItems);
+        ++otherIt;
+      }
+      else
+      {
+        words.push_back(*it++);
+        UnionWord(words.back(), otherIt->Bits, newItems);
+        ++otherIt;
+      }
+    }
+    Words_ = std::move(words);
+
+    return Size_ != sizeBefore;
+  }
+
+  void
+  UnionWord(Word & word, WordType bits, SparseBitVector * newItems)
+  {
+    const auto added = bits & ~word.Bits;
+    if (added == 0)
+      return;
+
+    word.Bits |= added;
+    Size_ += __builtin_popcountll(added);
+
+    // Words are produced in ascending order, so new words can be appended to newItems
+    if (newItems)
+      newItems->InsertWord(word.Index, added);
+  }
+
+  void
+  InsertWord(size_t index, WordType bits)
+  {
+    auto it = Words_.end();
+    if (Words_.empty() || Words_.back().Index < index)
+      it = Words_.insert(Words_.end(), { index, 0 });
+    else
+    {
+      it = FindWord(index);
+      if (it == Words_.end() || it->Index != index)
+        it = Words_.insert(it, { index, 0 });
+    }
+
+    Size_ += __builtin_popcountll(bits & ~it->Bits);
+    it->Bits |= bits;
+  }
+
+  std::vector<Word> Words_;
+  size_t Size_ = 0;
+};
+
+}
+
+#endif // JLM_UTIL_SPARSEBITVECTOR_HPP
@@ -0,0 +1,157 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <jlm/util/common.hpp>
+#include <jlm/util/ThreadPool.hpp>
+
+namespace jlm::util
+{
+
+ThreadPool::~ThreadPool() noexcept
+{
+  {
+    std::lock_guard<std::mutex> guard(Mutex_);
+    ShuttingDown_ = true;
+  }
+  BatchStarted_.notify_all();
+
+  for (auto & thread : Threads_)
+    thread.join();
+}
+
+ThreadPool::ThreadPool(size_t numThreads)
+{
+  JLM_ASSERT(numThreads > 0);
+
+  for (size_t n = 0; n < numThreads; n++)
+    Queues_.push_back(std::make_unique<Queue>());
+
+  // Worker 0 is the thread that invokes Run()
+  for (size_t n = 1; n < numThreads; n++)
+    Threads_.emplace_back(&ThreadPool::WorkerLoop, this, n);
+}
+
+void
+ThreadPool::Run(std::vector<Task> tasks)
+{
+  {
+    std::lock_guard<std::mutex> guard(Mutex_);
+    JLM_ASSERT(NumBusyThreads_ == 0);
+
+    Tasks_ = std::move(tasks);
+    for (size_t n = 0; n < Tasks_.size(); n++)
+      Queues_[n % NumThreads()]->Tasks.push_front(n);
+
+    Exception_ = nullptr;
+    NumBusyThreads_ = Threads_.size();
+    Batch_++;
+  }
+  BatchStarted_.notify_all();
+
+  ExecuteTasks(0);
+
+  std::exception_ptr exception;
+  {
+    std::unique_lock<std::mutex> lock(Mutex_);
+    BatchFinished_.wait(
+        lock,
+        [&]()
+        {
+          return NumBusyThreads_ == 0;
+        });
+
+    Tasks_.clear();
+    std::swap(exception, Exception_);
+  }
+
+  if (exception)
+    std::rethrow_exception(exception);
+}
+
+void
+ThreadPool::WorkerLoop(size_t workerIndex)
+{
+  size_t batch = 0;
+  while (true)
+  {
+    {
+      std::unique_lock<std::mutex> lock(Mutex_);
+      BatchStarted_.wait(
+          lock,
+          [&]()
+          {
+            return ShuttingDown_ || Batch_ != batch;
+          });
+
+      if (ShuttingDown_)
+        return;
+
+      batch = Batch_;
+    }
+
+    ExecuteTasks(workerIndex);
+
+    bool isLastThread = false;
+    {
+      std::lock_guard<std::mutex> guard(Mutex_);
+      isLastThread = --NumBusyThreads_ == 0;
+    }
+
+    if (isLastThread)
+      BatchFinished_.notify_all();
+  }
+}
+
+void
+ThreadPool::ExecuteTasks(size_t workerIndex)
+{
+  size_t task = 0;
+  while (TryPopTask(workerIndex, task))
+  {
+    try
+    {
+      Tasks_[task](workerIndex);
+    }
+    catch (...)
+    {
+      std::lock_guard<std::mutex> guard(Mutex_);
+      if (!Exception_)
+        Exception_ = std::current_exception();
+    }
+  }
+}
+
+bool
+ThreadPool::TryPopTask(size_t workerIndex, size_t & task)
+{
+  auto & ownQueue = *Queues_[workerIndex];
+  {
+    std::lock_guard<std::mutex> guard(ownQueue.Mutex);
+    if (!ownQueue.Tasks.empty())
+    {
+      task = ownQueue.Tasks.back();
+      ownQueue.Tasks.pop_back();
+      return true;
+    }
+  }
+
+  // Tasks are never added while a batch is executed. Thus, a worker is done once all queues
+  // were empty.
+  for (size_t n = 1; n < NumThreads(); n++)
+  {
+    auto & victimQueue = *Queues_[(workerIndex + n) % NumThreads()];
+    std::lock_guard<std::mutex> guard(victimQueue.Mutex);
+    if (!victimQueue.Tasks.empty())
+    {
+      task = victimQueue.Tasks.front();
+      victimQueue.Tasks.pop_front();
+      return true;
+    }
+  }
+
+  return false;
+}
+
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_UTIL_THREADPOOL_HPP
+#define JLM_UTIL_THREADPOOL_HPP
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace jlm::util
+{
+
+/**
+ * A fixed set of worker threads that executes batches of independent tasks.
+ *
+ * Every worker owns a task queue. The tasks of a batch are distributed round-robin over the
+ * queues, and every worker first drains its own queue from the back before it steals tasks from
+ * the front of the queues of the other workers. The thread that invokes Run() acts as worker 0,
+ * such that a pool with a single thread executes all tasks on the calling thread.
+ */
+class ThreadPool final
+{
+public:
+  /**
+   * A task is invoked with the index of the worker that executes it. The index is in the range
+   * [0, NumThreads()) and permits tasks to accumulate per-worker data without synchronization.
+   */
+  using Task = std::function<void(size_t)>;
+
+  ~ThreadPool() noexcept;
+
+  explicit ThreadPool(size_t numThreads);
+
+  ThreadPool(const ThreadPool &) = delete;
+
+  ThreadPool(ThreadPool &&) = delete;
+
+  ThreadPool &
+  operator=(const ThreadPool &) = delete;
+
+  ThreadPool &
+  operator=(ThreadPool &&) = delete;
+
+  /**
+   * @return The number of workers, including the thread that invokes Run().
+   */
+  [[nodiscard]] size_t
+  NumThreads() const noexcept
+  {
+    return Queues_.size();
+  }
+
+  /**
+   * Executes all \p tasks and blocks until they are finished. If a task throws, the remaining
+   * tasks are still executed and the first exception is rethrown afterwards.
+   *
+   * @param tasks The tasks of the batch. Tasks with a lower index are started earlier.
+   */
+  void
+  Run(std::vector<Task> tasks);
+
+private:
+  struct Queue
+  {
+    std::mutex Mutex;
+    std::deque<size_t> Tasks;
+  };
+
+  void
+  WorkerLoop(size_t workerIndex);
+
+  void
+  ExecuteTasks(size_t workerIndex);
+
+  bool
+  TryPopTask(size_t workerIndex, size_t & task);
+
+  std::vector<std::unique_ptr<Queue>> Queues_;
+  std::vector<std::thread> Threads_;
+  std::vector<Task> Tasks_;
+
+  std::mutex Mutex_;
+  std::condition_variable BatchStarted_;
+  std::condition_variable BatchFinished_;
+  size_t Batch_ = 0;
+  size_t NumBusyThreads_ = 0;
+  bool ShuttingDown_ = false;
+  std::exception_ptr Exception_;
+};
+
+}
+
+#endif // JLM_UTIL_THREADPOOL_HPP
@@ -0,0 +1,222 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#ifndef JLM_UTIL_UNIONFIND_HPP
+#define JLM_UTIL_UNIONFIND_HPP
+
+#include <jlm/util/common.hpp>
+#include <jlm/util/iterator_range.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace jlm::util
+{
+
+/**
+ * Union-find data structure over the dense indices 0, ..., NumElements() - 1.
+ *
+ * In contrast to \ref disjointset, the elements are not hashed and not individually allocated.
+ * The parents, ranks, and members of all elements are kept in flat vectors indexed by the
+ * elements. Find() performs path compression and Union() performs union by rank, such that
+ * a sequence of operations runs in nearly linear time.
+ *
+ * The members of a set are kept in an intrusive circular list, which is spliced in constant time
+ * by Union(). This permits to enumerate the members of a set without touching any other element.
+ */
+class UnionFind final
+{
+public:
+  class MemberIterator final
+  {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const size_t *;
+    using reference = const size_t &;
+
+    MemberIterator(const UnionFind * unionFind, size_t first, size_t element)
+        : UnionFind_(unionFind),
+          First_(first),
+          Element_(element)
+    {}
+
+    reference
+    operator*() const noexcept
+    {
+      return Element_;
+    }
+
+    MemberIterator &
+    operator++() noexcept
+    {
+      Element_ = UnionFind_->Next_[Element_];
+      if (Element_ == First_)
+        Element_ = End;
+
+      return *this;
+    }
+
+    MemberIterator
+    operator++(int) noexcept
+    {
+      auto tmp = *this;
+      ++*this;
+      return tmp;
+    }
+
+    bool
+    operator==(const MemberIterator & other) const noexcept
+    {
+      return Element_ == other.Element_;
+    }
+
+    bool
+    operator!=(const MemberIterator & other) const noexcept
+    {
+      return !operator==(other);
+    }
+
+  private:
+    const UnionFind * UnionFind_;
+    size_t First_;
+    size_t Element_;
+  };
+
+  /**
+   * Inserts a new element that forms a set on its own.
+   *
+   * @return The index of the new element.
+   */
+  size_t
+  Insert()
+  {
+    auto element = Parents_.size();
+    Parents_.push_back(element);
+    Ranks_.push_back(0);
+    Next_.push_back(element);
+    Sizes_.push_back(1);
+    NumSets_++;
+
+    return element;
+  }
+
+  /**
+   * Reserves space for \p numElements elements.
+   */
+  void
+  Reserve(size_t numElements)
+  {
+    Parents_.reserve(numElements);
+    Ranks_.reserve(numElements);
+    Next_.reserve(numElements);
+    Sizes_.reserve(numElements);
+  }
+
+  /**
+   * @return The root element of the set containing \p element.
+   */
+  size_t
+  Find(size_t element) const noexcept
+  {
+    JLM_ASSERT(element < NumElements());
+
+    auto root = element;
+    while (Parents_[root] != root)
+      root = Parents_[root];
+
+    // Path compression
+    while (Parents_[element] != root)
+    {
+      auto parent = Parents_[element];
+      Parents_[element] = root;
+      element = parent;
+    }
+
+    return root;
+  }
+
+  /**
+   * Unifies the sets containing \p element1 and \p element2.
+   *
+   * @return The root element of the unified set.
+   */
+  size_t
+  Union(size_t element1, size_t element2) noexcept
+  {
+    auto root1 = Find(element1);
+    auto root2 = Find(element2);
+    if (root1 == root2)
+      return root1;
+
+    // Union by rank
+    if (Ranks_[root1] < Ranks_[root2])
+      std::swap(root1, root2);
+    if (Ranks_[root1] == Ranks_[root2])
+      Ranks_[root1]++;
+
+    Parents_[root2] = root1;
+    Sizes_[root1] += Sizes_[root2];
+    std::swap(Next_[root1], Next_[root2]);
+    NumSets_--;
+
+    return root1;
+  }
+
+  [[nodiscard]] bool
+  IsRoot(size_t element) const noexcept
+  {
+    JLM_ASSERT(element < NumElements());
+    return Parents_[element] == element;
+  }
+
+  /**
+   * @return The number of members of the set containing \p element.
+   */
+  [[nodiscard]] size_t
+  NumMembers(size_t element) const noexcept
+  {
+    return Sizes_[Find(element)];
+  }
+
+  /**
+   * @return The members of the set containing \p element.
+   */
+  [[nodiscard]] iterator_range<MemberIterator>
+  Members(size_t element) const noexcept
+  {
+    JLM_ASSERT(element < NumElements());
+    return { MemberIterator(this, element, element), MemberIterator(this, element, End) };
+  }
+
+  [[nodiscard]] size_t
+  NumElements() const noexcept
+  {
+    return Parents_.size();
+  }
+
+  [[nodiscard]] size_t
+  NumSets() const noexcept
+  {
+    return NumSets_;
+  }
+
+private:
+  static constexpr size_t End = SIZE_MAX;
+
+  size_t NumSets_ = 0;
+  mutable std::vector<size_t> Parents_;
+  std::vector<uint8_t> Ranks_;
+  std::vector<size_t> Next_;
+  std::vector<size_t> Sizes_;
+};
+
+}
+
+#endif
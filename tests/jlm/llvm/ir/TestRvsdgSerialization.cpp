@@ -0,0 +1,212 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <test-registry.hpp>
+#include <TestRvsdgs.hpp>
+
+#include <jlm/llvm/ir/operators/delta.hpp>
+#include <jlm/llvm/ir/operators/lambda.hpp>
+#include <jlm/llvm/ir/operators/operators.hpp>
+#include <jlm/llvm/ir/RvsdgModule.hpp>
+#include <jlm/llvm/ir/RvsdgSerialization.hpp>
+#include <jlm/rvsdg/traverser.hpp>
+
+#include <cassert>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+
+/**
+ * Serializes \p rvsdgModule, deserializes it again, and checks that the deserialized module is
+ * structurally identical by serializing it a second time.
+ */
+static void
+AssertRoundTrip(const jlm::llvm::RvsdgModule & rvsdgModule)
+{
+  using namespace jlm::llvm;
+
+  // Act
+  auto bytes = SerializeRvsdgModule(rvsdgModule);
+  auto deserializedModule = DeserializeRvsdgModule(bytes.data(), bytes.size());
+
+  // Assert
+  auto & root = *rvsdgModule.Rvsdg().root();
+  auto & deserializedRoot = *deserializedModule->Rvsdg().root();
+  assert(jlm::rvsdg::nnodes(&deserializedRoot) == jlm::rvsdg::nnodes(&root));
+  assert(deserializedRoot.narguments() == root.narguments());
+  assert(deserializedRoot.nresults() == root.nresults());
+  for (size_t n = 0; n < root.narguments(); n++)
+    assert(deserializedRoot.argument(n)->port() == root.argument(n)->port());
+  for (size_t n = 0; n < root.nresults(); n++)
+    assert(deserializedRoot.result(n)->port() == root.result(n)->port());
+
+  assert(SerializeRvsdgModule(*deserializedModule) == bytes);
+}
+
+static void
+TestRoundTrip()
+{
+  using namespace jlm::tests;
+
+  AssertRoundTrip(StoreTest1().module());
+  AssertRoundTrip(LoadFromUndefTest().module());
+  AssertRoundTrip(BitCastTest().module());
+  AssertRoundTrip(Bits2PtrTest().module());
+  AssertRoundTrip(ConstantPointerNullTest().module());
+  AssertRoundTrip(CallTest1().module());
+  AssertRoundTrip(IndirectCallTest2().module());
+  AssertRoundTrip(GammaTest().module());
+  AssertRoundTrip(GammaTest2().module());
+  AssertRoundTrip(ThetaTest().module());
+  AssertRoundTrip(DeltaTest3().module());
+  AssertRoundTrip(ImportTest().module());
+  AssertRoundTrip(PhiTest2().module());
+  AssertRoundTrip(MemcpyTest().module());
+  AssertRoundTrip(FreeNullTest().module());
+}
+
+static void
+TestStructType()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  auto declaration = jlm::rvsdg::rcddeclaration::create({ &jlm::rvsdg::bit32 });
+  PointerType pointerType;
+  declaration->append(pointerType);
+  auto structType = StructType::Create("list", false, *declaration);
+
+  RvsdgModule rvsdgModule(jlm::util::filepath(""), "", "");
+  auto & rvsdg = rvsdgModule.Rvsdg();
+
+  auto deltaNode = delta::node::Create(
+      rvsdg.root(),
+      *structType,
+      "head",
+      linkage::external_linkage,
+      "",
+      false);
+  auto zero = ConstantAggregateZero::Create(*deltaNode->subregion(), *structType);
+  auto output = deltaNode->finalize(zero);
+  rvsdg.add_export(output, { pointerType, "head" });
+
+  // Act
+  auto bytes = SerializeRvsdgModule(rvsdgModule);
+  auto deserializedModule = DeserializeRvsdgModule(bytes.data(), bytes.size());
+
+  // Assert
+  auto & root = *deserializedModule->Rvsdg().root();
+  auto deserializedDelta = dynamic_cast<const delta::node *>(root.nodes.first());
+  assert(deserializedDelta != nullptr);
+
+  auto deserializedType = dynamic_cast<const StructType *>(&deserializedDelta->type());
+  assert(deserializedType != nullptr);
+  assert(deserializedType->GetName() == "list");
+  assert(deserializedType->GetDeclaration().nelements() == 2);
+  assert(deserializedType->GetDeclaration().element(0) == jlm::rvsdg::bit32);
+  assert(deserializedType->GetDeclaration().element(1) == pointerType);
+
+  assert(SerializeRvsdgModule(*deserializedModule) == bytes);
+}
+
+static void
+TestModuleProperties()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  jlm::tests::ThetaTest thetaTest;
+  auto & rvsdgModule = thetaTest.module();
+
+  // Act
+  auto bytes = SerializeRvsdgModule(rvsdgModule);
+  auto deserializedModule = DeserializeRvsdgModule(bytes.data(), bytes.size());
+
+  // Assert
+  assert(deserializedModule->SourceFileName() == rvsdgModule.SourceFileName());
+  assert(deserializedModule->TargetTriple() == rvsdgModule.TargetTriple());
+  assert(deserializedModule->DataLayout() == rvsdgModule.DataLayout());
+
+  auto & root = *deserializedModule->Rvsdg().root();
+  assert(root.nnodes() == 1);
+  auto lambda = dynamic_cast<const lambda::node *>(root.nodes.first());
+  assert(lambda != nullptr);
+  assert(lambda->name() == thetaTest.lambda->name());
+  assert(lambda->type() == thetaTest.lambda->type());
+  assert(lambda->linkage() == thetaTest.lambda->linkage());
+  assert(lambda->subregion()->nnodes() == thetaTest.lambda->subregion()->nnodes());
+}
+
+static void
+TestMemoryMappedFile()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  jlm::tests::PhiTest1 phiTest;
+  auto bytes = SerializeRvsdgModule(phiTest.module());
+
+  auto file = jlm::util::filepath::CreateUniqueFileName(
+      { std::filesystem::temp_directory_path() },
+      "TestRvsdgSerialization-",
+      ".rvsdg");
+  {
+    std::ofstream stream(file.to_str(), std::ios::binary);
+    stream.write(reinterpret_cast<const char *>(bytes.data()), bytes.size());
+  }
+
+  // Act
+  auto rvsdgModule = ReadRvsdgModuleFile(file);
+
+  // Assert
+  assert(SerializeRvsdgModule(*rvsdgModule) == bytes);
+
+  std::filesystem::remove(file.to_str());
+}
+
+static void
+TestMalformedInput()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  auto bytes = SerializeRvsdgModule(jlm::tests::CallTest1().module());
+
+  auto throwsError = [](const std::vector<uint8_t> & bytes)
+  {
+    try
+    {
+      (void)DeserializeRvsdgModule(bytes.data(), bytes.size());
+    }
+    catch (jlm::util::error &)
+    {
+      return true;
+    }
+
+    return false;
+  };
+
+  // Act & Assert
+  auto wrongMagicNumber = bytes;
+  wrongMagicNumber[0] = 'X';
+  assert(throwsError(wrongMagicNumber));
+
+  for (size_t size : { size_t(0), size_t(4), bytes.size() / 2, bytes.size() - 1 })
+    assert(throwsError(std::vector<uint8_t>(bytes.begin(), bytes.begin() + size)));
+}
+
+static int
+TestRvsdgSerialization()
+{
+  TestRoundTrip();
+  TestStructType();
+  TestModuleProperties();
+  TestMemoryMappedFile();
+  TestMalformedInput();
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/llvm/ir/TestRvsdgSerialization", TestRvsdgSerialization)
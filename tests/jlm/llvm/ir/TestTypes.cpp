@@ -0,0 +1,96 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <test-registry.hpp>
+
+#include <jlm/llvm/ir/types.hpp>
+#include <jlm/rvsdg/bitstring/type.hpp>
+
+#include <cassert>
+
+static void
+TestStructTypeEquality()
+{
+  using namespace jlm::llvm;
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  auto declaration = rcddeclaration::create({ &bit32, &bit8 });
+  auto equalDeclaration = rcddeclaration::create({ &bit32, &bit8 });
+  auto otherDeclaration = rcddeclaration::create({ &bit32 });
+
+  StructType structType("myStruct", false, *declaration);
+
+  // Act & Assert
+  assert(structType == StructType("myStruct", false, *equalDeclaration));
+  assert(structType.hash() == StructType("myStruct", false, *equalDeclaration).hash());
+  assert(structType != StructType("myStruct", false, *otherDeclaration));
+  assert(structType != StructType("otherStruct", false, *declaration));
+  assert(structType != StructType("myStruct", true, *declaration));
+}
+
+static void
+TestStructTypeInterning()
+{
+  using namespace jlm::llvm;
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  auto declaration = rcddeclaration::create({ &bit32, &bit8 });
+  auto & internedType = StructType("internedStruct", false, *declaration).Intern();
+  auto & internedStructType = *dynamic_cast<const StructType *>(&internedType);
+
+  // Act
+  declaration.reset();
+  auto otherDeclaration = rcddeclaration::create({ &bit16 });
+  auto equalDeclaration = rcddeclaration::create({ &bit32, &bit8 });
+
+  // Assert
+  // The canonical instance does not refer to the freed declaration
+  assert(&internedStructType.GetDeclaration() != otherDeclaration.get());
+  assert(internedStructType.GetDeclaration().nelements() == 2);
+  assert(internedStructType.GetDeclaration().element(0) == bit32);
+  assert(internedStructType.GetDeclaration().element(1) == bit8);
+
+  assert(&StructType("internedStruct", false, *otherDeclaration).Intern() != &internedType);
+  assert(&StructType("internedStruct", false, *equalDeclaration).Intern() == &internedType);
+}
+
+static void
+TestNestedStructTypeInterning()
+{
+  using namespace jlm::llvm;
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  auto innerDeclaration = rcddeclaration::create({ &bit64 });
+  StructType innerType("innerStruct", false, *innerDeclaration);
+  auto outerDeclaration = rcddeclaration::create({ &innerType, &bit32 });
+
+  // Act
+  auto & internedType = StructType("outerStruct", false, *outerDeclaration).Intern();
+  outerDeclaration.reset();
+  innerDeclaration.reset();
+
+  // Assert
+  auto & internedStructType = *dynamic_cast<const StructType *>(&internedType);
+  auto & elementType =
+      *dynamic_cast<const StructType *>(&internedStructType.GetDeclaration().element(0));
+  assert(elementType.GetName() == "innerStruct");
+  assert(elementType.GetDeclaration().nelements() == 1);
+  assert(elementType.GetDeclaration().element(0) == bit64);
+}
+
+static int
+TestTypes()
+{
+  TestStructTypeEquality();
+  TestStructTypeInterning();
+  TestNestedStructTypeInterning();
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/llvm/ir/TestTypes", TestTypes)
@@ -0,0 +1,208 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include "test-operation.hpp"
+#include "test-registry.hpp"
+#include "test-types.hpp"
+
+#include <jlm/llvm/ir/operators/lambda.hpp>
+#include <jlm/llvm/ir/operators/Phi.hpp>
+#include <jlm/llvm/ir/RvsdgModule.hpp>
+#include <jlm/llvm/opt/cne.hpp>
+#include <jlm/llvm/opt/DeadNodeElimination.hpp>
+#include <jlm/llvm/opt/OptimizationSequence.hpp>
+#include <jlm/util/Statistics.hpp>
+
+#include <thread>
+
+/**
+ * Creates a function with a dead node and a pair of congruent nodes. Both context variables are
+ * bound to \p x and are therefore congruent as well.
+ */
+static jlm::llvm::lambda::node *
+CreateFunction(jlm::rvsdg::region & region, jlm::rvsdg::output & x, size_t index)
+{
+  using namespace jlm::llvm;
+
+  jlm::tests::valuetype vt;
+  FunctionType functionType({ &vt, &vt }, { &vt });
+
+  auto lambda = lambda::node::create(
+      &region,
+      functionType,
+      "f" + std::to_string(index),
+      linkage::external_linkage);
+  auto d1 = lambda->add_ctxvar(&x);
+  auto d2 = lambda->add_ctxvar(&x);
+  auto a0 = lambda->fctargument(0);
+  auto a1 = lambda->fctargument(1);
+
+  jlm::tests::create_testop(lambda->subregion(), { a0 }, { &vt });
+  auto b1 = jlm::tests::create_testop(lambda->subregion(), { d1, d2 }, { &vt })[0];
+  auto b2 = jlm::tests::create_testop(lambda->subregion(), { a0, a1 }, { &vt })[0];
+  auto b3 = jlm::tests::create_testop(lambda->subregion(), { a0, a1 }, { &vt })[0];
+  auto result = jlm::tests::create_testop(lambda->subregion(), { b1, b2, b3 }, { &vt })[0];
+
+  lambda->finalize({ result });
+  return lambda;
+}
+
+static void
+TestParallelIntraProceduralOptimizations()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  jlm::tests::valuetype vt;
+
+  RvsdgModule rvsdgModule(jlm::util::filepath(""), "", "");
+  auto & rvsdg = rvsdgModule.Rvsdg();
+  auto nf = rvsdg.node_normal_form(typeid(jlm::rvsdg::operation));
+  nf->set_mutable(false);
+
+  auto x = rvsdg.add_import({ vt, "x" });
+
+  std::vector<lambda::node *> lambdaNodes;
+  for (size_t n = 0; n < 32; n++)
+  {
+    auto lambda = CreateFunction(*rvsdg.root(), *x, n);
+    rvsdg.add_export(lambda->output(), { lambda->output()->type(), lambda->name() });
+    lambdaNodes.push_back(lambda);
+  }
+
+  phi::builder phiBuilder;
+  phiBuilder.begin(rvsdg.root());
+  auto phiX = phiBuilder.add_ctxvar(x);
+  for (size_t n = 32; n < 64; n++)
+  {
+    auto recursionVariable = phiBuilder.add_recvar(PointerType());
+    auto lambda = CreateFunction(*phiBuilder.subregion(), *phiX, n);
+    recursionVariable->set_rvorigin(lambda->output());
+    lambdaNodes.push_back(lambda);
+  }
+  auto phiNode = phiBuilder.end();
+  for (size_t n = 0; n < phiNode->noutputs(); n++)
+    rvsdg.add_export(phiNode->output(n), { phiNode->output(n)->type(), "p" + std::to_string(n) });
+
+  jlm::util::StatisticsCollectorSettings statisticsCollectorSettings(
+      { jlm::util::Statistics::Id::RvsdgOptimization });
+  jlm::util::StatisticsCollector statisticsCollector(statisticsCollectorSettings);
+
+  cne commonNodeElimination;
+  DeadNodeElimination deadNodeElimination;
+
+  // Act
+  OptimizationSequence::CreateAndRun(
+      rvsdgModule,
+      statisticsCollector,
+      { &commonNodeElimination, &deadNodeElimination },
+      4);
+
+  // Assert
+  for (auto lambda : lambdaNodes)
+  {
+    auto & body = *lambda->subregion();
+    assert(body.nnodes() == 3);
+
+    auto result = jlm::rvsdg::node_output::node(body.result(0)->origin());
+    auto b1 = jlm::rvsdg::node_output::node(result->input(0)->origin());
+    assert(b1->input(0)->origin() == b1->input(1)->origin());
+    assert(result->input(1)->origin() == result->input(2)->origin());
+
+    // The context variables of the lambda nodes are not pruned on function bodies
+    assert(lambda->ninputs() == 2);
+  }
+
+  assert(statisticsCollector.NumCollectedStatistics() == 1);
+  auto & statistics = *statisticsCollector.CollectedStatistics().begin();
+  assert(statistics.ToString().find("Optimization0Thread0[ns]:") != std::string::npos);
+  assert(statistics.ToString().find("Optimization1Thread3[ns]:") != std::string::npos);
+  assert(statistics.ToString().find("#Allocations:") != std::string::npos);
+  assert(statistics.ToString().find("PeakRss[KiB]:") != std::string::npos);
+}
+
+/**
+ * Inter-procedural test optimization that records the state of the RVSDG it is applied to.
+ */
+class RecordingOptimization final : public jlm::llvm::optimization
+{
+public:
+  void
+  run(jlm::llvm::RvsdgModule & rvsdgModule, jlm::util::StatisticsCollector &) override
+  {
+    NumRuns++;
+    ThreadId = std::this_thread::get_id();
+    NumNodes = jlm::rvsdg::nnodes(rvsdgModule.Rvsdg().root());
+  }
+
+  void
+  RunWithThreads(
+      jlm::llvm::RvsdgModule & rvsdgModule,
+      jlm::util::StatisticsCollector & statisticsCollector,
+      size_t numThreads) override
+  {
+    NumThreads = numThreads;
+    run(rvsdgModule, statisticsCollector);
+  }
+
+  size_t NumRuns = 0;
+  size_t NumThreads = 0;
+  std::thread::id ThreadId;
+  size_t NumNodes = 0;
+};
+
+static void
+TestInterProceduralBarrier()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  jlm::tests::valuetype vt;
+
+  RvsdgModule rvsdgModule(jlm::util::filepath(""), "", "");
+  auto & rvsdg = rvsdgModule.Rvsdg();
+  auto nf = rvsdg.node_normal_form(typeid(jlm::rvsdg::operation));
+  nf->set_mutable(false);
+
+  auto x = rvsdg.add_import({ vt, "x" });
+  auto lambda1 = CreateFunction(*rvsdg.root(), *x, 0);
+  auto lambda2 = CreateFunction(*rvsdg.root(), *x, 1);
+  rvsdg.add_export(lambda1->output(), { lambda1->output()->type(), "f0" });
+  rvsdg.add_export(lambda2->output(), { lambda2->output()->type(), "f1" });
+
+  jlm::util::StatisticsCollector statisticsCollector;
+  cne commonNodeElimination;
+  DeadNodeElimination deadNodeElimination;
+  RecordingOptimization recordingOptimization;
+
+  // Act
+  OptimizationSequence::CreateAndRun(
+      rvsdgModule,
+      statisticsCollector,
+      { &commonNodeElimination, &recordingOptimization, &deadNodeElimination },
+      2);
+
+  // Assert
+  assert(recordingOptimization.NumRuns == 1);
+  assert(recordingOptimization.NumThreads == 2);
+  assert(recordingOptimization.ThreadId == std::this_thread::get_id());
+
+  // The barrier observed both function bodies after common node elimination, but before dead
+  // node elimination.
+  assert(recordingOptimization.NumNodes == 2 + 2 * 5);
+  assert(lambda1->subregion()->nnodes() == 3);
+  assert(lambda2->subregion()->nnodes() == 3);
+}
+
+static int
+TestOptimizationSequence()
+{
+  TestParallelIntraProceduralOptimizations();
+  TestInterProceduralBarrier();
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/llvm/opt/TestOptimizationSequence", TestOptimizationSequence)
@@ -0,0 +1,197 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <test-registry.hpp>
+#include <TestRvsdgs.hpp>
+
+#include <jlm/llvm/opt/alias-analyses/AgnosticMemoryNodeProvider.hpp>
+#include <jlm/llvm/opt/alias-analyses/AliasClassMemoryNodeEliminator.hpp>
+#include <jlm/llvm/opt/alias-analyses/Andersen.hpp>
+#include <jlm/llvm/opt/alias-analyses/EliminatedMemoryNodeProvider.hpp>
+#include <jlm/llvm/opt/alias-analyses/MemoryStateEncoder.hpp>
+#include <jlm/llvm/opt/alias-analyses/Operators.hpp>
+#include <jlm/llvm/opt/alias-analyses/Optimization.hpp>
+#include <jlm/llvm/opt/alias-analyses/RegionAwareMemoryNodeProvider.hpp>
+#include <jlm/llvm/opt/alias-analyses/Steensgaard.hpp>
+#include <jlm/util/Statistics.hpp>
+
+#include <cassert>
+
+static void
+TestStoreTest1()
+{
+  using namespace jlm::llvm;
+  using namespace jlm::llvm::aa;
+
+  // Arrange
+  jlm::tests::StoreTest1 test;
+  jlm::util::StatisticsCollectorSettings settings({ jlm::util::Statistics::Id::MemoryNodeElimination });
+  jlm::util::StatisticsCollector statisticsCollector(settings);
+
+  auto pointsToGraph = Steensgaard().Analyze(test.module());
+  auto seedProvisioning = AgnosticMemoryNodeProvider::Create(test.module(), *pointsToGraph);
+
+  // Act
+  auto provisioning = AliasClassMemoryNodeEliminator::CreateAndEliminate(
+      test.module(),
+      *seedProvisioning,
+      statisticsCollector);
+
+  // Assert
+  auto & allocaA = pointsToGraph->GetAllocaNode(*test.alloca_a);
+  auto & allocaB = pointsToGraph->GetAllocaNode(*test.alloca_b);
+  auto & allocaC = pointsToGraph->GetAllocaNode(*test.alloca_c);
+  auto & allocaD = pointsToGraph->GetAllocaNode(*test.alloca_d);
+  auto & lambdaMemoryNode = pointsToGraph->GetLambdaNode(*test.lambda);
+  auto & externalMemoryNode = pointsToGraph->GetExternalMemoryNode();
+
+  // The lambda and external memory nodes are never accessed by the lambda and therefore form a
+  // single alias class. All alloca memory nodes form their own alias class.
+  auto & seedEntryNodes = seedProvisioning->GetLambdaEntryNodes(*test.lambda);
+  auto & entryNodes = provisioning->GetLambdaEntryNodes(*test.lambda);
+  assert(seedEntryNodes.Size() == 6);
+  assert(entryNodes.Size() == 5);
+  assert(entryNodes.IsSubsetOf(seedEntryNodes));
+  assert(entryNodes.Contains(&allocaA));
+  assert(entryNodes.Contains(&allocaB));
+  assert(entryNodes.Contains(&allocaC));
+  assert(entryNodes.Contains(&allocaD));
+  assert(entryNodes.Contains(&lambdaMemoryNode) != entryNodes.Contains(&externalMemoryNode));
+  assert(provisioning->GetLambdaExitNodes(*test.lambda) == entryNodes);
+
+  auto & address = *test.alloca_a->output(0);
+  assert(provisioning->GetOutputNodes(address) == seedProvisioning->GetOutputNodes(address));
+
+  assert(statisticsCollector.NumCollectedStatistics() == 1);
+  auto & statistics = *dynamic_cast<const AliasClassMemoryNodeEliminator::Statistics *>(
+      &*statisticsCollector.CollectedStatistics().begin());
+  assert(statistics.NumMemoryNodes() == 6);
+  assert(statistics.NumAliasClasses() == 5);
+  assert(statistics.NumStateEdgesBefore() == statistics.NumStateEdgesAfter() + 2);
+}
+
+static void
+TestStoreTest1Encoding()
+{
+  using namespace jlm::llvm;
+  using namespace jlm::llvm::aa;
+
+  // Arrange
+  jlm::tests::StoreTest1 test;
+  jlm::util::StatisticsCollector statisticsCollector;
+
+  auto pointsToGraph = Steensgaard().Analyze(test.module());
+  auto provisioning = EliminatedMemoryNodeProvider<
+      AgnosticMemoryNodeProvider,
+      AliasClassMemoryNodeEliminator>::Create(test.module(), *pointsToGraph, statisticsCollector);
+
+  // Act
+  MemoryStateEncoder encoder;
+  encoder.Encode(test.module(), *provisioning, statisticsCollector);
+
+  // Assert
+  // The agnostic encoding routes six state edges through the lambda, while only five alias classes
+  // are required.
+  auto lambdaExitMerge = jlm::rvsdg::node_output::node(test.lambda->fctresult(0)->origin());
+  assert(is<LambdaExitMemStateOperator>(lambdaExitMerge));
+  assert(lambdaExitMerge->ninputs() == 5);
+
+  assert(test.alloca_a->output(1)->nusers() == 1);
+  assert(test.alloca_b->output(1)->nusers() == 1);
+  assert(test.alloca_c->output(1)->nusers() == 1);
+  assert(test.alloca_d->output(1)->nusers() == 1);
+}
+
+/**
+ * Checks that every memory node set of the eliminated provisioning only contains memory nodes of
+ * the corresponding set of the seed provisioning.
+ */
+template<class Test>
+static void
+TestSubsets()
+{
+  using namespace jlm::llvm;
+  using namespace jlm::llvm::aa;
+
+  // Arrange
+  Test test;
+  auto pointsToGraph = Steensgaard().Analyze(test.module());
+  auto seedProvisioning = RegionAwareMemoryNodeProvider::Create(test.module(), *pointsToGraph);
+
+  // Act
+  auto provisioning =
+      AliasClassMemoryNodeEliminator::CreateAndEliminate(test.module(), *seedProvisioning);
+
+  // Assert
+  for (auto & node : test.module().Rvsdg().root()->nodes)
+  {
+    auto lambdaNode = dynamic_cast<const lambda::node *>(&node);
+    if (lambdaNode == nullptr)
+      continue;
+
+    auto & seedEntryNodes = seedProvisioning->GetLambdaEntryNodes(*lambdaNode);
+    auto & entryNodes = provisioning->GetLambdaEntryNodes(*lambdaNode);
+    assert(entryNodes.IsSubsetOf(seedEntryNodes));
+    assert(entryNodes.IsEmpty() == seedEntryNodes.IsEmpty());
+
+    auto & seedExitNodes = seedProvisioning->GetLambdaExitNodes(*lambdaNode);
+    auto & exitNodes = provisioning->GetLambdaExitNodes(*lambdaNode);
+    assert(exitNodes.IsSubsetOf(seedExitNodes));
+    assert(exitNodes.IsEmpty() == seedExitNodes.IsEmpty());
+  }
+}
+
+/**
+ * Checks that the encoding with alias classes succeeds for the given test.
+ */
+template<class Test>
+static void
+TestEncoding()
+{
+  using namespace jlm::llvm::aa;
+  using Provider =
+      EliminatedMemoryNodeProvider<RegionAwareMemoryNodeProvider, AliasClassMemoryNodeEliminator>;
+
+  Test steensgaardTest;
+  jlm::util::StatisticsCollector statisticsCollector;
+  AliasAnalysisStateEncoder<Steensgaard, Provider> steensgaardEncoder;
+  steensgaardEncoder.run(steensgaardTest.module(), statisticsCollector);
+
+  Test andersenTest;
+  AliasAnalysisStateEncoder<Andersen, Provider> andersenEncoder;
+  andersenEncoder.run(andersenTest.module(), statisticsCollector);
+}
+
+static int
+TestAliasClassMemoryNodeEliminator()
+{
+  TestStoreTest1();
+  TestStoreTest1Encoding();
+
+  TestSubsets<jlm::tests::CallTest1>();
+  TestSubsets<jlm::tests::GammaTest>();
+  TestSubsets<jlm::tests::ThetaTest>();
+  TestSubsets<jlm::tests::PhiTest1>();
+  TestSubsets<jlm::tests::IndirectCallTest2>();
+
+  TestEncoding<jlm::tests::StoreTest2>();
+  TestEncoding<jlm::tests::LoadTest2>();
+  TestEncoding<jlm::tests::CallTest1>();
+  TestEncoding<jlm::tests::IndirectCallTest2>();
+  TestEncoding<jlm::tests::GammaTest2>();
+  TestEncoding<jlm::tests::ThetaTest>();
+  TestEncoding<jlm::tests::DeltaTest2>();
+  TestEncoding<jlm::tests::PhiTest2>();
+  TestEncoding<jlm::tests::EscapedMemoryTest2>();
+  TestEncoding<jlm::tests::MemcpyTest>();
+  TestEncoding<jlm::tests::LinkedListTest>();
+  TestEncoding<jlm::tests::FreeNullTest>();
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER(
+    "jlm/llvm/opt/alias-analyses/TestAliasClassMemoryNodeEliminator",
+    TestAliasClassMemoryNodeEliminator)
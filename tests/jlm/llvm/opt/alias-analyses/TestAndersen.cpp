@@ -16,12 +16,16 @@
 
 #include <cassert>
 
+// The constraint solver used by RunAndersen. All tests are run once per solver.
+static jlm::llvm::aa::Andersen::Solver TestedSolver = jlm::llvm::aa::Andersen::Solver::Worklist;
+
 static std::unique_ptr<jlm::llvm::aa::PointsToGraph>
 RunAndersen(jlm::llvm::RvsdgModule & module)
 {
   using namespace jlm::llvm;
 
   aa::Andersen andersen;
+  andersen.SetSolver(TestedSolver);
   return andersen.Analyze(module);
 }
 
@@ -870,9 +874,33 @@ TestLinkedList()
       TargetsExactly(deltaMyListNode, { &deltaMyListNode, &lambdaNextNode, &externalMemoryNode }));
 }
 
-static int
-TestAndersen()
+static void
+TestStatistics()
+{
+  // Arrange
+  jlm::tests::LoadTest1 test;
+  jlm::util::filepath filePath("/tmp/TestAndersenStatistics");
+  std::remove(filePath.to_str().c_str());
+
+  jlm::util::StatisticsCollectorSettings statisticsCollectorSettings(
+      filePath,
+      { jlm::util::Statistics::Id::AndersenAnalysis });
+  jlm::util::StatisticsCollector statisticsCollector(statisticsCollectorSettings);
+
+  // Act
+  jlm::llvm::aa::Andersen andersen;
+  andersen.SetSolver(TestedSolver);
+  andersen.Analyze(test.module(), statisticsCollector);
+
+  // Assert
+  assert(statisticsCollector.NumCollectedStatistics() == 1);
+}
+
+static void
+TestAndersenWithSolver(jlm::llvm::aa::Andersen::Solver solver)
 {
+  TestedSolver = solver;
+
   TestStore1();
   TestStore2();
   TestLoad1();
@@ -899,6 +927,14 @@ TestAndersen()
   TestEscapedMemory3();
   TestMemcpy();
   TestLinkedList();
+  TestStatistics();
+}
+
+static int
+TestAndersen()
+{
+  TestAndersenWithSolver(jlm::llvm::aa::Andersen::Solver::Naive);
+  TestAndersenWithSolver(jlm::llvm::aa::Andersen::Solver::Worklist);
 
   return 0;
 }
@@ -0,0 +1,128 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <test-registry.hpp>
+#include <TestRvsdgs.hpp>
+
+#include <jlm/llvm/opt/alias-analyses/MemoryNodeSet.hpp>
+#include <jlm/llvm/opt/alias-analyses/Steensgaard.hpp>
+#include <jlm/util/Statistics.hpp>
+
+#include <cassert>
+
+static std::unique_ptr<jlm::llvm::aa::PointsToGraph>
+RunSteensgaard(jlm::llvm::RvsdgModule & rvsdgModule)
+{
+  jlm::llvm::aa::Steensgaard steensgaard;
+  jlm::util::StatisticsCollector statisticsCollector;
+  return steensgaard.Analyze(rvsdgModule, statisticsCollector);
+}
+
+static void
+TestSetOperations()
+{
+  using namespace jlm::llvm::aa;
+
+  // Arrange
+  jlm::tests::AllMemoryNodesTest test;
+  auto pointsToGraph = RunSteensgaard(test.module());
+
+  auto & allocaNode = pointsToGraph->GetAllocaNode(test.GetAllocaNode());
+  auto & mallocNode = pointsToGraph->GetMallocNode(test.GetMallocNode());
+  auto & deltaNode = pointsToGraph->GetDeltaNode(test.GetDeltaNode());
+  auto & externalNode = pointsToGraph->GetExternalMemoryNode();
+
+  // Act
+  MemoryNodeSet set1({ &allocaNode, &mallocNode });
+  MemoryNodeSet set2({ &mallocNode, &deltaNode });
+
+  // Assert
+  assert(set1.Size() == 2);
+  assert(set1.Contains(&allocaNode));
+  assert(!set1.Contains(&deltaNode));
+  assert(!set1.Insert(&allocaNode));
+  assert(set1 != set2);
+
+  auto unionSet = set1;
+  assert(unionSet.UnionWith(set2));
+  assert(!unionSet.UnionWith(set1));
+  assert(unionSet.Size() == 3);
+  assert(set1.IsSubsetOf(unionSet) && set2.IsSubsetOf(unionSet));
+  assert(!unionSet.IsSubsetOf(set1));
+
+  // The items are visited in ascending index order
+  size_t numItems = 0;
+  const PointsToGraph::MemoryNode * previous = nullptr;
+  for (auto & memoryNode : unionSet.Items())
+  {
+    assert(unionSet.Contains(memoryNode));
+    assert(previous == nullptr || previous->GetIndex() < memoryNode->GetIndex());
+    previous = memoryNode;
+    numItems++;
+  }
+  assert(numItems == 3);
+
+  auto intersection = set1;
+  intersection.IntersectWith(set2);
+  assert(intersection == MemoryNodeSet({ &mallocNode }));
+
+  auto difference = set1;
+  difference.DifferenceWith(set2);
+  assert(difference == MemoryNodeSet({ &allocaNode }));
+
+  jlm::util::HashSet<const PointsToGraph::MemoryNode *> hashSet({ &externalNode, &deltaNode });
+  MemoryNodeSet fromHashSet;
+  assert(fromHashSet.UnionWith(hashSet));
+  assert(fromHashSet == hashSet);
+  assert(fromHashSet.Remove(&externalNode));
+  assert(fromHashSet != hashSet);
+
+  MemoryNodeSet emptySet;
+  assert(emptySet.IsEmpty());
+  assert(emptySet.Items().begin() == emptySet.Items().end());
+  assert(emptySet.IsSubsetOf(set1));
+}
+
+static void
+TestPool()
+{
+  using namespace jlm::llvm::aa;
+
+  // Arrange
+  jlm::tests::AllMemoryNodesTest test;
+  auto pointsToGraph = RunSteensgaard(test.module());
+
+  auto & allocaNode = pointsToGraph->GetAllocaNode(test.GetAllocaNode());
+  auto & mallocNode = pointsToGraph->GetMallocNode(test.GetMallocNode());
+
+  MemoryNodeSetPool pool;
+
+  // Act
+  auto & set1 = pool.Intern(MemoryNodeSet({ &allocaNode, &mallocNode }));
+  auto & set2 = pool.Intern(MemoryNodeSet({ &mallocNode, &allocaNode }));
+  auto & set3 = pool.Intern(MemoryNodeSet({ &mallocNode }));
+  auto & set4 = pool.Intern(MemoryNodeSet());
+  auto & set5 = pool.Intern(MemoryNodeSet());
+
+  // Assert
+  assert(&set1 == &set2);
+  assert(&set1 != &set3);
+  assert(&set4 == &set5);
+  assert(set1.Size() == 2 && set3.Size() == 1 && set4.IsEmpty());
+
+  assert(pool.NumSets() == 3);
+  assert(pool.NumInternRequests() == 5);
+}
+
+static int
+TestMemoryNodeSet()
+{
+  TestSetOperations();
+  TestPool();
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/llvm/opt/alias-analyses/TestMemoryNodeSet", TestMemoryNodeSet)
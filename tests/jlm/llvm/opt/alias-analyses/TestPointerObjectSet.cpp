@@ -10,6 +10,8 @@
 #include <jlm/llvm/opt/alias-analyses/PointerObjectSet.hpp>
 
 #include <cassert>
+#include <tuple>
+#include <vector>
 
 // Test the flag functions on the PointerObject class
 static void
@@ -494,9 +496,9 @@ TestAddRegisterContentEscapedConstraint()
   assert(set.GetPointerObject(alloca1).HasEscaped());
 }
 
-// Tests crating a ConstraintSet with multiple different constraints and calling Solve()
+// Tests crating a ConstraintSet with multiple different constraints and solving it
 static void
-TestPointerObjectConstraintSetSolve()
+TestPointerObjectConstraintSetSolve(bool useWorklist)
 {
   using namespace jlm::llvm::aa;
 
@@ -562,7 +564,10 @@ TestPointerObjectConstraintSetSolve()
   constraints.AddConstraint(SupersetOfAllPointeesConstraint(reg[10], reg[8]));
 
   // Find a solution to all the constraints
-  constraints.Solve();
+  if (useWorklist)
+    constraints.SolveUsingWorklist();
+  else
+    constraints.SolveNaively();
 
   // alloca1 should point to alloca2, etc
   assert(set.GetPointsToSet(alloca1).Size() == 1);
@@ -616,6 +621,111 @@ TestPointerObjectConstraintSetSolve()
   assert(set.GetPointerObject(reg[10]).PointsToExternal());
 }
 
+// Tests that the worklist solver collapses cycles of superset constraints
+static void
+TestWorklistSolverCycleCollapse()
+{
+  using namespace jlm::llvm::aa;
+
+  jlm::tests::NAllocaNodesTest rvsdg(2);
+  rvsdg.InitializeTest();
+
+  PointerObjectSet set;
+  PointerObject::Index reg[5];
+  for (size_t i = 0; i < 5; i++)
+    reg[i] = set.CreateDummyRegisterPointerObject();
+  const auto alloca0 = set.CreateAllocaMemoryObject(rvsdg.GetAllocaNode(0));
+  const auto alloca1 = set.CreateAllocaMemoryObject(rvsdg.GetAllocaNode(1));
+
+  PointerObjectConstraintSet constraints(set);
+  constraints.AddPointerPointeeConstraint(reg[0], alloca0);
+  constraints.AddPointerPointeeConstraint(reg[4], alloca1);
+
+  // reg1 -> reg2 -> reg3 -> reg1 form a cycle, that is fed by reg0
+  constraints.AddConstraint(SupersetConstraint(reg[1], reg[0]));
+  constraints.AddConstraint(SupersetConstraint(reg[2], reg[1]));
+  constraints.AddConstraint(SupersetConstraint(reg[3], reg[2]));
+  constraints.AddConstraint(SupersetConstraint(reg[1], reg[3]));
+
+  // The content of reg4 is stored into the pointees of reg2
+  constraints.AddConstraint(AllPointeesPointToSupersetConstraint(reg[2], reg[4]));
+
+  const auto statistics = constraints.SolveUsingWorklist();
+
+  // The three registers of the cycle have been unified
+  assert(statistics.NumCycleDetections >= 1);
+  assert(statistics.NumUnifications == 2);
+
+  // All unified registers still get the complete solution
+  for (size_t i = 1; i < 4; i++)
+  {
+    assert(set.GetPointsToSet(reg[i]).Size() == 1);
+    assert(set.GetPointsToSet(reg[i]).Contains(alloca0));
+  }
+  assert(set.GetPointsToSet(reg[0]).Size() == 1);
+
+  // The store through the cycle has been applied
+  assert(set.GetPointsToSet(alloca0).Size() == 1);
+  assert(set.GetPointsToSet(alloca0).Contains(alloca1));
+  assert(set.GetPointsToSet(alloca1).IsEmpty());
+}
+
+// Tests that the solvers agree when a memory object escapes after its loads and edges exist
+static void
+TestEscapeAfterLoadAndSupersetEdge()
+{
+  using namespace jlm::llvm::aa;
+
+  jlm::tests::NAllocaNodesTest rvsdg(1);
+  rvsdg.InitializeTest();
+
+  auto solve = [&](bool useWorklist)
+  {
+    PointerObjectSet set;
+    PointerObject::Index reg[4];
+    for (size_t i = 0; i < 4; i++)
+      reg[i] = set.CreateDummyRegisterPointerObject();
+    const auto alloca0 = set.CreateAllocaMemoryObject(rvsdg.GetAllocaNode(0));
+
+    PointerObjectConstraintSet constraints(set);
+
+    // %0 is a function parameter
+    constraints.AddPointsToExternalConstraint(reg[0]);
+    // %1 = alloca 8
+    constraints.AddPointerPointeeConstraint(reg[1], alloca0);
+    // %2 = load [%1]
+    constraints.AddConstraint(SupersetOfAllPointeesConstraint(reg[2], reg[1]));
+    // %3 is a superset of the content of the alloca
+    constraints.AddConstraint(SupersetConstraint(reg[3], alloca0));
+    // store [%0], %1 (the alloca escapes through the external pointee of %0)
+    constraints.AddConstraint(AllPointeesPointToSupersetConstraint(reg[0], reg[1]));
+
+    if (useWorklist)
+      constraints.SolveUsingWorklist();
+    else
+      constraints.SolveNaively();
+
+    std::vector<std::tuple<bool, bool, size_t>> solution;
+    for (PointerObject::Index idx = 0; idx < set.NumPointerObjects(); idx++)
+    {
+      auto & pointerObject = set.GetPointerObject(idx);
+      solution.emplace_back(
+          pointerObject.HasEscaped(),
+          pointerObject.PointsToExternal(),
+          set.GetPointsToSet(idx).Size());
+    }
+
+    // The alloca escapes, and therefore its content and everything loaded from it is external
+    assert(set.GetPointerObject(alloca0).HasEscaped());
+    assert(set.GetPointerObject(reg[2]).PointsToExternal());
+    assert(set.GetPointerObject(reg[3]).PointsToExternal());
+
+    return solution;
+  };
+
+  assert(solve(false) == solve(true));
+}
+
 static int
 TestPointerObjectSet()
 {
@@ -631,7 +741,10 @@ TestPointerObjectSet()
   TestFunctionCallConstraint();
   TestAddPointsToExternalConstraint();
   TestAddRegisterContentEscapedConstraint();
-  TestPointerObjectConstraintSetSolve();
+  TestPointerObjectConstraintSetSolve(false);
+  TestPointerObjectConstraintSetSolve(true);
+  TestWorklistSolverCycleCollapse();
+  TestEscapeAfterLoadAndSupersetEdge();
   return 0;
 }
 
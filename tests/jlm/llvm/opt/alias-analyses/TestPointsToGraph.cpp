@@ -211,11 +211,43 @@ TestRegisterSetNodeIteration()
   assert(numIteratedRegisterSetNodes == pointsToGraph->NumRegisterSetNodes());
 }
 
+static void
+TestMemoryNodeIndices()
+{
+  using namespace jlm::llvm;
+
+  // Arrange
+  jlm::tests::AllMemoryNodesTest test;
+  auto pointsToGraph = TestAnalysis::CreateAndAnalyze(test.module());
+
+  std::vector<const aa::PointsToGraph::MemoryNode *> memoryNodes(
+      { &pointsToGraph->GetUnknownMemoryNode(),
+        &pointsToGraph->GetExternalMemoryNode(),
+        &pointsToGraph->GetImportNode(test.GetImportOutput()),
+        &pointsToGraph->GetLambdaNode(test.GetLambdaNode()),
+        &pointsToGraph->GetDeltaNode(test.GetDeltaNode()),
+        &pointsToGraph->GetAllocaNode(test.GetAllocaNode()),
+        &pointsToGraph->GetMallocNode(test.GetMallocNode()) });
+
+  // Act & Assert
+  assert(pointsToGraph->NumMemoryNodeIndices() == memoryNodes.size());
+
+  jlm::util::HashSet<size_t> indices;
+  for (auto memoryNode : memoryNodes)
+  {
+    assert(memoryNode->GetIndex() < pointsToGraph->NumMemoryNodeIndices());
+    assert(&pointsToGraph->GetMemoryNode(memoryNode->GetIndex()) == memoryNode);
+    indices.Insert(memoryNode->GetIndex());
+  }
+  assert(indices.Size() == memoryNodes.size());
+}
+
 static int
 TestPointsToGraph()
 {
   TestNodeIterators();
   TestRegisterSetNodeIteration();
+  TestMemoryNodeIndices();
 
   return 0;
 }
@@ -0,0 +1,180 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <test-registry.hpp>
+#include <TestRvsdgs.hpp>
+
+#include <jlm/llvm/opt/alias-analyses/Andersen.hpp>
+#include <jlm/llvm/opt/alias-analyses/PointsToQuery.hpp>
+#include <jlm/llvm/opt/alias-analyses/RegionAwareMemoryNodeProvider.hpp>
+#include <jlm/llvm/opt/alias-analyses/Steensgaard.hpp>
+#include <jlm/util/Statistics.hpp>
+
+#include <cassert>
+#include <set>
+
+/**
+ * The memory nodes of the points-to graph returned by Analyze() and of the graph of the query
+ * returned by AnalyzeOnDemand() are created in the same order. Memory nodes of the two graphs can
+ * therefore be compared by their indices.
+ */
+template<class MemoryNodes>
+static std::set<size_t>
+GetIndices(const MemoryNodes & memoryNodes)
+{
+  std::set<size_t> indices;
+  for (auto & memoryNode : memoryNodes.Items())
+    indices.insert(memoryNode->GetIndex());
+
+  return indices;
+}
+
+static std::set<size_t>
+GetTargetIndices(const jlm::llvm::aa::PointsToGraph::Node & node)
+{
+  std::set<size_t> indices;
+  for (auto & memoryNode : node.Targets())
+    indices.insert(memoryNode.GetIndex());
+
+  return indices;
+}
+
+static void
+AssertEquivalentQuery(
+    const jlm::llvm::aa::PointsToGraph & pointsToGraph,
+    const jlm::llvm::aa::PointsToQuery & pointsToQuery)
+{
+  auto & queryGraph = pointsToQuery.GetPointsToGraph();
+  assert(queryGraph.NumMemoryNodes() == pointsToGraph.NumMemoryNodes());
+  assert(queryGraph.NumRegisterNodes() == 0);
+  assert(queryGraph.NumRegisterSetNodes() == 0);
+  assert(
+      GetIndices(queryGraph.GetEscapedMemoryNodes())
+      == GetIndices(pointsToGraph.GetEscapedMemoryNodes()));
+
+  for (auto & registerNode : pointsToGraph.RegisterNodes())
+  {
+    auto memoryNodes = pointsToQuery.GetOutputNodes(registerNode.GetOutput());
+    assert(GetIndices(memoryNodes) == GetTargetIndices(registerNode));
+  }
+
+  for (auto & registerSetNode : pointsToGraph.RegisterSetNodes())
+  {
+    for (auto & output : registerSetNode.GetOutputs().Items())
+    {
+      auto memoryNodes = pointsToQuery.GetOutputNodes(*output);
+      assert(GetIndices(memoryNodes) == GetTargetIndices(registerSetNode));
+    }
+  }
+}
+
+template<class Analysis, class Test>
+static void
+TestEquivalence()
+{
+  // Arrange
+  Test test;
+  jlm::util::StatisticsCollector statisticsCollector;
+
+  // Act
+  Analysis analysis;
+  auto pointsToGraph = analysis.Analyze(test.module(), statisticsCollector);
+  auto pointsToQuery = analysis.AnalyzeOnDemand(test.module(), statisticsCollector);
+
+  // Assert
+  AssertEquivalentQuery(*pointsToGraph, *pointsToQuery);
+}
+
+template<class Analysis>
+static void
+TestAnalysis()
+{
+  TestEquivalence<Analysis, jlm::tests::StoreTest1>();
+  TestEquivalence<Analysis, jlm::tests::LoadFromUndefTest>();
+  TestEquivalence<Analysis, jlm::tests::Bits2PtrTest>();
+  TestEquivalence<Analysis, jlm::tests::CallTest2>();
+  TestEquivalence<Analysis, jlm::tests::IndirectCallTest2>();
+  TestEquivalence<Analysis, jlm::tests::DeltaTest3>();
+  TestEquivalence<Analysis, jlm::tests::ImportTest>();
+  TestEquivalence<Analysis, jlm::tests::PhiTest2>();
+  TestEquivalence<Analysis, jlm::tests::ExternalMemoryTest>();
+  TestEquivalence<Analysis, jlm::tests::EscapedMemoryTest1>();
+  TestEquivalence<Analysis, jlm::tests::EscapedMemoryTest2>();
+  TestEquivalence<Analysis, jlm::tests::EscapedMemoryTest3>();
+  TestEquivalence<Analysis, jlm::tests::MemcpyTest>();
+  TestEquivalence<Analysis, jlm::tests::LinkedListTest>();
+}
+
+static void
+TestCache()
+{
+  using namespace jlm::llvm::aa;
+
+  // Arrange
+  jlm::tests::LoadTest1 test;
+  auto pointsToGraph = Steensgaard().Analyze(test.module());
+  auto pointsToQuery = PointsToGraphQuery::Create(*pointsToGraph);
+  auto & address = *test.load_p->input(0)->origin();
+
+  // Act
+  auto memoryNodes1 = pointsToQuery->GetOutputNodes(address);
+  auto memoryNodes2 = pointsToQuery->GetOutputNodes(address);
+
+  // Assert
+  assert(memoryNodes1 == memoryNodes2);
+  assert(pointsToQuery->NumCacheMisses() == 1);
+  assert(pointsToQuery->NumCacheHits() == 1);
+}
+
+static void
+TestProvisioning()
+{
+  using namespace jlm::llvm::aa;
+
+  // Arrange
+  jlm::tests::PhiTest2 test;
+  jlm::util::StatisticsCollector statisticsCollector;
+
+  Steensgaard steensgaard;
+  auto pointsToGraph = steensgaard.Analyze(test.module(), statisticsCollector);
+  auto pointsToQuery = steensgaard.AnalyzeOnDemand(test.module(), statisticsCollector);
+
+  // Act
+  auto graphProvisioning =
+      RegionAwareMemoryNodeProvider::Create(test.module(), *pointsToGraph, statisticsCollector);
+  auto queryProvisioning =
+      RegionAwareMemoryNodeProvider::Create(test.module(), *pointsToQuery, statisticsCollector);
+
+  // Assert
+  for (auto lambdaNode : { &test.GetLambdaEight(),
+                           &test.GetLambdaI(),
+                           &test.GetLambdaA(),
+                           &test.GetLambdaB(),
+                           &test.GetLambdaC(),
+                           &test.GetLambdaD(),
+                           &test.GetLambdaTest() })
+  {
+    assert(
+        GetIndices(graphProvisioning->GetLambdaEntryNodes(*lambdaNode))
+        == GetIndices(queryProvisioning->GetLambdaEntryNodes(*lambdaNode)));
+    assert(
+        GetIndices(graphProvisioning->GetLambdaExitNodes(*lambdaNode))
+        == GetIndices(queryProvisioning->GetLambdaExitNodes(*lambdaNode)));
+  }
+}
+
+static int
+TestPointsToQuery()
+{
+  TestAnalysis<jlm::llvm::aa::Steensgaard>();
+  TestAnalysis<jlm::llvm::aa::Andersen>();
+
+  TestCache();
+  TestProvisioning();
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/llvm/opt/alias-analyses/TestPointsToQuery", TestPointsToQuery)
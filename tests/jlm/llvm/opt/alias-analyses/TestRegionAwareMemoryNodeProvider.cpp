@@ -22,8 +22,7 @@ RunSteensgaard(jlm::llvm::RvsdgModule & rvsdgModule)
 
 static void
 AssertMemoryNodes(
-    const jlm::util::HashSet<const jlm::llvm::aa::PointsToGraph::MemoryNode *> &
-        receivedMemoryNodes,
+    const jlm::llvm::aa::MemoryNodeSet & receivedMemoryNodes,
     const jlm::util::HashSet<const jlm::llvm::aa::PointsToGraph::MemoryNode *> &
         expectedMemoryNodes)
 {
@@ -1421,6 +1420,50 @@ TestEscapedMemory3()
   ValidateProvider(test, *provisioning, *pointsToGraph);
 }
 
+static void
+TestMultipleThreads()
+{
+  /*
+   * Arrange
+   */
+  jlm::tests::PhiTest2 test;
+  auto pointsToGraph = RunSteensgaard(test.module());
+
+  /*
+   * Act
+   */
+  jlm::util::StatisticsCollector statisticsCollector;
+  auto sequentialProvisioning = jlm::llvm::aa::RegionAwareMemoryNodeProvider::Create(
+      test.module(),
+      *pointsToGraph,
+      statisticsCollector,
+      1);
+  auto parallelProvisioning = jlm::llvm::aa::RegionAwareMemoryNodeProvider::Create(
+      test.module(),
+      *pointsToGraph,
+      statisticsCollector,
+      4);
+
+  /*
+   * Assert
+   */
+  for (auto lambdaNode : { &test.GetLambdaEight(),
+                           &test.GetLambdaI(),
+                           &test.GetLambdaA(),
+                           &test.GetLambdaB(),
+                           &test.GetLambdaC(),
+                           &test.GetLambdaD(),
+                           &test.GetLambdaTest() })
+  {
+    assert(
+        sequentialProvisioning->GetLambdaEntryNodes(*lambdaNode)
+        == parallelProvisioning->GetLambdaEntryNodes(*lambdaNode));
+    assert(
+        sequentialProvisioning->GetLambdaExitNodes(*lambdaNode)
+        == parallelProvisioning->GetLambdaExitNodes(*lambdaNode));
+  }
+}
+
 static void
 TestStatistics()
 {
@@ -1458,6 +1501,8 @@ TestStatistics()
   assert(memoryNodeProvisioningStatistics.NumRvsdgNodes() == 3);
   assert(memoryNodeProvisioningStatistics.NumRvsdgRegions() == 2);
   assert(memoryNodeProvisioningStatistics.NumPointsToGraphMemoryNodes() == 2);
+  assert(memoryNodeProvisioningStatistics.NumCallGraphSccs() == 1);
+  assert(memoryNodeProvisioningStatistics.NumCallGraphLevels() == 1);
 
   assert(memoryNodeProvisioningStatistics.GetAnnotationStatisticsTime() != 0);
   assert(memoryNodeProvisioningStatistics.GetPropagationPass1Time() != 0);
@@ -1499,6 +1544,8 @@ TestRegionAwareMemoryNodeProvider()
 
   TestMemcpy();
 
+  TestMultipleThreads();
+
   TestStatistics();
 
   return 0;
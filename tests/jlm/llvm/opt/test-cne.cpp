@@ -467,6 +467,310 @@ test_phi()
   assert(f1->node()->input(0)->origin() == f2->node()->input(0)->origin());
 }
 
+static inline void
+test_theta_cycle()
+{
+  using namespace jlm::llvm;
+
+  jlm::tests::valuetype vt;
+  jlm::rvsdg::ctltype ct(2);
+
+  RvsdgModule rm(jlm::util::filepath(""), "", "");
+  auto & graph = rm.Rvsdg();
+  auto nf = graph.node_normal_form(typeid(jlm::rvsdg::operation));
+  nf->set_mutable(false);
+
+  auto c = graph.add_import({ ct, "c" });
+  auto x = graph.add_import({ vt, "x" });
+  auto y = graph.add_import({ vt, "y" });
+
+  auto theta = jlm::rvsdg::theta_node::create(graph.root());
+  auto region = theta->subregion();
+
+  auto lv0 = theta->add_loopvar(c);
+  auto lv1 = theta->add_loopvar(x);
+  auto lv2 = theta->add_loopvar(y);
+  auto lv3 = theta->add_loopvar(x);
+  auto lv4 = theta->add_loopvar(y);
+
+  /*
+    lv1 and lv2 as well as lv3 and lv4 swap their values in every iteration. The pairs are only
+    congruent through the cycle over the loop variables.
+  */
+  auto u1 = jlm::tests::create_testop(region, { lv2->argument() }, { &vt })[0];
+  auto u2 = jlm::tests::create_testop(region, { lv1->argument() }, { &vt })[0];
+  auto u3 = jlm::tests::create_testop(region, { lv4->argument() }, { &vt })[0];
+  auto u4 = jlm::tests::create_testop(region, { lv3->argument() }, { &vt })[0];
+
+  lv1->result()->divert_to(u1);
+  lv2->result()->divert_to(u2);
+  lv3->result()->divert_to(u3);
+  lv4->result()->divert_to(u4);
+
+  theta->set_predicate(lv0->argument());
+
+  auto ex1 = graph.add_export(lv1, { lv1->type(), "lv1" });
+  auto ex2 = graph.add_export(lv2, { lv2->type(), "lv2" });
+  auto ex3 = graph.add_export(lv3, { lv3->type(), "lv3" });
+  auto ex4 = graph.add_export(lv4, { lv4->type(), "lv4" });
+
+  //	jlm::rvsdg::view(graph, stdout);
+  jlm::llvm::cne cne;
+  cne.run(rm, statisticsCollector);
+  //	jlm::rvsdg::view(graph, stdout);
+
+  assert(ex1->origin() == ex3->origin());
+  assert(ex2->origin() == ex4->origin());
+  assert(ex1->origin() != ex2->origin());
+  assert(lv1->result()->origin() == lv3->result()->origin());
+  assert(lv2->result()->origin() == lv4->result()->origin());
+  assert(lv1->result()->origin() != lv2->result()->origin());
+}
+
+static inline void
+test_theta_not_congruent()
+{
+  using namespace jlm::llvm;
+
+  jlm::tests::valuetype vt;
+  jlm::rvsdg::ctltype ct(2);
+
+  RvsdgModule rm(jlm::util::filepath(""), "", "");
+  auto & graph = rm.Rvsdg();
+  auto nf = graph.node_normal_form(typeid(jlm::rvsdg::operation));
+  nf->set_mutable(false);
+
+  auto c = graph.add_import({ ct, "c" });
+  auto x = graph.add_import({ vt, "x" });
+  auto y = graph.add_import({ vt, "y" });
+
+  auto theta = jlm::rvsdg::theta_node::create(graph.root());
+  auto region = theta->subregion();
+
+  auto lv0 = theta->add_loopvar(c);
+  auto lv1 = theta->add_loopvar(x);
+  auto lv2 = theta->add_loopvar(x);
+  auto lv3 = theta->add_loopvar(y);
+
+  /* lv1 and lv2 start with the same value, but are updated differently */
+  auto u1 = jlm::tests::create_testop(region, { lv1->argument() }, { &vt })[0];
+  auto u2 = jlm::tests::create_testop(region, { lv2->argument() }, { &vt })[0];
+  auto u3 = jlm::tests::create_testop(region, { u2 }, { &vt })[0];
+
+  /* lv1 and lv3 are updated the same way, but start with different values */
+  auto u4 = jlm::tests::create_testop(region, { lv3->argument() }, { &vt })[0];
+
+  lv1->result()->divert_to(u1);
+  lv2->result()->divert_to(u3);
+  lv3->result()->divert_to(u4);
+
+  theta->set_predicate(lv0->argument());
+
+  auto ex1 = graph.add_export(lv1, { lv1->type(), "lv1" });
+  auto ex2 = graph.add_export(lv2, { lv2->type(), "lv2" });
+  auto ex3 = graph.add_export(lv3, { lv3->type(), "lv3" });
+
+  //	jlm::rvsdg::view(graph, stdout);
+  jlm::llvm::cne cne;
+  cne.run(rm, statisticsCollector);
+  //	jlm::rvsdg::view(graph, stdout);
+
+  assert(ex1->origin() != ex2->origin());
+  assert(ex1->origin() != ex3->origin());
+  assert(ex2->origin() != ex3->origin());
+  assert(lv1->argument()->nusers() == 1);
+  assert(lv2->argument()->nusers() == 1);
+  assert(lv3->argument()->nusers() == 1);
+
+  /* u1 and u2 apply the same operation to the same value in the first iteration only */
+  auto un1 = jlm::rvsdg::node_output::node(u1);
+  auto un2 = jlm::rvsdg::node_output::node(u2);
+  assert(un1->input(0)->origin() != un2->input(0)->origin());
+}
+
+static inline void
+test_gamma_outputs()
+{
+  using namespace jlm::llvm;
+
+  jlm::tests::valuetype vt;
+  jlm::rvsdg::ctltype ct(2);
+
+  RvsdgModule rm(jlm::util::filepath(""), "", "");
+  auto & graph = rm.Rvsdg();
+  auto nf = graph.node_normal_form(typeid(jlm::rvsdg::operation));
+  nf->set_mutable(false);
+
+  auto c = graph.add_import({ ct, "c" });
+  auto x = graph.add_import({ vt, "x" });
+  auto y = graph.add_import({ vt, "y" });
+
+  auto gamma = jlm::rvsdg::gamma_node::create(c, 2);
+
+  auto ev1 = gamma->add_entryvar(x);
+  auto ev2 = gamma->add_entryvar(x);
+  auto ev3 = gamma->add_entryvar(y);
+
+  auto n1 = jlm::tests::create_testop(gamma->subregion(0), { ev1->argument(0) }, { &vt })[0];
+  auto n2 = jlm::tests::create_testop(gamma->subregion(0), { ev2->argument(0) }, { &vt })[0];
+
+  /* The first two exit variables are congruent in all subregions, the third only in the first */
+  auto xv1 = gamma->add_exitvar({ n1, ev1->argument(1) });
+  auto xv2 = gamma->add_exitvar({ n2, ev2->argument(1) });
+  auto xv3 = gamma->add_exitvar({ n1, ev3->argument(1) });
+
+  auto ex1 = graph.add_export(xv1, { xv1->type(), "x1" });
+  auto ex2 = graph.add_export(xv2, { xv2->type(), "x2" });
+  auto ex3 = graph.add_export(xv3, { xv3->type(), "x3" });
+
+  //	jlm::rvsdg::view(graph.root(), stdout);
+  jlm::llvm::cne cne;
+  cne.run(rm, statisticsCollector);
+  //	jlm::rvsdg::view(graph.root(), stdout);
+
+  auto subregion0 = gamma->subregion(0);
+  auto subregion1 = gamma->subregion(1);
+  assert(ex1->origin() == ex2->origin());
+  assert(ex1->origin() != ex3->origin());
+  assert(subregion0->result(0)->origin() == subregion0->result(1)->origin());
+  assert(subregion1->result(0)->origin() == subregion1->result(1)->origin());
+  assert(subregion0->result(0)->origin() == subregion0->result(2)->origin());
+  assert(subregion1->result(0)->origin() != subregion1->result(2)->origin());
+}
+
+static inline void
+test_nested_theta()
+{
+  using namespace jlm::llvm;
+
+  jlm::tests::valuetype vt;
+  jlm::rvsdg::ctltype ct(2);
+
+  RvsdgModule rm(jlm::util::filepath(""), "", "");
+  auto & graph = rm.Rvsdg();
+  auto nf = graph.node_normal_form(typeid(jlm::rvsdg::operation));
+  nf->set_mutable(false);
+
+  auto c = graph.add_import({ ct, "c" });
+  auto x = graph.add_import({ vt, "x" });
+  auto y = graph.add_import({ vt, "y" });
+
+  auto outerTheta = jlm::rvsdg::theta_node::create(graph.root());
+  auto outerRegion = outerTheta->subregion();
+
+  auto olv0 = outerTheta->add_loopvar(c);
+  auto olv1 = outerTheta->add_loopvar(x);
+  auto olv2 = outerTheta->add_loopvar(x);
+  auto olv3 = outerTheta->add_loopvar(y);
+
+  auto innerTheta = jlm::rvsdg::theta_node::create(outerRegion);
+  auto innerRegion = innerTheta->subregion();
+
+  auto ilv0 = innerTheta->add_loopvar(olv0->argument());
+  auto ilv1 = innerTheta->add_loopvar(olv1->argument());
+  auto ilv2 = innerTheta->add_loopvar(olv2->argument());
+  auto ilv3 = innerTheta->add_loopvar(olv3->argument());
+
+  auto u1 = jlm::tests::create_testop(innerRegion, { ilv1->argument() }, { &vt })[0];
+  auto u2 = jlm::tests::create_testop(innerRegion, { ilv2->argument() }, { &vt })[0];
+  auto u3 = jlm::tests::create_testop(innerRegion, { ilv3->argument() }, { &vt })[0];
+
+  ilv1->result()->divert_to(u1);
+  ilv2->result()->divert_to(u2);
+  ilv3->result()->divert_to(u3);
+  innerTheta->set_predicate(ilv0->argument());
+
+  olv1->result()->divert_to(ilv1);
+  olv2->result()->divert_to(ilv2);
+  olv3->result()->divert_to(ilv3);
+  outerTheta->set_predicate(olv0->argument());
+
+  auto ex1 = graph.add_export(olv1, { olv1->type(), "lv1" });
+  auto ex2 = graph.add_export(olv2, { olv2->type(), "lv2" });
+  auto ex3 = graph.add_export(olv3, { olv3->type(), "lv3" });
+
+  //	jlm::rvsdg::view(graph, stdout);
+  jlm::llvm::cne cne;
+  cne.run(rm, statisticsCollector);
+  //	jlm::rvsdg::view(graph, stdout);
+
+  assert(ex1->origin() == ex2->origin());
+  assert(ex1->origin() != ex3->origin());
+  assert(outerRegion->result(2)->origin() == outerRegion->result(3)->origin());
+  assert(outerRegion->result(2)->origin() != outerRegion->result(4)->origin());
+  assert(innerTheta->input(1)->origin() == innerTheta->input(2)->origin());
+  assert(innerTheta->input(1)->origin() != innerTheta->input(3)->origin());
+  assert(innerRegion->result(2)->origin() == innerRegion->result(3)->origin());
+  assert(innerRegion->result(2)->origin() != innerRegion->result(4)->origin());
+}
+
+static inline void
+test_lambda_context_variables()
+{
+  using namespace jlm::llvm;
+
+  jlm::tests::valuetype vt;
+  FunctionType ft({ &vt }, { &vt });
+
+  auto setup = [&](RvsdgModule & rm)
+  {
+    auto & graph = rm.Rvsdg();
+    auto nf = graph.node_normal_form(typeid(jlm::rvsdg::operation));
+    nf->set_mutable(false);
+
+    auto x = graph.add_import({ vt, "x" });
+    auto y = graph.add_import({ vt, "y" });
+
+    /* u1 and u2 are congruent, but distinct outputs */
+    auto u1 = jlm::tests::create_testop(graph.root(), { x }, { &vt })[0];
+    auto u2 = jlm::tests::create_testop(graph.root(), { x }, { &vt })[0];
+
+    auto lambda = lambda::node::create(graph.root(), ft, "f", linkage::external_linkage);
+
+    auto d1 = lambda->add_ctxvar(u1);
+    auto d2 = lambda->add_ctxvar(u2);
+    auto d3 = lambda->add_ctxvar(x);
+    auto d4 = lambda->add_ctxvar(x);
+    auto d5 = lambda->add_ctxvar(y);
+
+    auto b1 = jlm::tests::create_testop(lambda->subregion(), { d1, d2, d3, d4, d5 }, { &vt })[0];
+
+    auto output = lambda->finalize({ b1 });
+    graph.add_export(output, { output->type(), "f" });
+
+    return jlm::rvsdg::node_output::node(b1);
+  };
+
+  /* The partition of the entire module covers the origins of the context variables */
+  {
+    RvsdgModule rm(jlm::util::filepath(""), "", "");
+    auto bn1 = setup(rm);
+
+    //	jlm::rvsdg::view(rm.Rvsdg().root(), stdout);
+    jlm::llvm::cne cne;
+    cne.run(rm, statisticsCollector);
+    //	jlm::rvsdg::view(rm.Rvsdg().root(), stdout);
+
+    assert(bn1->input(0)->origin() == bn1->input(1)->origin());
+    assert(bn1->input(2)->origin() == bn1->input(3)->origin());
+    assert(bn1->input(0)->origin() != bn1->input(2)->origin());
+    assert(bn1->input(2)->origin() != bn1->input(4)->origin());
+  }
+
+  /* The partition of a function body only merges context variables with the same origin */
+  {
+    RvsdgModule rm(jlm::util::filepath(""), "", "");
+    auto bn1 = setup(rm);
+
+    jlm::llvm::cne cne;
+    cne.RunOnFunctionBody(*bn1->region());
+
+    assert(bn1->input(0)->origin() != bn1->input(1)->origin());
+    assert(bn1->input(2)->origin() == bn1->input(3)->origin());
+    assert(bn1->input(2)->origin() != bn1->input(4)->origin());
+  }
+}
+
 static int
 verify()
 {
@@ -477,7 +781,12 @@ verify()
   test_theta3();
   test_theta4();
   test_theta5();
+  test_theta_cycle();
+  test_theta_not_congruent();
+  test_gamma_outputs();
+  test_nested_theta();
   test_lambda();
+  test_lambda_context_variables();
   test_phi();
 
   return 0;
@@ -0,0 +1,182 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include "test-operation.hpp"
+#include "test-registry.hpp"
+#include "test-types.hpp"
+
+#include <jlm/rvsdg/EdgeBatch.hpp>
+#include <jlm/rvsdg/graph.hpp>
+#include <jlm/rvsdg/notifiers.hpp>
+
+#include <cassert>
+#include <unordered_map>
+
+static void
+TestDivert()
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  jlm::tests::valuetype type;
+
+  graph graph;
+  auto i0 = graph.add_import({ type, "i0" });
+  auto i1 = graph.add_import({ type, "i1" });
+
+  auto node1 = jlm::tests::test_op::create(graph.root(), { i0 }, { &type });
+  auto node2 = jlm::tests::test_op::create(graph.root(), { node1->output(0) }, { &type });
+  auto node3 = jlm::tests::test_op::create(graph.root(), { node2->output(0) }, { &type });
+  auto node4 =
+      jlm::tests::test_op::create(graph.root(), { node1->output(0), i0 }, { &type, &type });
+  auto ex = graph.add_export(node3->output(0), { type, "e" });
+
+  size_t numNotifications = 0;
+  auto callback = on_input_change.connect(
+      [&](input *, output *, output *)
+      {
+        numNotifications++;
+      });
+
+  // Act
+  EdgeBatch batch;
+  batch.DivertUsers(*node1->output(0), *i1);
+  batch.Divert(*ex, *node4->output(0));
+  batch.Divert(*ex, *node3->output(0));
+  assert(batch.NumOperations() == 3);
+  auto numChangedInputs = batch.Apply();
+
+  // Assert
+  // The export ended up with its original origin
+  assert(numChangedInputs == 2);
+  assert(numNotifications == 2);
+  assert(batch.NumOperations() == 0);
+
+  assert(node1->output(0)->nusers() == 0);
+  assert(node2->input(0)->origin() == i1);
+  assert(node4->input(0)->origin() == i1);
+  assert(ex->origin() == node3->output(0));
+
+  assert(node2->depth() == 0);
+  assert(node3->depth() == 1);
+  assert(node4->depth() == 0);
+}
+
+/**
+ * Test that the depths are correct if a batch diverts the input of a node to a node whose depth is
+ * also changed by the batch.
+ */
+static void
+TestDepthsOfDependentDiversions()
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  jlm::tests::valuetype type;
+
+  graph graph;
+  auto i0 = graph.add_import({ type, "i0" });
+
+  auto chain = [&](size_t length)
+  {
+    auto node = jlm::tests::test_op::create(graph.root(), { i0 }, { &type });
+    for (size_t n = 1; n < length; n++)
+      node = jlm::tests::test_op::create(graph.root(), { node->output(0) }, { &type });
+
+    return node;
+  };
+
+  auto y = jlm::tests::test_op::create(graph.root(), { chain(1)->output(0) }, { &type });
+  auto x = jlm::tests::test_op::create(graph.root(), { chain(5)->output(0) }, { &type });
+  auto d = chain(11);
+  auto ySuccessor = jlm::tests::test_op::create(graph.root(), { y->output(0) }, { &type });
+  assert(y->depth() == 1);
+  assert(x->depth() == 5);
+  assert(d->depth() == 10);
+
+  // Maps the notified nodes to their old depths
+  std::unordered_map<node *, size_t> depthChanges;
+  auto callback = on_node_depth_change.connect(
+      [&](node * node, size_t oldDepth)
+      {
+        assert(depthChanges.find(node) == depthChanges.end());
+        depthChanges[node] = oldDepth;
+      });
+
+  // Act
+  EdgeBatch batch;
+  batch.Divert(*y->input(0), *x->output(0));
+  batch.Divert(*x->input(0), *d->output(0));
+  batch.Apply();
+
+  // Assert
+  assert(x->depth() == 11);
+  assert(y->depth() == 12);
+  assert(ySuccessor->depth() == 13);
+
+  assert(depthChanges.size() == 3);
+  assert(depthChanges[x] == 5);
+  assert(depthChanges[y] == 1);
+  assert(depthChanges[ySuccessor] == 2);
+}
+
+static void
+TestInvalidOperations()
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  jlm::tests::valuetype valueType;
+  jlm::tests::statetype stateType;
+
+  graph graph;
+  auto i0 = graph.add_import({ valueType, "i0" });
+  auto i1 = graph.add_import({ stateType, "i1" });
+  auto node = jlm::tests::test_op::create(graph.root(), { i0 }, { &valueType });
+
+  jlm::rvsdg::graph graph2;
+  auto i2 = graph2.add_import({ valueType, "i2" });
+
+  // Act & Assert
+  EdgeBatch batch;
+
+  bool exceptionWasCaught = false;
+  try
+  {
+    batch.Divert(*node->input(0), *i1);
+  }
+  catch (const jlm::util::type_error &)
+  {
+    exceptionWasCaught = true;
+  }
+  assert(exceptionWasCaught);
+
+  exceptionWasCaught = false;
+  try
+  {
+    batch.DivertUsers(*i0, *i2);
+  }
+  catch (const jlm::util::error &)
+  {
+    exceptionWasCaught = true;
+  }
+  assert(exceptionWasCaught);
+
+  assert(batch.NumOperations() == 0);
+  assert(batch.Apply() == 0);
+  assert(node->input(0)->origin() == i0);
+}
+
+static int
+Test()
+{
+  TestDivert();
+  TestDepthsOfDependentDiversions();
+  TestInvalidOperations();
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/rvsdg/TestEdgeBatch", Test)
@@ -0,0 +1,99 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include "test-operation.hpp"
+#include "test-registry.hpp"
+#include "test-types.hpp"
+
+#include <jlm/rvsdg/graph.hpp>
+#include <jlm/rvsdg/IdMap.hpp>
+
+#include <cassert>
+
+static void
+TestDenseIds()
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  jlm::tests::valuetype type;
+
+  graph graph;
+  auto import = graph.add_import({ type, "i" });
+  auto node1 = jlm::tests::test_op::create(graph.root(), { import }, { &type });
+  auto node2 = jlm::tests::test_op::create(graph.root(), { import }, { &type });
+
+  // Assert
+  assert(node1->Id() != node2->Id());
+  assert(node1->Id() < graph.NodeIdBound() && node2->Id() < graph.NodeIdBound());
+  assert(import->Id() != node1->output(0)->Id());
+  assert(node1->output(0)->Id() != node2->output(0)->Id());
+  assert(graph.root()->Id() < graph.RegionIdBound());
+
+  // Act
+  auto node1Id = node1->Id();
+  auto output1Id = node1->output(0)->Id();
+  auto nodeIdBound = graph.NodeIdBound();
+  remove(node1);
+  auto node3 = jlm::tests::test_op::create(graph.root(), { import }, { &type });
+
+  // Assert
+  // The ids of removed nodes and outputs are reused
+  assert(node3->Id() == node1Id);
+  assert(node3->output(0)->Id() == output1Id);
+  assert(graph.NodeIdBound() == nodeIdBound);
+}
+
+static void
+TestSideTables()
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  jlm::tests::valuetype type;
+
+  graph graph;
+  auto import = graph.add_import({ type, "i" });
+  auto node1 = jlm::tests::test_op::create(graph.root(), { import }, { &type });
+  auto node2 = jlm::tests::test_op::create(graph.root(), { import }, { &type });
+
+  NodeMap<int> nodeMap;
+  OutputSet outputSet;
+
+  // Act & Assert
+  assert(nodeMap.Insert(*node1, 1));
+  assert(!nodeMap.Insert(*node1, 3));
+  nodeMap[*node2] = 2;
+  assert(nodeMap.Size() == 2);
+  assert(nodeMap.Lookup(*node1) == 1);
+  assert(nodeMap.Lookup(*node2) == 2);
+
+  assert(nodeMap.Remove(*node1));
+  assert(!nodeMap.Remove(*node1));
+  assert(!nodeMap.Contains(*node1));
+  assert(nodeMap.Contains(*node2));
+  assert(nodeMap.Size() == 1);
+
+  assert(outputSet.Insert(*import));
+  assert(!outputSet.Insert(*import));
+  assert(outputSet.Contains(*import));
+  assert(!outputSet.Contains(*node1->output(0)));
+  assert(outputSet.Size() == 1);
+
+  outputSet.Clear();
+  assert(!outputSet.Contains(*import));
+  assert(outputSet.Size() == 0);
+}
+
+static int
+TestIdMap()
+{
+  TestDenseIds();
+  TestSideTables();
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/rvsdg/TestIdMap", TestIdMap)
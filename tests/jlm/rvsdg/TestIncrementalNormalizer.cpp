@@ -0,0 +1,91 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include "test-operation.hpp"
+#include "test-registry.hpp"
+#include "test-types.hpp"
+
+#include <jlm/rvsdg/graph.hpp>
+#include <jlm/rvsdg/IncrementalNormalizer.hpp>
+
+#include <cassert>
+
+static void
+TestNormalize()
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  jlm::tests::valuetype type;
+
+  graph graph;
+  auto i = graph.add_import({ type, "i" });
+
+  auto node1 = jlm::tests::test_op::create(graph.root(), { i }, { &type });
+  auto node2 = jlm::tests::test_op::create(graph.root(), { i }, { &type });
+  auto node3 =
+      jlm::tests::test_op::create(graph.root(), { node1->output(0), i }, { &type, &type });
+
+  auto ex1 = graph.add_export(node2->output(0), { type, "e1" });
+  auto ex2 = graph.add_export(node3->output(0), { type, "e2" });
+
+  // Act
+  IncrementalNormalizer normalizer(graph);
+  assert(normalizer.NumPendingNodes() == 3);
+  normalizer.Normalize();
+
+  // Assert
+  // Node1 and node2 are congruent, such that one of them is removed. Node3 is revisited as its
+  // operand changed if node1 is removed.
+  assert(normalizer.NumPendingNodes() == 0);
+  assert(graph.root()->nnodes() == 2);
+  auto origin = ex1->origin();
+  assert(node_output::node(ex2->origin())->input(0)->origin() == origin);
+
+  // Act & Assert
+  // Nothing changed since the last normalization
+  assert(normalizer.Normalize() == 0);
+
+  // Only the newly created node is visited
+  jlm::tests::test_op::create(graph.root(), { i }, { &type });
+  assert(normalizer.NumPendingNodes() == 1);
+  assert(normalizer.Normalize() == 1);
+  assert(graph.root()->nnodes() == 2);
+  assert(normalizer.NumVisitedNodes() >= 4);
+}
+
+static void
+TestRemovedPendingNode()
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  jlm::tests::valuetype type;
+
+  graph graph;
+  auto i = graph.add_import({ type, "i" });
+  auto node = jlm::tests::test_op::create(graph.root(), { i }, { &type });
+
+  IncrementalNormalizer normalizer(graph);
+  assert(normalizer.NumPendingNodes() == 1);
+
+  // Act
+  remove(node);
+
+  // Assert
+  assert(normalizer.NumPendingNodes() == 0);
+  assert(normalizer.Normalize() == 0);
+}
+
+static int
+Test()
+{
+  TestNormalize();
+  TestRemovedPendingNode();
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/rvsdg/TestIncrementalNormalizer", Test)
@@ -7,7 +7,10 @@
 #include "test-registry.hpp"
 #include "test-types.hpp"
 
+#include <jlm/rvsdg/substitution.hpp>
+
 #include <cassert>
+#include <vector>
 
 /**
  * Test check for adding argument to input of wrong structural node.
@@ -277,6 +280,115 @@ TestPruneArguments()
   assert(region.narguments() == 0);
 }
 
+/**
+ * Test region::copy() with nodes whose operands are produced at different depths.
+ */
+static void
+TestCopy()
+{
+  // Arrange
+  jlm::tests::valuetype valueType;
+
+  jlm::rvsdg::graph rvsdg;
+  auto import = rvsdg.add_import({ valueType, "i" });
+
+  auto node1 = jlm::tests::test_op::Create(rvsdg.root(), {}, {}, { &valueType });
+  auto node2 =
+      jlm::tests::test_op::Create(rvsdg.root(), { &valueType }, { import }, { &valueType });
+  auto node3 = jlm::tests::test_op::Create(
+      rvsdg.root(),
+      { &valueType, &valueType },
+      { node1->output(0), node2->output(0) },
+      { &valueType });
+  auto node4 = jlm::tests::test_op::Create(
+      rvsdg.root(),
+      { &valueType, &valueType },
+      { import, node3->output(0) },
+      { &valueType });
+
+  jlm::rvsdg::graph target;
+  auto targetImport = target.add_import({ valueType, "i" });
+
+  // Act
+  jlm::rvsdg::substitution_map smap;
+  smap.insert(import, targetImport);
+  rvsdg.root()->copy(target.root(), smap, false, false);
+
+  // Assert
+  assert(target.root()->nnodes() == 4);
+
+  auto copy3 = jlm::rvsdg::node_output::node(smap.lookup(node3->output(0)));
+  auto copy4 = jlm::rvsdg::node_output::node(smap.lookup(node4->output(0)));
+  assert(copy3->depth() == node3->depth());
+  assert(copy4->depth() == node4->depth());
+  assert(copy4->input(0)->origin() == targetImport);
+  assert(copy4->input(1)->origin() == copy3->output(0));
+}
+
+/**
+ * Test substitution_map with outputs of different graphs that share the same id.
+ */
+static void
+TestSubstitutionMapAcrossGraphs()
+{
+  // Arrange
+  jlm::tests::valuetype valueType;
+
+  jlm::rvsdg::graph rvsdg1;
+  auto import1 = rvsdg1.add_import({ valueType, "i" });
+
+  jlm::rvsdg::graph rvsdg2;
+  auto import2 = rvsdg2.add_import({ valueType, "i" });
+  assert(import1->Id() == import2->Id());
+
+  // Act
+  jlm::rvsdg::substitution_map smap;
+  smap.insert(import1, import2);
+  smap.insert(import2, import1);
+
+  // Assert
+  assert(smap.lookup(import1) == import2);
+  assert(smap.lookup(import2) == import1);
+  assert(smap.contains(*rvsdg1.root()) == false);
+}
+
+/**
+ * Test substitution_map with outputs whose ids are far apart and inserted in decreasing order.
+ */
+static void
+TestSubstitutionMapSparseIds()
+{
+  // Arrange
+  jlm::tests::valuetype valueType;
+
+  jlm::rvsdg::graph rvsdg;
+  std::vector<jlm::rvsdg::output *> outputs;
+  for (size_t n = 0; n < 1000; n++)
+    outputs.push_back(rvsdg.add_import({ valueType, "i" }));
+
+  std::vector<jlm::rvsdg::output *> keys;
+  for (size_t n = 0; n < outputs.size(); n += 7)
+    keys.push_back(outputs[outputs.size() - 1 - n]);
+  keys.push_back(outputs[0]);
+  keys.push_back(outputs[500]);
+
+  // Act
+  jlm::rvsdg::substitution_map smap;
+  for (size_t n = 0; n < keys.size(); n++)
+    smap.insert(keys[n], outputs[n]);
+
+  // Overwrite the substitute of a key
+  smap.insert(keys[0], outputs[999]);
+
+  // Assert
+  assert(smap.lookup(keys[0]) == outputs[999]);
+  for (size_t n = 1; n < keys.size(); n++)
+    assert(smap.lookup(keys[n]) == outputs[n]);
+
+  assert(!smap.contains(*outputs[1]));
+  assert(!smap.contains(*outputs[997]));
+}
+
 static int
 Test()
 {
@@ -289,6 +401,9 @@ Test()
   TestRemoveResultsWhere();
   TestRemoveArgumentsWhere();
   TestPruneArguments();
+  TestCopy();
+  TestSubstitutionMapAcrossGraphs();
+  TestSubstitutionMapSparseIds();
 
   return 0;
 }
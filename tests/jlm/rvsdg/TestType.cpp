@@ -0,0 +1,132 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include "test-registry.hpp"
+#include "test-types.hpp"
+
+#include <jlm/rvsdg/bitstring/type.hpp>
+#include <jlm/rvsdg/control.hpp>
+#include <jlm/rvsdg/operation.hpp>
+#include <jlm/rvsdg/record.hpp>
+
+#include <cassert>
+#include <thread>
+#include <vector>
+
+static void
+TestInterning()
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  bittype bit7(7);
+  bittype otherBit7(7);
+  ctltype ctl7(7);
+
+  // Act
+  auto & internedBit7 = bit7.Intern();
+  auto & otherInternedBit7 = otherBit7.Intern();
+  auto & internedCtl7 = ctl7.Intern();
+
+  // Assert
+  assert(!bit7.IsInterned());
+  assert(internedBit7.IsInterned());
+  assert(&internedBit7 == &otherInternedBit7);
+  assert(&internedBit7.Intern() == &internedBit7);
+  assert(&internedBit7 != &bit32.Intern());
+  assert(&internedCtl7 != &internedBit7);
+  assert(internedBit7 == bit7);
+
+  // Copies of interned types are not canonical
+  auto copy = internedBit7.copy();
+  assert(!copy->IsInterned());
+  assert(&copy->Intern() == &internedBit7);
+}
+
+static void
+TestPortsShareInternedTypes()
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  jlm::tests::valuetype valueType;
+
+  // Act
+  port port1(valueType);
+  port port2(valueType.copy());
+  port port3(bit8);
+
+  // Assert
+  assert(&port1.type() == &port2.type());
+  assert(&port1.type() == &valueType.Intern());
+  assert(port1 == port2);
+  assert(port1 != port3);
+}
+
+static void
+TestInterningOfRecordTypes()
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  auto declaration = rcddeclaration::create({ &bit32, &bit8 });
+  auto equalDeclaration = rcddeclaration::create({ &bit32, &bit8 });
+  auto otherDeclaration = rcddeclaration::create({ &bit8 });
+
+  // Act
+  auto & internedType = rcdtype(declaration.get()).Intern();
+  declaration.reset();
+
+  // Assert
+  // The canonical instance does not refer to the declaration of the interned type
+  auto & internedRecordType = *static_cast<const rcdtype *>(&internedType);
+  assert(internedRecordType.declaration()->nelements() == 2);
+  assert(internedRecordType.declaration()->element(0) == bit32);
+  assert(internedRecordType.declaration()->element(1) == bit8);
+
+  assert(&rcdtype(equalDeclaration.get()).Intern() == &internedType);
+  assert(&rcdtype(otherDeclaration.get()).Intern() != &internedType);
+}
+
+static void
+TestConcurrentInterning()
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  const size_t numThreads = 4;
+  std::vector<std::vector<const type *>> internedTypes(numThreads);
+
+  // Act
+  std::vector<std::thread> threads;
+  for (size_t t = 0; t < numThreads; t++)
+  {
+    threads.emplace_back(
+        [&, t]()
+        {
+          for (size_t n = 1; n <= 100; n++)
+            internedTypes[t].push_back(&bittype(1000 + n).Intern());
+        });
+  }
+  for (auto & thread : threads)
+    thread.join();
+
+  // Assert
+  for (size_t t = 1; t < numThreads; t++)
+    assert(internedTypes[t] == internedTypes[0]);
+}
+
+static int
+TestType()
+{
+  TestInterning();
+  TestPortsShareInternedTypes();
+  TestInterningOfRecordTypes();
+  TestConcurrentInterning();
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/rvsdg/TestType", TestType)
@@ -1673,6 +1673,43 @@ types_bitstring_test_value_representation()
   return 0;
 }
 
+static void
+types_bitstring_test_wide_value_representation()
+{
+  using namespace jlm::rvsdg;
+
+  bitvalue_repr minus3(96, -3), five(96, 5);
+  assert(minus3.add(five) == 2);
+  assert(minus3.sub(five) == -8);
+  assert(minus3.mul(five) == -15);
+  assert(minus3.neg() == 3);
+  assert(minus3.ult(five) == '0');
+  assert(minus3.slt(five) == '1');
+  assert(minus3.shl(70).shr(70) == bitvalue_repr(26, -3).zext(70));
+  assert(minus3.ashr(95) == -1);
+  assert(minus3.slice(64, 96) == bitvalue_repr(32, -1));
+  assert(minus3.to_int() == -3);
+  assert(five.sdiv(bitvalue_repr(96, 2)) == 2);
+
+  // The carry of the low word propagates into the high word
+  bitvalue_repr max64(128, -1);
+  max64 = max64.shr(64);
+  assert(max64.add(bitvalue_repr(128, 1)).shr(64) == 1);
+  assert(max64.mul(max64) == bitvalue_repr(128, 1).sub(bitvalue_repr(128, 1).shl(65)));
+
+  bitvalue_repr minus1(64, -1);
+  assert(minus1.umulh(minus1) == -2);
+  assert(minus1.smulh(minus1) == 0);
+
+  // Values with unknown bits are evaluated bit by bit
+  auto unknown = bitvalue_repr("1D").concat(bitvalue_repr(94, 0));
+  assert(unknown.add(bitvalue_repr(96, 1)).str() == "0DD" + std::string(93, '0'));
+  assert(unknown.land(bitvalue_repr(96, 1)) == 1);
+  assert(unknown.lnot()[1] == 'D');
+  assert(!unknown.is_known() && unknown.is_defined());
+  assert(!bitvalue_repr("0X").is_defined());
+}
+
 static int
 RunTests()
 {
@@ -1708,6 +1745,7 @@ RunTests()
   types_bitstring_test_reduction();
   types_bitstring_test_slice_concat();
   types_bitstring_test_value_representation();
+  types_bitstring_test_wide_value_representation();
 
   return 0;
 }
@@ -7,6 +7,66 @@
 #include "test-registry.hpp"
 #include "test-types.hpp"
 
+static void
+TestCseIndexAfterDivert()
+{
+  using namespace jlm::rvsdg;
+
+  jlm::tests::valuetype t;
+
+  jlm::rvsdg::graph graph;
+  auto i1 = graph.add_import({ t, "i1" });
+  auto i2 = graph.add_import({ t, "i2" });
+
+  auto n1 = jlm::tests::test_op::create(graph.root(), { i1 }, { &t });
+  auto n2 = jlm::tests::test_op::create(graph.root(), { i2 }, { &t });
+
+  auto e1 = graph.add_export(n1->output(0), { t, "e1" });
+  auto e2 = graph.add_export(n2->output(0), { t, "e2" });
+
+  // Node n2 must be found under its new operand after the divert
+  n2->input(0)->divert_to(i1);
+  auto o3 = jlm::tests::create_testop(graph.root(), { i1 }, { &t })[0];
+  assert(o3 == n1->output(0) || o3 == n2->output(0));
+
+  // Node n2 must no longer be found under its old operand
+  auto o4 = jlm::tests::create_testop(graph.root(), { i2 }, { &t })[0];
+  assert(o4 != n1->output(0) && o4 != n2->output(0));
+
+  graph.normalize();
+  assert(e1->origin() == e2->origin());
+
+  // Removed nodes must no longer be found, i.e., a new node must be created. The address of o4
+  // cannot be compared against, as the memory of the pruned node might be reused for the new node.
+  graph.prune();
+  auto numNodes = graph.root()->nnodes();
+  auto o5 = jlm::tests::create_testop(graph.root(), { i2 }, { &t })[0];
+  assert(graph.root()->nnodes() == numNodes + 1);
+  assert(o5->region() == graph.root());
+  assert(jlm::rvsdg::node_output::node(o5)->input(0)->origin() == i2);
+}
+
+static void
+TestCseIndexAfterCopy()
+{
+  using namespace jlm::rvsdg;
+
+  jlm::tests::valuetype t;
+
+  jlm::rvsdg::graph graph;
+  auto i = graph.add_import({ t, "i" });
+
+  auto o1 = jlm::tests::create_testop(graph.root(), { i }, { &t })[0];
+  graph.add_export(o1, { t, "o1" });
+
+  auto copy = graph.copy();
+  auto copiedImport = copy->root()->argument(0);
+  auto copiedExport = copy->root()->result(0);
+
+  auto o2 = jlm::tests::create_testop(copy->root(), { copiedImport }, { &t })[0];
+  assert(o2 == copiedExport->origin());
+}
+
 static int
 test_main()
 {
@@ -52,6 +112,9 @@ test_main()
   graph.normalize();
   assert(o7 != e1->origin());
 
+  TestCseIndexAfterDivert();
+  TestCseIndexAfterCopy();
+
   return 0;
 }
 
@@ -7,6 +7,7 @@
 #include "test-registry.hpp"
 #include "test-types.hpp"
 
+#include <jlm/rvsdg/notifiers.hpp>
 #include <jlm/rvsdg/view.hpp>
 
 static void
@@ -115,6 +116,71 @@ test_node_depth()
   assert(un->depth() == 1);
 }
 
+/**
+ * Test that depth changes are propagated such that each node is visited and notified at most once.
+ */
+static void
+TestDepthChangePropagation()
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  jlm::tests::valuetype valueType;
+
+  graph rvsdg;
+  auto x = rvsdg.add_import({ valueType, "x" });
+
+  // A ladder in which every node depends on its two predecessors
+  auto first = jlm::tests::test_op::create(rvsdg.root(), {}, { &valueType });
+  auto second = jlm::tests::test_op::create(rvsdg.root(), { first->output(0) }, { &valueType });
+  std::vector<node *> ladder({ first, second });
+  for (size_t n = 2; n < 30; n++)
+  {
+    ladder.push_back(jlm::tests::test_op::create(
+        rvsdg.root(),
+        { ladder[n - 1]->output(0), ladder[n - 2]->output(0) },
+        { &valueType }));
+  }
+  rvsdg.add_export(ladder.back()->output(0), { valueType, "y" });
+
+  auto chain = jlm::tests::test_op::create(rvsdg.root(), { x }, { &valueType });
+  for (size_t n = 0; n < 9; n++)
+    chain = jlm::tests::test_op::create(rvsdg.root(), { chain->output(0) }, { &valueType });
+
+  auto & head = jlm::tests::SimpleNode::Create(*rvsdg.root(), { chain->output(0) }, { &valueType });
+
+  std::unordered_map<node *, size_t> numNotifications;
+  auto callback = on_node_depth_change.connect(
+      [&](node * node, size_t)
+      {
+        numNotifications[node]++;
+      });
+
+  // The depths are already recomputed when the input changes are reported
+  std::vector<std::pair<node *, size_t>> notifiedDepths;
+  auto inputChangeCallback = on_input_change.connect(
+      [&](input * input, output *, output *)
+      {
+        auto node = static_cast<node_input *>(input)->node();
+        notifiedDepths.emplace_back(node, node->depth());
+      });
+
+  // Act
+  first->output(0)->divert_users(head.output(0));
+
+  // Assert
+  assert(numNotifications.size() == ladder.size() - 1);
+  for (auto & [node, count] : numNotifications)
+    assert(count == 1);
+
+  for (size_t n = 1; n < ladder.size(); n++)
+    assert(ladder[n]->depth() == head.depth() + n);
+
+  assert(notifiedDepths.size() == 2);
+  for (auto & [node, depth] : notifiedDepths)
+    assert(depth == node->depth());
+}
+
 /**
  * Test node::RemoveOutputsWhere()
  */
@@ -218,6 +284,7 @@ test_nodes()
 {
   test_node_copy();
   test_node_depth();
+  TestDepthChangePropagation();
   TestRemoveOutputsWhere();
   TestRemoveInputsWhere();
 
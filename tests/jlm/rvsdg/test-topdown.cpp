@@ -189,6 +189,46 @@ test_mutable_traverse()
   test(&graph, n1, n2, n3);
 }
 
+static void
+test_concurrent_traversals()
+{
+  using namespace jlm::rvsdg;
+
+  // Arrange
+  jlm::tests::valuetype type;
+
+  graph graph;
+  auto n1 = jlm::tests::test_op::create(graph.root(), {}, { &type });
+  auto n2 = jlm::tests::test_op::create(graph.root(), { n1->output(0) }, { &type });
+  auto n3 = jlm::tests::test_op::create(graph.root(), { n1->output(0), n2->output(0) }, { &type });
+  graph.add_export(n3->output(0), { type, "x" });
+
+  // Act
+  // More traversers than tracker slots are alive at the same time, such that the last ones fall
+  // back to tracking their node states outside of the nodes.
+  std::vector<std::unique_ptr<topdown_traverser>> traversers;
+  for (size_t n = 0; n < node::NumTrackerSlots + 2; n++)
+    traversers.push_back(std::make_unique<topdown_traverser>(graph.root()));
+
+  // Assert
+  for (auto & traverser : traversers)
+  {
+    assert(traverser->next() == n1);
+    assert(traverser->next() == n2);
+    assert(traverser->next() == n3);
+    assert(traverser->next() == nullptr);
+  }
+
+  // Act & Assert
+  // Slots of destroyed traversers are reused and start out without node states.
+  traversers.clear();
+  topdown_traverser traverser(graph.root());
+  assert(traverser.next() == n1);
+  assert(traverser.next() == n2);
+  assert(traverser.next() == n3);
+  assert(traverser.next() == nullptr);
+}
+
 static int
 test_main(void)
 {
@@ -197,6 +237,7 @@ test_main(void)
   test_order_enforcement_traversal();
   test_traversal_insertion();
   test_mutable_traverse();
+  test_concurrent_traversals();
 
   return 0;
 }
@@ -0,0 +1,290 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include "test-registry.hpp"
+
+#include <jlm/tooling/Command.hpp>
+#include <jlm/tooling/CommandGraph.hpp>
+#include <jlm/util/common.hpp>
+#include <jlm/util/file.hpp>
+
+#include <cassert>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+/**
+ * Test command that executes an arbitrary shell command line.
+ */
+class ShellCommand final : public jlm::tooling::ExternalCommand
+{
+public:
+  explicit ShellCommand(std::string commandLine)
+      : CommandLine_(std::move(commandLine))
+  {}
+
+  [[nodiscard]] std::string
+  ToString() const override
+  {
+    return CommandLine_;
+  }
+
+  static jlm::tooling::CommandGraph::Node &
+  Create(jlm::tooling::CommandGraph & commandGraph, std::string commandLine)
+  {
+    return jlm::tooling::CommandGraph::Node::Create(
+        commandGraph,
+        std::make_unique<ShellCommand>(std::move(commandLine)));
+  }
+
+private:
+  std::string CommandLine_;
+};
+
+/**
+ * Test command that writes a file from within the jlm process.
+ */
+class WriteFileCommand final : public jlm::tooling::Command
+{
+public:
+  explicit WriteFileCommand(std::string fileName)
+      : FileName_(std::move(fileName))
+  {}
+
+  [[nodiscard]] std::string
+  ToString() const override
+  {
+    return "WriteFile " + FileName_;
+  }
+
+  void
+  Run() const override
+  {
+    std::ofstream file(FileName_);
+    file << "done\n";
+  }
+
+private:
+  std::string FileName_;
+};
+
+static std::string
+CreateTemporaryDirectory()
+{
+  auto directory = jlm::util::filepath::CreateUniqueFileName(
+      { std::filesystem::temp_directory_path() },
+      "TestCommandGraph-",
+      "");
+  std::filesystem::create_directories(directory.to_str());
+  return directory.to_str();
+}
+
+static std::vector<std::string>
+ReadLines(const std::string & fileName)
+{
+  std::ifstream file(fileName);
+  std::vector<std::string> lines;
+  std::string line;
+  while (std::getline(file, line))
+    lines.push_back(line);
+
+  return lines;
+}
+
+static void
+TestParallelExecution()
+{
+  using namespace jlm::tooling;
+
+  // Arrange
+  auto directory = CreateTemporaryDirectory();
+  auto log = directory + "/log";
+
+  // The commands b and c only succeed if they are executed at the same time
+  auto waitFor = [&](const std::string & name)
+  {
+    return "(for i in $(seq 1 100); do [ -f " + directory + "/" + name
+         + " ] && exit 0; sleep 0.05; done; exit 1)";
+  };
+
+  CommandGraph commandGraph;
+  auto & a = ShellCommand::Create(commandGraph, "echo a >> " + log);
+  auto & b = ShellCommand::Create(
+      commandGraph,
+      "touch " + directory + "/b && " + waitFor("c") + " && echo b >> " + log);
+  auto & c = ShellCommand::Create(
+      commandGraph,
+      "touch " + directory + "/c && " + waitFor("b") + " && echo c >> " + log);
+  auto & d = ShellCommand::Create(commandGraph, "echo d >> " + log);
+
+  commandGraph.GetEntryNode().AddEdge(a);
+  a.AddEdge(b);
+  a.AddEdge(c);
+  b.AddEdge(d);
+  c.AddEdge(d);
+  d.AddEdge(commandGraph.GetExitNode());
+
+  // Act
+  commandGraph.Run(2);
+
+  // Assert
+  auto lines = ReadLines(log);
+  assert(lines.size() == 4);
+  assert(lines[0] == "a");
+  assert(lines[3] == "d");
+  assert((lines[1] == "b" && lines[2] == "c") || (lines[1] == "c" && lines[2] == "b"));
+
+  assert(a.GetWallTime() > 0);
+  assert(b.GetWallTime() > 0);
+  assert(c.GetWallTime() > 0);
+  assert(d.GetWallTime() > 0);
+
+  std::filesystem::remove_all(directory);
+}
+
+static void
+TestFailingCommand()
+{
+  using namespace jlm::tooling;
+
+  // Arrange
+  auto directory = CreateTemporaryDirectory();
+
+  CommandGraph commandGraph;
+  auto & a = ShellCommand::Create(commandGraph, "exit 1");
+  auto & b = ShellCommand::Create(commandGraph, "touch " + directory + "/b");
+  auto & c = ShellCommand::Create(commandGraph, "touch " + directory + "/c");
+
+  commandGraph.GetEntryNode().AddEdge(a);
+  commandGraph.GetEntryNode().AddEdge(c);
+  a.AddEdge(b);
+  b.AddEdge(commandGraph.GetExitNode());
+  c.AddEdge(commandGraph.GetExitNode());
+
+  // Act & Assert
+  bool exceptionWasCaught = false;
+  try
+  {
+    commandGraph.Run(4);
+  }
+  catch (jlm::util::error & e)
+  {
+    exceptionWasCaught = true;
+    assert(std::string(e.what()).find("exit 1") != std::string::npos);
+  }
+
+  assert(exceptionWasCaught);
+  assert(!std::filesystem::exists(directory + "/b"));
+
+  std::filesystem::remove_all(directory);
+}
+
+static void
+TestInProcessCommand()
+{
+  using namespace jlm::tooling;
+
+  // Arrange
+  auto directory = CreateTemporaryDirectory();
+  auto fileName = directory + "/file";
+
+  CommandGraph commandGraph;
+  auto & a = CommandGraph::Node::Create(commandGraph, std::make_unique<WriteFileCommand>(fileName));
+  auto & b = ShellCommand::Create(commandGraph, "test -f " + fileName);
+
+  commandGraph.GetEntryNode().AddEdge(a);
+  a.AddEdge(b);
+  b.AddEdge(commandGraph.GetExitNode());
+
+  // Act
+  commandGraph.Run(2);
+
+  // Assert
+  assert(ReadLines(fileName) == std::vector<std::string>({ "done" }));
+  assert(a.GetWallTime() > 0);
+
+  std::filesystem::remove_all(directory);
+}
+
+static void
+TestCachedCommand()
+{
+  using namespace jlm::tooling;
+
+  // Arrange
+  auto directory = CreateTemporaryDirectory();
+  auto log = directory + "/log";
+  auto compilationCache = CompilationCache::Create({ directory + "/cache" });
+
+  // The external tool of the cached command, which only prints its version
+  auto tool = directory + "/tool";
+  auto writeTool = [&](const std::string & version)
+  {
+    std::ofstream(tool) << "#!/bin/sh\necho " << version << "\n";
+    std::filesystem::permissions(tool, std::filesystem::perms::owner_all);
+  };
+  writeTool("1");
+
+  // Copies the input file to the output file, and logs each execution
+  auto runCachedCommand = [&](const std::string & input, const std::string & contents)
+  {
+    auto inputFile = directory + "/" + input + ".in";
+    auto outputFile = directory + "/" + input + ".out";
+    std::ofstream(inputFile) << contents;
+
+    CommandGraph commandGraph;
+    auto & node = CachedCommand::Create(
+        commandGraph,
+        std::make_unique<ShellCommand>(
+            "echo run >> " + log + " && cp " + inputFile + " " + outputFile),
+        compilationCache,
+        { inputFile },
+        { outputFile },
+        { { tool } });
+    commandGraph.GetEntryNode().AddEdge(node);
+    node.AddEdge(commandGraph.GetExitNode());
+    commandGraph.Run(2);
+
+    return ReadLines(outputFile);
+  };
+
+  // Act & Assert
+  assert(runCachedCommand("a", "foo\n") == std::vector<std::string>({ "foo" }));
+  assert(compilationCache->NumHits() == 0 && compilationCache->NumMisses() == 1);
+
+  // Same contents, but different file names
+  assert(runCachedCommand("b", "foo\n") == std::vector<std::string>({ "foo" }));
+  assert(compilationCache->NumHits() == 1 && compilationCache->NumMisses() == 1);
+
+  // Different contents
+  assert(runCachedCommand("c", "bar\n") == std::vector<std::string>({ "bar" }));
+  assert(compilationCache->NumHits() == 1 && compilationCache->NumMisses() == 2);
+
+  assert(ReadLines(log) == std::vector<std::string>({ "run", "run" }));
+
+  // Same contents, but a different version of the tool
+  writeTool("2");
+  compilationCache = CompilationCache::Create({ directory + "/cache" });
+  assert(runCachedCommand("d", "foo\n") == std::vector<std::string>({ "foo" }));
+  assert(compilationCache->NumHits() == 0 && compilationCache->NumMisses() == 1);
+
+  assert(ReadLines(log) == std::vector<std::string>({ "run", "run", "run" }));
+
+  std::filesystem::remove_all(directory);
+}
+
+static int
+TestCommandGraph()
+{
+  TestParallelExecution();
+  TestFailingCommand();
+  TestInProcessCommand();
+  TestCachedCommand();
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/tooling/TestCommandGraph", TestCommandGraph)
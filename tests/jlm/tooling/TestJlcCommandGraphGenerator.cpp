@@ -128,6 +128,84 @@ TestJlmOptStatistics()
   assert(statisticsCollectorSettings.GetDemandedStatistics() == expectedStatistics);
 }
 
+static void
+TestJlmOptNumThreads()
+{
+  using namespace jlm::tooling;
+
+  // Arrange
+  JlcCommandLineOptions commandLineOptions;
+  commandLineOptions.Compilations_.push_back(
+      { { "foo.c" }, { "foo.d" }, { "foo.o" }, "foo.o", true, true, true, false });
+  commandLineOptions.JlmOptNumThreads_ = 4;
+
+  // Act
+  auto commandGraph = JlcCommandGraphGenerator::Generate(commandLineOptions);
+
+  // Assert
+  auto & clangCommandNode = (*commandGraph->GetEntryNode().OutgoingEdges().begin()).GetSink();
+  auto & jlmOptCommandNode = (clangCommandNode.OutgoingEdges().begin())->GetSink();
+  auto & jlmOptCommand = *dynamic_cast<const JlmOptCommand *>(&jlmOptCommandNode.GetCommand());
+
+  assert(jlmOptCommand.GetCommandLineOptions().GetNumThreads() == 4);
+  assert(jlmOptCommand.ToString().find("-j 4 ") != std::string::npos);
+}
+
+static void
+TestInMemoryPipeline()
+{
+  using namespace jlm::tooling;
+
+  // Arrange
+  JlcCommandLineOptions commandLineOptions;
+  commandLineOptions.Compilations_.push_back(
+      { { "foo.c" }, { "foo.d" }, { "foo.o" }, "foo.o", true, true, true, false });
+  commandLineOptions.InMemoryPipeline_ = true;
+
+  // Act
+  auto commandGraph = JlcCommandGraphGenerator::Generate(commandLineOptions);
+
+  // Assert
+  assert(commandGraph->NumNodes() == 3);
+
+  auto & commandNode = (*commandGraph->GetExitNode().IncomingEdges().begin()).GetSource();
+  auto command = dynamic_cast<const InMemoryCompilationCommand *>(&commandNode.GetCommand());
+  assert(command && command->OutputFile() == "foo.o");
+
+  auto commandLine = command->ToString();
+  assert(commandLine.find("-c -emit-llvm -o - ") != std::string::npos);
+  assert(commandLine.find("-filetype=obj -o foo.o -") != std::string::npos);
+}
+
+static void
+TestCompilationCache()
+{
+  using namespace jlm::tooling;
+
+  // Arrange
+  JlcCommandLineOptions commandLineOptions;
+  commandLineOptions.Compilations_.push_back(
+      { { "foo.c" }, { "foo.d" }, { "foo.o" }, "foo.o", true, true, true, false });
+  commandLineOptions.CacheDirectory_ = { "/tmp/cache" };
+
+  // Act
+  auto commandGraph = JlcCommandGraphGenerator::Generate(commandLineOptions);
+
+  // Assert
+  auto & statisticsCommandNode =
+      (*commandGraph->GetExitNode().IncomingEdges().begin()).GetSource();
+  assert(dynamic_cast<const PrintCompilationCacheStatisticsCommand *>(
+      &statisticsCommandNode.GetCommand()));
+
+  auto & llcCommandNode = (*statisticsCommandNode.IncomingEdges().begin()).GetSource();
+  auto llcCommand = dynamic_cast<const CachedCommand *>(&llcCommandNode.GetCommand());
+  assert(llcCommand && dynamic_cast<const LlcCommand *>(&llcCommand->GetCommand()));
+
+  auto & jlmOptCommandNode = (*llcCommandNode.IncomingEdges().begin()).GetSource();
+  auto jlmOptCommand = dynamic_cast<const CachedCommand *>(&jlmOptCommandNode.GetCommand());
+  assert(jlmOptCommand && dynamic_cast<const JlmOptCommand *>(&jlmOptCommand->GetCommand()));
+}
+
 static int
 Test()
 {
@@ -135,6 +213,9 @@ Test()
   Test2();
   TestJlmOptOptimizations();
   TestJlmOptStatistics();
+  TestJlmOptNumThreads();
+  TestInMemoryPipeline();
+  TestCompilationCache();
 
   return 0;
 }
@@ -206,6 +206,55 @@ TestJlmOptPassStatistics()
   assert(commandLineOptions.JlmOptPassStatistics_ == expectedStatistics);
 }
 
+static void
+TestNumJobs()
+{
+  using namespace jlm::tooling;
+
+  // Arrange
+  std::vector<std::string> commandLineArguments(
+      { "jlc", "-j", "4", "--print-command-times", "foobar.c" });
+
+  // Act
+  auto & commandLineOptions = ParseCommandLineArguments(commandLineArguments);
+
+  // Assert
+  assert(commandLineOptions.NumJobs_ == 4);
+  assert(commandLineOptions.PrintCommandTimes_);
+}
+
+static void
+TestJlmOptNumThreads()
+{
+  using namespace jlm::tooling;
+
+  // Arrange
+  std::vector<std::string> commandLineArguments(
+      { "jlc", "-j", "2", "--jlm-opt-threads", "4", "foobar.c" });
+
+  // Act
+  auto & commandLineOptions = ParseCommandLineArguments(commandLineArguments);
+
+  // Assert
+  assert(commandLineOptions.NumJobs_ == 2);
+  assert(commandLineOptions.JlmOptNumThreads_ == 4);
+}
+
+static void
+TestCacheDirectory()
+{
+  using namespace jlm::tooling;
+
+  // Arrange
+  std::vector<std::string> commandLineArguments({ "jlc", "--cache-dir", "/tmp/cache", "foo.c" });
+
+  // Act
+  auto & commandLineOptions = ParseCommandLineArguments(commandLineArguments);
+
+  // Assert
+  assert(commandLineOptions.CacheDirectory_ == "/tmp/cache");
+}
+
 static int
 Test()
 {
@@ -216,6 +265,9 @@ Test()
   TestJlmOptOptimizations();
   TestFalseJlmOptOptimization();
   TestJlmOptPassStatistics();
+  TestNumJobs();
+  TestJlmOptNumThreads();
+  TestCacheDirectory();
 
   return 0;
 }
@@ -8,6 +8,13 @@
 #include <jlm/tooling/Command.hpp>
 #include <jlm/util/strfmt.hpp>
 
+#include <llvm/IR/IRBuilder.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/Module.h>
+
+#include <filesystem>
+#include <fstream>
+
 static void
 TestStatistics()
 {
@@ -26,7 +33,8 @@ TestStatistics()
       JlmOptCommandLineOptions::OutputFormat::Llvm,
       statisticsCollectorSettings,
       { JlmOptCommandLineOptions::OptimizationId::DeadNodeElimination,
-        JlmOptCommandLineOptions::OptimizationId::LoopUnrolling });
+        JlmOptCommandLineOptions::OptimizationId::LoopUnrolling },
+      1);
 
   JlmOptCommand command("jlm-opt", commandLineOptions);
 
@@ -46,10 +54,193 @@ TestStatistics()
   assert(receivedCommandLine == expectedCommandLine);
 }
 
+static void
+TestInMemoryCompilation()
+{
+  using namespace jlm::tooling;
+
+  // Arrange
+  ::llvm::LLVMContext llvmContext;
+  auto llvmModule = std::make_unique<::llvm::Module>("module", llvmContext);
+
+  auto int32Type = ::llvm::Type::getInt32Ty(llvmContext);
+  auto functionType = ::llvm::FunctionType::get(int32Type, { int32Type }, false);
+  auto function = ::llvm::Function::Create(
+      functionType,
+      ::llvm::GlobalValue::ExternalLinkage,
+      "f",
+      *llvmModule);
+
+  ::llvm::IRBuilder<> builder(::llvm::BasicBlock::Create(llvmContext, "entry", function));
+  auto sum = builder.CreateAdd(function->getArg(0), function->getArg(0));
+  builder.CreateRet(sum);
+
+  auto objectFile = jlm::util::filepath::CreateUniqueFileName(
+      { std::filesystem::temp_directory_path() },
+      "TestInMemoryCompilation-",
+      ".o");
+
+  JlmOptCommandLineOptions commandLineOptions(
+      jlm::util::filepath("-"),
+      jlm::util::filepath(""),
+      JlmOptCommandLineOptions::OutputFormat::Llvm,
+      jlm::util::StatisticsCollectorSettings(),
+      { JlmOptCommandLineOptions::OptimizationId::DeadNodeElimination },
+      1);
+  JlmOptCommand jlmOptCommand("jlm-opt", commandLineOptions);
+  LlcCommand llcCommand(
+      jlm::util::filepath("-"),
+      objectFile,
+      LlcCommand::OptimizationLevel::O2,
+      LlcCommand::RelocationModel::Static);
+
+  // Act
+  auto optimizedModule = jlmOptCommand.OptimizeLlvmModule(std::move(llvmModule), llvmContext);
+  llcCommand.EmitObjectFile(*optimizedModule);
+
+  // Assert
+  assert(optimizedModule->getFunction("f") != nullptr);
+  assert(std::filesystem::file_size(objectFile.to_str()) > 0);
+
+  std::filesystem::remove(objectFile.to_str());
+}
+
+static void
+TestBitcodeRoundTrip()
+{
+  using namespace jlm::tooling;
+
+  // Arrange
+  auto temporaryDirectory = jlm::util::filepath(std::filesystem::temp_directory_path());
+  auto llvmIrFile =
+      jlm::util::filepath::CreateUniqueFileName(temporaryDirectory, "TestBitcodeRoundTrip-", ".ll");
+  auto bitcodeFile =
+      jlm::util::filepath::CreateUniqueFileName(temporaryDirectory, "TestBitcodeRoundTrip-", ".bc");
+  auto outputFile =
+      jlm::util::filepath::CreateUniqueFileName(temporaryDirectory, "TestBitcodeRoundTrip-", ".ll");
+
+  {
+    std::ofstream file(llvmIrFile.to_str());
+    file << "define i32 @f(i32 %x) {\n"
+         << "  %y = add i32 %x, %x\n"
+         << "  ret i32 %y\n"
+         << "}\n";
+  }
+
+  auto createCommand = [](const jlm::util::filepath & inputFile,
+                          const jlm::util::filepath & outputFile,
+                          JlmOptCommandLineOptions::OutputFormat outputFormat)
+  {
+    JlmOptCommandLineOptions commandLineOptions(
+        inputFile,
+        outputFile,
+        outputFormat,
+        jlm::util::StatisticsCollectorSettings(),
+        {},
+        1);
+    return JlmOptCommand("jlm-opt", commandLineOptions);
+  };
+
+  auto toBitcodeCommand =
+      createCommand(llvmIrFile, bitcodeFile, JlmOptCommandLineOptions::OutputFormat::Bitcode);
+  auto fromBitcodeCommand =
+      createCommand(bitcodeFile, outputFile, JlmOptCommandLineOptions::OutputFormat::Llvm);
+
+  // Act
+  toBitcodeCommand.Run();
+  fromBitcodeCommand.Run();
+
+  // Assert
+  assert(toBitcodeCommand.ToString().find("--bitcode ") != std::string::npos);
+
+  std::ifstream bitcode(bitcodeFile.to_str(), std::ios::binary);
+  char magic[4] = {};
+  bitcode.read(magic, sizeof(magic));
+  assert(magic[0] == 'B' && magic[1] == 'C');
+
+  std::ifstream output(outputFile.to_str());
+  std::string content((std::istreambuf_iterator<char>(output)), std::istreambuf_iterator<char>());
+  assert(content.find("define i32 @f(i32") != std::string::npos);
+
+  std::filesystem::remove(llvmIrFile.to_str());
+  std::filesystem::remove(bitcodeFile.to_str());
+  std::filesystem::remove(outputFile.to_str());
+}
+
+static void
+TestRvsdgRoundTrip()
+{
+  using namespace jlm::tooling;
+
+  // Arrange
+  auto temporaryDirectory = jlm::util::filepath(std::filesystem::temp_directory_path());
+  auto llvmIrFile =
+      jlm::util::filepath::CreateUniqueFileName(temporaryDirectory, "TestRvsdgRoundTrip-", ".ll");
+  auto rvsdgFile = jlm::util::filepath::CreateUniqueFileName(
+      temporaryDirectory,
+      "TestRvsdgRoundTrip-",
+      ".rvsdg");
+  auto outputFile =
+      jlm::util::filepath::CreateUniqueFileName(temporaryDirectory, "TestRvsdgRoundTrip-", ".ll");
+
+  {
+    std::ofstream file(llvmIrFile.to_str());
+    file << "define i32 @f(i32 %x) {\n"
+         << "  %y = add i32 %x, %x\n"
+         << "  ret i32 %y\n"
+         << "}\n";
+  }
+
+  JlmOptCommand toRvsdgCommand(
+      "jlm-opt",
+      JlmOptCommandLineOptions(
+          llvmIrFile,
+          rvsdgFile,
+          JlmOptCommandLineOptions::OutputFormat::Rvsdg,
+          jlm::util::StatisticsCollectorSettings(),
+          {},
+          1));
+  JlmOptCommand fromRvsdgCommand(
+      "jlm-opt",
+      JlmOptCommandLineOptions(
+          rvsdgFile,
+          outputFile,
+          JlmOptCommandLineOptions::OutputFormat::Llvm,
+          jlm::util::StatisticsCollectorSettings(),
+          { JlmOptCommandLineOptions::OptimizationId::DeadNodeElimination },
+          1,
+          JlmOptCommandLineOptions::InputFormat::Rvsdg));
+
+  // Act
+  toRvsdgCommand.Run();
+  fromRvsdgCommand.Run();
+
+  // Assert
+  assert(toRvsdgCommand.ToString().find("--rvsdg ") != std::string::npos);
+  assert(toRvsdgCommand.ToString().find("--input-format") == std::string::npos);
+  assert(fromRvsdgCommand.ToString().find("--input-format=rvsdg ") != std::string::npos);
+
+  std::ifstream rvsdg(rvsdgFile.to_str(), std::ios::binary);
+  char magic[4] = {};
+  rvsdg.read(magic, sizeof(magic));
+  assert(std::string(magic, sizeof(magic)) == "JRVS");
+
+  std::ifstream output(outputFile.to_str());
+  std::string content((std::istreambuf_iterator<char>(output)), std::istreambuf_iterator<char>());
+  assert(content.find("define i32 @f(i32") != std::string::npos);
+
+  std::filesystem::remove(llvmIrFile.to_str());
+  std::filesystem::remove(rvsdgFile.to_str());
+  std::filesystem::remove(outputFile.to_str());
+}
+
 static int
 TestJlmOptCommand()
 {
   TestStatistics();
+  TestInMemoryCompilation();
+  TestBitcodeRoundTrip();
+  TestRvsdgRoundTrip();
 
   return 0;
 }
@@ -0,0 +1,90 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <test-registry.hpp>
+
+#include <jlm/util/LruCache.hpp>
+
+#include <cassert>
+#include <string>
+
+static void
+TestLookupAndInsert()
+{
+  using namespace jlm::util;
+
+  // Arrange
+  LruCache<int, std::string> cache(2);
+
+  // Act & Assert
+  assert(cache.IsEmpty());
+  assert(cache.Lookup(1) == nullptr);
+
+  assert(cache.Insert(1, "one") == "one");
+  cache.Insert(2, "two");
+  assert(cache.Size() == 2);
+  assert(*cache.Lookup(1) == "one");
+
+  // Replacing a value does not evict any entry
+  cache.Insert(2, "zwei");
+  assert(cache.Size() == 2);
+  assert(*cache.Lookup(2) == "zwei");
+
+  assert(cache.Remove(1));
+  assert(!cache.Remove(1));
+  assert(!cache.Contains(1));
+
+  cache.Clear();
+  assert(cache.IsEmpty());
+
+  assert(cache.NumHits() == 2);
+  assert(cache.NumMisses() == 1);
+  assert(cache.NumEvictions() == 0);
+}
+
+static void
+TestEviction()
+{
+  using namespace jlm::util;
+
+  // Arrange
+  LruCache<int, int> cache(3);
+  cache.Insert(1, 10);
+  cache.Insert(2, 20);
+  cache.Insert(3, 30);
+
+  // Act
+  // Entry 1 becomes the most recently used entry, such that entry 2 is evicted.
+  cache.Lookup(1);
+  cache.Insert(4, 40);
+
+  // Assert
+  assert(cache.Size() == 3);
+  assert(cache.Contains(1) && cache.Contains(3) && cache.Contains(4));
+  assert(!cache.Contains(2));
+  assert(cache.NumEvictions() == 1);
+
+  // Act
+  // Contains() does not affect the recency, such that entry 3 is evicted next.
+  assert(cache.Contains(3));
+  cache.Insert(5, 50);
+
+  // Assert
+  assert(!cache.Contains(3));
+  assert(*cache.Lookup(1) == 10);
+  assert(*cache.Lookup(5) == 50);
+  assert(cache.NumEvictions() == 2);
+}
+
+static int
+TestLruCache()
+{
+  TestLookupAndInsert();
+  TestEviction();
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/util/TestLruCache", TestLruCache)
@@ -0,0 +1,159 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <test-registry.hpp>
+
+#include <jlm/util/SlabAllocator.hpp>
+
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+
+static void
+TestReuseOfReleasedObjects()
+{
+  using namespace jlm::util;
+
+  // Arrange
+  auto numAllocations = SlabAllocator::NumAllocations();
+  auto object = SlabAllocator::Allocate(40);
+  SlabAllocator::Free(object, 40);
+
+  // Act
+  auto sameSizeClassObject = SlabAllocator::Allocate(48);
+
+  // Assert
+  assert(sameSizeClassObject == object);
+  assert(SlabAllocator::NumAllocations() == numAllocations + 2);
+
+  SlabAllocator::Free(sameSizeClassObject, 48);
+}
+
+static void
+TestDistinctObjects()
+{
+  using namespace jlm::util;
+
+  // Arrange
+  const size_t numObjects = 10000;
+  std::vector<std::pair<void *, size_t>> objects;
+  std::unordered_set<void *> addresses;
+
+  // Act
+  for (size_t n = 0; n < numObjects; n++)
+  {
+    auto size = 1 + (n * 7) % (SlabAllocator::MaxObjectSize + 64);
+    auto object = SlabAllocator::Allocate(size);
+    std::memset(object, static_cast<int>(n), size);
+    objects.emplace_back(object, size);
+    addresses.insert(object);
+  }
+
+  // Assert
+  assert(addresses.size() == numObjects);
+  for (size_t n = 0; n < numObjects; n++)
+  {
+    auto [object, size] = objects[n];
+    assert(reinterpret_cast<uintptr_t>(object) % SlabAllocator::Granularity == 0);
+    for (size_t i = 0; i < size; i++)
+      assert(static_cast<unsigned char *>(object)[i] == static_cast<unsigned char>(n));
+  }
+
+  for (auto [object, size] : objects)
+    SlabAllocator::Free(object, size);
+}
+
+static void
+TestReleaseFromOtherThread()
+{
+  using namespace jlm::util;
+
+  // Arrange
+  auto numChunks = SlabAllocator::NumChunks();
+  std::vector<void *> objects;
+  std::thread allocatingThread(
+      [&]()
+      {
+        for (size_t n = 0; n < 1000; n++)
+          objects.push_back(SlabAllocator::Allocate(64));
+      });
+  allocatingThread.join();
+  assert(SlabAllocator::NumChunks() > numChunks);
+
+  // Act
+  for (auto object : objects)
+    SlabAllocator::Free(object, 64);
+
+  // Assert
+  assert(SlabAllocator::NumChunks() == numChunks);
+}
+
+static void
+TestReturnOfFreeChunks()
+{
+  using namespace jlm::util;
+
+  // Arrange
+  auto numChunks = SlabAllocator::NumChunks();
+  std::vector<void *> objects;
+  for (size_t n = 0; n < 10000; n++)
+    objects.push_back(SlabAllocator::Allocate(96));
+  assert(SlabAllocator::NumChunks() > numChunks + 1);
+
+  // Act
+  for (auto object : objects)
+    SlabAllocator::Free(object, 96);
+
+  // Assert
+  // A single spare chunk is kept for the size class
+  assert(SlabAllocator::NumChunks() <= numChunks + 1);
+}
+
+static void
+TestReuseOfObjectsReleasedByOtherThread()
+{
+  using namespace jlm::util;
+
+  // Arrange
+  std::vector<void *> objects;
+  for (size_t n = 0; n < 10000; n++)
+    objects.push_back(SlabAllocator::Allocate(112));
+  auto numChunks = SlabAllocator::NumChunks();
+
+  std::thread releasingThread(
+      [&]()
+      {
+        for (auto object : objects)
+          SlabAllocator::Free(object, 112);
+      });
+  releasingThread.join();
+
+  // Act
+  for (auto & object : objects)
+    object = SlabAllocator::Allocate(112);
+
+  // Assert
+  assert(SlabAllocator::NumChunks() <= numChunks);
+
+  for (auto object : objects)
+    SlabAllocator::Free(object, 112);
+}
+
+static int
+TestSlabAllocator()
+{
+  TestReuseOfReleasedObjects();
+  TestDistinctObjects();
+  TestReleaseFromOtherThread();
+  TestReturnOfFreeChunks();
+  TestReuseOfObjectsReleasedByOtherThread();
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/util/TestSlabAllocator", TestSlabAllocator)
@@ -0,0 +1,69 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <test-registry.hpp>
+
+#include <jlm/util/SmallVector.hpp>
+
+#include <cassert>
+#include <vector>
+
+static void
+TestInlineStorage()
+{
+  using namespace jlm::util;
+
+  // Arrange
+  SmallVector<int, 2> vector;
+
+  // Act
+  vector.push_back(1);
+  vector.push_back(2);
+
+  // Assert
+  assert(vector.size() == 2);
+  assert(vector[0] == 1 && vector[1] == 2);
+  assert(vector.back() == 2);
+  assert(vector.HeapSize() == 0);
+}
+
+static void
+TestGrowth()
+{
+  using namespace jlm::util;
+
+  // Arrange
+  SmallVector<int, 2> vector;
+
+  // Act
+  for (int n = 0; n < 100; n++)
+    vector.push_back(n);
+
+  // Assert
+  assert(vector.size() == 100);
+  assert(vector.HeapSize() >= 100 * sizeof(int));
+  assert(std::vector<int>(vector.begin(), vector.end()).size() == 100);
+  for (int n = 0; n < 100; n++)
+    assert(vector[n] == n);
+
+  // Act
+  while (!vector.empty())
+    vector.pop_back();
+
+  // Assert
+  assert(vector.size() == 0);
+  assert(vector.begin() == vector.end());
+}
+
+static int
+TestSmallVector()
+{
+  TestInlineStorage();
+  TestGrowth();
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/util/TestSmallVector", TestSmallVector)
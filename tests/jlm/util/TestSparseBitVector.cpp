@@ -0,0 +1,156 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <test-registry.hpp>
+
+#include <jlm/util/SparseBitVector.hpp>
+
+#include <cassert>
+#include <vector>
+
+static void
+TestInsertRemove()
+{
+  jlm::util::SparseBitVector<size_t> set({ 0, 1, 63, 64, 1000 });
+
+  assert(set.Size() == 5);
+  assert(set.Contains(63));
+  assert(set.Contains(64));
+  assert(!set.Contains(65));
+  assert(!set.Contains(999));
+
+  assert(set.Insert(65));
+  assert(!set.Insert(65));
+  assert(set.Contains(65));
+
+  assert(set.Remove(1000));
+  assert(!set.Remove(1000));
+  assert(!set.Contains(1000));
+  assert(set.Size() == 5);
+
+  size_t sum = 0;
+  for (auto item : set.Items())
+    sum += item;
+  assert(sum == (0 + 1 + 63 + 64 + 65));
+
+  auto numRemoved = set.RemoveWhere(
+      [](size_t n) -> bool
+      {
+        return n % 2 != 0;
+      });
+  assert(numRemoved == 3);
+  assert(set.Size() == 2);
+
+  set.Clear();
+  assert(set.IsEmpty());
+}
+
+static void
+TestIterationOrder()
+{
+  jlm::util::SparseBitVector<size_t> set({ 4096, 3, 200, 64, 2 });
+
+  std::vector<size_t> items;
+  for (auto item : set.Items())
+    items.push_back(item);
+
+  assert((items == std::vector<size_t>{ 2, 3, 64, 200, 4096 }));
+
+  jlm::util::SparseBitVector<size_t> empty;
+  assert(empty.Items().begin() == empty.Items().end());
+}
+
+static void
+TestIsSubsetOf()
+{
+  jlm::util::SparseBitVector<size_t> set12({ 1, 2 });
+  jlm::util::SparseBitVector<size_t> set123({ 1, 2, 300 });
+  jlm::util::SparseBitVector<size_t> set1234({ 1, 2, 300, 4000 });
+
+  assert(set12.IsSubsetOf(set12));
+  assert(set12.IsSubsetOf(set123));
+  assert(set12.IsSubsetOf(set1234));
+  assert(!set123.IsSubsetOf(set12));
+  assert(set123.IsSubsetOf(set1234));
+  assert(!set1234.IsSubsetOf(set12));
+  assert(!set1234.IsSubsetOf(set123));
+}
+
+static void
+TestUnionWith()
+{
+  using namespace jlm::util;
+
+  SparseBitVector<size_t> set12({ 1, 2 });
+  SparseBitVector<size_t> set123({ 1, 2, 3 });
+  SparseBitVector<size_t> set45({ 400, 500 });
+
+  assert(!set123.UnionWith(set12));
+
+  assert(set12.UnionWith(set123));
+  assert(!set12.UnionWith(set123));
+
+  assert(set12.Size() == 3);
+  assert(set12 == set123);
+
+  assert(set45.UnionWith(set123));
+  assert(set45.Size() == 5);
+  assert(set45 == SparseBitVector<size_t>({ 1, 2, 3, 400, 500 }));
+}
+
+static void
+TestUnionWithNewItems()
+{
+  using namespace jlm::util;
+
+  SparseBitVector<size_t> set({ 1, 130 });
+  SparseBitVector<size_t> other({ 1, 2, 70, 130, 131 });
+  SparseBitVector<size_t> newItems({ 500 });
+
+  // Adds new words as well as bits in existing words
+  assert(set.UnionWith(other, newItems));
+  assert(set == other);
+  assert(newItems == SparseBitVector<size_t>({ 2, 70, 131, 500 }));
+
+  // Nothing is new the second time
+  SparseBitVector<size_t> noNewItems;
+  assert(!set.UnionWith(other, noNewItems));
+  assert(noNewItems.IsEmpty());
+}
+
+static void
+TestIntersectAndDifference()
+{
+  using namespace jlm::util;
+
+  SparseBitVector<size_t> set12({ 1, 200 });
+  SparseBitVector<size_t> set123({ 1, 200, 3 });
+  SparseBitVector<size_t> set45({ 4, 5 });
+
+  set123.IntersectWith(set12);
+  assert(set123 == set12);
+
+  set123.IntersectWith(set45);
+  assert(set123.Size() == 0);
+
+  SparseBitVector<size_t> set({ 1, 2, 200, 201 });
+  set.DifferenceWith(SparseBitVector<size_t>({ 2, 200, 201, 300 }));
+  assert(set == SparseBitVector<size_t>({ 1 }));
+}
+
+static int
+TestSparseBitVector()
+{
+  TestInsertRemove();
+  TestIterationOrder();
+  TestIsSubsetOf();
+  TestUnionWith();
+  TestUnionWithNewItems();
+  TestIntersectAndDifference();
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/util/TestSparseBitVector", TestSparseBitVector)
@@ -0,0 +1,170 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <test-registry.hpp>
+
+#include <jlm/util/ThreadPool.hpp>
+
+#include <atomic>
+#include <cassert>
+#include <stdexcept>
+
+static void
+TestAllTasksAreExecutedOnce()
+{
+  using namespace jlm::util;
+
+  // Arrange
+  const size_t numTasks = 1000;
+  ThreadPool threadPool(4);
+  assert(threadPool.NumThreads() == 4);
+
+  std::vector<std::atomic<size_t>> executions(numTasks);
+  std::vector<size_t> tasksPerThread(threadPool.NumThreads(), 0);
+
+  std::vector<ThreadPool::Task> tasks;
+  for (size_t n = 0; n < numTasks; n++)
+  {
+    tasks.emplace_back(
+        [&, n](size_t thread)
+        {
+          executions[n]++;
+          tasksPerThread[thread]++;
+        });
+  }
+
+  // Act
+  threadPool.Run(std::move(tasks));
+
+  // Assert
+  for (auto & numExecutions : executions)
+    assert(numExecutions == 1);
+
+  size_t numExecutedTasks = 0;
+  for (auto numTasksOfThread : tasksPerThread)
+    numExecutedTasks += numTasksOfThread;
+  assert(numExecutedTasks == numTasks);
+}
+
+static void
+TestMultipleBatches()
+{
+  using namespace jlm::util;
+
+  // Arrange
+  ThreadPool threadPool(3);
+  std::atomic<size_t> sum(0);
+
+  // Act
+  for (size_t batch = 0; batch < 50; batch++)
+  {
+    std::vector<ThreadPool::Task> tasks;
+    for (size_t n = 0; n <= batch; n++)
+    {
+      tasks.emplace_back(
+          [&, n](size_t)
+          {
+            sum += n;
+          });
+    }
+    threadPool.Run(std::move(tasks));
+  }
+
+  // Assert
+  size_t expectedSum = 0;
+  for (size_t batch = 0; batch < 50; batch++)
+    expectedSum += batch * (batch + 1) / 2;
+  assert(sum == expectedSum);
+}
+
+static void
+TestSingleThread()
+{
+  using namespace jlm::util;
+
+  // Arrange
+  ThreadPool threadPool(1);
+  auto callingThread = std::this_thread::get_id();
+
+  std::vector<size_t> order;
+  std::vector<ThreadPool::Task> tasks;
+  for (size_t n = 0; n < 10; n++)
+  {
+    tasks.emplace_back(
+        [&, n](size_t thread)
+        {
+          assert(thread == 0);
+          assert(std::this_thread::get_id() == callingThread);
+          order.push_back(n);
+        });
+  }
+
+  // Act
+  threadPool.Run(std::move(tasks));
+
+  // Assert
+  assert(order.size() == 10);
+  for (size_t n = 0; n < order.size(); n++)
+    assert(order[n] == n);
+}
+
+static void
+TestException()
+{
+  using namespace jlm::util;
+
+  // Arrange
+  ThreadPool threadPool(2);
+  std::atomic<size_t> numExecutedTasks(0);
+
+  std::vector<ThreadPool::Task> tasks;
+  for (size_t n = 0; n < 20; n++)
+  {
+    tasks.emplace_back(
+        [&, n](size_t)
+        {
+          numExecutedTasks++;
+          if (n == 5)
+            throw std::runtime_error("task failed");
+        });
+  }
+
+  // Act & Assert
+  bool exceptionWasCaught = false;
+  try
+  {
+    threadPool.Run(std::move(tasks));
+  }
+  catch (std::runtime_error &)
+  {
+    exceptionWasCaught = true;
+  }
+
+  assert(exceptionWasCaught);
+  assert(numExecutedTasks == 20);
+
+  // The pool must remain usable after a failed batch
+  std::vector<ThreadPool::Task> moreTasks;
+  moreTasks.emplace_back(
+      [&](size_t)
+      {
+        numExecutedTasks++;
+      });
+  threadPool.Run(std::move(moreTasks));
+  assert(numExecutedTasks == 21);
+}
+
+static int
+TestThreadPool()
+{
+  TestAllTasksAreExecutedOnce();
+  TestMultipleBatches();
+  TestSingleThread();
+  TestException();
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/util/TestThreadPool", TestThreadPool)
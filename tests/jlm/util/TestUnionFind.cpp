@@ -0,0 +1,90 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+#include <test-registry.hpp>
+
+#include <jlm/util/UnionFind.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+static std::vector<size_t>
+SortedMembers(const jlm::util::UnionFind & unionFind, size_t element)
+{
+  std::vector<size_t> members;
+  for (auto member : unionFind.Members(element))
+    members.push_back(member);
+
+  std::sort(members.begin(), members.end());
+  return members;
+}
+
+static void
+TestUnion()
+{
+  using namespace jlm::util;
+
+  // Arrange
+  UnionFind unionFind;
+  for (size_t n = 0; n < 6; n++)
+    assert(unionFind.Insert() == n);
+
+  // Act
+  unionFind.Union(0, 1);
+  unionFind.Union(2, 3);
+  auto root = unionFind.Union(1, 3);
+  unionFind.Union(0, 2);
+
+  // Assert
+  assert(unionFind.NumElements() == 6);
+  assert(unionFind.NumSets() == 3);
+
+  assert(unionFind.Find(0) == root && unionFind.Find(3) == root);
+  assert(unionFind.IsRoot(root));
+  assert(unionFind.Find(4) == 4 && unionFind.Find(5) == 5);
+
+  assert(unionFind.NumMembers(2) == 4);
+  assert(SortedMembers(unionFind, 3) == std::vector<size_t>({ 0, 1, 2, 3 }));
+  assert(SortedMembers(unionFind, 4) == std::vector<size_t>({ 4 }));
+}
+
+static void
+TestLongChains()
+{
+  using namespace jlm::util;
+
+  // Arrange
+  const size_t numElements = 10000;
+
+  UnionFind unionFind;
+  unionFind.Reserve(numElements);
+  for (size_t n = 0; n < numElements; n++)
+    unionFind.Insert();
+
+  // Act
+  for (size_t n = 1; n < numElements; n++)
+    unionFind.Union(n - 1, n);
+
+  // Assert
+  assert(unionFind.NumSets() == 1);
+  auto root = unionFind.Find(0);
+  for (size_t n = 0; n < numElements; n++)
+    assert(unionFind.Find(n) == root);
+
+  assert(unionFind.NumMembers(numElements / 2) == numElements);
+  assert(SortedMembers(unionFind, numElements - 1).size() == numElements);
+}
+
+static int
+TestUnionFind()
+{
+  TestUnion();
+  TestLongChains();
+
+  return 0;
+}
+
+JLM_UNIT_TEST_REGISTER("jlm/util/TestUnionFind", TestUnionFind)
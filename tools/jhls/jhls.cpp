@@ -20,7 +20,15 @@ main(int argc, char ** argv)
   auto & commandLineOptions = JhlsCommandLineParser::Parse(argc, argv);
 
   auto commandGraph = JhlsCommandGraphGenerator::Generate(commandLineOptions);
-  commandGraph->Run();
+  try
+  {
+    commandGraph->Run(commandLineOptions.NumJobs_);
+  }
+  catch (const jlm::util::error & e)
+  {
+    std::cerr << e.what() << std::endl;
+    exit(EXIT_FAILURE);
+  }
 
   return 0;
 }
@@ -24,7 +24,15 @@ main(int argc, char ** argv)
   }
 
   auto commandGraph = JlcCommandGraphGenerator::Generate(*commandLineOptions);
-  commandGraph->Run();
+  try
+  {
+    commandGraph->Run(commandLineOptions->NumJobs_);
+  }
+  catch (const jlm::util::error & e)
+  {
+    std::cerr << e.what() << std::endl;
+    exit(EXIT_FAILURE);
+  }
 
   return 0;
 }
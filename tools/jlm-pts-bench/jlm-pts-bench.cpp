@@ -0,0 +1,211 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+/**
+ * Benchmark comparing the points-to set representations util::HashSet and
+ * util::SparseBitVector. Both are used to solve the same synthetic subset constraint graph with a
+ * difference propagating worklist solver, and the solving time and the memory held by the
+ * points-to sets are reported.
+ *
+ * Usage: jlm-pts-bench [#PointerObjects] [#EdgesPerPointerObject] [#InitialPointees] [seed]
+ */
+
+#include <jlm/util/HashSet.hpp>
+#include <jlm/util/SparseBitVector.hpp>
+#include <jlm/util/time.hpp>
+
+#include <cstdlib>
+#include <deque>
+#include <iostream>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+// Number of bytes currently allocated through operator new
+static size_t NumLiveBytes = 0;
+
+// Every allocation is prefixed by its size, such that deallocations can be accounted for.
+static constexpr size_t AllocationHeaderSize = alignof(std::max_align_t);
+
+void *
+operator new(size_t size)
+{
+  auto memory = static_cast<char *>(std::malloc(size + AllocationHeaderSize));
+  if (!memory)
+    throw std::bad_alloc();
+
+  *reinterpret_cast<size_t *>(memory) = size;
+  NumLiveBytes += size;
+  return memory + AllocationHeaderSize;
+}
+
+void
+operator delete(void * pointer) noexcept
+{
+  if (!pointer)
+    return;
+
+  auto memory = static_cast<char *>(pointer) - AllocationHeaderSize;
+  NumLiveBytes -= *reinterpret_cast<size_t *>(memory);
+  std::free(memory);
+}
+
+void
+operator delete(void * pointer, size_t) noexcept
+{
+  operator delete(pointer);
+}
+
+struct ConstraintGraph
+{
+  size_t NumPointerObjects;
+
+  // Initial pointees of every PointerObject
+  std::vector<std::vector<size_t>> Pointees;
+
+  // For every PointerObject, the PointerObjects whose points-to sets must be a superset of its own
+  std::vector<std::vector<size_t>> Successors;
+};
+
+static ConstraintGraph
+CreateConstraintGraph(size_t numPointerObjects, size_t numEdges, size_t numPointees, size_t seed)
+{
+  std::mt19937_64 generator(seed);
+  std::uniform_int_distribution<size_t> distribution(0, numPointerObjects - 1);
+
+  ConstraintGraph graph{ numPointerObjects, {}, {} };
+  graph.Pointees.resize(numPointerObjects);
+  graph.Successors.resize(numPointerObjects);
+
+  // Only a few PointerObjects have initial pointees, similar to the results of allocas and mallocs
+  for (size_t n = 0; n < numPointerObjects; n += 16)
+  {
+    for (size_t i = 0; i < numPointees; i++)
+      graph.Pointees[n].push_back(distribution(generator));
+  }
+
+  for (size_t n = 0; n < numPointerObjects; n++)
+  {
+    for (size_t i = 0; i < numEdges; i++)
+      graph.Successors[n].push_back(distribution(generator));
+  }
+
+  return graph;
+}
+
+static bool
+UnionWith(
+    jlm::util::HashSet<size_t> & set,
+    const jlm::util::HashSet<size_t> & items,
+    jlm::util::HashSet<size_t> & newItems)
+{
+  bool modified = false;
+  for (auto item : items.Items())
+  {
+    if (set.Insert(item))
+    {
+      newItems.Insert(item);
+      modified = true;
+    }
+  }
+
+  return modified;
+}
+
+static bool
+UnionWith(
+    jlm::util::SparseBitVector<size_t> & set,
+    const jlm::util::SparseBitVector<size_t> & items,
+    jlm::util::SparseBitVector<size_t> & newItems)
+{
+  return set.UnionWith(items, newItems);
+}
+
+template<typename Set>
+static void
+RunBenchmark(const char * name, const ConstraintGraph & graph)
+{
+  const auto numLiveBytesBefore = NumLiveBytes;
+
+  jlm::util::timer timer;
+  timer.start();
+
+  std::vector<Set> pointsToSets(graph.NumPointerObjects);
+  std::vector<Set> newPointees(graph.NumPointerObjects);
+  std::deque<size_t> worklist;
+  std::vector<bool> inWorklist(graph.NumPointerObjects, false);
+
+  for (size_t n = 0; n < graph.NumPointerObjects; n++)
+  {
+    for (auto pointee : graph.Pointees[n])
+    {
+      pointsToSets[n].Insert(pointee);
+      newPointees[n].Insert(pointee);
+    }
+
+    worklist.push_back(n);
+    inWorklist[n] = true;
+  }
+
+  while (!worklist.empty())
+  {
+    const auto node = worklist.front();
+    worklist.pop_front();
+    inWorklist[node] = false;
+
+    Set pointees;
+    std::swap(pointees, newPointees[node]);
+    for (auto successor : graph.Successors[node])
+    {
+      if (successor == node)
+        continue;
+
+      if (UnionWith(pointsToSets[successor], pointees, newPointees[successor])
+          && !inWorklist[successor])
+      {
+        worklist.push_back(successor);
+        inWorklist[successor] = true;
+      }
+    }
+  }
+
+  timer.stop();
+
+  size_t numPointsToRelations = 0;
+  for (auto & pointsToSet : pointsToSets)
+    numPointsToRelations += pointsToSet.Size();
+
+  std::cout << name << " SolvingTime[ns]:" << timer.ns()
+            << " PointsToSetMemory[bytes]:" << NumLiveBytes - numLiveBytesBefore
+            << " #PointsToRelations:" << numPointsToRelations << std::endl;
+}
+
+int
+main(int argc, char ** argv)
+{
+  auto argument = [&](int index, size_t defaultValue) -> size_t
+  {
+    return argc > index ? std::stoul(argv[index]) : defaultValue;
+  };
+
+  const auto numPointerObjects = argument(1, 10000);
+  const auto numEdges = argument(2, 2);
+  const auto numPointees = argument(3, 4);
+  const auto seed = argument(4, 0);
+
+  if (numPointerObjects == 0)
+  {
+    std::cerr << "The number of PointerObjects must be positive." << std::endl;
+    exit(EXIT_FAILURE);
+  }
+
+  const auto graph = CreateConstraintGraph(numPointerObjects, numEdges, numPointees, seed);
+
+  RunBenchmark<jlm::util::HashSet<size_t>>("HashSet", graph);
+  RunBenchmark<jlm::util::SparseBitVector<size_t>>("SparseBitVector", graph);
+
+  return 0;
+}
@@ -0,0 +1,180 @@
+/*
+ * Copyright 2026 Nico Reißmann <nico.reissmann@gmail.com>
+ * See COPYING for terms of redistribution.
+ */
+
+/**
+ * Benchmark for the top-down and bottom-up traversal of an RVSDG region. A synthetic region with
+ * the given number of layers of binary nodes is created, whose operands are randomly chosen from
+ * the previous layer. The region is then repeatedly traversed in both directions, and the time
+ * per traversal is reported.
+ *
+ * The benchmark also measures the copying of a theta node whose body consists of the same layers,
+ * which exercises region::copy() and the substitution map.
+ *
+ * Usage: jlm-traversal-bench [#Layers] [#NodesPerLayer] [#Repetitions] [seed]
+ */
+
+#include <jlm/rvsdg/bitstring/arithmetic.hpp>
+#include <jlm/rvsdg/graph.hpp>
+#include <jlm/rvsdg/substitution.hpp>
+#include <jlm/rvsdg/theta.hpp>
+#include <jlm/rvsdg/traverser.hpp>
+#include <jlm/util/time.hpp>
+
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+static std::vector<jlm::rvsdg::output *>
+CreateLayers(
+    jlm::rvsdg::region & region,
+    std::vector<jlm::rvsdg::output *> layer,
+    size_t numLayers,
+    size_t seed)
+{
+  std::mt19937_64 generator(seed);
+  std::uniform_int_distribution<size_t> distribution(0, layer.size() - 1);
+
+  for (size_t l = 0; l < numLayers; l++)
+  {
+    std::vector<jlm::rvsdg::output *> nextLayer;
+    for (size_t n = 0; n < layer.size(); n++)
+    {
+      auto operand1 = layer[distribution(generator)];
+      auto operand2 = layer[distribution(generator)];
+      auto node =
+          jlm::rvsdg::simple_node::create(&region, jlm::rvsdg::bitadd_op(32), { operand1, operand2 });
+      nextLayer.push_back(node->output(0));
+    }
+
+    layer = std::move(nextLayer);
+  }
+
+  return layer;
+}
+
+static std::vector<jlm::rvsdg::output *>
+CreateImports(jlm::rvsdg::graph & graph, size_t numImports)
+{
+  jlm::rvsdg::bittype type(32);
+  std::vector<jlm::rvsdg::output *> imports;
+  for (size_t n = 0; n < numImports; n++)
+    imports.push_back(graph.add_import({ type, "i" + std::to_string(n) }));
+
+  return imports;
+}
+
+static void
+CreateRegion(jlm::rvsdg::graph & graph, size_t numLayers, size_t numNodesPerLayer, size_t seed)
+{
+  auto imports = CreateImports(graph, numNodesPerLayer);
+  auto layer = CreateLayers(*graph.root(), imports, numLayers, seed);
+
+  jlm::rvsdg::bittype type(32);
+  for (size_t n = 0; n < numNodesPerLayer; n++)
+    graph.add_export(layer[n], { type, "o" + std::to_string(n) });
+}
+
+static jlm::rvsdg::theta_node &
+CreateTheta(jlm::rvsdg::graph & graph, size_t numLayers, size_t numNodesPerLayer, size_t seed)
+{
+  auto imports = CreateImports(graph, numNodesPerLayer);
+
+  auto theta = jlm::rvsdg::theta_node::create(graph.root());
+  std::vector<jlm::rvsdg::theta_output *> loopVariables;
+  std::vector<jlm::rvsdg::output *> arguments;
+  for (auto import : imports)
+  {
+    loopVariables.push_back(theta->add_loopvar(import));
+    arguments.push_back(loopVariables.back()->argument());
+  }
+
+  auto layer = CreateLayers(*theta->subregion(), arguments, numLayers, seed);
+  for (size_t n = 0; n < numNodesPerLayer; n++)
+    loopVariables[n]->result()->divert_to(layer[n]);
+
+  return *theta;
+}
+
+static void
+RunCopyBenchmark(jlm::rvsdg::theta_node & theta, size_t numRepetitions)
+{
+  auto & graph = *theta.graph();
+
+  jlm::util::timer timer;
+  timer.start();
+
+  for (size_t n = 0; n < numRepetitions; n++)
+  {
+    jlm::rvsdg::substitution_map smap;
+    for (size_t i = 0; i < theta.ninputs(); i++)
+      smap.insert(theta.input(i)->origin(), theta.input(i)->origin());
+
+    auto copy = theta.copy(graph.root(), smap);
+    graph.root()->remove_node(copy);
+  }
+
+  timer.stop();
+
+  std::cout << "ThetaCopy Time[ns]:" << timer.ns() / numRepetitions
+            << " #CopiedNodes:" << theta.subregion()->nnodes() << std::endl;
+}
+
+template<typename Traverser>
+static void
+RunBenchmark(const char * name, jlm::rvsdg::graph & graph, size_t numRepetitions)
+{
+  size_t numVisitedNodes = 0;
+
+  jlm::util::timer timer;
+  timer.start();
+
+  for (size_t n = 0; n < numRepetitions; n++)
+  {
+    for (auto node : Traverser(graph.root()))
+    {
+      if (node)
+        numVisitedNodes++;
+    }
+  }
+
+  timer.stop();
+
+  std::cout << name << " Time[ns]:" << timer.ns() / numRepetitions
+            << " #VisitedNodes:" << numVisitedNodes / numRepetitions << std::endl;
+}
+
+int
+main(int argc, char ** argv)
+{
+  auto argument = [&](int index, size_t defaultValue) -> size_t
+  {
+    return argc > index ? std::stoul(argv[index]) : defaultValue;
+  };
+
+  const auto numLayers = argument(1, 1000);
+  const auto numNodesPerLayer = argument(2, 100);
+  const auto numRepetitions = argument(3, 10);
+  const auto seed = argument(4, 0);
+
+  if (numNodesPerLayer == 0 || numRepetitions == 0)
+  {
+    std::cerr << "The number of nodes per layer and repetitions must be positive." << std::endl;
+    exit(EXIT_FAILURE);
+  }
+
+  jlm::rvsdg::graph graph;
+  CreateRegion(graph, numLayers, numNodesPerLayer, seed);
+
+  RunBenchmark<jlm::rvsdg::topdown_traverser>("TopDownTraversal", graph, numRepetitions);
+  RunBenchmark<jlm::rvsdg::bottomup_traverser>("BottomUpTraversal", graph, numRepetitions);
+
+  jlm::rvsdg::graph thetaGraph;
+  auto & theta = CreateTheta(thetaGraph, numLayers, numNodesPerLayer, seed);
+  RunCopyBenchmark(theta, numRepetitions);
+
+  return 0;
+}